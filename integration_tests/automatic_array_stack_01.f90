@@ -0,0 +1,70 @@
+module automatic_array_stack_01_mod
+implicit none
+
+contains
+
+    ! With -fmax-stack-var-size, automatic arrays below it live on the stack
+    ! and larger ones on the heap; without it, all of them are on the heap.
+    ! Heap arrays are freed on return.
+    real(8) function norm_of_shifted(x, n) result(r)
+        integer, intent(in) :: n
+        real(8), intent(in) :: x(n)
+        real(8) :: work(n)
+        work = x + 1.0d0
+        r = sqrt(sum(work * work))
+    end function
+
+    recursive integer function depth_sum(n) result(r)
+        integer, intent(in) :: n
+        integer :: buf(n + 1)
+        integer :: i
+        do i = 1, n + 1
+            buf(i) = i
+        end do
+        if (n == 0) then
+            r = buf(1)
+            return
+        end if
+        r = sum(buf) + depth_sum(n - 1)
+    end function
+
+    subroutine scaled_copy(x, y)
+        real(8), intent(in) :: x(:)
+        real(8), intent(out) :: y(:)
+        real(8), allocatable :: tmp(:)
+        real(8), allocatable :: fixed(:)
+        allocate(tmp(size(x)))
+        allocate(fixed(3))
+        fixed = [1.0d0, 2.0d0, 3.0d0]
+        tmp = 2.0d0 * x
+        y = tmp + fixed(1)
+    end subroutine
+
+end module
+
+program automatic_array_stack_01
+use automatic_array_stack_01_mod
+implicit none
+
+real(8), allocatable :: x(:), y(:)
+real(8) :: r
+integer :: i, n
+
+do n = 1, 2000, 97
+    allocate(x(n), y(n))
+    do i = 1, n
+        x(i) = real(i, 8)
+    end do
+    r = norm_of_shifted(x, n)
+    if (abs(r - sqrt(sum((x + 1.0d0)**2))) > 1d-9 * r) error stop
+    call scaled_copy(x, y)
+    if (any(abs(y - (2.0d0 * x + 1.0d0)) > 1d-12)) error stop
+    deallocate(x, y)
+end do
+print *, r
+
+i = depth_sum(40)
+print *, i
+if (i /= 12341) error stop
+
+end program
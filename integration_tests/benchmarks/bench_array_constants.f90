@@ -0,0 +1,51 @@
+module bench_array_constants_tables
+! Large constant tables, emitted from packed ArrayConstant data as single
+! constant arrays.
+implicit none
+integer, parameter :: n = 20000
+integer, private :: i
+real(8), parameter :: coeffs(n) = [(1.0d0 / i, i = 1, n)]
+integer, parameter :: ids(n) = [(i, i = 1, n)]
+integer, parameter :: ids3(3*n) = [ids, ids, ids]
+real(8), parameter :: both(2*n) = [coeffs, coeffs]
+end module
+
+program bench_array_constants
+! Runtime benchmark: gathers from large PARAMETER tables, which are read
+! straight from the constant data of the binary. The compile time and memory
+! of these tables are measured by lfortran_bench. See run_benchmarks.py.
+use bench_array_constants_tables
+implicit none
+integer, parameter :: reps = 200
+real(8) :: t, best, s
+integer :: i, j, r
+
+best = huge(best)
+do r = 1, 3
+    t = wall_time()
+    s = 0
+    do j = 1, reps
+        do i = 1, n
+            s = s + both(ids3(2*n + i) + n) * coeffs(ids(n + 1 - i))
+        end do
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("constant_table_gather", best)
+if (abs(s - reps * sum(coeffs * coeffs(n:1:-1))) > 1d-9 * s) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
@@ -0,0 +1,53 @@
+program bench_array_expr
+! Runtime benchmark: elemental array expressions and array sections.
+! See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 2000000, m = 1000, reps = 5
+real(8), allocatable :: a(:), b(:), c(:), x(:, :), y(:, :)
+real(8) :: t, best
+integer :: i, r
+
+allocate(a(n), b(n), c(n), x(m, m), y(m, m))
+do i = 1, n
+    b(i) = 1 + mod(i, 7)
+    c(i) = 0.5d0 * mod(i, 3)
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    a = b * c + 2 * b - sqrt(b)
+    a = a / (1 + c) + abs(c - b)
+    best = min(best, wall_time() - t)
+end do
+call report("array_expr_1d", best)
+if (abs(a(7) - ((b(7)*c(7) + 2*b(7) - sqrt(b(7))) / (1 + c(7)) &
+        + abs(c(7) - b(7)))) > 1d-12) error stop
+
+x = 1
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    y(2:m-1, 2:m-1) = 0.25d0 * (x(1:m-2, 2:m-1) + x(3:m, 2:m-1) &
+        + x(2:m-1, 1:m-2) + x(2:m-1, 3:m))
+    x(2:m-1, 2:m-1) = y(2:m-1, 2:m-1)
+    best = min(best, wall_time() - t)
+end do
+call report("array_sections_2d", best)
+if (abs(x(m/2, m/2) - 1) > 1d-12) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
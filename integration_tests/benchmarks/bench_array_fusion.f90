@@ -0,0 +1,116 @@
+program bench_array_fusion
+! Runtime benchmark: array syntax stencils and elemental expressions, each
+! next to the same computation written as DO loops (the `_loops` kernels).
+! With expression fusion the pairs should take about the same time.
+! See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 2000000, reps = 10
+real(8), allocatable :: u(:), v(:), w(:), x(:)
+real(8) :: t, best, check
+integer :: i, r
+
+allocate(u(n), v(n), w(n), x(n))
+do i = 1, n
+    u(i) = sin(real(i, 8) * 1d-3)
+    w(i) = 1d0 + real(mod(i, 7), 8)
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    v(2:n-1) = 0.25d0*u(1:n-2) + 0.5d0*u(2:n-1) + 0.25d0*u(3:n)
+    best = min(best, wall_time() - t)
+end do
+call report("stencil3", best)
+check = sum(v(2:n-1))
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 2, n - 1
+        v(i) = 0.25d0*u(i-1) + 0.5d0*u(i) + 0.25d0*u(i+1)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("stencil3_loops", best)
+call check_close(check, sum(v(2:n-1)))
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    v = u*w + sin(u) - u/w
+    best = min(best, wall_time() - t)
+end do
+call report("elemental_expr", best)
+check = sum(v)
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        v(i) = u(i)*w(i) + sin(u(i)) - u(i)/w(i)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("elemental_expr_loops", best)
+call check_close(check, sum(v))
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    v = sqrt(u*u + w*w)
+    best = min(best, wall_time() - t)
+end do
+call report("intrinsic_of_expr", best)
+check = sum(v)
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        v(i) = sqrt(u(i)*u(i) + w(i)*w(i))
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("intrinsic_of_expr_loops", best)
+call check_close(check, sum(v))
+
+! In-place update that reads the target
+x = u
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    x = 0.5d0*x + 0.25d0*cos(x)*w
+    best = min(best, wall_time() - t)
+end do
+call report("in_place_update", best)
+check = sum(x)
+x = u
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        x(i) = 0.5d0*x(i) + 0.25d0*cos(x(i))*w(i)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("in_place_update_loops", best)
+call check_close(check, sum(x))
+
+contains
+
+    subroutine check_close(a, b)
+    real(8), intent(in) :: a, b
+    if (abs(a - b) > 1d-6 * abs(b)) error stop
+    end subroutine
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
@@ -0,0 +1,84 @@
+program bench_derived_types
+! Runtime benchmark: arrays of derived types, component access through
+! procedures, and types with allocatable components. See run_benchmarks.py.
+implicit none
+type :: particle
+    real(8) :: x(3), v(3)
+    real(8) :: mass
+end type
+type :: histogram
+    integer, allocatable :: counts(:)
+end type
+integer, parameter :: n = 200000, steps = 20, reps = 3
+type(particle), allocatable :: p(:)
+type(histogram) :: h
+real(8) :: t, best, e
+integer :: i, r, s
+
+allocate(p(n))
+best = huge(best)
+do r = 1, reps
+    do i = 1, n
+        p(i)%x = [i * 1.0d-3, 0.0d0, 1.0d0]
+        p(i)%v = [1.0d0, 0.5d0, -1.0d0]
+        p(i)%mass = 1 + mod(i, 4)
+    end do
+    t = wall_time()
+    do s = 1, steps
+        do i = 1, n
+            call move(p(i), 1.0d-2)
+        end do
+    end do
+    e = 0
+    do i = 1, n
+        e = e + kinetic_energy(p(i))
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("particles", best)
+if (abs(p(1)%x(2) - steps * 0.5d-2) > 1d-12) error stop
+if (e <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do s = 1, steps
+        if (allocated(h%counts)) deallocate(h%counts)
+        allocate(h%counts(0:99))
+        h%counts = 0
+        do i = 1, n
+            h%counts(mod(i * s, 100)) = h%counts(mod(i * s, 100)) + 1
+        end do
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("allocatable_component", best)
+if (sum(h%counts) /= n) error stop
+
+contains
+
+    subroutine move(q, dt)
+    type(particle), intent(inout) :: q
+    real(8), intent(in) :: dt
+    q%x = q%x + dt * q%v
+    q%v(3) = q%v(3) - dt * 9.81d0
+    end subroutine
+
+    real(8) function kinetic_energy(q) result(e)
+    type(particle), intent(in) :: q
+    e = 0.5d0 * q%mass * sum(q%v**2)
+    end function
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
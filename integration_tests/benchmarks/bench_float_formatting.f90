@@ -0,0 +1,140 @@
+program bench_float_formatting
+! Runtime benchmark: writing reals to an internal file with list-directed
+! output and the ES, F and G edit descriptors, which is dominated by the
+! binary to decimal conversion in the runtime. The snprintf_* kernels time
+! the snprintf conversions the runtime used before for the same values
+! (bench_float_formatting_c.c). See run_benchmarks.py.
+use iso_c_binding, only: c_int, c_double
+implicit none
+interface
+    integer(c_int) function bench_snprintf_list_directed(x, n) bind(c)
+    import :: c_int, c_double
+    real(c_double), intent(in) :: x(*)
+    integer(c_int), value :: n
+    end function
+    integer(c_int) function bench_snprintf_es(x, n) bind(c)
+    import :: c_int, c_double
+    real(c_double), intent(in) :: x(*)
+    integer(c_int), value :: n
+    end function
+    integer(c_int) function bench_snprintf_f(x, n, scale) bind(c)
+    import :: c_int, c_double
+    real(c_double), intent(in) :: x(*)
+    integer(c_int), value :: n
+    real(c_double), value :: scale
+    end function
+    integer(c_int) function bench_snprintf_g(x, n) bind(c)
+    import :: c_int, c_double
+    real(c_double), intent(in) :: x(*)
+    integer(c_int), value :: n
+    end function
+end interface
+integer, parameter :: n = 200000, reps = 3
+real(8), allocatable :: x(:)
+character(len=64) :: buf
+real(8) :: t, best, y
+integer :: i, r, total
+
+allocate(x(n))
+do i = 1, n
+    x(i) = sin(real(i, 8)) * 10.0d0**(mod(i, 40) - 20)
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        write(buf, *) x(i)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("write_list_directed", best)
+read(buf, *) y
+if (y /= x(n)) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = bench_snprintf_list_directed(x, n)
+    best = min(best, wall_time() - t)
+end do
+call report("snprintf_list_directed", best)
+if (total <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        write(buf, "(ES24.16)") x(i)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("write_es24_16", best)
+read(buf, *) y
+if (abs(y - x(n)) > 1d-15 * abs(x(n))) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = bench_snprintf_es(x, n)
+    best = min(best, wall_time() - t)
+end do
+call report("snprintf_es24_16", best)
+if (total <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        write(buf, "(F24.8)") x(i) * 1d-12
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("write_f24_8", best)
+if (buf(24:24) < "0" .or. buf(24:24) > "9") error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = bench_snprintf_f(x, n, 1d-12)
+    best = min(best, wall_time() - t)
+end do
+call report("snprintf_f24_8", best)
+if (total <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        write(buf, "(G24.15)") x(i)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("write_g24_15", best)
+read(buf, *) y
+if (abs(y - x(n)) > 1d-14 * abs(x(n))) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = bench_snprintf_g(x, n)
+    best = min(best, wall_time() - t)
+end do
+call report("snprintf_g24_15", best)
+if (total <= 0) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
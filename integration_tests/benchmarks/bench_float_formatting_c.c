@@ -0,0 +1,64 @@
+/*
+ * The snprintf conversions the runtime used for real output before it
+ * generated the decimal digits itself, timed by bench_float_formatting.f90
+ * as the baseline for its write_* kernels. Each function converts x(1:n)
+ * and returns the total length, so that the calls are not optimized away.
+ * Only the conversions are timed, not the rest of the WRITE statement, so
+ * the comparison favours the old path.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* List-directed real(8): "%.16E" outside [0.1, 1e16), else "%.*f" with 17
+   significant digits */
+int bench_snprintf_list_directed(const double *x, int n) {
+    char buf[64];
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        double a = fabs(x[i]);
+        if (a < 0.1 || a >= 1.0e16) {
+            total += snprintf(buf, sizeof(buf), "%.16E", x[i]);
+        } else {
+            int decimal_places = 17 - ((int)floor(log10(a)) + 1);
+            if (decimal_places < 0) decimal_places = 0;
+            total += snprintf(buf, sizeof(buf), "%.*f", decimal_places, x[i]);
+        }
+    }
+    return total;
+}
+
+/* ES and E: the value with about 500 fraction digits, which the old
+   handle_decimal then rounded by hand */
+int bench_snprintf_es(const double *x, int n) {
+    char buf[512];
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        double integer_part = trunc(x[i]);
+        int integer_length = integer_part == 0
+            ? 1 : (int)log10(fabs(integer_part)) + 1;
+        int frac = (int)sizeof(buf) - integer_length - (x[i] < 0) - 2;
+        total += snprintf(buf, sizeof(buf), "%.*f", frac, x[i]);
+    }
+    return total;
+}
+
+/* F24.8 */
+int bench_snprintf_f(const double *x, int n, double scale) {
+    char buf[64];
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        total += snprintf(buf, sizeof(buf), "%.*f", 8, x[i] * scale);
+    }
+    return total;
+}
+
+/* G24.15 */
+int bench_snprintf_g(const double *x, int n) {
+    char buf[64];
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        total += snprintf(buf, sizeof(buf), "%#.*G", 15, x[i]);
+    }
+    return total;
+}
@@ -0,0 +1,102 @@
+program bench_io
+! Runtime benchmark: formatted and unformatted sequential file I/O, and
+! internal (string) writes and reads. See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 100000, reps = 3
+real(8), allocatable :: x(:), y(:)
+character(len=32) :: buf
+real(8) :: t, best, v
+integer :: i, j, r, u
+
+allocate(x(n), y(n))
+do i = 1, n
+    x(i) = i * 0.125d0
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    open(newunit=u, file="bench_io_formatted.txt", status="replace", &
+        action="write", form="formatted")
+    do i = 1, n
+        write(u, '(i8, 1x, es24.16)') i, x(i)
+    end do
+    close(u)
+    best = min(best, wall_time() - t)
+end do
+call report("io_formatted_write", best)
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    open(newunit=u, file="bench_io_formatted.txt", status="old", &
+        action="read", form="formatted")
+    do i = 1, n
+        read(u, *) j, y(i)
+    end do
+    close(u)
+    best = min(best, wall_time() - t)
+end do
+open(newunit=u, file="bench_io_formatted.txt", status="old")
+close(u, status="delete")
+call report("io_formatted_read", best)
+if (any(y /= x)) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    open(newunit=u, file="bench_io_unformatted.dat", status="replace", &
+        action="write", form="unformatted")
+    do i = 1, 100
+        write(u) x
+    end do
+    close(u)
+    best = min(best, wall_time() - t)
+end do
+call report("io_unformatted_write", best)
+
+y = 0
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    open(newunit=u, file="bench_io_unformatted.dat", status="old", &
+        action="read", form="unformatted")
+    do i = 1, 100
+        read(u) y
+    end do
+    close(u)
+    best = min(best, wall_time() - t)
+end do
+open(newunit=u, file="bench_io_unformatted.dat", status="old", &
+    form="unformatted")
+close(u, status="delete")
+call report("io_unformatted_read", best)
+if (any(y /= x)) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, n
+        write(buf, '(f0.3)') x(i)
+        read(buf, *) v
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("io_internal", best)
+if (v /= x(n)) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
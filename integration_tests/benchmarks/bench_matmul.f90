@@ -0,0 +1,53 @@
+program bench_matmul
+! Runtime benchmark: MATMUL of square matrices, and matrix-vector products.
+! See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 600, reps = 3
+real(8), allocatable :: a(:, :), b(:, :), c(:, :), v(:), w(:)
+real(8) :: t, best
+integer :: i, j, r
+
+allocate(a(n, n), b(n, n), c(n, n), v(n), w(n))
+do j = 1, n
+    do i = 1, n
+        a(i, j) = 1.0d0 / (i + j)
+        b(i, j) = mod(i * j, 5)
+    end do
+    v(j) = 1
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    c = matmul(a, b)
+    best = min(best, wall_time() - t)
+end do
+call report("matmul", best)
+if (abs(c(3, 4) - sum(a(3, :) * b(:, 4))) > 1d-9) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    do i = 1, 20
+        w = matmul(a, v)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("matmul_vector", best)
+if (abs(w(5) - sum(a(5, :))) > 1d-9) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
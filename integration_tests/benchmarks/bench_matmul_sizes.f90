@@ -0,0 +1,67 @@
+program bench_matmul_sizes
+! Runtime benchmark: MATMUL of square matrices from 8 to 1024, which moves
+! from the inlined loops to the blocked runtime kernel, and DOT_PRODUCT of
+! long vectors. Each size repeats the product to about 2e8 flops.
+! See run_benchmarks.py.
+implicit none
+integer, parameter :: sizes(8) = [8, 16, 32, 64, 128, 256, 512, 1024]
+integer, parameter :: n_dot = 4000000
+real(8), allocatable :: a(:, :), b(:, :), c(:, :), x(:), y(:)
+character(len=16) :: name
+real(8) :: t, best, d
+integer :: i, j, k, n, reps, r
+
+do k = 1, size(sizes)
+    n = sizes(k)
+    allocate(a(n, n), b(n, n), c(n, n))
+    do j = 1, n
+        do i = 1, n
+            a(i, j) = 1.0d0 / (i + j)
+            b(i, j) = mod(i * j, 7) - 3
+        end do
+    end do
+    reps = max(1, int(1.0d8 / real(n, 8)**3))
+    best = huge(best)
+    do r = 1, 3
+        t = wall_time()
+        do i = 1, reps
+            c = matmul(a, b)
+        end do
+        best = min(best, wall_time() - t)
+    end do
+    write(name, '("matmul_", i0)') n
+    call report(trim(name), best)
+    if (abs(c(n, 1) - sum(a(n, :) * b(:, 1))) > 1d-9 * n) error stop
+    if (abs(c(1, n) - sum(a(1, :) * b(:, n))) > 1d-9 * n) error stop
+    deallocate(a, b, c)
+end do
+
+allocate(x(n_dot), y(n_dot))
+do i = 1, n_dot
+    x(i) = 1.0d0 / i
+    y(i) = i
+end do
+best = huge(best)
+do r = 1, 5
+    t = wall_time()
+    d = dot_product(x, y)
+    best = min(best, wall_time() - t)
+end do
+call report("dot_product", best)
+if (abs(d - n_dot) > 1d-6 * n_dot) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
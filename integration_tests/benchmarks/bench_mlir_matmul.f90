@@ -0,0 +1,48 @@
+program bench_mlir_matmul
+! Runtime benchmark for the MLIR backend: a matrix product written as a loop
+! nest over explicit shape arrays, which the backend interchanges and tiles
+! as affine loops (see mlir_loops_01.f90). The backend has no timer, so the
+! whole program is timed by run_benchmarks.py; the set up is negligible.
+! The arrays are allocated on the stack by the backend, keep them small.
+implicit none
+integer, parameter :: n = 256, reps = 10
+real(8) :: a(n, n), b(n, n), c(n, n)
+real(8) :: s, r
+integer :: i, j, k, t
+
+do j = 1, n
+    do i = 1, n
+        ! mod(), which the backend does not lower
+        a(i, j) = i + j - 7*((i + j)/7)
+        b(i, j) = i*j - 5*((i*j)/5)
+    end do
+end do
+
+do t = 1, reps
+    do j = 1, n
+        do i = 1, n
+            c(i, j) = 0.0d0
+        end do
+    end do
+    do i = 1, n
+        do j = 1, n
+            do k = 1, n
+                c(i, j) = c(i, j) + a(i, k) * b(k, j)
+            end do
+        end do
+    end do
+end do
+
+s = 0.0d0
+do j = 1, n
+    do i = 1, n
+        s = s + c(i, j)
+    end do
+end do
+print *, s
+r = 0.0d0
+do k = 1, n
+    r = r + a(3, k) * b(k, 4)
+end do
+if (abs(c(3, 4) - r) > 1.0d-9) error stop
+end program
@@ -0,0 +1,56 @@
+program bench_omp_loops
+! Runtime benchmark: OpenMP `parallel do` loops with and without a
+! reduction, at the default number of threads. See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 5000000, reps = 5
+real(8), allocatable :: a(:), b(:)
+real(8) :: t, best, s
+integer :: i, r
+
+allocate(a(n), b(n))
+do i = 1, n
+    b(i) = mod(i, 100) * 1.0d-2
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+!$omp parallel do
+    do i = 1, n
+        a(i) = sin(b(i)) * cos(b(i)) + sqrt(b(i))
+    end do
+!$omp end parallel do
+    best = min(best, wall_time() - t)
+end do
+call report("omp_parallel_do", best)
+if (abs(a(17) - (sin(b(17)) * cos(b(17)) + sqrt(b(17)))) > 1d-12) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    s = 0
+!$omp parallel do reduction(+:s)
+    do i = 1, n
+        s = s + b(i) * b(i)
+    end do
+!$omp end parallel do
+    best = min(best, wall_time() - t)
+end do
+call report("omp_reduction", best)
+if (abs(s - 0.3283500d0 * n) > 1d-6 * n) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
@@ -0,0 +1,57 @@
+program bench_omp_reduction_threads
+! Runtime benchmark: short `parallel do` reductions at 1 to 8 threads. The
+! per-thread share of the loop is small, so the time is dominated by
+! combining the partial results. See run_benchmarks.py.
+use omp_lib
+implicit none
+integer, parameter :: n = 100000, reps = 200
+character(len=24) :: name
+integer :: i, r, k, nthreads
+real(8) :: s, m, t, best
+
+nthreads = 1
+do k = 1, 4
+    call omp_set_num_threads(nthreads)
+    best = huge(best)
+    do r = 1, 3
+        t = wall_time()
+        do i = 1, reps
+            call reduce(s, m)
+        end do
+        best = min(best, wall_time() - t)
+    end do
+    write(name, '("omp_reduce_", i0, "_threads")') nthreads
+    call report(trim(name), best)
+    if (abs(s - 12.090146129863d0) > 1d-9) error stop
+    if (m /= 976) error stop
+    nthreads = nthreads * 2
+end do
+
+contains
+
+    subroutine reduce(s, m)
+    real(8), intent(out) :: s, m
+    integer :: i
+    s = 0
+    m = 0
+!$omp parallel do reduction(+:s) reduction(max:m)
+    do i = 1, n
+        s = s + 1d0 / i
+        m = max(m, real(mod(i, 977), 8))
+    end do
+!$omp end parallel do
+    end subroutine
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
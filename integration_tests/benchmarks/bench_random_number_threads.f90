@@ -0,0 +1,71 @@
+program bench_random_number_threads
+! Runtime benchmark: random_number at 1 to 8 threads and into a contiguous
+! array. Every thread draws from its own generator, so the scalar time should
+! drop with the thread count instead of collapsing on a shared state.
+! See run_benchmarks.py.
+use omp_lib
+implicit none
+integer, parameter :: n = 1000000, reps = 20
+character(len=24) :: name
+integer :: r, k, nthreads
+real(8) :: s, t, best
+real(8), allocatable :: v(:)
+
+nthreads = 1
+do k = 1, 4
+    call omp_set_num_threads(nthreads)
+    best = huge(best)
+    do r = 1, 3
+        t = wall_time()
+        call draw(s)
+        best = min(best, wall_time() - t)
+    end do
+    write(name, '("random_number_", i0, "_threads")') nthreads
+    call report(trim(name), best)
+    if (abs(s / (real(n, 8) * reps) - 0.5d0) > 1d-2) error stop
+    nthreads = nthreads * 2
+end do
+
+allocate(v(n))
+best = huge(best)
+do r = 1, 3
+    t = wall_time()
+    do k = 1, reps
+        call random_number(v)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("random_number_array", best)
+if (abs(sum(v) / n - 0.5d0) > 1d-2) error stop
+if (minval(v) < 0 .or. maxval(v) >= 1) error stop
+
+contains
+
+    subroutine draw(s)
+    real(8), intent(out) :: s
+    real(8) :: x
+    integer :: i, j
+    s = 0
+!$omp parallel do private(x, j) reduction(+:s)
+    do i = 1, n
+        do j = 1, reps
+            call random_number(x)
+            s = s + x
+        end do
+    end do
+!$omp end parallel do
+    end subroutine
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
@@ -0,0 +1,74 @@
+program bench_reductions
+! Runtime benchmark: SUM, PRODUCT, MAXVAL/MINVAL, DOT_PRODUCT, COUNT and
+! masked reductions over large arrays. See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 4000000, reps = 5
+real(8), allocatable :: x(:), y(:)
+integer, allocatable :: k(:)
+real(8) :: t, best, s, d, mx, mn
+integer :: i, r, cnt
+
+allocate(x(n), y(n), k(n))
+do i = 1, n
+    x(i) = mod(i, 1000) * 1.0d-3
+    y(i) = 2
+    k(i) = mod(i, 10)
+end do
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    s = sum(x)
+    mx = maxval(x)
+    mn = minval(x)
+    best = min(best, wall_time() - t)
+end do
+call report("sum_maxval_minval", best)
+if (abs(s - 499.5d0 * (n / 1000)) > 1d-6) error stop
+if (abs(mx - 0.999d0) > 1d-12 .or. mn /= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    d = dot_product(x, y)
+    best = min(best, wall_time() - t)
+end do
+call report("dot_product", best)
+if (abs(d - 2 * s) > 1d-6) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    cnt = count(k > 4)
+    s = sum(x, mask=k == 3)
+    mx = maxval(x, mask=k < 5)
+    best = min(best, wall_time() - t)
+end do
+call report("masked_reductions", best)
+if (cnt /= n / 2) error stop
+if (abs(mx - 0.994d0) > 1d-12) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    i = sum(k) + product(k(1:9)) + maxval(k)
+    best = min(best, wall_time() - t)
+end do
+call report("integer_reductions", best)
+if (i /= 45 * (n / 10) + 362880 + 9) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
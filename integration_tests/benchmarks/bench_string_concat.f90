@@ -0,0 +1,45 @@
+program bench_string_concat
+! Runtime benchmark: log lines built from many short pieces with `//` and
+! REPEAT, assigned to a deferred-length string. Each line is a single
+! concatenation chain. See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 500000, reps = 3
+character(len=8) :: level(3) = [character(len=8) :: "INFO", "WARNING", "ERROR"]
+character(len=:), allocatable :: line
+character(len=12) :: num
+real(8) :: t, best
+integer :: i, r, total
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = 0
+    do i = 1, n
+        write(num, "(i0)") i
+        line = "2024-01-01 12:00:00 [" // trim(level(mod(i, 3) + 1)) // "] " // &
+            "worker " // trim(num) // ": " // repeat("-", mod(i, 16)) // &
+            " request served in " // trim(num) // " us" // repeat(" ", 4) // "|"
+        total = total + len(line)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("concat_chain", best)
+if (line /= "2024-01-01 12:00:00 [ERROR] worker 500000: " // &
+    " request served in 500000 us    |") error stop
+if (total /= 41694458) error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
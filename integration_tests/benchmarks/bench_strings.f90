@@ -0,0 +1,70 @@
+program bench_strings
+! Runtime benchmark: concatenation, TRIM/ADJUSTL, INDEX/SCAN, substrings,
+! character comparisons and deferred-length reallocation.
+! See run_benchmarks.py.
+implicit none
+integer, parameter :: n = 200000, reps = 3
+character(len=16) :: words(8) = [character(len=16) :: "alpha", "beta", &
+    "gamma", "delta", "epsilon", "zeta", "eta", "theta"]
+character(len=:), allocatable :: s
+character(len=64) :: line
+real(8) :: t, best
+integer :: i, r, total
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = 0
+    do i = 1, n
+        line = trim(words(mod(i, 8) + 1)) // "-" // trim(words(mod(i, 5) + 1)) &
+            // "." // trim(adjustl(words(mod(i, 3) + 1)))
+        total = total + len_trim(line)
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("concat_trim", best)
+if (total <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    total = 0
+    do i = 1, n
+        line = "key_" // words(mod(i, 8) + 1)
+        total = total + index(line, "ta") + scan(line, "mz") &
+            + verify(line(1:4), "key_")
+        if (line(5:9) == "gamma") total = total + 1
+        if (llt(line, "key_d")) total = total + 1
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("search_compare", best)
+if (total <= 0) error stop
+
+best = huge(best)
+do r = 1, reps
+    t = wall_time()
+    s = ""
+    do i = 1, n / 10
+        s = s // trim(words(mod(i, 8) + 1))
+    end do
+    best = min(best, wall_time() - t)
+end do
+call report("append_deferred", best)
+if (s(1:4) /= "beta") error stop
+
+contains
+
+    real(8) function wall_time() result(t)
+    integer(8) :: count, rate
+    call system_clock(count, rate)
+    t = real(count, 8) / real(rate, 8)
+    end function
+
+    subroutine report(name, t)
+    character(len=*), intent(in) :: name
+    real(8), intent(in) :: t
+    print '("BENCH ", a, " ", f12.6, " s")', name, t
+    end subroutine
+
+end program
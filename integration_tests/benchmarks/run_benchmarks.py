@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+"""
+Builds and runs the runtime benchmarks (benchmarks/bench_*.f90) through the
+integration_tests CMake setup (-DBENCHMARKS=yes) and prints the timings of
+every kernel. If GFortran is installed, the same benchmarks are also built
+with `gfortran -O3` and the table shows LFortran's time relative to it.
+
+    ./run_benchmarks.py                  # llvm and llvm_omp vs gfortran
+    ./run_benchmarks.py --no-gfortran --json lfortran.json
+    ./run_benchmarks.py --baseline lfortran.json
+
+The OpenMP benchmark uses the `llvm_omp` backend, which links against the
+OpenMP runtime in $CONDA_PREFIX/lib.
+
+The MLIR backend has no timer intrinsic, so the bench_mlir_* programs print
+no BENCH lines; the time ctest reports for the whole program is used instead:
+
+    ./run_benchmarks.py -b mlir          # requires LFortran built with MLIR
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess as sp
+import sys
+
+BENCH_DIR = os.path.dirname(os.path.realpath(__file__))
+BASE_DIR = os.path.dirname(BENCH_DIR)
+LFORTRAN_PATH = f"{BASE_DIR}/../src/bin"
+BENCH_LINE = re.compile(r"BENCH\s+(\S+)\s+([0-9.]+)\s+s")
+# ctest's summary line of a test, for the programs timed as a whole
+CTEST_LINE = re.compile(r"Test\s+#\d+:\s+(bench_mlir_\S+)\s+\.*\s*"
+                        r"Passed\s+([0-9.]+)\s+sec")
+
+
+def run_cmd(cmd, cwd=None):
+    print(f"+ {cmd}")
+    process = sp.run(cmd, shell=True, cwd=cwd)
+    if process.returncode != 0:
+        print("Command failed.")
+        sys.exit(1)
+
+
+def run_benchmarks(backend, jobs):
+    """Returns {kernel: seconds} for all benchmarks built with `backend`."""
+    build_dir = f"{BASE_DIR}/bench-{backend}"
+    shutil.rmtree(build_dir, ignore_errors=True)
+    os.makedirs(build_dir)
+    common = (f"-DBENCHMARKS=yes -DCURRENT_BINARY_DIR={build_dir} "
+              f"-S {BASE_DIR} -B {build_dir}")
+    if backend == "gfortran":
+        run_cmd("FC=gfortran cmake " + common, cwd=build_dir)
+    else:
+        run_cmd(f"FC=lfortran cmake -DLFORTRAN_BACKEND={backend} "
+                "-DCMAKE_Fortran_COMPILER_WORKS=1 "
+                "-DCMAKE_Fortran_COMPILER_FORCED=1 " + common, cwd=build_dir)
+    run_cmd(f"cmake --build . -j{jobs}", cwd=build_dir)
+
+    # One benchmark at a time, so that they do not compete for the cores
+    process = sp.run("ctest -j1 -V", shell=True, cwd=build_dir,
+                     stdout=sp.PIPE, stderr=sp.STDOUT, text=True)
+    if process.returncode != 0:
+        print(process.stdout)
+        print(f"Some benchmarks failed with the {backend} backend.")
+    results = {}
+    for line in process.stdout.splitlines():
+        m = BENCH_LINE.search(line) or CTEST_LINE.search(line)
+        if m:
+            results[m.group(1)] = float(m.group(2))
+    return results
+
+
+def ratio(a, b):
+    return f"{a / b:8.2f}x" if a is not None and b else ""
+
+
+def print_table(lfortran, others):
+    names = list(lfortran)
+    for results in others.values():
+        names += [n for n in results if n not in names]
+    header = f"{'kernel':24} {'lfortran':>12}"
+    for label in others:
+        header += f" {label:>12} {'ratio':>9}"
+    print(header)
+    for name in names:
+        t = lfortran.get(name)
+        row = f"{name:24} " + (f"{t:12.6f}" if t is not None else f"{'-':>12}")
+        for results in others.values():
+            o = results.get(name)
+            row += " " + (f"{o:12.6f}" if o is not None else f"{'-':>12}")
+            row += " " + f"{ratio(t, o):>9}"
+        print(row)
+
+
+def get_args():
+    parser = argparse.ArgumentParser(
+        description="LFortran runtime benchmarks")
+    parser.add_argument("-b", "--backends", nargs="*",
+                        default=["llvm", "llvm_omp"],
+                        help="LFortran backends to benchmark")
+    parser.add_argument("--no-gfortran", action="store_true",
+                        help="Do not compare with GFortran")
+    parser.add_argument("--json", type=str,
+                        help="Save the LFortran timings to this file")
+    parser.add_argument("--baseline", type=str,
+                        help="Compare with LFortran timings saved by --json")
+    parser.add_argument("-j", "--jobs", type=int, default=8,
+                        help="Parallel build jobs")
+    return parser.parse_args()
+
+
+def main():
+    args = get_args()
+    local_lfortran = os.path.join(LFORTRAN_PATH, "lfortran")
+    if os.path.isfile(local_lfortran):
+        os.environ["PATH"] = LFORTRAN_PATH + os.pathsep + os.environ["PATH"]
+
+    lfortran = {}
+    for backend in args.backends:
+        lfortran.update(run_benchmarks(backend, args.jobs))
+
+    others = {}
+    if args.baseline:
+        with open(args.baseline) as f:
+            others["baseline"] = json.load(f)
+    if not args.no_gfortran:
+        if shutil.which("gfortran"):
+            others["gfortran"] = run_benchmarks("gfortran", args.jobs)
+        else:
+            print("gfortran not found, skipping the comparison")
+
+    print()
+    print_table(lfortran, others)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(lfortran, f, indent=4, sort_keys=True)
+
+
+if __name__ == "__main__":
+    main()
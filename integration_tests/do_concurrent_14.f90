@@ -0,0 +1,19 @@
+program do_concurrent_14
+! Nested and reducing `do concurrent`, the innermost loop is vectorized
+implicit none
+integer, parameter :: n = 37, m = 101
+real(8) :: a(m, n), s
+integer :: i, j
+
+do concurrent (j = 1:n, i = 1:m)
+    a(i, j) = i + 1000 * j
+end do
+if (a(m, n) /= m + 1000 * n) error stop
+
+s = 0
+do concurrent (j = 1:n, i = 1:m) reduce(+:s)
+    s = s + a(i, j)
+end do
+print *, s
+if (abs(s - (real(n, 8) * m * (m + 1) / 2 + 1000d0 * m * n * (n + 1) / 2)) > 1d-6) error stop
+end program
@@ -0,0 +1,33 @@
+program do_concurrent_15
+! A `do concurrent` body may write a variable and read it back in the same
+! iteration. Only the accesses indexed by the loop variable are free of
+! dependences between iterations, the temporaries `t(1)` and `w(k)` are not.
+implicit none
+integer, parameter :: n = 1000
+real(8) :: a(n), b(n), c(n), t(2), w(3)
+integer :: i, k
+
+do i = 1, n
+    a(i) = i
+end do
+
+do concurrent (i = 1:n)
+    t(1) = a(i)
+    t(2) = 2 * t(1)
+    b(i) = t(1) + t(2)
+end do
+do i = 1, n
+    if (b(i) /= 3 * a(i)) error stop
+end do
+
+do concurrent (i = 1:n)
+    do k = 1, 3
+        w(k) = k * a(i)
+    end do
+    c(i) = w(1) + w(2) + w(3)
+end do
+do i = 1, n
+    if (c(i) /= 6 * a(i)) error stop
+end do
+print *, sum(b), sum(c)
+end program
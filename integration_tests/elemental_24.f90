@@ -0,0 +1,112 @@
+module elemental_24_mod
+implicit none
+
+real(8) :: shared(8)
+
+contains
+
+    elemental function twice_plus_one(x) result(r)
+        real(8), intent(in) :: x
+        real(8) :: r
+        r = 2.0d0 * x + 1.0d0
+    end function
+
+    elemental function shift_by_shared(x) result(r)
+        real(8), intent(in) :: x
+        real(8) :: r
+        r = x + shared(1)
+    end function
+
+    subroutine update(a, b)
+        real(8), intent(inout) :: a(:)
+        real(8), intent(in) :: b(:)
+        a = twice_plus_one(a*b) - a/b
+    end subroutine
+
+end module
+
+program elemental_24
+use elemental_24_mod
+implicit none
+
+integer, parameter :: n = 8
+real(8) :: a(n), b(n), c(n), d(n), ref(n)
+integer :: i
+
+do i = 1, n
+    a(i) = real(i, 8)
+    b(i) = real(n - i + 1, 8)
+    d(i) = 0.5d0 * real(i, 8)
+end do
+
+! Whole expression tree in one loop, no aliasing
+c = a*b + sin(d) - a/b
+do i = 1, n
+    ref(i) = a(i)*b(i) + sin(d(i)) - a(i)/b(i)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+! Elemental intrinsic and user function with array expression arguments
+c = sqrt(a*b + 1.0d0) + twice_plus_one(a - b)
+do i = 1, n
+    ref(i) = sqrt(a(i)*b(i) + 1.0d0) + (2.0d0*(a(i) - b(i)) + 1.0d0)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+! The target appears on the right hand side as a whole array
+c = a
+c = c*b + cos(c) - twice_plus_one(c/b)
+do i = 1, n
+    ref(i) = a(i)*b(i) + cos(a(i)) - (2.0d0*(a(i)/b(i)) + 1.0d0)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+c = a
+call update(c, b)
+do i = 1, n
+    ref(i) = (2.0d0*(a(i)*b(i)) + 1.0d0) - a(i)/b(i)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+! Overlapping sections of the target still see the old values
+c = a
+c(2:n) = c(1:n-1) + c(2:n)
+ref(1) = a(1)
+do i = 2, n
+    ref(i) = a(i-1) + a(i)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+c = a
+c = c(n:1:-1) * 2.0d0 + c
+do i = 1, n
+    ref(i) = a(n - i + 1) * 2.0d0 + a(i)
+end do
+print *, c
+if (any(abs(c - ref) > 1d-12)) error stop
+
+! Procedures which can see the target must see its old values
+shared = a
+shared = shift_by_shared(shared)
+print *, shared
+if (any(abs(shared - (a + a(1))) > 1d-12)) error stop
+
+c = a
+c = add_first(c) + c
+print *, c
+if (any(abs(c - (2.0d0*a + a(1))) > 1d-12)) error stop
+
+contains
+
+    elemental function add_first(x) result(r)
+        real(8), intent(in) :: x
+        real(8) :: r
+        r = x + c(1)
+    end function
+
+end program
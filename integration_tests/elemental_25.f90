@@ -0,0 +1,50 @@
+program elemental_25
+! Assignments whose right hand side reads the target through an associate
+! name or a pointer must not be evaluated in place. GFortran evaluates the
+! first one in place, so this only runs with LFortran.
+implicit none
+integer, parameter :: n = 8
+real(8), target :: b(n)
+real(8) :: a(n), c(n), expected(n)
+real(8), pointer :: p(:)
+integer :: i
+
+do i = 1, n
+    a(i) = i
+end do
+expected = 2 * a + a(n:1:-1)
+associate (r => a(n:1:-1))
+    a = 2 * a + r
+end associate
+print *, a
+if (any(a /= expected)) error stop
+
+do i = 1, n
+    a(i) = i
+end do
+expected = a + a(1)
+associate (s => a(1))
+    a = a + s
+end associate
+print *, a
+if (any(a /= expected)) error stop
+
+do i = 1, n
+    b(i) = i
+end do
+expected = b * b(n:1:-1)
+p => b(n:1:-1)
+b = b * p
+print *, b
+if (any(b /= expected)) error stop
+
+do i = 1, n
+    c(i) = i
+end do
+expected = sqrt(c) + c
+associate (r => c)
+    c = sqrt(c) + r
+end associate
+print *, c
+if (any(abs(c - expected) > 1d-12)) error stop
+end program
@@ -0,0 +1,44 @@
+module fast_math_01_mod
+use, intrinsic :: ieee_arithmetic, only: ieee_is_nan, ieee_value, ieee_quiet_nan
+implicit none
+contains
+
+! Uses ieee_arithmetic, so it is compiled without fast-math flags and the
+! NaN checks are kept
+logical function has_nan(x)
+    real(8), intent(in) :: x(:)
+    integer :: i
+    has_nan = .false.
+    do i = 1, size(x)
+        if (ieee_is_nan(x(i))) has_nan = .true.
+    end do
+end function
+
+real(8) function quiet_nan()
+    quiet_nan = ieee_value(1d0, ieee_quiet_nan)
+end function
+end module
+
+program fast_math_01
+use fast_math_01_mod, only: has_nan, quiet_nan
+implicit none
+real(8) :: x(1000), s, d
+integer :: i
+
+do i = 1, size(x)
+    x(i) = 1d0 / i
+end do
+s = 0
+d = 0
+do i = 1, size(x)
+    s = s + x(i)
+    d = d + x(i) * x(i)
+end do
+print *, s, d
+if (abs(s - 7.4854708605503433d0) > 1d-10) error stop
+if (abs(d - 1.6439345666815615d0) > 1d-10) error stop
+
+if (has_nan(x)) error stop
+x(500) = quiet_nan()
+if (.not. has_nan(x)) error stop
+end program
@@ -0,0 +1,57 @@
+program file_60
+    ! Asynchronous unformatted output with two buffers: one is filled while
+    ! the other is being written, and WAIT(id=) guards each refill
+    implicit none
+    integer, parameter :: n = 50000, nrec = 6
+    real(8), allocatable, asynchronous :: buf(:, :)
+    real(8), allocatable :: back(:)
+    integer, asynchronous :: tags(2)
+    integer :: ids(2), r, s, i, k, ios
+
+    allocate(buf(n, 2), back(n))
+
+    open(10, file="file_60_data.bin", form="unformatted", access="sequential", &
+        status="replace", asynchronous="yes")
+    do r = 1, nrec
+        s = mod(r - 1, 2) + 1
+        if (r > 2) then
+            wait(10, id=ids(s), iostat=ios)
+            if (ios /= 0) error stop
+        end if
+        tags(s) = r
+        do i = 1, n
+            buf(i, s) = r * 1000000.0d0 + i
+        end do
+        write(10, asynchronous="yes", id=ids(s)) tags(s), buf(:, s)
+    end do
+    wait(10)
+    close(10)
+
+    open(10, file="file_60_data.bin", form="unformatted", access="sequential", &
+        status="old")
+    do r = 1, nrec
+        read(10) k, back
+        if (k /= r) error stop
+        if (back(1) /= r * 1000000.0d0 + 1) error stop
+        if (back(n) /= r * 1000000.0d0 + n) error stop
+    end do
+    close(10)
+
+    ! Stream access, closing the unit with transfers still pending
+    open(11, file="file_60_data.bin", form="unformatted", access="stream", &
+        status="replace", asynchronous="yes")
+    do s = 1, 2
+        buf(:, s) = s
+        write(11, asynchronous="yes") buf(:, s)
+    end do
+    close(11)
+
+    open(11, file="file_60_data.bin", form="unformatted", access="stream", &
+        status="old")
+    do s = 1, 2
+        read(11) back
+        if (any(back /= s)) error stop
+    end do
+    close(11, status="delete")
+    print *, "ok"
+end program file_60
@@ -0,0 +1,54 @@
+program file_61
+    ! Read-only unformatted stream and direct access reads (built with
+    ! --mmap-io, so these go through a mapping of the file)
+    implicit none
+    integer, parameter :: n = 100000, recn = 1000, nrec = 8
+    real(8), allocatable :: a(:), back(:)
+    integer(4) :: ia(recn), ib(recn)
+    integer :: i, r, k, ios
+
+    allocate(a(n), back(n))
+    do i = 1, n
+        a(i) = i * 0.5d0
+    end do
+
+    open(10, file="file_61_data.bin", form="unformatted", access="stream", &
+        status="replace")
+    write(10) 42, a
+    close(10)
+
+    open(10, file="file_61_data.bin", form="unformatted", access="stream", &
+        status="old", action="read")
+    read(10) k, back
+    if (k /= 42) error stop
+    if (any(back /= a)) error stop
+
+    ! Reposition and read part of the array again
+    read(10, pos=5 + 8 * 99) back(1:10)
+    do i = 1, 10
+        if (back(i) /= a(99 + i)) error stop
+    end do
+
+    ! Reading past the end of the file
+    read(10, pos=5 + 8 * (n - 2), iostat=ios) back(1:4)
+    if (ios >= 0) error stop
+    close(10)
+
+    open(11, file="file_61_data.bin", form="unformatted", access="direct", &
+        recl=4 * recn, status="replace")
+    do r = 1, nrec
+        ia = [(r * 10000 + i, i = 1, recn)]
+        write(11, rec=r) ia
+    end do
+    close(11)
+
+    open(11, file="file_61_data.bin", form="unformatted", access="direct", &
+        recl=4 * recn, status="old", action="read")
+    do r = nrec, 1, -1
+        read(11, rec=r) ib
+        if (ib(1) /= r * 10000 + 1) error stop
+        if (ib(recn) /= r * 10000 + recn) error stop
+    end do
+    close(11, status="delete")
+    print *, "ok"
+end program file_61
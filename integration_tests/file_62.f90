@@ -0,0 +1,35 @@
+program file_62
+    ! WAIT with err= and iomsg=: a successful wait leaves iomsg alone, a
+    ! failed asynchronous WRITE branches to the err= label
+    implicit none
+    integer, parameter :: n = 100000
+    real(8), asynchronous :: buf(n)
+    character(len=80) :: msg
+    integer :: id, ios
+
+    buf = 1
+    open(10, file="file_62_data.bin", form="unformatted", access="stream", &
+        status="replace", asynchronous="yes")
+    write(10, asynchronous="yes", id=id) buf
+    msg = "unchanged"
+    wait(10, id=id, iostat=ios, iomsg=msg)
+    if (ios /= 0) error stop
+    if (msg /= "unchanged") error stop
+    wait(10, err=10)
+    close(10, status="delete")
+
+    ! Every write to /dev/full fails with ENOSPC
+    open(11, file="/dev/full", form="unformatted", access="stream", &
+        status="old", action="write", asynchronous="yes")
+    write(11, asynchronous="yes", id=id) buf
+    wait(11, id=id, iostat=ios, iomsg=msg)
+    if (ios == 0) error stop
+    if (len_trim(msg) == 0 .or. msg == "unchanged") error stop
+    write(11, asynchronous="yes", id=id) buf
+    wait(11, id=id, err=20, iomsg=msg)
+    error stop
+20  close(11)
+    print *, "ok"
+    stop
+10  error stop
+end program file_62
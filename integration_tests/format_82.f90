@@ -0,0 +1,48 @@
+program format_82
+! Formatted and list-directed output of reals prints the exact decimal
+! digits of the binary value, correctly rounded
+implicit none
+character(len=64) :: s
+
+write(s, *) 0.1d0
+if (trim(adjustl(s)) /= "0.10000000000000001") error stop
+write(s, *) 1d-5
+if (trim(adjustl(s)) /= "1.0000000000000001E-005") error stop
+write(s, *) 123456.789d0
+if (trim(adjustl(s)) /= "123456.78900000000") error stop
+write(s, *) -2.5d300
+if (trim(adjustl(s)) /= "-2.5000000000000001E+300") error stop
+write(s, *) 5d-324
+if (trim(adjustl(s)) /= "4.9406564584124654E-324") error stop
+write(s, *) 0.1
+if (trim(adjustl(s)) /= "0.100000001") error stop
+write(s, *) 2.5e10
+if (trim(adjustl(s)) /= "2.49999995E+10") error stop
+write(s, *) -1.17549435e-38
+if (trim(adjustl(s)) /= "-1.17549435E-38") error stop
+
+write(s, '(ES30.22)') 0.1d0
+if (trim(adjustl(s)) /= "1.0000000000000000555112E-01") error stop
+write(s, '(ES12.5)') 1.2345678d-300
+if (trim(adjustl(s)) /= "1.23457-300") error stop
+write(s, '(ES24.16E3)') 5d-324
+if (trim(adjustl(s)) /= "4.9406564584124654E-324") error stop
+write(s, '(E12.4)') 295.17294311523438d0
+if (trim(adjustl(s)) /= "0.2952E+03") error stop
+write(s, '(EN12.3)') 0.9999996d0
+if (trim(adjustl(s)) /= "1.000E+00") error stop
+write(s, '(EN12.3)') 999999.9d0
+if (trim(adjustl(s)) /= "1.000E+06") error stop
+write(s, '(G15.7)') 295.1729d0
+if (trim(adjustl(s)) /= "295.1729") error stop
+write(s, '(F10.4)') 2.71828182845d0
+if (trim(adjustl(s)) /= "2.7183") error stop
+write(s, '(F12.3)') -1234.5678d0
+if (trim(adjustl(s)) /= "-1234.568") error stop
+write(s, '(F8.3)') -0.0004d0
+if (trim(adjustl(s)) /= "-0.000") error stop
+write(s, '(ES15.7)') 3.4028235e38
+if (trim(adjustl(s)) /= "3.4028235E+38") error stop
+print *, "ok"
+
+end program
@@ -0,0 +1,62 @@
+program matmul_07
+! Operands large enough to be computed by the blocked runtime kernels,
+! checked against the naive triple loop
+implicit none
+integer, parameter :: m = 67, n = 45, k = 81
+real(8) :: a(m, k), b(k, n), c(m, n), r(m, n)
+real :: as(m, k), bs(k, n), cs(m, n)
+complex(8) :: az(m, k), bz(k, n), cz(m, n), rz(m, n)
+real(8), allocatable :: x(:), y(:)
+real(8) :: d, rd
+integer :: i, j, l
+
+do j = 1, k
+    do i = 1, m
+        a(i, j) = real(mod(i*7 + j*3, 11), 8) / 4 - 1
+        az(i, j) = cmplx(a(i, j), -a(i, j) / 2, 8)
+    end do
+end do
+do j = 1, n
+    do i = 1, k
+        b(i, j) = real(mod(i*5 + j*13, 17), 8) / 8 - 1
+        bz(i, j) = cmplx(b(i, j) / 3, b(i, j), 8)
+    end do
+end do
+as = real(a)
+bs = real(b)
+
+r = 0
+rz = 0
+do j = 1, n
+    do l = 1, k
+        do i = 1, m
+            r(i, j) = r(i, j) + a(i, l) * b(l, j)
+            rz(i, j) = rz(i, j) + az(i, l) * bz(l, j)
+        end do
+    end do
+end do
+
+c = matmul(a, b)
+if (maxval(abs(c - r)) > 1d-10) error stop
+cs = matmul(as, bs)
+if (maxval(abs(cs - real(r))) > 1e-3) error stop
+cz = matmul(az, bz)
+if (maxval(abs(cz - rz)) > 1d-10) error stop
+
+! Non-contiguous operands use the inline loops
+c(:, 1:n:2) = matmul(a(:, 1:k), b(:, 1:n:2))
+if (maxval(abs(c(:, 1:n:2) - r(:, 1:n:2))) > 1d-10) error stop
+
+allocate(x(1000), y(1000))
+do i = 1, size(x)
+    x(i) = real(mod(i, 13), 8) / 2
+    y(i) = real(mod(i, 7), 8) - 2
+end do
+rd = 0
+do i = 1, size(x)
+    rd = rd + x(i) * y(i)
+end do
+d = dot_product(x, y)
+if (abs(d - rd) > 1d-9) error stop
+print *, sum(c), sum(cs), sum(abs(cz)), d
+end program
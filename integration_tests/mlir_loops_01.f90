@@ -0,0 +1,104 @@
+module mlir_loops_01_mod
+implicit none
+
+contains
+
+subroutine sum10(v, s)
+integer, intent(in) :: v(10)
+integer, intent(out) :: s
+integer :: i
+s = 0
+do i = 1, 10
+    s = s + v(i)
+end do
+end subroutine
+
+end module
+
+program mlir_loops_01
+! Loops that the MLIR backend keeps structured: the local arrays are
+! memrefs, the first two loops are fused, the matrix product is
+! interchanged and tiled, and DO CONCURRENT becomes affine.parallel or
+! scf.parallel. Use --show-mlir to look at the loops.
+use mlir_loops_01_mod, only: sum10
+implicit none
+integer, parameter :: n = 70
+real(8) :: a(n, n), b(n, n), c(n, n)
+real(8) :: x(n*n), y(n*n)
+integer :: p(10), q(10)
+real(8) :: s
+integer :: i, j, k, m, t, r
+
+do i = 1, n*n
+    x(i) = i
+end do
+do i = 1, n*n
+    y(i) = 2.0d0*x(i) + 1.0d0
+end do
+s = 0
+do i = 1, n*n
+    s = s + y(i)
+end do
+print *, s
+if (s /= 24019800.0d0) error stop
+
+do i = 1, n
+    do j = 1, n
+        a(i, j) = i + j
+        b(i, j) = i - j
+        c(i, j) = 0.0d0
+    end do
+end do
+
+! i is the contiguous index of all three arrays
+do i = 1, n
+    do j = 1, n
+        do k = 1, n
+            c(i, j) = c(i, j) + a(i, k) * b(k, j)
+        end do
+    end do
+end do
+s = 0
+do j = 1, n
+    do i = 1, n
+        r = 0
+        do k = 1, n
+            r = r + (i + k) * (k - j)
+        end do
+        if (c(i, j) /= r) error stop
+        s = s + c(i, j)
+    end do
+end do
+print *, s
+if (s /= 140029750.0d0) error stop
+
+do concurrent (i = 1:10)
+    p(i) = i*i
+end do
+m = 10
+do concurrent (i = 1:m)
+    q(i) = p(m + 1 - i)
+end do
+do concurrent (i = 1:n, j = 1:n)
+    a(i, j) = c(i, j) + 1.0d0
+end do
+if (q(1) /= 100) error stop
+if (q(10) /= 1) error stop
+if (a(3, 5) /= c(3, 5) + 1.0d0) error stop
+call sum10(q, r)
+print *, r
+if (r /= 385) error stop
+
+! The loop variable keeps its value after the loop
+do t = 1, 10, 3
+end do
+print *, t
+if (t /= 13) error stop
+r = 0
+do t = 10, 1, -2
+    r = r + t
+end do
+print *, r, t
+if (r /= 30) error stop
+if (t /= 0) error stop
+end program
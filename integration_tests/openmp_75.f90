@@ -0,0 +1,38 @@
+program openmp_75
+! Reductions over every type/operator pair that is combined lock-free
+use omp_lib
+implicit none
+integer, parameter :: n = 10000
+integer :: i, isum, imax
+integer(8) :: lsum, lmin
+real :: rmax, rmin
+real(8) :: dsum, dprod
+
+call omp_set_num_threads(8)
+isum = 0; imax = -huge(imax); lsum = 0; lmin = huge(lmin)
+rmax = -huge(rmax); rmin = huge(rmin); dsum = 0; dprod = 1
+
+!$omp parallel do reduction(+:isum, lsum, dsum) reduction(max:imax, rmax) &
+!$omp reduction(min:lmin, rmin) reduction(*:dprod)
+do i = 1, n
+    isum = isum + i
+    lsum = lsum + int(i, 8) * 1000000_8
+    dsum = dsum + 0.5d0
+    imax = max(imax, mod(i * 37, 1009) - 2000)
+    rmax = max(rmax, -real(i))
+    lmin = min(lmin, int(mod(i * 17, 997), 8) - 5_8)
+    rmin = min(rmin, real(i) / 3)
+    if (mod(i, 1000) == 0) dprod = dprod * 2
+end do
+!$omp end parallel do
+
+print *, isum, lsum, dsum, imax, rmax, lmin, rmin, dprod
+if (isum /= n * (n + 1) / 2) error stop
+if (lsum /= int(n, 8) * (n + 1) / 2 * 1000000_8) error stop
+if (abs(dsum - 5000d0) > 1d-10) error stop
+if (imax /= 1008 - 2000) error stop
+if (abs(rmax + 1) > 1e-6) error stop
+if (lmin /= -5) error stop
+if (abs(rmin - 1.0/3) > 1e-6) error stop
+if (abs(dprod - 1024d0) > 1d-10) error stop
+end program
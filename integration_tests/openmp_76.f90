@@ -0,0 +1,48 @@
+program openmp_76
+! `simd` loops and `do concurrent` lowered with vectorization hints
+implicit none
+integer, parameter :: n = 1003
+real(8) :: a(n), b(n), c(n), s
+integer :: i
+
+do i = 1, n
+    a(i) = i
+    b(i) = 2 * i
+end do
+
+!$omp simd
+do i = 1, n
+    c(i) = a(i) + b(i)
+end do
+!$omp end simd
+if (any(c /= 3 * a)) error stop
+
+!$omp simd simdlen(4)
+do i = 1, n
+    c(i) = a(i) * b(i)
+end do
+!$omp end simd
+if (any(c /= 2 * a**2)) error stop
+
+! a(i) depends on a(i - 4), so at most 4 iterations may run together
+!$omp simd safelen(4)
+do i = 5, n
+    a(i) = a(i - 4) + 1
+end do
+!$omp end simd
+if (a(n) /= 3 + (n - 3) / 4) error stop
+
+s = 0
+!$omp simd reduction(+:s)
+do i = 1, n
+    s = s + b(i)
+end do
+!$omp end simd
+if (abs(s - real(n, 8) * (n + 1)) > 1d-8) error stop
+
+do concurrent (i = 1:n)
+    c(i) = 2 * b(i)
+end do
+if (any(c /= 2 * b)) error stop
+print *, a(n), s
+end program
@@ -0,0 +1,32 @@
+program openmp_77
+! real(4) MAX and MIN reductions start from -huge() and huge() of their own
+! kind, not from the real(8) bounds narrowed to -inf and +inf
+use omp_lib
+implicit none
+real :: rmax, rmin
+real(8) :: dmax
+integer :: i, n_bad
+real :: x(6) = [-3.3e38, -2.0e38, -1.0e30, -3.0e38, -2.5e38, -1.5e38]
+
+call omp_set_num_threads(4)
+rmax = -huge(rmax); rmin = huge(rmin); dmax = -huge(dmax)
+n_bad = 0
+!$omp parallel reduction(max:rmax, dmax) reduction(min:rmin) reduction(+:n_bad)
+    if (rmax /= -huge(rmax)) n_bad = n_bad + 1
+    if (rmin /= huge(rmin)) n_bad = n_bad + 1
+    if (dmax /= -huge(dmax)) n_bad = n_bad + 1
+!$omp end parallel
+print *, n_bad, rmax, rmin, dmax
+if (n_bad /= 0) error stop
+if (rmax /= -huge(rmax) .or. rmin /= huge(rmin)) error stop
+
+!$omp parallel do reduction(max:rmax) reduction(min:rmin)
+do i = 1, size(x)
+    rmax = max(rmax, x(i))
+    rmin = min(rmin, -x(i))
+end do
+!$omp end parallel do
+print *, rmax, rmin
+if (rmax /= -1.0e30) error stop
+if (rmin /= 1.0e30) error stop
+end program
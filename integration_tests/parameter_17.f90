@@ -0,0 +1,44 @@
+module parameter_17_mod
+    ! Large constant tables built from other constants
+    implicit none
+    integer, parameter :: n = 1000
+    integer, private :: i
+    integer(8), parameter :: squares(n) = [(int(i, 8)**2, i = 1, n)]
+    integer(8), parameter :: both(2*n + 1) = [squares, -1_8, squares]
+    real(4), parameter :: halves(n) = [(i * 0.5, i = 1, n)]
+    integer(2), parameter :: small(6) = [integer(2) :: 1, 2, 3, 4, 5, 6]
+    integer(2), parameter :: small2(12) = [small, small(6:1:-1)]
+    logical, parameter :: flags(4) = [.true., .false., .true., .false.]
+    logical, parameter :: flags2(9) = [flags, .true., flags]
+end module
+
+program parameter_17
+    use parameter_17_mod
+    implicit none
+    integer :: i
+    real(8) :: table(10)
+    data table / 4*1.5d0, 3*2.5d0, 3*-1.0d0 /
+
+    if (size(both) /= 2*n + 1) error stop
+    if (both(1) /= 1) error stop
+    if (both(n) /= int(n, 8)**2) error stop
+    if (both(n + 1) /= -1) error stop
+    if (both(2*n + 1) /= int(n, 8)**2) error stop
+    if (sum(both) /= 2 * sum(squares) - 1) error stop
+
+    if (abs(halves(n) - n * 0.5) > 1e-6) error stop
+    if (small2(7) /= 6 .or. small2(12) /= 1) error stop
+    if (sum(small2) /= 42) error stop
+
+    if (count(flags2) /= 5) error stop
+    if (.not. flags2(5) .or. flags2(9)) error stop
+
+    do i = 1, 4
+        if (table(i) /= 1.5d0) error stop
+    end do
+    do i = 5, 7
+        if (table(i) /= 2.5d0) error stop
+    end do
+    if (any(table(8:10) /= -1.0d0)) error stop
+    print *, both(n), sum(small2), count(flags2), sum(table)
+end program
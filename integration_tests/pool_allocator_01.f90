@@ -0,0 +1,73 @@
+module pool_allocator_01_mod
+implicit none
+
+contains
+
+    recursive function tree_sum(a, depth) result(s)
+        real(8), intent(in) :: a(:)
+        integer, intent(in) :: depth
+        real(8) :: s
+        if (depth == 0 .or. size(a) < 2) then
+            s = sum(a)
+            return
+        end if
+        ! Both halves go through temporaries while the caller's are live
+        s = tree_sum(a(1:size(a)/2) * 1.0d0, depth - 1) &
+            + tree_sum(a(size(a)/2+1:) * 1.0d0, depth - 1)
+    end function
+
+    subroutine smooth(a, n_iter)
+        real(8), intent(inout) :: a(:)
+        integer, intent(in) :: n_iter
+        integer :: it
+        do it = 1, n_iter
+            a(2:size(a)-1) = (a(1:size(a)-2) + a(2:size(a)-1) + a(3:size(a))) / 3.0d0
+            if (maxval(abs(a)) < 1d-300) return
+        end do
+    end subroutine
+
+    function reversed(a) result(r)
+        real(8), intent(in) :: a(:)
+        real(8), allocatable :: r(:)
+        allocate(r(size(a)))
+        r = a(size(a):1:-1)
+    end function
+
+end module
+
+program pool_allocator_01
+use pool_allocator_01_mod
+implicit none
+
+integer, parameter :: n = 1000
+real(8), allocatable :: a(:), b(:)
+real(8) :: s
+integer :: i
+
+allocate(a(n))
+do i = 1, n
+    a(i) = real(i, 8)
+end do
+
+s = tree_sum(a, 6)
+print *, s
+if (abs(s - real(n, 8) * real(n + 1, 8) / 2.0d0) > 1d-6) error stop
+
+b = a
+call smooth(b, 20)
+print *, b(1), b(n)
+if (abs(b(1) - 1.0d0) > 1d-12 .or. abs(b(n) - real(n, 8)) > 1d-12) error stop
+
+! Allocatable results outlive the procedure that created them
+b = reversed(a) + reversed(reversed(a))
+print *, b(1), b(n)
+if (any(abs(b - real(n + 1, 8)) > 1d-12)) error stop
+
+do i = 1, 100
+    b = reversed(a(1:i)) * 2.0d0
+    if (size(b) /= i) error stop
+    if (abs(b(1) - 2.0d0 * real(i, 8)) > 1d-12) error stop
+end do
+print *, size(b), b(1)
+
+end program
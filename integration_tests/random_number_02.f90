@@ -0,0 +1,66 @@
+program random_number_02
+    ! random_number on contiguous arrays fills them in memory order with the
+    ! numbers that the scalar calls draw, other arrays go element by element
+    implicit none
+    integer :: n, i, j
+    integer, allocatable :: seed(:)
+    real(8) :: a(7), x
+    real(8), allocatable :: m(:, :)
+    real :: s(5), y
+    real(8) :: c(10)
+
+    call random_seed(size=n)
+    allocate(seed(n))
+    seed = 7
+    allocate(m(3, 4))
+
+    call random_seed(put=seed)
+    call random_number(a)
+    call random_seed(put=seed)
+    do i = 1, 7
+        call random_number(x)
+        if (a(i) /= x) error stop
+    end do
+
+    call random_seed(put=seed)
+    call random_number(m)
+    call random_seed(put=seed)
+    do j = 1, 4
+        do i = 1, 3
+            call random_number(x)
+            if (m(i, j) /= x) error stop
+        end do
+    end do
+
+    call random_seed(put=seed)
+    call random_number(s)
+    call random_seed(put=seed)
+    do i = 1, 5
+        call random_number(y)
+        if (s(i) /= y) error stop
+    end do
+
+    ! A strided section is not contiguous
+    c = -1
+    call random_number(c(1:10:2))
+    do i = 1, 10
+        if (mod(i, 2) == 1) then
+            if (c(i) < 0 .or. c(i) >= 1) error stop
+        else
+            if (c(i) /= -1) error stop
+        end if
+    end do
+
+    call fill(a, 7)
+    if (any(a < 0) .or. any(a >= 1)) error stop
+    print *, a(1), m(3, 4), s(5), c(9)
+
+contains
+
+    subroutine fill(v, k)
+        integer, intent(in) :: k
+        real(8), intent(out) :: v(k)
+        call random_number(v(2:k))
+        v(1) = 0.5d0
+    end subroutine
+end program
@@ -0,0 +1,24 @@
+program random_seed_02
+    ! random_seed(get=) returns the current state, so putting it back
+    ! repeats the numbers drawn after the get
+    implicit none
+    integer :: n, i
+    integer, allocatable :: seed(:), state(:)
+    real(8) :: a(1000), b(1000)
+    real :: x(100)
+
+    call random_seed(size=n)
+    allocate(seed(n), state(n))
+    seed = [(i * 7919, i = 1, n)]
+    call random_seed(put=seed)
+    call random_number(x)
+    call random_seed(get=state)
+    call random_number(a)
+    call random_seed(put=state)
+    call random_number(b)
+    if (any(a /= b)) error stop
+    if (any(a < 0) .or. any(a >= 1)) error stop
+    if (any(x < 0) .or. any(x >= 1)) error stop
+    if (abs(sum(a) / size(a) - 0.5d0) > 0.05d0) error stop
+    print *, "ok"
+end program
@@ -0,0 +1,51 @@
+program read_65
+! Reading reals: D and Q exponents, exponents without a letter, blanks in
+! formatted fields, and values that need all 17 digits to round trip
+implicit none
+character(len=80) :: line
+real(8) :: a, b, c, x(3)
+real(4) :: f
+complex(8) :: z
+
+line = "1.5d0, -2.25D+2  3.0q-1"
+read(line, *) a, b, c
+print *, a, b, c
+if (a /= 1.5d0 .or. b /= -225.0d0 .or. abs(c - 0.3d0) > 1d-16) error stop
+
+line = "0.10000000000000001 2.2250738585072014D-308 1.7976931348623157E+308"
+read(line, *) x
+print *, x
+if (x(1) /= 0.1d0) error stop
+if (x(2) /= tiny(1.0d0)) error stop
+if (x(3) /= huge(1.0d0)) error stop
+
+line = "3.4028235E+38"
+read(line, *) f
+if (f /= huge(1.0)) error stop
+line = "0.1"
+read(line, *) f
+if (f /= 0.1) error stop
+
+line = "(1.0d1, -2.5)"
+read(line, *) z
+print *, z
+if (z /= (10.0d0, -2.5d0)) error stop
+
+! Formatted: blanks are ignored by default, BZ makes them zeros
+line = " 1 2.5 "
+read(line, "(F7.2)") a
+if (a /= 12.5d0) error stop
+read(line, "(BZ,F7.2)") a
+if (a /= 102.5d0) error stop
+line = "1.5-3"
+read(line, "(F5.0)") a
+if (abs(a - 1.5d-3) > 1d-18) error stop
+line = "12345"
+read(line, "(F5.2)") a
+if (a /= 123.45d0) error stop
+line = "  123.456D2"
+read(line, "(2PE11.3)") a
+if (a /= 12345.6d0) error stop
+print *, "ok"
+
+end program
@@ -0,0 +1,37 @@
+program read_66
+! List-directed complex reads from a file unit: D exponents, blanks inside
+! the parentheses, and values that need all 17 digits to round trip
+implicit none
+complex(8) :: z, zs(2)
+complex(4) :: c, cs(2)
+integer :: u
+
+open(newunit=u, file="read_66.txt", status="replace", action="write")
+write(u, "(a)") "(1.5d0, -2.25D+2)"
+write(u, "(a)") "( 0.10000000000000001 ,  2.2250738585072014D-308 )"
+write(u, "(a)") "(0.1, 3.4028235E+38)"
+write(u, "(a)") "(1.0d1,-2.5) (-0.5E0, 4)"
+close(u)
+
+open(newunit=u, file="read_66.txt", status="old", action="read")
+read(u, *) z
+print *, z
+if (z /= (1.5d0, -225.0d0)) error stop
+read(u, *) z
+print *, z
+if (real(z) /= 0.1d0 .or. aimag(z) /= tiny(1.0d0)) error stop
+read(u, *) c
+print *, c
+if (real(c) /= 0.1 .or. aimag(c) /= huge(1.0)) error stop
+read(u, *) zs
+print *, zs
+if (zs(1) /= (10.0d0, -2.5d0) .or. zs(2) /= (-0.5d0, 4.0d0)) error stop
+close(u)
+
+open(newunit=u, file="read_66.txt", status="old", action="read")
+read(u, *) cs
+print *, cs
+if (cs(1) /= (1.5, -225.0) .or. real(cs(2)) /= 0.1) error stop
+close(u, status="delete")
+print *, "ok"
+end program
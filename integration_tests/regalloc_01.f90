@@ -0,0 +1,89 @@
+program regalloc_01
+! Register pressure in the x86 backend: more integer locals are live at once
+! than there are registers for them (ebx, esi, edi), so some are spilled,
+! and locals kept in registers are passed by reference and by value
+implicit none
+integer :: a, b, c, d, e, f, g, h, i, s, t
+
+a = 1
+b = 2
+c = 3
+d = 4
+e = 5
+f = 6
+g = 7
+h = 8
+s = 0
+do i = 1, 10
+    s = s + a * i + b + c + d + e + f + g + h
+    a = a + 1
+    h = h - 1
+    if (i > 5) then
+        t = i * 2
+    else
+        t = i
+    end if
+    s = s + t
+end do
+print *, s
+if (s /= 785) error stop
+
+call rotate(a, b, c)
+if (a /= 2) error stop
+if (b /= 3) error stop
+if (c /= 11) error stop
+call bump(d)
+call bump(d)
+if (d /= 6) error stop
+print *, d
+
+s = sum4(a, sum4(b, c, d, e), f, g)
+print *, s
+if (s /= 157) error stop
+s = weighted(a, b, c, d)
+print *, s
+if (s /= 4229) error stop
+print *, a + b + c + d + e + f + g + h + i + t
+
+contains
+
+subroutine rotate(x, y, z)
+integer, intent(inout) :: x, y, z
+integer :: tmp
+tmp = x
+x = y
+y = z
+z = tmp
+end subroutine
+
+subroutine bump(x)
+integer, intent(inout) :: x
+x = x + 1
+end subroutine
+
+integer function sum4(p, q, r, w) result(res)
+integer, intent(in) :: p, q, r, w
+integer :: u, v
+u = p + q
+v = r + w
+res = u * 2 + v * 3 - p
+end function
+
+! Four arguments and five locals, all live in the same loop
+integer function weighted(p, q, r, w) result(res)
+integer, intent(in) :: p, q, r, w
+integer :: k, m1, m2, m3, acc
+acc = 0
+m1 = 1
+m2 = 2
+m3 = 3
+do k = 1, 20
+    acc = acc + p * m1 + q * m2 + r * m3 + w * k
+    m1 = m2
+    m2 = m3
+    m3 = k
+end do
+res = acc
+end function
+
+end program
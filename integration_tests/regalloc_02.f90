@@ -0,0 +1,197 @@
+program regalloc_02
+! Integer workload for register allocation in the x86 backend: loops,
+! recursion, nested calls and arguments passed by reference. Only uses what
+! the x86 backend supports: default integers, IF, DO, DO WHILE, calls and
+! PRINT. Its compile time is compared with LLVM by the lfortran_bench_x86
+! test (WITH_BENCHMARKS), or by hand with
+!     lfortran_bench --x86-only --no-link regalloc_02.f90
+implicit none
+integer :: errors
+
+errors = 0
+if (gcd(1071, 462) /= 21) errors = errors + 1
+if (collatz_steps(27) /= 111) errors = errors + 1
+if (isqrt(1000000) /= 1000) errors = errors + 1
+if (count_primes(1000) /= 168) errors = errors + 1
+if (fib(25) /= 75025) errors = errors + 1
+if (digit_sum(987654321) /= 45) errors = errors + 1
+if (power_mod(3, 200, 1000) /= 1) errors = errors + 1
+if (binomial(20, 10) /= 184756) errors = errors + 1
+if (triangle(1000) /= 500500) errors = errors + 1
+if (reverse_digits(12345) /= 54321) errors = errors + 1
+if (sum_of_divisors(496) /= 992) errors = errors + 1
+if (ackermann(2, 3) /= 9) errors = errors + 1
+call check_swap(errors)
+print *, errors
+if (errors /= 0) error stop
+
+contains
+
+integer function gcd(a, b) result(r)
+integer, intent(in) :: a, b
+integer :: x, y, t
+x = a
+y = b
+do while (y /= 0)
+    t = x - (x / y) * y
+    x = y
+    y = t
+end do
+r = x
+end function
+
+integer function collatz_steps(n) result(r)
+integer, intent(in) :: n
+integer :: m
+m = n
+r = 0
+do while (m /= 1)
+    if (m - (m / 2) * 2 == 0) then
+        m = m / 2
+    else
+        m = 3 * m + 1
+    end if
+    r = r + 1
+end do
+end function
+
+integer function isqrt(n) result(r)
+integer, intent(in) :: n
+integer :: lo, hi, mid
+lo = 0
+hi = n
+do while (lo < hi)
+    mid = (lo + hi + 1) / 2
+    if (mid <= n / mid) then
+        lo = mid
+    else
+        hi = mid - 1
+    end if
+end do
+r = lo
+end function
+
+integer function count_primes(n) result(r)
+integer, intent(in) :: n
+integer :: i, j, prime
+r = 0
+do i = 2, n
+    prime = 1
+    j = 2
+    do while (j * j <= i)
+        if (i - (i / j) * j == 0) then
+            prime = 0
+        end if
+        j = j + 1
+    end do
+    r = r + prime
+end do
+end function
+
+integer recursive function fib(n) result(r)
+integer, intent(in) :: n
+if (n < 2) then
+    r = n
+else
+    r = fib(n - 1) + fib(n - 2)
+end if
+end function
+
+integer function digit_sum(n) result(r)
+integer, intent(in) :: n
+integer :: m
+m = n
+r = 0
+do while (m > 0)
+    r = r + (m - (m / 10) * 10)
+    m = m / 10
+end do
+end function
+
+integer function power_mod(b, e, m) result(r)
+integer, intent(in) :: b, e, m
+integer :: base, ex
+base = b - (b / m) * m
+ex = e
+r = 1
+do while (ex > 0)
+    if (ex - (ex / 2) * 2 == 1) then
+        r = r * base
+        r = r - (r / m) * m
+    end if
+    base = base * base
+    base = base - (base / m) * m
+    ex = ex / 2
+end do
+end function
+
+integer function binomial(n, k) result(r)
+integer, intent(in) :: n, k
+integer :: i
+r = 1
+do i = 1, k
+    r = r * (n - k + i) / i
+end do
+end function
+
+integer function triangle(n) result(r)
+integer, intent(in) :: n
+integer :: i
+r = 0
+do i = 1, n
+    r = r + i
+end do
+end function
+
+integer function reverse_digits(n) result(r)
+integer, intent(in) :: n
+integer :: m
+m = n
+r = 0
+do while (m > 0)
+    r = 10 * r + (m - (m / 10) * 10)
+    m = m / 10
+end do
+end function
+
+integer function sum_of_divisors(n) result(r)
+integer, intent(in) :: n
+integer :: i
+r = 0
+do i = 1, n
+    if (n - (n / i) * i == 0) then
+        r = r + i
+    end if
+end do
+end function
+
+integer recursive function ackermann(m, n) result(r)
+integer, intent(in) :: m, n
+if (m == 0) then
+    r = n + 1
+else if (n == 0) then
+    r = ackermann(m - 1, 1)
+else
+    r = ackermann(m - 1, ackermann(m, n - 1))
+end if
+end function
+
+subroutine swap(a, b)
+integer, intent(inout) :: a, b
+integer :: t
+t = a
+a = b
+b = t
+end subroutine
+
+subroutine check_swap(errors)
+integer, intent(inout) :: errors
+integer :: p, q
+p = 1
+q = 2
+call swap(p, q)
+if (p /= 2) errors = errors + 1
+if (q /= 1) errors = errors + 1
+end subroutine
+
+end program
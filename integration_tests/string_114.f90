@@ -0,0 +1,25 @@
+program string_114
+    ! Concatenation chains, including empty and repeated operands
+    implicit none
+    character(len=3) :: a = "abc"
+    character(len=:), allocatable :: b, c, line
+    integer :: i
+
+    b = ""
+    c = "xy"
+    line = a // b // c // a(2:3) // repeat(c, 3) // "!"
+    if (line /= "abcxybcxyxyxy!") error stop
+    if (len(line) /= 14) error stop
+
+    line = ""
+    do i = 1, 20
+        line = line // "[" // a(1:mod(i, 3) + 1) // "]" // b
+    end do
+    if (len(line) /= 20 * 2 + 6 * 1 + 7 * 2 + 7 * 3) error stop
+    if (line(1:9) /= "[ab][abc]") error stop
+
+    if (repeat(a, 0) /= "") error stop
+    if (len(repeat(a // c, 4)) /= 20) error stop
+    if (repeat(a // c, 4) /= "abcxyabcxyabcxyabcxy") error stop
+    print *, line
+end program
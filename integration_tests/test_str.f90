@@ -18,12 +18,20 @@ program test_str
     r = 2.3
     str =  trim(str) // "World" //_lfortran_str(r) // "--"// _lfortran_str(22.5) 
     print *, str,"|"
-    if(trim(str) /= "HI911World2.300000--22.500000") error stop
+    if(trim(str) /= "HI911World2.3--22.5") error stop
     
     ! --------------------------------------------------------------------------- !
     
     call test(_lfortran_str(112233) ,"112233")
     call test(_lfortran_str(i) ,"11")
+
+    ! Reals give the shortest text that reads back as the same value
+    call test(_lfortran_str(0.1d0), "0.1")
+    call test(_lfortran_str(1.0/3.0), "0.33333334")
+    call test(_lfortran_str(100.0d0), "100.0")
+    call test(_lfortran_str(-1.5d-7), "-1.5e-07")
+    r = 1.0e20
+    call test(_lfortran_str(r), "1e+20")
     
     
     ! --------------------------------------------------------------------------- !
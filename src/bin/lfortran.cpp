@@ -4,6 +4,7 @@
 #include <regex>
 #include <stdlib.h>
 #include <filesystem>
+#include <optional>
 #include <random>
 #ifndef CLI11_HAS_FILESYSTEM
 #define CLI11_HAS_FILESYSTEM 0
@@ -49,6 +50,7 @@
 #include <libasr/config.h>
 #include <lfortran/fortran_kernel.h>
 #include <libasr/string_utils.h>
+#include <libasr/time_trace.h>
 #include <lfortran/utils.h>
 #include <lfortran/parser/parser.tab.hh>
 #include <string>
@@ -421,7 +423,6 @@ int prompt(bool verbose, CompilerOptions &cu)
     std::cout << "    - Editing (Keys: Left, Right, Home, End, Backspace, Delete)" << std::endl;
     std::cout << "    - History (Keys: Up, Down)" << std::endl;
 
-    Allocator al(64*1024*1024);
     cu.interactive = true;
     LCompilers::FortranEvaluator e(cu);
 
@@ -546,6 +547,9 @@ int prompt(bool verbose, CompilerOptions &cu)
             }
             default : throw LCompilers::LCompilersException("Return type not supported");
         }
+        if (cu.time_report) {
+            std::cerr << r.stats() << std::endl;
+        }
     }
     return 0;
 }
@@ -981,10 +985,28 @@ int dump_all_passes(const std::string &infile, CompilerOptions &compiler_options
     return 0;
 }
 
+// Bytes handed out, asked for (only counted with assertions), left at the
+// end of filled chunks and mapped
+std::string allocator_stats(Allocator &al) {
+    auto mb = [](size_t n) { return std::to_string(n / (1024. * 1024)); };
+#if defined(WITH_LFORTRAN_ASSERT)
+    return "Allocator used / requested / wasted / reserved (MB): "
+        + mb(al.size_used()) + " / " + mb(al.size_requested()) + " / "
+        + mb(al.size_wasted()) + " / " + mb(al.size_reserved());
+#else
+    return "Allocator used / wasted / reserved (MB): "
+        + mb(al.size_used()) + " / " + mb(al.size_wasted()) + " / "
+        + mb(al.size_reserved());
+#endif
+}
+
 int save_mod_files(const LCompilers::ASR::TranslationUnit_t &u,
     const LCompilers::CompilerOptions &compiler_options,
     LCompilers::LocationManager lm)
 {
+    // The wrapping TranslationUnit of each module is only needed until its
+    // modfile is written, so one arena is rewound after every module
+    Allocator al(4*1024);
     for (auto &item : u.m_symtab->get_scope()) {
         if (LCompilers::ASR::is_a<LCompilers::ASR::Module_t>(*item.second)) {
             LCompilers::ASR::Module_t *m = LCompilers::ASR::down_cast<LCompilers::ASR::Module_t>(item.second);
@@ -993,7 +1015,7 @@ int save_mod_files(const LCompilers::ASR::TranslationUnit_t &u,
             // from modfiles (as full ASR)
             if (m->m_loaded_from_mod) continue;
 
-            Allocator al(4*1024);
+            Allocator::Checkpoint cp = al.checkpoint();
             LCompilers::SymbolTable *symtab =
                 al.make_new<LCompilers::SymbolTable>(nullptr);
             symtab->add_symbol(std::string(m->m_name), item.second);
@@ -1037,6 +1059,7 @@ int save_mod_files(const LCompilers::ASR::TranslationUnit_t &u,
                     std::ofstream emptyfile_out(emptyfile_fullpath);
                 }
             }
+            al.rewind(cp);
         }
     }
     return 0;
@@ -1156,7 +1179,8 @@ int compile_src_to_object_file(const std::string &infile,
         bool assembly,
         CompilerOptions &compiler_options,
         LCompilers::PassManager& lpm,
-        bool arg_c = false)
+        bool arg_c = false,
+        Allocator *arena = nullptr)
 {
     int time_file_read=0;
     int time_src_to_asr=0;
@@ -1164,12 +1188,22 @@ int compile_src_to_object_file(const std::string &infile,
     int time_opt=0;
     int time_llvm_to_bin=0;
 
+    LCompilers::TimeTraceScope trace(compiler_options.po.time_trace, "Compile",
+        infile);
     auto t1 = std::chrono::high_resolution_clock::now();
-    std::string input = read_file_ok(infile);
+    std::string input;
+    {
+        LCompilers::TimeTraceScope trace(compiler_options.po.time_trace,
+            "Read file", infile);
+        input = read_file_ok(infile);
+    }
     auto t2 = std::chrono::high_resolution_clock::now();
     time_file_read = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
 
-    LCompilers::FortranEvaluator fe(compiler_options);
+    // Everything this file allocates in `arena` is released on return
+    std::optional<Allocator::Scope> arena_scope;
+    if (arena) arena_scope.emplace(*arena);
+    LCompilers::FortranEvaluator fe(compiler_options, arena);
     LCompilers::ASR::TranslationUnit_t* asr;
 
 
@@ -1205,6 +1239,8 @@ int compile_src_to_object_file(const std::string &infile,
 
     // Save .mod files
     {
+        LCompilers::TimeTraceScope trace(compiler_options.po.time_trace,
+            "Save mod files");
         t1 = std::chrono::high_resolution_clock::now();
         int err = save_mod_files(*asr, compiler_options, lm);
         t2 = std::chrono::high_resolution_clock::now();
@@ -1259,6 +1295,8 @@ int compile_src_to_object_file(const std::string &infile,
     if (assembly) {
         e.save_asm_file(*(m->m_m), outfile);
     } else {
+        LCompilers::TimeTraceScope trace(compiler_options.po.time_trace,
+            "Emit object", outfile);
         t1 = std::chrono::high_resolution_clock::now();
         e.save_object_file(*(m->m_m), outfile);
         t2 = std::chrono::high_resolution_clock::now();
@@ -1298,6 +1336,7 @@ int compile_src_to_object_file(const std::string &infile,
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "Allocator chunks: " + std::to_string(fe.get_al().num_chunks());
         compiler_options.po.vector_of_time_report.push_back(message);
+        compiler_options.po.vector_of_time_report.push_back(allocator_stats(fe.get_al()));
         message = "File reading: " + std::to_string(time_file_read / 1000) + "." + std::to_string(time_file_read % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "Src -> ASR:  " + std::to_string(time_src_to_asr / 1000) + "." + std::to_string(time_src_to_asr % 1000) + " ms";
@@ -1446,6 +1485,7 @@ int compile_to_binary_x86(const std::string &infile, const std::string &outfile,
         std::cout << "Allocator usage of last chunk (MB): "
             << al.size_current() / (1024. * 1024) << std::endl;
         std::cout << "Allocator chunks: " << al.num_chunks() << std::endl;
+        std::cout << allocator_stats(al) << std::endl;
         std::cout << std::endl;
         std::cout << "Time report:" << std::endl;
         std::cout << "File reading:" << std::setw(5) << time_file_read << std::endl;
@@ -1547,6 +1587,7 @@ int compile_to_binary_wasm(const std::string &infile, const std::string &outfile
         std::cout << "Allocator usage of last chunk (MB): "
             << al.size_current() / (1024. * 1024) << std::endl;
         std::cout << "Allocator chunks: " << al.num_chunks() << std::endl;
+        std::cout << allocator_stats(al) << std::endl;
         std::cout << std::endl;
         std::cout << "Time report:" << std::endl;
         std::cout << "File reading:" << std::setw(5) << time_file_read << std::endl;
@@ -1827,6 +1868,8 @@ int link_executable(const std::vector<std::string> &infiles,
     const std::vector<std::string> &linker_flags,
     CompilerOptions &compiler_options)
 {
+    LCompilers::TimeTraceScope trace(compiler_options.po.time_trace, "Link",
+        outfile);
     /*
     The `gcc` line for dynamic linking that is constructed below:
 
@@ -2023,6 +2066,22 @@ int link_executable(const std::vector<std::string> &infiles,
                 compile_cmd += extra_linker_flags;
             }
             compile_cmd += " -l" + runtime_lib + " -lm";
+            if (static_executable) {
+                // The static runtime does not carry its dependency on the
+                // threads library (asynchronous I/O writer threads)
+                compile_cmd += " -pthread";
+            }
+            if (compiler_options.profile_generate) {
+                if (CC.find("clang") == std::string::npos) {
+                    std::cerr << "The option `-fprofile-generate` requires "
+                        "the clang linker to link the LLVM profile runtime. "
+                        "Use --linker=clang" << std::endl;
+                    return 10;
+                }
+                // Links `libclang_rt.profile`, which writes the `.profraw`
+                // file when the program exits
+                compile_cmd += " -fprofile-generate";
+            }
             if (compiler_options.openmp && CC.find("clang" ) != std::string::npos) {
                 std::string openmp_shared_library = compiler_options.openmp_lib_dir;
                 std::string omp_cmd =  " -L" + openmp_shared_library + " -Wl,-rpath," + openmp_shared_library + " -lomp";
@@ -2427,6 +2486,14 @@ int main_app(int argc, char *argv[]) {
         return 0;
     }
     compiler_options.po.time_report = compiler_options.time_report;
+    Allocator::default_huge_pages = compiler_options.huge_pages;
+    // The trace is written when main_app returns, whichever way it does
+    std::unique_ptr<LCompilers::TimeTrace> time_trace;
+    if (!compiler_options.time_trace_file.empty()) {
+        time_trace = std::make_unique<LCompilers::TimeTrace>(
+            compiler_options.time_trace_file);
+        compiler_options.po.time_trace = time_trace.get();
+    }
 #ifdef HAVE_INTERNAL_ALLOC_CHECK
     compiler_options.internal_alloc_check = true;
 #endif
@@ -2720,6 +2787,8 @@ int main_app(int argc, char *argv[]) {
     // we need this separate vector to store temporary object files as some object files passed as arguments
     // are considered as it is and we do not want to delete them
     std::vector<std::string> temp_object_files;
+    // Rewound after each file, so that the files reuse the same chunks
+    Allocator arena(1024*1024);
     for (const auto &arg_file : opts.arg_files) {
         int err = 0;
         std::string tmp_o = (std::filesystem::path(LFORTRAN_TEMP_DIR) / std::filesystem::path(arg_file)
@@ -2734,7 +2803,7 @@ int main_app(int argc, char *argv[]) {
             if (backend == Backend::llvm) {
 #ifdef HAVE_LFORTRAN_LLVM
                 err = compile_src_to_object_file(arg_file, tmp_o, compiler_options.time_report, false,
-                    compiler_options, lfortran_pass_manager);
+                    compiler_options, lfortran_pass_manager, false, &arena);
 #else
                 std::cerr << "Compiling Fortran files to object files requires the LLVM backend to be enabled. Recompile with `WITH_LLVM=yes`." << std::endl;
                 return 1;
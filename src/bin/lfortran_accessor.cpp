@@ -20,7 +20,8 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::error_highlight> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
 
         LCompilers::LocationManager lm;
         {
@@ -75,7 +76,8 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
         LCompilers::LocationManager lm;
@@ -133,7 +135,8 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<std::pair<LCompilers::document_symbols, std::string>> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
         std::vector<std::pair<LCompilers::document_symbols, std::string>> symbol_lists;
 
         LCompilers::LocationManager lm;
@@ -196,7 +199,8 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
         LCompilers::LocationManager lm;
@@ -239,7 +243,8 @@ namespace LCompilers::LLanguageServer {
         bool indent_unit
     ) -> LCompilers::Result<std::string> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
         LCompilers::LocationManager lm;
         LCompilers::diag::Diagnostics diagnostics;
         {
@@ -270,7 +275,8 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        Allocator::Scope arena_scope(arena);
+        LCompilers::FortranEvaluator fe(compiler_options, &arena);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
         LCompilers::LocationManager lm;
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include <libasr/alloc.h>
 #include <libasr/exception.h>
 #include <libasr/lsp_interface.h>
 #include <libasr/utils.h>
@@ -95,6 +96,10 @@ namespace LCompilers::LLanguageServer {
         ) -> LCompilers::Result<std::string>;
     private:
         std::mutex mutex;
+        // Shared by the requests, which are serialized by `mutex`, and
+        // rewound after each one, so that a long running server reuses its
+        // chunks instead of mapping new ones for every keystroke
+        Allocator arena{1024*1024};
     };
 
 } // namespace LCompilers::LLanguageServer
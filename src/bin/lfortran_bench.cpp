@@ -0,0 +1,989 @@
+// Offline compiler benchmark.
+//
+// Compiles a corpus of generated and user supplied Fortran files and times
+// every phase of the pipeline separately: tokenizer, parser, semantics, each
+// ASR pass, LLVM code generation, LLVM -> object file and linking. The memory
+// high-water mark of the AST/ASR allocator is reported for every input. The
+// results can be saved as JSON (--json) and compared against a previously
+// saved run (--baseline), in which case the exit code is non-zero if any
+// phase got slower (or used more memory) than the given threshold.
+//
+// Typical use, comparing two builds:
+//
+//     ./lfortran_bench --json base.json                  # old build
+//     ./lfortran_bench --baseline base.json --json new.json  # new build
+//
+// With --semantics-only every input stops after semantic analysis, which
+// isolates the front end when comparing changes to name lookup or to the
+// intrinsic tables.
+//
+// The inputs within the subset of the x86 backend (default integers, IF, DO,
+// DO WHILE, calls and PRINT) are also compiled with it, which adds the phase
+// "x86_codegen" next to the LLVM ones. --x86-only keeps just those inputs and
+// compiles the given files with both backends:
+//
+//     ./lfortran_bench --x86-only --no-link integration_tests/regalloc_02.f90
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <bin/CLI11.hpp>
+#include <libasr/config.h>
+#include <libasr/asr_utils.h>
+#include <libasr/exception.h>
+#include <libasr/stacktrace.h>
+#include <libasr/pass/pass_manager.h>
+#include <libasr/codegen/evaluator.h>
+#include <libasr/codegen/asr_to_x86.h>
+#include <lfortran/parser/parser.h>
+#include <lfortran/fortran_evaluator.h>
+#include <lfortran/utils.h>
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+int64_t microseconds(Clock::time_point t1, Clock::time_point t2) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+}
+
+struct Input {
+    std::string name;
+    std::string filename;
+    std::string source;
+    bool fixed_form = false;
+    bool x86 = false; // also compiled with the x86 backend
+};
+
+struct Measurement {
+    std::string name;
+    size_t bytes = 0;
+    size_t lines = 0;
+    // (phase, microseconds) in pipeline order
+    std::vector<std::pair<std::string, int64_t>> phases;
+    size_t allocator_used = 0;
+    size_t allocator_chunks = 0;
+    size_t allocator_wasted = 0;
+    size_t allocator_reserved = 0;
+    std::string error;
+};
+
+/* ---------------------------------------------------------------------- */
+// Generated corpus
+//
+// Each generator stresses one part of the compiler and scales linearly with
+// `n`, so that a change in the asymptotic behaviour shows up as a regression.
+
+// Many small procedures: parser and symbol table throughput
+std::string gen_procedures(int n) {
+    std::string s = "module bench_procedures\nimplicit none\ncontains\n";
+    for (int i = 0; i < n; i++) {
+        std::string k = std::to_string(i);
+        s += "subroutine g" + k + "(x)\n"
+            "    integer, intent(out) :: x\n"
+            "    integer :: i\n"
+            "    x = " + k + "\n"
+            "    do i = 1, 10\n"
+            "        x = x*i + mod(i, 3)\n"
+            "    end do\n"
+            "end subroutine\n\n";
+    }
+    s += "end module\n\nprogram bench_procedures_main\n"
+        "use bench_procedures\nimplicit none\ninteger :: x, s\ns = 0\n";
+    for (int i = 0; i < n; i++) {
+        s += "call g" + std::to_string(i) + "(x); s = s + x\n";
+    }
+    s += "print *, s\nend program\n";
+    return s;
+}
+
+// Long arithmetic expressions: expression trees, type checking and folding
+std::string gen_expressions(int n) {
+    const char *terms[] = {
+        "(a + 1.5d0*b) * (c - a) / (1 + b**2)",
+        "sin(a) * cos(b) - sqrt(abs(c) + 1)",
+        "max(a, b, c) - min(a, 2*b) + exp(-a*a)",
+        "(a - b)**2 / (1 + c*c) + log(1 + abs(b))",
+        "real(int(a*10) + mod(int(b*7), 5), 8) * 0.25d0",
+    };
+    std::string s = "module bench_expressions\nimplicit none\ncontains\n";
+    for (int i = 0; i < n; i++) {
+        std::string k = std::to_string(i);
+        s += "real(8) function f" + k + "(a, b, c) result(r)\n"
+            "    real(8), intent(in) :: a, b, c\n"
+            "    r = " + k + " * 1.0d-3";
+        for (int j = 0; j < 20; j++) {
+            s += (j % 2 ? " &\n        - " : " &\n        + ");
+            s += terms[(i + j) % 5];
+        }
+        s += "\n    if (r > 10) then\n        r = r - 10\n    else\n"
+            "        r = r * 0.5d0\n    end if\nend function\n\n";
+    }
+    s += "end module\n\nprogram bench_expressions_main\n"
+        "use bench_expressions\nimplicit none\nreal(8) :: s\ns = 0\n";
+    for (int i = 0; i < n; i++) {
+        s += "s = s + f" + std::to_string(i) + "(0.5d0, 1.5d0, -2.0d0)\n";
+    }
+    s += "print *, s\nend program\n";
+    return s;
+}
+
+// A chain of modules with derived types, each using the previous one:
+// module import, symbol resolution and derived type handling
+std::string gen_modules(int n) {
+    std::string s;
+    for (int i = 0; i < n; i++) {
+        std::string k = std::to_string(i);
+        s += "module bench_m" + k + "\n";
+        if (i > 0) s += "use bench_m" + std::to_string(i - 1) + "\n";
+        s += "implicit none\n"
+            "type :: t" + k + "\n"
+            "    integer :: a\n"
+            "    real(8) :: b(4)\n"
+            "end type\n"
+            "contains\n"
+            "function make" + k + "(a) result(r)\n"
+            "    integer, intent(in) :: a\n"
+            "    type(t" + k + ") :: r\n";
+        if (i > 0) {
+            std::string p = std::to_string(i - 1);
+            s += "    type(t" + p + ") :: prev\n"
+                "    prev = make" + p + "(a - 1)\n"
+                "    r%a = a + prev%a\n";
+        } else {
+            s += "    r%a = a\n";
+        }
+        s += "    r%b = a * 0.5d0\n"
+            "end function\nend module\n\n";
+    }
+    std::string last = std::to_string(n - 1);
+    s += "program bench_modules_main\nuse bench_m" + last + "\nimplicit none\n"
+        "type(t" + last + ") :: x\n"
+        "x = make" + last + "(3)\n"
+        "print *, x%a, sum(x%b)\nend program\n";
+    return s;
+}
+
+// Large constant tables: compile time evaluation and constant emission
+std::string gen_array_constants(int n) {
+    std::string k = std::to_string(n);
+    return "module bench_array_constants\nimplicit none\n"
+        "integer, parameter :: n = " + k + "\n"
+        "integer, private :: i\n"
+        "real(8), parameter :: coeffs(n) = [(1.0d0 / i, i = 1, n)]\n"
+        "integer, parameter :: ids(n) = [(i, i = 1, n)]\n"
+        "integer, parameter :: ids3(3*n) = [ids, ids, ids]\n"
+        "end module\n\n"
+        "program bench_array_constants_main\n"
+        "use bench_array_constants\nimplicit none\n"
+        "print *, ids3(2*n + 5), sum(coeffs(1:4))\nend program\n";
+}
+
+// Many intrinsic calls on arrays: intrinsic lookup and the array passes
+std::string gen_intrinsics(int n) {
+    const char *calls[] = {
+        "sum(x * %c) + maxval(y)",
+        "dot_product(x, y) - minval(x + %c)",
+        "sqrt(abs(sum(y))) + real(count(x > %c), 8)",
+        "maxval(abs(x - y)) * %c",
+        "sum(sin(x) * cos(y)) + size(x)",
+        "real(maxloc(x, 1) + minloc(y, 1), 8) / %c",
+    };
+    std::string s = "program bench_intrinsics\nimplicit none\n"
+        "real(8) :: x(100), y(100), s\ninteger :: i\n"
+        "x = [(i * 0.5d0, i = 1, 100)]\n"
+        "y = [(1.0d0 / i, i = 1, 100)]\n"
+        "s = 0\n";
+    for (int i = 0; i < n; i++) {
+        std::string c = std::to_string(i % 97 + 1) + ".5d0";
+        std::string call = calls[i % 6];
+        size_t pos = call.find("%c");
+        if (pos != std::string::npos) call.replace(pos, 2, c);
+        s += "s = s + " + call + "\n";
+    }
+    s += "print *, s\nend program\n";
+    return s;
+}
+
+// Procedures full of calls to scalar intrinsics and to each other: name
+// resolution in semantics (intrinsic tables, compile time evaluation lookups
+// and user symbols), with little work left for the passes
+std::string gen_name_resolution(int n) {
+    std::string s = "module bench_names\nimplicit none\ncontains\n";
+    for (int i = 0; i < n; i++) {
+        std::string k = std::to_string(i);
+        s += "integer function h" + k + "(i, x, c) result(r)\n"
+            "    integer, intent(in) :: i\n"
+            "    real(8), intent(in) :: x\n"
+            "    character(len=*), intent(in) :: c\n"
+            "    r = abs(i) + sign(i, -3) + mod(i, 7) + modulo(i, 5) &\n"
+            "        + max(i, 2, 3) + min(i, 4) + nint(x) + floor(x) &\n"
+            "        + ceiling(x) + int(aint(x)) + int(dim(x, 1d0)) &\n"
+            "        + iand(i, 255) + ior(i, 16) + ieor(i, 3) + ishft(i, 2) &\n"
+            "        + popcnt(i) + len_trim(c) + index(c, \"b\") &\n"
+            "        + scan(c, \"xy\") + verify(c, \"ab\") &\n"
+            "        + merge(1, 0, btest(i, 1)) + kind(x) + digits(x) + range(x)\n";
+        if (i > 0) {
+            s += "    r = r + h" + std::to_string(i - 1) + "(i - 1, x, c)\n";
+        }
+        s += "end function\n\n";
+    }
+    std::string last = std::to_string(n - 1);
+    s += "end module\n\nprogram bench_names_main\nuse bench_names\n"
+        "implicit none\nprint *, h" + last + "(3, 2.5d0, \"abc\")\n"
+        "end program\n";
+    return s;
+}
+
+// Integer procedures with loops, branches and calls, with more variables
+// live at once than the x86 backend has registers for: code generation and
+// register allocation of the x86 backend against LLVM
+std::string gen_x86_integers(int n) {
+    std::string s = "program bench_x86_integers\nimplicit none\n"
+        "integer :: s\ns = 0\n";
+    for (int i = 0; i < n; i++) {
+        s += "s = s + k" + std::to_string(i) + "(" + std::to_string(i % 50)
+            + ", 7)\n";
+    }
+    s += "print *, s\ncontains\n\n";
+    for (int i = 0; i < n; i++) {
+        std::string k = std::to_string(i);
+        s += "integer function k" + k + "(a, b) result(r)\n"
+            "    integer, intent(in) :: a, b\n"
+            "    integer :: i, j, t, u\n"
+            "    r = 0\n"
+            "    t = a\n"
+            "    do i = 1, 10\n"
+            "        u = b + i\n"
+            "        j = i * t - u\n"
+            "        if (j > r) then\n"
+            "            r = j\n"
+            "        else\n"
+            "            r = r - i\n"
+            "        end if\n"
+            "        do while (u > 1)\n"
+            "            u = u / 2\n"
+            "            t = t + u - a\n"
+            "        end do\n"
+            "    end do\n";
+        if (i > 0) {
+            s += "    if (a > 0) r = r + k" + std::to_string(i - 1)
+                + "(a - 1, b)\n";
+        }
+        s += "end function\n\n";
+    }
+    s += "end program\n";
+    return s;
+}
+
+std::vector<Input> generated_corpus(int scale) {
+    std::vector<Input> corpus;
+    auto add = [&](const std::string &name, std::string source,
+            bool x86=false) {
+        Input in;
+        in.name = "gen/" + name;
+        in.filename = name + ".f90";
+        in.source = std::move(source);
+        in.x86 = x86;
+        corpus.push_back(std::move(in));
+    };
+    add("procedures", gen_procedures(2000 * scale));
+    add("expressions", gen_expressions(300 * scale));
+    add("modules", gen_modules(100 * scale));
+    add("array_constants", gen_array_constants(100000 * scale));
+    add("intrinsics", gen_intrinsics(1000 * scale));
+    add("name_resolution", gen_name_resolution(1000 * scale));
+    add("x86_integers", gen_x86_integers(1000 * scale), true);
+    return corpus;
+}
+
+bool is_fortran_file(const std::filesystem::path &p) {
+    static const std::vector<std::string> exts = {
+        ".f90", ".F90", ".f95", ".f03", ".f08", ".f", ".F", ".for"};
+    return std::find(exts.begin(), exts.end(), p.extension().string())
+        != exts.end();
+}
+
+void add_file(std::vector<Input> &corpus, const std::filesystem::path &p,
+        bool x86) {
+    std::ifstream f(p, std::ios::binary);
+    if (!f) throw std::runtime_error("Cannot read '" + p.string() + "'");
+    std::stringstream ss;
+    ss << f.rdbuf();
+    Input in;
+    in.name = p.string();
+    in.filename = p.string();
+    in.source = ss.str();
+    std::string ext = p.extension().string();
+    in.fixed_form = (ext == ".f" || ext == ".F" || ext == ".for");
+    in.x86 = x86;
+    corpus.push_back(std::move(in));
+}
+
+// Files are taken as they are, directories are searched recursively for
+// Fortran sources. Every file must compile on its own.
+void add_user_inputs(std::vector<Input> &corpus,
+        const std::vector<std::string> &paths, bool x86) {
+    for (auto &path : paths) {
+        std::filesystem::path p(path);
+        if (std::filesystem::is_directory(p)) {
+            std::vector<std::filesystem::path> files;
+            for (auto &e : std::filesystem::recursive_directory_iterator(p)) {
+                if (e.is_regular_file() && is_fortran_file(e.path())) {
+                    files.push_back(e.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+            for (auto &f : files) add_file(corpus, f, x86);
+        } else {
+            add_file(corpus, p, x86);
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+// Measurement
+
+struct Options {
+    bool link = true;
+    bool fast = false;
+    bool semantics_only = false;
+    std::string tmp_dir;
+    std::string runtime_library_dir;
+};
+
+std::string link_command(const std::string &obj, const std::string &exe,
+        const std::string &rtlib_dir) {
+    // Same linker selection as `lfortran`
+    std::string CC;
+    if (char *env_path = std::getenv("LFORTRAN_LINKER_PATH")) {
+        CC = env_path;
+        if (!CC.empty() && CC.back() != '/') CC += "/";
+    }
+    if (char *env_linker = std::getenv("LFORTRAN_LINKER")) {
+        CC += env_linker;
+    } else {
+        CC += "clang";
+    }
+    std::string base_path = "\"" + rtlib_dir + "\"";
+    return CC + " -o \"" + exe + "\" \"" + obj + "\" -L" + base_path
+        + " -Wl,-rpath," + base_path + " -llfortran_runtime -lm";
+}
+
+void record_allocator(Allocator &al, Measurement &m) {
+    m.allocator_used = al.size_used();
+    m.allocator_chunks = al.num_chunks();
+    m.allocator_wasted = al.size_wasted();
+    m.allocator_reserved = al.size_reserved();
+}
+
+// Compiles `in` once, appending the phase timings to `m`. Returns false
+// (with `m.error` set) if the input does not compile.
+bool compile_once(const Input &in, const Options &opts, Measurement &m) {
+    LCompilers::CompilerOptions co;
+    co.fixed_form = in.fixed_form;
+    co.time_report = true;
+    co.po.time_report = true;
+    co.po.fast = opts.fast;
+    co.po.runtime_library_dir = opts.runtime_library_dir;
+
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = in.filename;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(in.source.size());
+    }
+    LCompilers::diag::Diagnostics diagnostics;
+    auto fail = [&](const std::string &phase) {
+        m.error = phase + " failed";
+        std::string msg = diagnostics.render(lm, co);
+        if (!msg.empty()) m.error += ":\n" + msg;
+        return false;
+    };
+    auto add_phase = [&](const std::string &name, int64_t us) {
+        // Some passes run more than once, keep the names unique
+        std::string key = name;
+        int count = 1;
+        while (std::any_of(m.phases.begin(), m.phases.end(),
+                [&](const auto &p) { return p.first == key; })) {
+            key = name + "#" + std::to_string(++count);
+        }
+        m.phases.push_back({key, us});
+    };
+
+    // The parser runs its own tokenizer, so "parser" includes this time
+    if (!in.fixed_form) {
+        Allocator al(1024*1024);
+        auto t1 = Clock::now();
+        auto r = LCompilers::LFortran::tokens(al, in.source, diagnostics,
+            nullptr, nullptr, false);
+        auto t2 = Clock::now();
+        if (!r.ok) return fail("tokenizer");
+        add_phase("tokenizer", microseconds(t1, t2));
+    }
+
+    LCompilers::FortranEvaluator fe(co);
+    auto t1 = Clock::now();
+    auto ast = fe.get_ast2(in.source, lm, diagnostics);
+    auto t2 = Clock::now();
+    if (!ast.ok) return fail("parser");
+    add_phase("parser", microseconds(t1, t2));
+
+    t1 = Clock::now();
+    auto asr = fe.get_asr3(*ast.result, diagnostics, lm);
+    t2 = Clock::now();
+    if (!asr.ok) return fail("semantics");
+    add_phase("semantics", microseconds(t1, t2));
+    if (opts.semantics_only) {
+        record_allocator(fe.get_al(), m);
+        return true;
+    }
+
+    std::string base = (std::filesystem::path(opts.tmp_dir)
+        / std::filesystem::path(in.filename).stem()).string();
+    if (in.x86) {
+        // The backends run their passes on the ASR in place, so the x86
+        // backend gets its own from a second front end run (not timed)
+        LCompilers::FortranEvaluator fe_x86(co);
+        LCompilers::LocationManager lm_x86 = lm;
+        auto ast_x86 = fe_x86.get_ast2(in.source, lm_x86, diagnostics);
+        if (!ast_x86.ok) return fail("parser");
+        auto asr_x86 = fe_x86.get_asr3(*ast_x86.result, diagnostics, lm_x86);
+        if (!asr_x86.ok) return fail("semantics");
+        // Includes the passes it runs and writing the executable, like
+        // the LLVM phases include the passes and writing the object file
+        t1 = Clock::now();
+        auto x86 = LCompilers::asr_to_x86(*asr_x86.result, fe_x86.get_al(),
+            base + ".x86", false, diagnostics);
+        t2 = Clock::now();
+        if (!x86.ok) return fail("x86 code generation");
+        add_phase("x86_codegen", microseconds(t1, t2));
+    }
+
+    LCompilers::PassManager lpm;
+    lpm.use_default_passes();
+    co.po.pass_times.clear();
+#ifdef HAVE_LFORTRAN_LLVM
+    // The ASR passes run inside the LLVM backend, the code generation time
+    // is what remains after subtracting them
+    int time_opt = 0;
+    t1 = Clock::now();
+    auto llvm = fe.get_llvm3(*asr.result, lpm, diagnostics, lm, in.filename,
+        &time_opt);
+    t2 = Clock::now();
+    if (!llvm.ok) return fail("LLVM code generation");
+    int64_t time_passes = 0;
+    for (auto &p : co.po.pass_times) {
+        add_phase("pass:" + p.first, p.second);
+        time_passes += p.second;
+    }
+    add_phase("llvm_codegen", microseconds(t1, t2) - time_passes - time_opt);
+    if (opts.fast) add_phase("llvm_opt", time_opt);
+
+    std::string obj = base + ".o";
+    LCompilers::LLVMEvaluator e(co.target);
+    t1 = Clock::now();
+    e.save_object_file(*llvm.result->m_m, obj);
+    t2 = Clock::now();
+    add_phase("llvm_to_object", microseconds(t1, t2));
+
+#ifndef _WIN32
+    if (opts.link && LCompilers::ASRUtils::main_program_present(*asr.result)) {
+        std::string cmd = link_command(obj, base + ".out",
+            opts.runtime_library_dir);
+        t1 = Clock::now();
+        int err = system(cmd.c_str());
+        t2 = Clock::now();
+        if (err) {
+            m.error = "The command '" + cmd + "' failed.";
+            return false;
+        }
+        add_phase("link", microseconds(t1, t2));
+    }
+#endif
+#else
+    t1 = Clock::now();
+    lpm.apply_passes(fe.get_al(), asr.result, co.po, diagnostics);
+    t2 = Clock::now();
+    for (auto &p : co.po.pass_times) add_phase("pass:" + p.first, p.second);
+#endif
+
+    record_allocator(fe.get_al(), m);
+    return true;
+}
+
+// Compiles `in` `repeat` times and keeps the fastest time of every phase
+Measurement measure(const Input &in, const Options &opts, int repeat) {
+    Measurement best;
+    best.name = in.name;
+    best.bytes = in.source.size();
+    best.lines = std::count(in.source.begin(), in.source.end(), '\n');
+    for (int i = 0; i < repeat; i++) {
+        Measurement m;
+        bool ok;
+        try {
+            ok = compile_once(in, opts, m);
+        } catch (const LCompilers::LCompilersException &e) {
+            m.error = e.name() + ": " + e.msg();
+            ok = false;
+        }
+        if (!ok) {
+            best.error = m.error;
+            return best;
+        }
+        if (i == 0) {
+            best.phases = m.phases;
+        } else {
+            for (auto &p : m.phases) {
+                for (auto &b : best.phases) {
+                    if (b.first == p.first) b.second = std::min(b.second, p.second);
+                }
+            }
+        }
+        best.allocator_used = m.allocator_used;
+        best.allocator_chunks = m.allocator_chunks;
+        best.allocator_wasted = m.allocator_wasted;
+        best.allocator_reserved = m.allocator_reserved;
+    }
+    return best;
+}
+
+long peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+// JSON output and baseline comparison
+
+std::string json_string(const std::string &s) {
+    std::string r = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"': r += "\\\""; break;
+            case '\\': r += "\\\\"; break;
+            case '\n': r += "\\n"; break;
+            case '\t': r += "\\t"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    r += buf;
+                } else {
+                    r += c;
+                }
+        }
+    }
+    return r + "\"";
+}
+
+std::string to_json(const std::vector<Measurement> &results, int repeat,
+        bool fast) {
+    std::stringstream out;
+    out << "{\n";
+    out << "  \"lfortran_version\": " << json_string(LFORTRAN_VERSION) << ",\n";
+    out << "  \"repeat\": " << repeat << ",\n";
+    out << "  \"fast\": " << (fast ? "true" : "false") << ",\n";
+    out << "  \"time_unit\": \"us\",\n";
+    out << "  \"peak_rss_kb\": " << peak_rss_kb() << ",\n";
+    out << "  \"inputs\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Measurement &m = results[i];
+        out << (i ? ",\n" : "\n") << "    {\n";
+        out << "      \"name\": " << json_string(m.name) << ",\n";
+        out << "      \"bytes\": " << m.bytes << ",\n";
+        out << "      \"lines\": " << m.lines << ",\n";
+        if (!m.error.empty()) {
+            out << "      \"error\": " << json_string(m.error) << "\n    }";
+            continue;
+        }
+        out << "      \"phases\": {";
+        for (size_t j = 0; j < m.phases.size(); j++) {
+            out << (j ? ",\n" : "\n") << "        "
+                << json_string(m.phases[j].first) << ": " << m.phases[j].second;
+        }
+        out << "\n      },\n";
+        out << "      \"memory\": {\n";
+        out << "        \"allocator_used\": " << m.allocator_used << ",\n";
+        out << "        \"allocator_chunks\": " << m.allocator_chunks << ",\n";
+        out << "        \"allocator_wasted\": " << m.allocator_wasted << ",\n";
+        out << "        \"allocator_reserved\": " << m.allocator_reserved << "\n";
+        out << "      }\n    }";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+// Just enough of a JSON reader for the files written by `to_json`
+struct JSONValue {
+    enum class Kind { Null, Bool, Number, String, Array, Object } kind = Kind::Null;
+    double number = 0;
+    std::string str;
+    std::vector<JSONValue> array;
+    std::vector<std::pair<std::string, JSONValue>> object;
+
+    const JSONValue *get(const std::string &key) const {
+        for (auto &kv : object) {
+            if (kv.first == key) return &kv.second;
+        }
+        return nullptr;
+    }
+};
+
+class JSONReader {
+    const std::string &s;
+    size_t pos = 0;
+
+    [[noreturn]] void error(const std::string &msg) {
+        throw std::runtime_error("Baseline JSON: " + msg + " at offset "
+            + std::to_string(pos));
+    }
+    void skip_ws() {
+        while (pos < s.size() && isspace((unsigned char)s[pos])) pos++;
+    }
+    void expect(char c) {
+        skip_ws();
+        if (pos >= s.size() || s[pos] != c) error(std::string("expected '") + c + "'");
+        pos++;
+    }
+    bool consume(const char *word) {
+        size_t n = strlen(word);
+        if (s.compare(pos, n, word) != 0) return false;
+        pos += n;
+        return true;
+    }
+    std::string parse_string() {
+        expect('"');
+        std::string r;
+        while (pos < s.size() && s[pos] != '"') {
+            char c = s[pos++];
+            if (c == '\\') {
+                if (pos >= s.size()) break;
+                c = s[pos++];
+                switch (c) {
+                    case 'n': r += '\n'; break;
+                    case 't': r += '\t'; break;
+                    case 'r': r += '\r'; break;
+                    case 'b': r += '\b'; break;
+                    case 'f': r += '\f'; break;
+                    case 'u':
+                        if (pos + 4 > s.size()) error("bad escape");
+                        r += (char)std::stoi(s.substr(pos, 4), nullptr, 16);
+                        pos += 4;
+                        break;
+                    default: r += c;
+                }
+            } else {
+                r += c;
+            }
+        }
+        expect('"');
+        return r;
+    }
+
+public:
+    JSONReader(const std::string &s) : s{s} {}
+
+    JSONValue parse() {
+        JSONValue v;
+        skip_ws();
+        if (pos >= s.size()) error("unexpected end");
+        char c = s[pos];
+        if (c == '{') {
+            v.kind = JSONValue::Kind::Object;
+            pos++;
+            skip_ws();
+            if (s[pos] == '}') { pos++; return v; }
+            while (true) {
+                std::string key = parse_string();
+                expect(':');
+                v.object.push_back({key, parse()});
+                skip_ws();
+                if (pos < s.size() && s[pos] == ',') { pos++; continue; }
+                expect('}');
+                return v;
+            }
+        } else if (c == '[') {
+            v.kind = JSONValue::Kind::Array;
+            pos++;
+            skip_ws();
+            if (s[pos] == ']') { pos++; return v; }
+            while (true) {
+                v.array.push_back(parse());
+                skip_ws();
+                if (pos < s.size() && s[pos] == ',') { pos++; continue; }
+                expect(']');
+                return v;
+            }
+        } else if (c == '"') {
+            v.kind = JSONValue::Kind::String;
+            v.str = parse_string();
+        } else if (consume("true")) {
+            v.kind = JSONValue::Kind::Bool;
+            v.number = 1;
+        } else if (consume("false")) {
+            v.kind = JSONValue::Kind::Bool;
+        } else if (consume("null")) {
+        } else {
+            size_t end;
+            try {
+                v.number = std::stod(s.substr(pos, 32), &end);
+            } catch (const std::exception &) {
+                error("unexpected character");
+            }
+            v.kind = JSONValue::Kind::Number;
+            pos += end;
+        }
+        return v;
+    }
+};
+
+struct Thresholds {
+    double percent;
+    double min_time_us;
+    double min_bytes;
+};
+
+// Prints every metric that changed by more than the thresholds and returns
+// the number of regressions
+int compare_to_baseline(const std::vector<Measurement> &results,
+        const JSONValue &baseline, const Thresholds &th) {
+    std::map<std::string, const JSONValue*> base_inputs;
+    if (const JSONValue *inputs = baseline.get("inputs")) {
+        for (auto &in : inputs->array) {
+            const JSONValue *name = in.get("name");
+            if (name) base_inputs[name->str] = &in;
+        }
+    }
+
+    int regressions = 0;
+    auto check = [&](const std::string &input, const std::string &metric,
+            double base, double current, double min_abs, const char *unit) {
+        double diff = current - base;
+        if (std::abs(diff) < min_abs || base <= 0) return;
+        double percent = 100 * diff / base;
+        if (std::abs(percent) < th.percent) return;
+        bool regression = diff > 0;
+        if (regression) regressions++;
+        std::cout << (regression ? "REGRESSION " : "improved   ")
+            << input << " " << metric << ": " << std::fixed
+            << std::setprecision(3) << base << " -> " << current << " "
+            << unit << " (" << std::showpos << std::setprecision(1)
+            << percent << std::noshowpos << "%)" << std::endl;
+    };
+
+    std::cout << "Comparison with the baseline (threshold " << th.percent
+        << "%):" << std::endl;
+    for (auto &m : results) {
+        auto it = base_inputs.find(m.name);
+        if (it == base_inputs.end()) {
+            std::cout << "new        " << m.name << std::endl;
+            continue;
+        }
+        const JSONValue &base = *it->second;
+        if (!m.error.empty()) {
+            if (!base.get("error")) {
+                std::cout << "REGRESSION " << m.name << ": fails to compile"
+                    << std::endl;
+                regressions++;
+            }
+            continue;
+        }
+        if (const JSONValue *phases = base.get("phases")) {
+            for (auto &p : m.phases) {
+                const JSONValue *b = phases->get(p.first);
+                if (!b) continue;
+                check(m.name, p.first, b->number / 1000., p.second / 1000.,
+                    th.min_time_us / 1000., "ms");
+            }
+        }
+        if (const JSONValue *memory = base.get("memory")) {
+            if (const JSONValue *b = memory->get("allocator_used")) {
+                check(m.name, "allocator_used", b->number / (1024. * 1024),
+                    m.allocator_used / (1024. * 1024),
+                    th.min_bytes / (1024. * 1024), "MB");
+            }
+        }
+    }
+    std::cout << regressions << " regression(s)" << std::endl;
+    return regressions;
+}
+
+void print_measurement(const Measurement &m) {
+    std::cout << m.name << " (" << m.bytes << " bytes, " << m.lines
+        << " lines)" << std::endl;
+    if (!m.error.empty()) {
+        std::cout << "  error: " << m.error << std::endl;
+        return;
+    }
+    // The total is that of the LLVM pipeline; the x86 backend replaces the
+    // phases after semantics
+    int64_t total = 0, x86 = 0, llvm = 0;
+    bool after_semantics = false;
+    for (auto &p : m.phases) {
+        std::cout << "  " << std::left << std::setw(40) << p.first << std::right
+            << std::fixed << std::setprecision(3) << std::setw(12)
+            << p.second / 1000. << " ms" << std::endl;
+        if (p.first == "x86_codegen") {
+            x86 = p.second;
+            continue;
+        }
+        total += p.second;
+        if (after_semantics && p.first != "link") llvm += p.second;
+        if (p.first == "semantics") after_semantics = true;
+    }
+    std::cout << "  " << std::left << std::setw(40) << "total" << std::right
+        << std::setw(12) << total / 1000. << " ms" << std::endl;
+    if (x86 > 0 && llvm > 0) {
+        std::cout << "  x86 backend " << x86 / 1000. << " ms, LLVM backend "
+            << llvm / 1000. << " ms (" << std::setprecision(1)
+            << (double)llvm / x86 << "x)" << std::endl;
+    }
+    std::cout << "  allocator: " << std::setprecision(2)
+        << m.allocator_used / (1024. * 1024) << " MB in "
+        << m.allocator_chunks << " chunk(s), "
+        << m.allocator_wasted / (1024. * 1024) << " MB wasted, "
+        << m.allocator_reserved / (1024. * 1024) << " MB reserved" << std::endl;
+}
+
+int main_app(int argc, char *argv[]) {
+    int dirname_length;
+    LCompilers::LFortran::get_executable_path(LCompilers::binary_executable_path,
+        dirname_length);
+    LCompilers::LFortran::set_exec_path_and_mode(
+        LCompilers::binary_executable_path, dirname_length);
+
+    std::vector<std::string> paths;
+    bool no_generated = false;
+    int scale = 1;
+    int repeat = 3;
+    std::string json_file;
+    std::string baseline_file;
+    std::string corpus_dir;
+    Thresholds th{10, 1000, 64 * 1024};
+    double min_delta_ms = 1;
+    Options opts;
+    bool no_link = false;
+    bool x86_only = false;
+
+    CLI::App app{"LFortran compiler benchmark"};
+    app.add_option("inputs", paths, "Fortran files or directories to benchmark in addition to the generated corpus");
+    app.add_flag("--no-generated", no_generated, "Do not benchmark the generated corpus");
+    app.add_option("--scale", scale, "Size multiplier of the generated corpus")->capture_default_str();
+    app.add_option("--repeat", repeat, "Compile every input this many times and keep the fastest time of each phase")->capture_default_str();
+    app.add_option("--json", json_file, "Save the results to this JSON file");
+    app.add_option("--baseline", baseline_file, "Compare the results to this JSON file and exit with 1 on regressions");
+    app.add_option("--threshold", th.percent, "Relative change (in %) reported as a regression")->capture_default_str();
+    app.add_option("--min-delta", min_delta_ms, "Ignore time changes smaller than this (in ms)")->capture_default_str();
+    app.add_option("--write-corpus", corpus_dir, "Write the generated corpus into this directory");
+    app.add_flag("--fast", opts.fast, "Run the LLVM optimizer and time it");
+    app.add_flag("--no-link", no_link, "Do not time linking");
+    app.add_flag("--semantics-only", opts.semantics_only, "Stop after semantics, to time the front end alone");
+    app.add_flag("--x86-only", x86_only, "Only benchmark the inputs the x86 backend supports, and compile the given files with it too");
+    CLI11_PARSE(app, argc, argv);
+
+    th.min_time_us = min_delta_ms * 1000;
+    opts.link = !no_link;
+    opts.runtime_library_dir = LCompilers::LFortran::get_runtime_library_dir();
+    if (repeat < 1) repeat = 1;
+    if (scale < 1) scale = 1;
+
+    JSONValue baseline;
+    if (!baseline_file.empty()) {
+        std::ifstream f(baseline_file);
+        if (!f) {
+            std::cerr << "Cannot read '" << baseline_file << "'" << std::endl;
+            return 2;
+        }
+        std::stringstream ss;
+        ss << f.rdbuf();
+        std::string text = ss.str();
+        baseline = JSONReader(text).parse();
+    }
+
+    std::vector<Input> corpus;
+    if (!no_generated) corpus = generated_corpus(scale);
+    if (x86_only) {
+        corpus.erase(std::remove_if(corpus.begin(), corpus.end(),
+            [](const Input &in) { return !in.x86; }), corpus.end());
+    }
+    if (!corpus_dir.empty()) {
+        std::filesystem::create_directories(corpus_dir);
+        for (auto &in : corpus) {
+            std::ofstream out(std::filesystem::path(corpus_dir) / in.filename);
+            out << in.source;
+        }
+    }
+    add_user_inputs(corpus, paths, x86_only);
+    if (corpus.empty()) {
+        std::cerr << "Nothing to benchmark" << std::endl;
+        return 2;
+    }
+
+    std::filesystem::path tmp = std::filesystem::temp_directory_path()
+        / ("lfortran_bench_" + std::to_string(
+            Clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(tmp);
+    opts.tmp_dir = tmp.string();
+
+    std::vector<Measurement> results;
+    for (auto &in : corpus) {
+        results.push_back(measure(in, opts, repeat));
+        print_measurement(results.back());
+    }
+    std::filesystem::remove_all(tmp);
+    std::cout << "Peak RSS: " << peak_rss_kb() / 1024. << " MB" << std::endl;
+
+    if (!json_file.empty()) {
+        std::ofstream out(json_file);
+        out << to_json(results, repeat, opts.fast);
+    }
+
+    int errors = std::count_if(results.begin(), results.end(),
+        [](const Measurement &m) { return !m.error.empty(); });
+    if (!baseline_file.empty()) {
+        std::cout << std::endl;
+        if (compare_to_baseline(results, baseline, th) > 0) return 1;
+    }
+    return errors ? 1 : 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    LCompilers::initialize();
+    try {
+        return main_app(argc, argv);
+    } catch(const LCompilers::LCompilersException &e) {
+        std::cerr << e.name() + ": " << e.msg() << std::endl;
+        return 2;
+    } catch(const std::exception &e) {
+        std::cerr << "std::exception: " << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <filesystem>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -150,7 +151,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_option("-D", compiler_options.c_preprocessor_defines, "Define <macro>=<value> (or 1 if <value> omitted)")->allow_extra_args(false);
         app.add_flag("--version", opts.arg_version, "Display compiler version information");
         app.add_option("-W", opts.linker_flags, "Linker flags")->allow_extra_args(false);
-        app.add_option("-f", opts.f_flags, "All `-f*` flags (only -fPIC & -fdefault-integer-8 supported for now)")->allow_extra_args(false);
+        app.add_option("-f", opts.f_flags, "All `-f*` flags (only -fPIC, -fdefault-integer-8, -fprofile-generate[=<dir>], -fprofile-use=<file|dir> (both imply the --fast LLVM pipeline), -ffast-math, -fno-signed-zeros, -freciprocal-math, -ffp-contract=fast|off & -fmax-stack-var-size=<bytes> supported for now)")->allow_extra_args(false);
         app.add_option("-O", opts.O_flags, "Optimization level (ignored for now)")->allow_extra_args(false);
         app.add_option("--fpe-trap", fpe_traps_str, "Enable floating point exception trapping. Comma-separated list of: invalid, zero, overflow, underflow, inexact, denormal");
 
@@ -208,6 +209,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--show-fortran", opts.show_fortran, "Show Fortran translation source for the given file and exit")->group(group_output_debugging_options);
         app.add_flag("--show-stacktrace", compiler_options.show_stacktrace, "Show internal stacktrace on compiler errors")->group(group_output_debugging_options);
         app.add_flag("--time-report", compiler_options.time_report, "Show compilation time report")->group(group_output_debugging_options);
+        app.add_option("--time-trace", compiler_options.time_trace_file, "Write a Chrome trace event profile of the compilation (chrome://tracing, Perfetto) to the given file")->group(group_output_debugging_options);
 
 
         // Pass and transformation-related flags
@@ -216,6 +218,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--dump-all-passes", compiler_options.po.dump_all_passes, "Apply all the passes and dump the ASR into a file")->group(group_pass_transformation_options);
         app.add_flag("--dump-all-passes-fortran", compiler_options.po.dump_fortran, "Apply all passes and dump the ASR after each pass into fortran file")->group(group_pass_transformation_options);
         app.add_flag("--cumulative", compiler_options.po.pass_cumulative, "Apply all the passes cumulatively till the given pass")->group(group_pass_transformation_options);
+        app.add_option("--verify-interval", compiler_options.po.verify_interval, "In builds with assertions, verify the whole ASR only after every N passes")->capture_default_str()->group(group_pass_transformation_options);
 
         // Backend and code generation-related flags
         app.add_option("--backend", opts.arg_backend, "Select a backend (llvm, c, cpp, x86, wasm, fortran, mlir)")->capture_default_str()->group(group_backend_codegen_options);
@@ -265,6 +268,10 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--stack-arrays", compiler_options.stack_arrays, "Allocate memory for arrays on stack")->group(group_miscellaneous_options);
         app.add_flag("--descriptor-index-64", compiler_options.descriptor_index_64, "Use 64-bit indices in array descriptors (implied by -fdefault-integer-8)")->group(group_miscellaneous_options);
         app.add_flag("--detect-leaks", compiler_options.detect_leaks, "Print a memory leak report")->group(group_miscellaneous_options);
+        app.add_flag("--pool-allocator", compiler_options.pool_allocator, "Allocate from a thread-local pool and compiler temporaries from a per-procedure scratch stack")->group(group_miscellaneous_options);
+        app.add_flag("--mmap-io", compiler_options.mmap_io, "Read unformatted stream and direct access files opened with action='read' through a memory mapping")->group(group_miscellaneous_options);
+        app.add_flag("--huge-pages", compiler_options.huge_pages, "Back the large chunks of the compiler's memory arenas with transparent huge pages")->group(group_miscellaneous_options);
+        app.add_option("--semantic-threads", compiler_options.semantic_threads, "Analyze the procedure bodies of each module on this many threads")->group(group_miscellaneous_options);
         app.add_flag("--array-bounds-checking", compiler_options.po.bounds_checking, "Enables runtime array bounds checking")->group(group_miscellaneous_options);
         app.add_flag("--no-array-bounds-checking", disable_bounds_checking, "Disables runtime array bounds checking")->group(group_miscellaneous_options);
         app.add_flag("--strict-array-bounds-checking", compiler_options.po.strict_bounds_checking, "Enables strict runtime array bounds checking: Array passed into subroutine must exactly match the expected size")->group(group_miscellaneous_options);
@@ -416,6 +423,43 @@ namespace LCompilers::CommandLineInterface {
                 compiler_options.po.default_integer_kind = 8;
                 compiler_options.descriptor_index_64 = true;
                 compiler_options.po.descriptor_index_64 = true;
+            } else if (f_flag == "profile-generate") {
+                compiler_options.profile_generate = true;
+            } else if (startswith(f_flag, "profile-generate=")) {
+                compiler_options.profile_generate = true;
+                compiler_options.profile_generate_path = f_flag.substr(
+                    std::string("profile-generate=").size());
+            } else if (startswith(f_flag, "profile-use=")) {
+                compiler_options.profile_use_path = f_flag.substr(
+                    std::string("profile-use=").size());
+            } else if (f_flag == "fast-math") {
+                compiler_options.fast_math = true;
+            } else if (f_flag == "no-fast-math") {
+                compiler_options.fast_math = false;
+            } else if (f_flag == "no-signed-zeros") {
+                compiler_options.no_signed_zeros = true;
+            } else if (f_flag == "reciprocal-math") {
+                compiler_options.reciprocal_math = true;
+            } else if (f_flag == "fp-contract=fast") {
+                compiler_options.fp_contract_fast = true;
+            } else if (f_flag == "fp-contract=off" || f_flag == "fp-contract=on") {
+                // `on` only fuses within a statement in C; we never fuse
+                // without `fast`
+                compiler_options.fp_contract_fast = false;
+            } else if (startswith(f_flag, "max-stack-var-size=")) {
+                std::string value = f_flag.substr(
+                    std::string("max-stack-var-size=").size());
+                try {
+                    size_t n_parsed = 0;
+                    compiler_options.max_stack_var_size = std::stoll(value, &n_parsed);
+                    if (n_parsed != value.size() || compiler_options.max_stack_var_size < 0) {
+                        throw std::invalid_argument(value);
+                    }
+                } catch (const std::exception &) {
+                    throw lc::LCompilersException(
+                        "Invalid value `" + value + "` for -fmax-stack-var-size");
+                }
+                compiler_options.stack_automatic_arrays = true;
             } else {
                 throw lc::LCompilersException(
                     "The flag `-f" + f_flag + "` is not supported"
@@ -423,6 +467,23 @@ namespace LCompilers::CommandLineInterface {
             }
         }
 
+        if (compiler_options.profile_generate && !compiler_options.profile_use_path.empty()) {
+            throw lc::LCompilersException("Cannot use -fprofile-generate and -fprofile-use at the same time");
+        }
+        // Same as clang: the `-fprofile-generate` argument is a directory
+        // that receives one `default_<signature>.profraw` per binary, and
+        // `-fprofile-use` accepts a directory containing `default.profdata`
+        if (compiler_options.profile_generate) {
+            std::filesystem::path profraw = compiler_options.profile_generate_path;
+            profraw /= "default_%m.profraw";
+            compiler_options.profile_generate_path = profraw.string();
+        }
+        if (!compiler_options.profile_use_path.empty()
+                && std::filesystem::is_directory(compiler_options.profile_use_path)) {
+            std::filesystem::path profdata = compiler_options.profile_use_path;
+            profdata /= "default.profdata";
+            compiler_options.profile_use_path = profdata.string();
+        }
         // Parse and validate --fpe-trap values, build bitmask
         if (!fpe_traps_str.empty()) {
             std::string token;
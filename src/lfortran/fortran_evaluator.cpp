@@ -1,4 +1,8 @@
+#include <chrono>
 #include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
 
 #include <lfortran/fortran_evaluator.h>
 #include <libasr/codegen/asr_to_cpp.h>
@@ -15,10 +19,13 @@
 #include <lfortran/semantics/ast_to_asr.h>
 #include <lfortran/parser/parser.h>
 #include <lfortran/parser/preprocessor.h>
+#include <libasr/time_trace.h>
 #include <lfortran/pickle.h>
 #include <libasr/pickle.h>
 #include <libasr/utils.h>
 #include <libasr/asr_lookup_name.h>
+#include <libasr/serialization.h>
+#include <libasr/string_utils.h>
 
 
 #ifdef HAVE_LFORTRAN_LLVM
@@ -39,10 +46,14 @@ namespace LCompilers {
 /* ------------------------------------------------------------------------- */
 // FortranEvaluator
 
-FortranEvaluator::FortranEvaluator(CompilerOptions& compiler_options)
+FortranEvaluator::FortranEvaluator(CompilerOptions& compiler_options,
+        Allocator *arena)
     :
     compiler_options{compiler_options},
-    al{1024*1024},
+    own_al{arena ? nullptr : std::make_unique<Allocator>(1024*1024)},
+    al{arena ? *arena : *own_al},
+    al_start{al.checkpoint()},
+    al_live{0},
 #ifdef HAVE_LFORTRAN_LLVM
     e{std::make_unique<LLVMEvaluator>()},
     eval_count{0},
@@ -53,6 +64,68 @@ FortranEvaluator::FortranEvaluator(CompilerOptions& compiler_options)
 
 FortranEvaluator::~FortranEvaluator() = default;
 
+std::string FortranEvaluator::EvalResult::stats() const {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3)
+        << "compile: " << compile_time << " ms, run: " << run_time << " ms"
+        << std::setprecision(1)
+        << ", ASR: +" << asr_bytes / 1024. << " KiB ("
+        << asr_total_bytes / (1024. * 1024) << " MiB total)"
+        << ", JIT modules: " << jit_modules;
+    return ss.str();
+}
+
+#ifdef HAVE_LFORTRAN_LLVM
+// evaluate() compacts the arena once this much more than what is live has
+// been allocated since the last compact(), and at least as much as is live
+static const size_t compact_min_bytes = 8*1024*1024;
+
+// Whether the JIT module of the cell that added `s` to the global scope
+// holds code or storage for it
+static bool defined_in_jit(ASR::symbol_t *s) {
+    if (ASR::is_a<ASR::Function_t>(*s)) {
+        return ASRUtils::get_FunctionType(s)->m_deftype
+            != ASR::deftypeType::Interface;
+    } else if (ASR::is_a<ASR::Module_t>(*s)) {
+        ASR::Module_t *m = ASR::down_cast<ASR::Module_t>(s);
+        return !m->m_intrinsic && !m->m_loaded_from_mod;
+    }
+    return ASR::is_a<ASR::Variable_t>(*s);
+}
+
+// Whether `s` or a procedure nested in it calls one of `names`
+static bool depends_on(ASR::symbol_t *s, const std::set<std::string> &names) {
+    if (ASR::is_a<ASR::Function_t>(*s)) {
+        ASR::Function_t *f = ASR::down_cast<ASR::Function_t>(s);
+        for (size_t i = 0; i < f->n_dependencies; i++) {
+            if (names.count(f->m_dependencies[i])) return true;
+        }
+    } else if (ASR::is_a<ASR::GenericProcedure_t>(*s)) {
+        ASR::GenericProcedure_t *g = ASR::down_cast<ASR::GenericProcedure_t>(s);
+        for (size_t i = 0; i < g->n_procs; i++) {
+            if (names.count(ASRUtils::symbol_name(g->m_procs[i]))) return true;
+        }
+    }
+    SymbolTable *st = ASRUtils::symbol_symtab(s);
+    if (st) {
+        for (auto &a : st->get_scope()) {
+            if (depends_on(a.second, names)) return true;
+        }
+    }
+    return false;
+}
+#endif
+
+// Runs the destructors of `st` and of the symbol tables nested in it, which
+// rewinding the arena does not
+static void destroy_symbol_tables(SymbolTable *st) {
+    for (auto &a : st->get_scope()) {
+        SymbolTable *child = ASRUtils::symbol_symtab(a.second);
+        if (child && child->parent == st) destroy_symbol_tables(child);
+    }
+    st->~SymbolTable();
+}
+
 Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate2(const std::string &code) {
     LocationManager lm;
     LCompilers::PassManager lpm;
@@ -81,6 +154,8 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
 {
 #ifdef HAVE_LFORTRAN_LLVM
     EvalResult result;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    size_t al_used = al.size_used();
 
     // Src -> AST
     Result<LFortran::AST::TranslationUnit_t*> res = get_ast2(
@@ -97,6 +172,13 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
     }
 
     // AST -> ASR
+    evict_redefined(*ast);
+    std::set<std::string> names_before;
+    if (symbol_table) {
+        for (auto &a : symbol_table->get_scope()) {
+            names_before.insert(a.first);
+        }
+    }
     Result<ASR::TranslationUnit_t*> res2 = get_asr3(*ast, diagnostics, lm);
     ASR::TranslationUnit_t* asr;
     if (res2.ok) {
@@ -144,7 +226,27 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
     }
 
     // LLVM -> Machine code -> Execution
-    e->add_module(std::move(m));
+    // A cell that only defines its run function (a statement or expression)
+    // is dropped from the JIT once it has run, so that the JIT does not grow
+    // with every evaluation. Cells defining procedures or variables stay
+    // until all their procedures are defined again (evict_redefined()).
+    bool one_shot = m->only_defines(run_fn);
+    e->add_module(std::move(m), eval_count);
+    if (!one_shot) {
+        // Including the procedures the ASR passes added for this cell
+        for (auto &a : symbol_table->get_scope()) {
+            if (a.first != run_fn && names_before.count(a.first) == 0
+                    && defined_in_jit(a.second)) {
+                jit_module_defs[eval_count].push_back(a.first);
+                jit_module_of[a.first] = eval_count;
+            }
+        }
+    }
+    if (return_type != "none") {
+        // Materializes the machine code, so that it counts as compile time
+        e->get_symbol_address(run_fn);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
     if (return_type == "integer4") {
         int32_t r = e->execfn<int32_t>(run_fn);
         result.type = EvalResult::integer4;
@@ -183,12 +285,110 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
     } else {
         throw LCompilersException("FortranEvaluator::evaluate(): Return type not supported");
     }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    if (one_shot) {
+        e->remove_module(eval_count);
+    }
+
+    result.compile_time = std::chrono::duration<double, std::milli>(
+        t2 - t1).count();
+    result.run_time = std::chrono::duration<double, std::milli>(
+        t3 - t2).count();
+    result.asr_bytes = al.size_used() - al_used;
+    if (al.size_used() - al_live > std::max(al_live, compact_min_bytes)) {
+        compact();
+    }
+    result.asr_total_bytes = al.size_used();
+    result.jit_modules = e->n_modules();
     return result;
 #else
     throw LCompilersException("LLVM is not enabled");
 #endif
 }
 
+#ifdef HAVE_LFORTRAN_LLVM
+/*
+   A cell that defines a global procedure again replaces it. The JIT module
+   of the old definition is dropped and its symbols are erased, so that the
+   semantics accept the new one and the JIT does not see two definitions.
+
+   Only done when that module defines nothing but procedures the cell
+   defines again, and no procedure that stays calls them: their machine
+   code would keep calling the old, freed definition. Otherwise the old
+   definition stays and the semantics report the redefinition as before.
+*/
+void FortranEvaluator::evict_redefined(LFortran::AST::TranslationUnit_t &ast) {
+    if (!symbol_table || !LLVMEvaluator::can_remove_modules()) return;
+    std::set<std::string> names;
+    std::set<uint64_t> keys;
+    for (size_t i = 0; i < ast.n_items; i++) {
+        if (ast.m_items[i]->type != LFortran::AST::astType::program_unit) {
+            continue;
+        }
+        LFortran::AST::program_unit_t *pu
+            = LFortran::AST::down_cast<LFortran::AST::program_unit_t>(
+                ast.m_items[i]);
+        std::string name;
+        if (LFortran::AST::is_a<LFortran::AST::Function_t>(*pu)) {
+            name = to_lower(LFortran::AST::down_cast<
+                LFortran::AST::Function_t>(pu)->m_name);
+        } else if (LFortran::AST::is_a<LFortran::AST::Subroutine_t>(*pu)) {
+            name = to_lower(LFortran::AST::down_cast<
+                LFortran::AST::Subroutine_t>(pu)->m_name);
+        } else {
+            continue;
+        }
+        auto it = jit_module_of.find(name);
+        if (it != jit_module_of.end()) {
+            names.insert(name);
+            keys.insert(it->second);
+        }
+    }
+    if (names.empty()) return;
+    for (uint64_t key : keys) {
+        for (auto &name : jit_module_defs[key]) {
+            if (names.count(name) == 0) return;
+        }
+    }
+    for (auto &a : symbol_table->get_scope()) {
+        if (names.count(a.first) == 0 && a.first != run_fn
+                && depends_on(a.second, names)) {
+            return;
+        }
+    }
+    for (uint64_t key : keys) {
+        e->remove_module(key);
+        jit_module_defs.erase(key);
+    }
+    for (auto &name : names) {
+        symbol_table->erase_symbol(name);
+        jit_module_of.erase(name);
+    }
+}
+#endif
+
+void FortranEvaluator::compact() {
+    if (!own_al || !symbol_table) return;
+    if (symbol_table->get_symbol(run_fn) != nullptr) {
+        symbol_table->erase_symbol(run_fn);
+    }
+    // Serializing the global scope is a deep copy that refers to symbols by
+    // scope and name, the same as a .mod file. Whatever it does not reach
+    // is garbage.
+    ASR::TranslationUnit_t *tu = ASR::down_cast2<ASR::TranslationUnit_t>(
+        ASR::make_TranslationUnit_t(al, symbol_table->asr_owner->loc,
+            symbol_table, nullptr, 0));
+    std::string live = serialize(*tu);
+    destroy_symbol_tables(symbol_table);
+    al.rewind(al_start);
+    tu = ASR::down_cast2<ASR::TranslationUnit_t>(
+        deserialize_asr(al, live, true, 0));
+    SymbolTable external_symtab(nullptr);
+    fix_external_symbols(*tu, external_symtab);
+    symbol_table = tu->m_symtab;
+    al_live = al.size_used();
+}
+
 Result<std::string> FortranEvaluator::get_ast(const std::string &code,
     LocationManager &lm, diag::Diagnostics &diagnostics)
 {
@@ -217,6 +417,7 @@ Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
     std::string tmp;
     if (compiler_options.c_preprocessor) {
         // Preprocessor
+        TimeTraceScope scope(compiler_options.po.time_trace, "Preprocess");
         LFortran::CPreprocessor cpp(compiler_options);
         Result<std::string> res = cpp.run(code_orig, lm, cpp.macro_definitions, diagnostics);
         if (res.ok) {
@@ -233,6 +434,7 @@ Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
         include_dirs.insert(include_dirs.end(),
                             compiler_options.po.include_dirs.begin(),
                             compiler_options.po.include_dirs.end());
+        TimeTraceScope scope(compiler_options.po.time_trace, "Prescan");
         tmp = LFortran::prescan(*code, lm, compiler_options.fixed_form, include_dirs);
         code = &tmp;
     }
@@ -310,6 +512,7 @@ Result<ASR::TranslationUnit_t*> FortranEvaluator::get_asr3(
         }
         symbol_table->mark_all_variables_external(al);
     }
+    TimeTraceScope scope(compiler_options.po.time_trace, "Semantics", "", &al);
     auto res = LFortran::ast_to_asr(al, ast, diagnostics, symbol_table,
         compiler_options.symtab_only, compiler_options, lm);
     if (res.ok) {
@@ -365,8 +568,9 @@ Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm2(
 }
 
 /*
-    time_opt: keeps track of time taken by using `--fast` flag
-        i.e. time taken by optimizations, and used when
+    time_opt: keeps track of time taken by using `--fast` flag (or the
+        `-fprofile-generate` / `-fprofile-use` flags, which also run the
+        LLVM pipeline) i.e. time taken by optimizations, and used when
         `--time-report` flag is used
 */
 Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm3(
@@ -401,9 +605,13 @@ Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm3(
         return res.error;
     }
 
-    if (compiler_options.po.fast) {
+    if (compiler_options.po.fast || compiler_options.profile_generate
+            || !compiler_options.profile_use_path.empty()) {
+        TimeTraceScope scope(compiler_options.po.time_trace, "LLVM optimize");
         auto t1 = std::chrono::high_resolution_clock::now();
-        e->opt(*m->m_m);
+        e->opt(*m->m_m, compiler_options.profile_generate,
+            compiler_options.profile_generate_path,
+            compiler_options.profile_use_path);
         auto t2 = std::chrono::high_resolution_clock::now();
         if (compiler_options.po.time_report && time_opt) {
             *time_opt = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
@@ -566,11 +774,13 @@ Result<std::unique_ptr<MLIRModule>> FortranEvaluator::get_mlir(
     LCompilers::PassManager pass_manager;
     if (ASR::is_a<ASR::unit_t>(asr)) {
         pass_manager.use_default_passes();
+        pass_manager.skip_mlir_passes();
         pass_manager.apply_passes(al, (ASR::TranslationUnit_t *)&asr,
             compiler_options.po, diagnostics);
     }
     Result<std::unique_ptr<MLIRModule>> res = asr_to_mlir(al,
-        (ASR::asr_t &)asr, diagnostics);
+        (ASR::asr_t &)asr, diagnostics,
+        compiler_options.po.enable_gpu_offloading);
     if (res.ok) {
         m = std::move(res.result);
     } else {
@@ -1,7 +1,9 @@
 #ifndef LFORTRAN_FORTRAN_EVALUATOR_H
 #define LFORTRAN_FORTRAN_EVALUATOR_H
 
+#include <map>
 #include <memory>
+#include <vector>
 
 #include <libasr/alloc.h>
 #include <lfortran/parser/parser.h>
@@ -36,7 +38,10 @@ class FortranEvaluator
 public:
     CompilerOptions& compiler_options;
 
-    FortranEvaluator(CompilerOptions& compiler_options);
+    // Allocates the ASR in `arena` if given, which must outlive the
+    // evaluator, otherwise in an Allocator of its own
+    FortranEvaluator(CompilerOptions& compiler_options,
+        Allocator *arena=nullptr);
     ~FortranEvaluator();
 
     struct EvalResult {
@@ -55,6 +60,14 @@ public:
         std::string ast;
         std::string asr;
         std::string llvm_ir;
+
+        // What the evaluation cost, for keeping long sessions in check
+        double compile_time = 0; // ms, source to machine code
+        double run_time = 0; // ms
+        size_t asr_bytes = 0; // added to the session's AST/ASR arena
+        size_t asr_total_bytes = 0;
+        size_t jit_modules = 0; // modules the JIT still holds afterwards
+        std::string stats() const;
     };
 
     // Evaluates `code`.
@@ -64,6 +77,13 @@ public:
         diag::Diagnostics &diagnostics);
     Result<EvalResult> evaluate2(const std::string &code);
 
+    // Copies the ASR that later evaluations can still reach to the start of
+    // the evaluator's own arena and frees everything else: the ASTs, the
+    // run functions of past cells, procedures that were redefined and the
+    // garbage of the ASR passes. evaluate() does this once the arena has
+    // grown to twice its live size. Does nothing for an external arena.
+    void compact();
+
     Result<std::string> get_ast(const std::string &code,
         LocationManager &lm, diag::Diagnostics &diagnostics);
     Result<LCompilers::LFortran::AST::TranslationUnit_t*> get_ast2(
@@ -117,10 +137,19 @@ public:
     Allocator &get_al() { return al; };
 
 private:
-    Allocator al;
+    std::unique_ptr<Allocator> own_al;
+    Allocator &al;
+    Allocator::Checkpoint al_start;
+    size_t al_live; // bytes in use after the last compact()
 #ifdef HAVE_LFORTRAN_LLVM
     std::unique_ptr<LLVMEvaluator> e;
     int eval_count;
+    // The global procedures and variables that each cell kept in the JIT
+    // defines, by the key of its module, and the other way round
+    std::map<uint64_t, std::vector<std::string>> jit_module_defs;
+    std::map<std::string, uint64_t> jit_module_of;
+
+    void evict_redefined(LFortran::AST::TranslationUnit_t &ast);
 #endif
     SymbolTable *symbol_table;
     std::string run_fn;
@@ -119,6 +119,7 @@ namespace LCompilers::LFortran {
         std::string std_out;
         std::string code0;
         CompilerOptions cu;
+        bool show_stats = false;
         try {
             if (startswith(code, "%%showast")) {
                 code0 = code.substr(code.find("\n")+1);
@@ -306,7 +307,13 @@ namespace LCompilers::LFortran {
             }
 
             RedirectStdout s(std_out);
-            code0 = code;
+            if (startswith(code, "%%showstats")) {
+                // Evaluate the cell and report what it cost
+                code0 = code.substr(code.find("\n")+1);
+                show_stats = true;
+            } else {
+                code0 = code;
+            }
             LocationManager lm;
             {
                 LocationManager::FileLocations fl;
@@ -347,6 +354,9 @@ namespace LCompilers::LFortran {
         if (std_out.size() > 0) {
             publish_stream("stdout", std_out);
         }
+        if (show_stats) {
+            publish_stream("stderr", r.stats() + "\n");
+        }
 
         switch (r.type) {
             case (LCompilers::FortranEvaluator::EvalResult::integer4) : {
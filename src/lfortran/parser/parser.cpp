@@ -9,6 +9,7 @@
 #include <lfortran/parser/parser_exception.h>
 #include <lfortran/parser/fixedform_tokenizer.h>
 #include <lfortran/utils.h>
+#include <libasr/time_trace.h>
 
 #include <lfortran/pickle.h>
 
@@ -236,7 +237,11 @@ void fix_program_without_program_line(Allocator &al, AST::TranslationUnit_t &ast
 Result<AST::TranslationUnit_t*> parse(Allocator &al, const std::string &s,
         diag::Diagnostics &diagnostics, const CompilerOptions &co)
 {
+    // Free-form source is tokenized on demand by the parser, so for it this
+    // span includes the tokenizer
+    TimeTraceScope scope(co.po.time_trace, "Parse", "", &al);
     Parser p(al, diagnostics, co.fixed_form, co.continue_compilation, co.openmp);
+    p.time_trace = co.po.time_trace;
     try {
         if (!p.parse(s)) {
             if (!co.continue_compilation) {
@@ -291,7 +296,10 @@ bool Parser::parse(const std::string &input)
         }
     } else {
         f_tokenizer.set_string(inp);
-        if (!f_tokenizer.tokenize_input(diag, m_a, this->continue_compilation)) return false;
+        {
+            TimeTraceScope scope(time_trace, "Tokenize", "", &m_a);
+            if (!f_tokenizer.tokenize_input(diag, m_a, this->continue_compilation)) return false;
+        }
         if (yyparse(*this) == 0) {
             if (diag.has_error())
                 return false;
@@ -25,6 +25,7 @@ public:
     Vec<AST::ast_t*> result;
     bool fixed_form;
     bool continue_compilation;
+    TimeTrace *time_trace = nullptr;
 
     Parser(Allocator &al, diag::Diagnostics &diagnostics, const bool &fixed_form=false,
         const bool &continue_compilation=false, const bool &openmp=false)
@@ -14,7 +14,7 @@ see the documentation in that script for details and motivation.
 %param {LCompilers::LFortran::Parser &p}
 %locations
 %glr-parser
-%expect    238 // shift/reduce conflicts
+%expect    239 // shift/reduce conflicts
 %expect-rr 180 // reduce/reduce conflicts
 
 // Uncomment this to get verbose error messages
@@ -478,6 +478,7 @@ void yyerror(YYLTYPE *yyloc, LCompilers::LFortran::Parser &p,
 %type <ast> format
 %type <ast> open_statement
 %type <ast> flush_statement
+%type <ast> wait_statement
 %type <ast> close_statement
 %type <ast> write_statement
 %type <ast> read_statement
@@ -1780,6 +1781,7 @@ single_line_statement
     | sync_images_statement
     | sync_memory_statement
     | sync_team_statement
+    | wait_statement
     | where_statement_single
     | write_statement
     ;
@@ -1957,6 +1959,10 @@ flush_statement
             $$ =  FLUSH2(FUNCCALLORARRAY($2, $4, @$), @$); }
     ;
 
+wait_statement
+    : KW_WAIT "(" write_arg_list ")" { $$ = WAIT($3, @$); }
+    ;
+
 endfile_statement
     : end_file "(" write_arg_list ")" { $$ = ENDFILE($3, @$); }
     | end_file id { $$ = ENDFILE2($2, @$); }
@@ -2,6 +2,8 @@
 #include <cmath>
 #include <cstring>
 #include <set>
+#include <system_error>
+#include <thread>
 #include <unordered_set>
 
 #include <lfortran/ast.h>
@@ -9,6 +11,7 @@
 #include <libasr/asr_utils.h>
 #include <libasr/asr_verify.h>
 #include <libasr/asr_side_effect.h>
+#include <libasr/serialization.h>
 #include <libasr/exception.h>
 #include <lfortran/semantics/asr_implicit_cast_rules.h>
 #include <lfortran/semantics/ast_common_visitor.h>
@@ -43,6 +46,147 @@ static void check_pure_function(ASR::Function_t *v, ASR::stmt_t **stmts,
     }
 }
 
+/*
+   Concurrent analysis of the procedures of a module (--semantic-threads)
+
+   After the symbol table visitor, the bodies of the procedures of a module
+   are mostly independent. visit_contains_concurrently() deals them out to
+   worker threads. Each worker has its own Allocator, Diagnostics,
+   CompilerOptions, LocationManager and copies of the tables that the
+   visitors share by reference, and analyzes its procedures in a private
+   copy of the unit, deserialized from one serialization of it. A worker
+   passes only if its copy changed nothing outside of its own procedures and
+   no state was carried from one procedure to the next. The procedures are
+   then deserialized into the unit in source order, new symbol tables are
+   renumbered in that order, and the diagnostics and module dependencies of
+   each procedure are appended in that order, so the result does not depend
+   on the scheduling. Anything else (a failed worker, an error, a change
+   outside of a procedure) leaves the unit as it was and the module goes
+   through the serial loop.
+*/
+struct ConcurrentProcedure {
+    std::string name; // In the module scope
+    ASR::Function_t *f;
+    std::string baseline; // serialize(f) before the analysis
+    std::string interface; // interface_fingerprint(f) before the analysis
+    // Filled by the worker that analyzes it
+    std::string analyzed;
+    std::vector<diag::Diagnostic> diagnostics;
+    std::vector<std::string> module_dependencies;
+};
+
+// Looks up the procedure `name` like visit_Function() does, returns
+// nullptr unless it is a Function. `key` is set to its name in `scope`.
+static ASR::Function_t *lookup_procedure(SymbolTable *scope,
+        const char *name, std::string &key) {
+    key = to_lower(name);
+    ASR::symbol_t *t = scope->get_symbol(key);
+    if (t && ASR::is_a<ASR::GenericProcedure_t>(*t)) {
+        key += "~genericprocedure";
+        t = scope->get_symbol(key);
+    }
+    if (t == nullptr || !ASR::is_a<ASR::Function_t>(*t)) {
+        return nullptr;
+    }
+    return ASR::down_cast<ASR::Function_t>(t);
+}
+
+// Appends the procedure `x` of `scope` and its internal procedures to
+// `order`, in the order in which the body visitor analyzes them. Returns
+// false for anything but plain functions and subroutines.
+static bool analysis_order(const AST::program_unit_t &x, SymbolTable *scope,
+        std::vector<ASR::Function_t*> &order) {
+    const char *name;
+    AST::program_unit_t **contains;
+    size_t n_contains;
+    if (AST::is_a<AST::Function_t>(x)) {
+        const AST::Function_t *f = AST::down_cast<AST::Function_t>(&x);
+        if (f->n_temp_args > 0) return false;
+        name = f->m_name;
+        contains = f->m_contains;
+        n_contains = f->n_contains;
+    } else if (AST::is_a<AST::Subroutine_t>(x)) {
+        const AST::Subroutine_t *f = AST::down_cast<AST::Subroutine_t>(&x);
+        if (f->n_temp_args > 0) return false;
+        name = f->m_name;
+        contains = f->m_contains;
+        n_contains = f->n_contains;
+    } else {
+        return false;
+    }
+    std::string key;
+    ASR::Function_t *v = lookup_procedure(scope, name, key);
+    if (v == nullptr) return false;
+    order.push_back(v);
+    for (size_t i = 0; i < n_contains; i++) {
+        if (!analysis_order(*contains[i], v->m_symtab, order)) return false;
+    }
+    return true;
+}
+
+// What callers of `f` see of it while their bodies are analyzed
+static std::string interface_fingerprint(const ASR::Function_t *f) {
+    std::string s = serialize((ASR::asr_t&)*f->m_function_signature);
+    for (size_t i = 0; i < f->n_args; i++) {
+        if (f->m_args[i] && ASR::is_a<ASR::Var_t>(*f->m_args[i])) {
+            s += serialize((ASR::asr_t&)*ASR::down_cast<ASR::Var_t>(
+                f->m_args[i])->m_v);
+        }
+    }
+    if (f->m_return_var) {
+        s += serialize((ASR::asr_t&)*f->m_return_var);
+    }
+    return s;
+}
+
+// Appends `symtab` and the symbol tables below it, in a fixed order
+static void collect_symtabs(SymbolTable *symtab,
+        std::vector<SymbolTable*> &tables) {
+    tables.push_back(symtab);
+    for (auto &a : symtab->get_scope()) {
+        SymbolTable *s = ASRUtils::symbol_symtab(a.second);
+        if (s && s->parent == symtab) collect_symtabs(s, tables);
+    }
+}
+
+// The procedures called in a body, including its BLOCKs and ASSOCIATE
+// blocks: the ones whose m_deterministic and m_side_effect_free the body
+// visitor reads at the call
+class CalledProcedures : public ASR::BaseWalkVisitor<CalledProcedures> {
+    void add(ASR::symbol_t *s) {
+        s = ASRUtils::symbol_get_past_external(s);
+        if (ASR::is_a<ASR::StructMethodDeclaration_t>(*s)) {
+            s = ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::StructMethodDeclaration_t>(s)->m_proc);
+        }
+        if (ASR::is_a<ASR::Function_t>(*s)) {
+            called.insert(ASR::down_cast<ASR::Function_t>(s));
+        }
+    }
+public:
+    std::set<ASR::Function_t*> called;
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &x) {
+        add(x.m_name);
+        ASR::BaseWalkVisitor<CalledProcedures>::visit_FunctionCall(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
+        add(x.m_name);
+        ASR::BaseWalkVisitor<CalledProcedures>::visit_SubroutineCall(x);
+    }
+
+    void visit_BlockCall(const ASR::BlockCall_t &x) {
+        ASR::Block_t *b = ASR::down_cast<ASR::Block_t>(x.m_m);
+        for (size_t i = 0; i < b->n_body; i++) visit_stmt(*b->m_body[i]);
+    }
+
+    void visit_AssociateBlockCall(const ASR::AssociateBlockCall_t &x) {
+        ASR::AssociateBlock_t *b = ASR::down_cast<ASR::AssociateBlock_t>(x.m_m);
+        for (size_t i = 0; i < b->n_body; i++) visit_stmt(*b->m_body[i]);
+    }
+};
+
 class BodyVisitor : public CommonVisitor<BodyVisitor> {
 private:
 
@@ -359,7 +503,7 @@ public:
         ASR::expr_t *a_newunit = nullptr, *a_filename = nullptr, *a_status = nullptr, *a_form = nullptr,
             *a_access = nullptr, *a_iostat = nullptr, *a_iomsg = nullptr, *a_action = nullptr, *a_delim = nullptr,
             *a_recl = nullptr, *a_position = nullptr, *a_blank = nullptr, *a_encoding = nullptr, *a_sign = nullptr,
-            *a_decimal = nullptr;
+            *a_decimal = nullptr, *a_asynchronous = nullptr;
         int64_t err_label = -1;
         if( x.n_args > 1 ) {
             diag.add(Diagnostic(
@@ -832,6 +976,26 @@ public:
                     throw SemanticAbort();
                 }
 
+            } else if (m_arg_str == std::string("asynchronous")) {
+                if (a_asynchronous != nullptr) {
+                    diag.add(Diagnostic(
+                        R"""(Duplicate value of `asynchronous` found)""",
+                        Level::Error, Stage::Semantic, {
+                            Label("",{x.base.base.loc})
+                        }));
+                    throw SemanticAbort();
+                }
+                this->visit_expr(*kwarg.m_value);
+                a_asynchronous = ASRUtils::EXPR(tmp);
+                ASR::ttype_t *a_asynchronous_type = ASRUtils::expr_type(a_asynchronous);
+                if (!ASRUtils::is_character(*a_asynchronous_type)) {
+                    diag.add(Diagnostic(
+                        "`asynchronous` must be of type, String or StringPointer",
+                        Level::Error, Stage::Semantic, {
+                            Label("",{x.base.base.loc})
+                        }));
+                    throw SemanticAbort();
+                }
             }
             else {
                 const std::unordered_set<std::string> unsupported_args {"fileopt", "pad"};
@@ -883,7 +1047,7 @@ public:
             a_iostat = ASRUtils::EXPR(ASR::make_Var_t(al, x.base.base.loc, iostat_sym));
         }
         tmp = ASR::make_FileOpen_t(
-            al, x.base.base.loc, x.m_label, a_newunit, a_filename, a_status, a_form, a_access, a_iostat, a_iomsg, a_action, a_delim, a_recl, a_position, a_blank, a_encoding, a_sign, a_decimal);
+            al, x.base.base.loc, x.m_label, a_newunit, a_filename, a_status, a_form, a_access, a_iostat, a_iomsg, a_action, a_delim, a_recl, a_position, a_blank, a_encoding, a_sign, a_decimal, a_asynchronous);
         tmp_vec.push_back(tmp);
         if (err_label != -1) {
             emit_err_label_jump(err_label, a_iostat, x.base.base.loc, tmp_vec);
@@ -1726,10 +1890,11 @@ public:
                 }
                 this->visit_expr(*kwarg.m_value);
                 a_id = ASRUtils::EXPR(tmp);
-                ASR::ttype_t* a_status_type = ASRUtils::expr_type(a_id);
-                if (!ASR::is_a<ASR::String_t>(*ASRUtils::type_get_past_pointer(a_status_type))) {
+                ASR::ttype_t* a_id_type = ASRUtils::expr_type(a_id);
+                if (!ASRUtils::is_variable(a_id) ||
+                    !ASR::is_a<ASR::Integer_t>(*ASRUtils::type_get_past_pointer(a_id_type))) {
                         diag.add(Diagnostic(
-                            "`status` must be of type String",
+                            "`id` must be a mutable variable of type, Integer",
                             Level::Error, Stage::Semantic, {
                                 Label("",{loc})
                             }));
@@ -2531,6 +2696,63 @@ public:
         tmp = ASR::make_Flush_t(al, x.base.base.loc, x.m_label, unit, err, iomsg, iostat);
     }
 
+    void visit_Wait(const AST::Wait_t& x) {
+        mark_IO_side_effect();
+        std::map<std::string, size_t> argname2idx = {{"unit", 0}, {"id", 1}, {"iostat", 2}, {"iomsg", 3}, {"err", 4}};
+        std::vector<ASR::expr_t*> args;
+        std::string node_name = "Wait";
+        fill_args_for_rewind_inquire_flush(x, 5, args, 5, argname2idx, node_name);
+        if( !args[0] ) {
+            diag.add(Diagnostic(
+                "unit must be present in wait statement arguments",
+                Level::Error, Stage::Semantic, {
+                    Label("",{x.base.base.loc})
+                }));
+            throw SemanticAbort();
+        }
+        ASR::expr_t *unit = args[0], *id = args[1], *iostat = args[2], *iomsg = args[3], *err = args[4];
+        if( id && !ASRUtils::is_integer(*ASRUtils::expr_type(id)) ) {
+            diag.add(Diagnostic(
+                "`id` must be of type, Integer",
+                Level::Error, Stage::Semantic, {
+                    Label("",{x.base.base.loc})
+                }));
+            throw SemanticAbort();
+        }
+        if (err == nullptr) {
+            tmp = ASR::make_FileWait_t(al, x.base.base.loc, x.m_label, unit, id, iostat, iomsg, err);
+            return;
+        }
+        // ERR= branches on the status of the wait, so it is lowered to an
+        // IOSTAT= variable followed by a jump to the label
+        ASR::expr_t* label_expr = ASRUtils::expr_value(err);
+        if (label_expr == nullptr || !ASR::is_a<ASR::IntegerConstant_t>(*label_expr)) {
+            diag.add(Diagnostic(
+                "`err` must be a constant integer label",
+                Level::Error, Stage::Semantic, {Label("", {err->base.loc})}));
+            throw SemanticAbort();
+        }
+        int64_t err_label = ASR::down_cast<ASR::IntegerConstant_t>(label_expr)->m_n;
+        if (labels.find(std::to_string(err_label)) == labels.end()) {
+            diag.add(Diagnostic(
+                "err= label " + std::to_string(err_label) + " is not defined",
+                Level::Error, Stage::Semantic, {Label("", {err->base.loc})}));
+            throw SemanticAbort();
+        }
+        if (iostat == nullptr) {
+            ASR::ttype_t* int_type = ASRUtils::TYPE(
+                ASR::make_Integer_t(al, x.base.base.loc, 4));
+            std::string iostat_name = current_scope->get_unique_name("__lfortran_iostat");
+            ASR::symbol_t* iostat_sym = declare_implicit_variable2(
+                x.base.base.loc, iostat_name, ASRUtils::intent_local, int_type);
+            iostat = ASRUtils::EXPR(ASR::make_Var_t(al, x.base.base.loc, iostat_sym));
+        }
+        tmp_vec.push_back(ASR::make_FileWait_t(al, x.base.base.loc, x.m_label,
+            unit, id, iostat, iomsg, nullptr));
+        emit_err_label_jump(err_label, iostat, x.base.base.loc, tmp_vec);
+        tmp = nullptr;
+    }
+
     void visit_Associate(const AST::Associate_t& x) {
         this->visit_expr(*(x.m_target));
         ASR::expr_t* target = ASRUtils::EXPR(tmp);
@@ -4286,6 +4508,246 @@ public:
                                      select_type_default.p, select_type_default.size());
     }
 
+    // Whether this visitor holds state that the serial loop over the
+    // procedures of a module would carry from one procedure into the next
+    bool carries_procedure_state() const {
+        return !changed_external_function_symbol.empty()
+            || !postponed_genericProcedure_calls_vec.empty()
+            || !pending_proc_ptr_inits.empty()
+            || !pending_proc_placeholders.empty()
+            || !vars_with_deferred_struct_declaration.empty()
+            || !symbols_having_only_attributes_without_type.empty()
+            || !select_type_casts_map.empty()
+            || !assumed_rank_arrays.empty()
+            || !generic_procedures.empty()
+            || !common_block_dictionary.empty()
+            || !entry_point_mapping.empty()
+            || !external_procedures.empty()
+            || !explicit_intrinsic_procedures.empty()
+            || !print_statements.empty()
+            || !omp_constructs.empty()
+            || default_storage_save || is_global_save_enabled
+            || needs_implicit_interface_postprocessing;
+    }
+
+    // The work of thread `t` of `n_threads` in visit_contains_concurrently():
+    // analyzes procs[t], procs[t + n_threads], ... in a private copy of the
+    // unit serialized as `unit_s`, and checks that the copy, without the
+    // procedures, still serializes as `rest`
+    bool analyze_procedures_in_copy(size_t t, size_t n_threads,
+            AST::program_unit_t **contains,
+            std::vector<ConcurrentProcedure> &procs,
+            const std::string &unit_s, const std::string &rest,
+            const std::string &module_name) {
+        Allocator wal(1024*1024);
+        ASR::TranslationUnit_t *wunit = ASR::down_cast2<ASR::TranslationUnit_t>(
+            deserialize_asr(wal, unit_s, true, 0));
+        SymbolTable external_symtab(nullptr);
+        fix_external_symbols(*wunit, external_symtab);
+        ASR::Module_t *wm = ASR::down_cast<ASR::Module_t>(
+            wunit->m_symtab->get_symbol(module_name));
+
+        diag::Diagnostics wdiag;
+        CompilerOptions wcompiler_options = compiler_options;
+        LocationManager wlm = lm;
+        auto wimplicit_mapping = implicit_mapping;
+        auto wcommon_variables_hash = common_variables_hash;
+        auto wcommon_variables_byte_offset = common_variables_byte_offset;
+        auto wexternal_procedures_mapping = external_procedures_mapping;
+        auto wexplicit_intrinsic_procedures_mapping
+            = explicit_intrinsic_procedures_mapping;
+        auto winstantiate_types = instantiate_types;
+        auto winstantiate_symbols = instantiate_symbols;
+        auto wentry_functions = entry_functions;
+        auto wentry_function_arguments_mapping = entry_function_arguments_mapping;
+        auto wdata_structure = data_structure;
+        BodyVisitor b(wal, (ASR::asr_t*)wunit, wdiag, wcompiler_options,
+            wimplicit_mapping, wcommon_variables_hash,
+            wcommon_variables_byte_offset, wexternal_procedures_mapping,
+            wexplicit_intrinsic_procedures_mapping, winstantiate_types,
+            winstantiate_symbols, wentry_functions,
+            wentry_function_arguments_mapping, wdata_structure, wlm);
+        b.is_body_visitor = true;
+        b.current_scope = wm->m_symtab;
+        b.current_module = wm;
+        for (size_t i = t; i < procs.size(); i += n_threads) {
+            size_t n_diagnostics = wdiag.diagnostics.size();
+            size_t n_dependencies = b.current_module_dependencies.size();
+            b.visit_program_unit(*contains[i]);
+            if (b.carries_procedure_state()) return false;
+            procs[i].diagnostics.assign(
+                wdiag.diagnostics.begin() + n_diagnostics,
+                wdiag.diagnostics.end());
+            for (size_t k = n_dependencies;
+                    k < b.current_module_dependencies.size(); k++) {
+                procs[i].module_dependencies.push_back(
+                    b.current_module_dependencies[k]);
+            }
+        }
+
+        for (size_t i = 0; i < procs.size(); i++) {
+            ASR::Function_t *f = ASR::down_cast<ASR::Function_t>(
+                wm->m_symtab->get_symbol(procs[i].name));
+            if (i % n_threads == t) {
+                // The procedures analyzed later must not depend on the
+                // analysis of this one, see the flags in
+                // visit_contains_concurrently() for the exception
+                if (interface_fingerprint(f) != procs[i].interface) {
+                    return false;
+                }
+                procs[i].analyzed = serialize((ASR::asr_t&)*f);
+            } else if (serialize((ASR::asr_t&)*f) != procs[i].baseline) {
+                return false;
+            }
+        }
+        for (auto &p : procs) wm->m_symtab->erase_symbol(p.name);
+        return serialize(*wunit) == rest;
+    }
+
+    // Analyzes the procedures `contains` of the module `m` on
+    // compiler_options.semantic_threads threads, see ConcurrentProcedure.
+    // Returns false, with the unit unchanged, if the module has to go
+    // through the serial loop instead.
+    bool visit_contains_concurrently(AST::program_unit_t **contains,
+            size_t n_contains, ASR::Module_t *m) {
+        size_t n_threads = std::min<size_t>(
+            std::max(compiler_options.semantic_threads, 1), n_contains);
+        if (n_threads < 2 || compiler_options.implicit_typing
+                || compiler_options.implicit_interface
+                || compiler_options.interactive
+                || compiler_options.po.time_trace
+                || !implicit_mapping.empty() || !common_variables_hash.empty()
+                || !entry_functions.empty() || !instantiate_types.empty()
+                || !instantiate_symbols.empty() || carries_procedure_state()) {
+            return false;
+        }
+        for (auto &d : data_structure) {
+            if (!d.second.empty()) return false;
+        }
+        ASR::TranslationUnit_t *unit = ASR::down_cast2<ASR::TranslationUnit_t>(asr);
+        std::string module_name = m->m_name;
+        if (unit->m_symtab->get_symbol(module_name) != (ASR::symbol_t*)m) {
+            return false;
+        }
+        std::vector<ConcurrentProcedure> procs(n_contains);
+        for (size_t i = 0; i < n_contains; i++) {
+            std::vector<ASR::Function_t*> order;
+            if (!analysis_order(*contains[i], m->m_symtab, order)) return false;
+            procs[i].f = order[0];
+            // The flags a caller sees before the callee is analyzed
+            for (ASR::Function_t *f : order) {
+                if (!f->m_deterministic || !f->m_side_effect_free) return false;
+            }
+            const char *name = AST::is_a<AST::Function_t>(*contains[i])
+                ? AST::down_cast<AST::Function_t>(contains[i])->m_name
+                : AST::down_cast<AST::Subroutine_t>(contains[i])->m_name;
+            lookup_procedure(m->m_symtab, name, procs[i].name);
+        }
+
+        std::string unit_s = serialize(*unit);
+        for (auto &p : procs) {
+            p.baseline = serialize((ASR::asr_t&)*p.f);
+            p.interface = interface_fingerprint(p.f);
+        }
+        for (auto &p : procs) m->m_symtab->erase_symbol(p.name);
+        std::string rest = serialize(*unit);
+        for (auto &p : procs) {
+            m->m_symtab->add_symbol(p.name, (ASR::symbol_t*)p.f);
+        }
+        unsigned int counter_start = SymbolTable::get_global_counter();
+
+        std::vector<char> passed(n_threads, false);
+        auto work = [&](size_t t) {
+            try {
+                passed[t] = analyze_procedures_in_copy(t, n_threads, contains,
+                    procs, unit_s, rest, module_name);
+            } catch (...) {
+                // SemanticAbort included: the serial loop reports the error
+                passed[t] = false;
+            }
+        };
+        std::vector<std::thread> threads;
+        try {
+            for (size_t t = 1; t < n_threads; t++) {
+                threads.emplace_back(work, t);
+            }
+        } catch (const std::system_error &) {
+            // The threads that did not start leave `passed` false
+        }
+        work(0);
+        for (auto &th : threads) th.join();
+        for (char ok : passed) {
+            if (!ok) return false;
+        }
+
+        for (auto &p : procs) {
+            deserialize_symbol_into(al, p.analyzed, *unit, (ASR::symbol_t*)p.f);
+        }
+        SymbolTable external_symtab(nullptr);
+        fix_external_symbols(*unit, external_symtab);
+        // The IDs of the symbol tables created by the workers depend on the
+        // scheduling
+        for (auto &p : procs) {
+            std::vector<SymbolTable*> tables;
+            collect_symtabs(p.f->m_symtab, tables);
+            for (SymbolTable *s : tables) {
+                if (s->counter > counter_start) s->reset_counter();
+            }
+        }
+
+        // The serial loop would have shown each procedure the final flags of
+        // the procedures analyzed before it, a worker showed the initial
+        // ones (true, checked above) for those of the other workers. The
+        // flags of a procedure only turn false, so the serial result is the
+        // worker's result and the final flags of the earlier callees.
+        std::vector<ASR::Function_t*> order;
+        for (size_t i = 0; i < n_contains; i++) {
+            analysis_order(*contains[i], m->m_symtab, order);
+        }
+        std::map<ASR::Function_t*, size_t> position;
+        for (size_t k = 0; k < order.size(); k++) position[order[k]] = k;
+        bool rollback = false;
+        for (size_t k = 0; k < order.size() && !rollback; k++) {
+            ASR::Function_t *f = order[k];
+            CalledProcedures c;
+            for (size_t i = 0; i < f->n_body; i++) c.visit_stmt(*f->m_body[i]);
+            bool deterministic = f->m_deterministic;
+            bool side_effect_free = f->m_side_effect_free;
+            for (ASR::Function_t *g : c.called) {
+                auto it = position.find(g);
+                if (it != position.end() && it->second < k) {
+                    deterministic = deterministic && g->m_deterministic;
+                    side_effect_free = side_effect_free && g->m_side_effect_free;
+                }
+            }
+            if (side_effect_free != f->m_side_effect_free
+                    && ASRUtils::get_FunctionType(f)->m_pure) {
+                // check_pure_function() would have run, leave the error to
+                // the serial loop
+                rollback = true;
+            }
+            f->m_deterministic = deterministic;
+            f->m_side_effect_free = side_effect_free;
+        }
+        if (rollback) {
+            for (auto &p : procs) {
+                deserialize_symbol_into(al, p.baseline, *unit,
+                    (ASR::symbol_t*)p.f);
+            }
+            fix_external_symbols(*unit, external_symtab);
+            return false;
+        }
+
+        for (auto &p : procs) {
+            diag.diagnostics.insert(diag.diagnostics.end(),
+                p.diagnostics.begin(), p.diagnostics.end());
+            for (auto &d : p.module_dependencies) {
+                current_module_dependencies.push_back(al, s2c(al, d));
+            }
+        }
+        return true;
+    }
+
     template <typename T>
     void visit_SubmoduleModuleCommon(const T& x) {
         SymbolTable *old_scope = current_scope;
@@ -4315,12 +4777,14 @@ public:
         // We have to visit unit_decl_2 because in the example, the Template is directly inside the module and
         // Template is a unit_decl_2
 
-        for (size_t i=0; i<x.n_contains; i++) {
-            try {
-                visit_program_unit(*x.m_contains[i]);
-            } catch (const SemanticAbort &a) {
-                if (!compiler_options.continue_compilation) {
-                    throw a;
+        if (!visit_contains_concurrently(x.m_contains, x.n_contains, v)) {
+            for (size_t i=0; i<x.n_contains; i++) {
+                try {
+                    visit_program_unit(*x.m_contains[i]);
+                } catch (const SemanticAbort &a) {
+                    if (!compiler_options.continue_compilation) {
+                        throw a;
+                    }
                 }
             }
         }
@@ -4341,10 +4805,12 @@ public:
     }
 
     void visit_Submodule(const AST::Submodule_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Submodule", x.m_name, &al);
         visit_SubmoduleModuleCommon(x);
     }
 
     void visit_Module(const AST::Module_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Module", x.m_name, &al);
         visit_SubmoduleModuleCommon(x);
     }
 
@@ -4397,6 +4863,7 @@ public:
 
 
     void visit_Program(const AST::Program_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Program", x.m_name, &al);
         program_count++;
         if (program_count >= 2) {
         return;  // Just skip 
@@ -4818,6 +5285,7 @@ public:
     }
 
     void visit_Subroutine(const AST::Subroutine_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Procedure", x.m_name, &al);
     // TODO: add SymbolTable::lookup_symbol(), which will automatically return
     // an error
     // TODO: add SymbolTable::get_symbol(), which will only check in Debug mode
@@ -4919,6 +5387,7 @@ public:
     }
 
     void visit_Function(const AST::Function_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Procedure", x.m_name, &al);
         starting_m_body = x.m_body;
         starting_n_body = x.n_body;
         collect_labels();
@@ -8357,7 +8826,7 @@ public:
         for (size_t i = 0; i < x.n_clauses; i++) {
             std::string clause = AST::down_cast<AST::String_t>(x.m_clauses[i])->m_s;
             std::string clause_name = clause.substr(0, clause.find('('));
-            if (clause_name == "private" || clause_name == "reduction" || clause_name == "shared" || clause_name == "firstprivate" || clause_name == "collapse" || clause_name == "num_teams" || clause_name == "thread_limit" || clause_name == "schedule" || clause_name == "num_threads" || clause_name == "map" || clause_name == "device") {
+            if (clause_name == "private" || clause_name == "reduction" || clause_name == "shared" || clause_name == "firstprivate" || clause_name == "collapse" || clause_name == "num_teams" || clause_name == "thread_limit" || clause_name == "schedule" || clause_name == "num_threads" || clause_name == "map" || clause_name == "device" || clause_name == "simdlen" || clause_name == "safelen") {
                 std::string list = clause.substr(clause.find('(') + 1, clause.size() - clause_name.size() - 2);
                 Vec<ASR::expr_t*> vars;
                 vars.reserve(al, 1);
@@ -8414,6 +8883,15 @@ public:
                     int num_teams = std::stoi(list.erase(0, list.find_first_not_of(" "))); // Get the value of N
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPNumTeams_t(al, loc, ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, num_teams, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)))))));
                     continue;
+                } else if (clause_name == "simdlen" || clause_name == "safelen") {
+                    int len = std::stoi(list.erase(0, list.find_first_not_of(" "))); // Get the value of N
+                    ASR::expr_t* len_expr = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, len, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4))));
+                    if (clause_name == "simdlen") {
+                        clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPSimdlen_t(al, loc, len_expr)));
+                    } else {
+                        clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPSafelen_t(al, loc, len_expr)));
+                    }
+                    continue;
                 } else if (clause_name == "device") {
                     int dev = std::stoi(list.erase(0, list.find_first_not_of(" "))); // Get the value of N
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPDevice_t(al, loc, ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, dev, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)))))));
@@ -8508,6 +8986,9 @@ public:
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
                         ASR::make_OMPReduction_t(al, loc, op, vars.p, vars.n)));
                 }
+            } else if (clause_name == "aligned") {
+                // Only an optimization hint, the backends do not use it yet
+                continue;
             } else {
                 diag.add(Diagnostic("The clause " + clause_name + " is not supported for parallel sections", Level::Error, Stage::Semantic, {Label("", {loc})}));
                 throw SemanticAbort();
@@ -8536,6 +9017,8 @@ public:
                     collect_omp_body(ASR::omp_region_typeType::Section);
                     // Now collect stmts of all Sections inside the parallel sections and add it in body of ParallelSections OMPRegion_t
                     collect_omp_body(ASR::omp_region_typeType::Sections);
+                } else if (LCompilers::startswith(x.m_construct_name, "simd")) {
+                    collect_omp_body(ASR::omp_region_typeType::Simd);
                 } else if (LCompilers::startswith(x.m_construct_name, "single")) {
                     collect_omp_body(ASR::omp_region_typeType::Single);
                 } else if (LCompilers::startswith(x.m_construct_name, "master")) {
@@ -8592,6 +9075,15 @@ public:
                 body.reserve(al, 0);
                 omp_region_body.push_back(ASRUtils::STMT(
                     ASR::make_OMPRegion_t(al, loc, ASR::omp_region_typeType::Do, clauses.p, clauses.n, body.p, body.n)));
+            } else if (to_lower(x.m_construct_name) == "simd") {
+                pragma_nesting_level_2++;
+                Vec<ASR::omp_clause_t*> clauses;
+                clauses = get_clauses(x);
+
+                Vec<ASR::stmt_t*> body;
+                body.reserve(al, 0);
+                omp_region_body.push_back(ASRUtils::STMT(
+                    ASR::make_OMPRegion_t(al, loc, ASR::omp_region_typeType::Simd, clauses.p, clauses.n, body.p, body.n)));
             } else if (to_lower(x.m_construct_name) == "parallel do") {
                 pragma_nesting_level_2++;
                 Vec<ASR::omp_clause_t*> clauses;
@@ -8804,6 +9296,7 @@ Result<ASR::TranslationUnit_t*> body_visitor(Allocator &al,
         std::map<uint32_t, std::vector<ASR::stmt_t*>> &data_structure,
         LCompilers::LocationManager &lm)
 {
+    TimeTraceScope trace(compiler_options.po.time_trace, "BodyVisitor", "", &al);
     BodyVisitor b(al, unit, diagnostics, compiler_options, implicit_mapping,
         common_variables_hash, common_variables_byte_offset,
         external_procedures_mapping,
@@ -11,6 +11,8 @@
 #include <libasr/pass/intrinsic_function_registry.h>
 #include <libasr/pass/intrinsic_array_function_registry.h>
 #include <libasr/pass/intrinsic_subroutine_registry.h>
+#include <libasr/perfect_hash.h>
+#include <libasr/time_trace.h>
 #include <lfortran/utils.h>
 #include <lfortran/semantics/comptime_eval.h>
 #include <lfortran/semantics/asr_implicit_cast_rules.h>
@@ -29,9 +31,7 @@ using LCompilers::diag::Diagnostic;
 
 namespace LCompilers::LFortran {
 
-static std::map<std::string, std::vector<ASR::Variable_t*>> vars_with_deferred_struct_declaration;
-static std::map<std::string, int> assumed_rank_arrays;
-static int PDT_SENTINEL = 1000;
+static const int PDT_SENTINEL = 1000;
 
 template <typename T>
 void extract_bind(T &x, ASR::abiType &abi_type, char *&bindc_name, diag::Diagnostics &diag) {
@@ -139,6 +139,7 @@ static inline int64_t stmt_label(AST::stmt_t *f)
         LFORTRAN_STMT_LABEL_TYPE(SyncImages)
         LFORTRAN_STMT_LABEL_TYPE(SyncMemory)
         LFORTRAN_STMT_LABEL_TYPE(SyncTeam)
+        LFORTRAN_STMT_LABEL_TYPE(Wait)
         LFORTRAN_STMT_LABEL_TYPE(Write)
         LFORTRAN_STMT_LABEL_TYPE(AssociateBlock)
         LFORTRAN_STMT_LABEL_TYPE(Block)
@@ -175,7 +176,7 @@ class ImpliedDoLoopValuesVisitor : public ASR::BaseWalkVisitor<ImpliedDoLoopValu
     ASR::expr_t* value;
     ASR::ttype_t* type;
     diag::Diagnostics& diag;
-    const std::map<ASRUtils::IntrinsicElementalFunctions, size_t> name2signature_varargs = {
+    inline static const std::map<ASRUtils::IntrinsicElementalFunctions, size_t> name2signature_varargs = {
         // max0 can accept any arbitrary number of arguments 2<=x<=100
         {ASRUtils::IntrinsicElementalFunctions::Max, 100},
         // min0 can accept any arbitrary number of arguments 2<=x<=100
@@ -1647,7 +1648,7 @@ public:
         {AST::intrinsicopType::CONCAT, "~concat"}
     };
 
-    std::map<std::string, IntrinsicSignature> name2signature = {
+    inline static const PerfectHashMap<IntrinsicSignature> name2signature = {
         {"any", IntrinsicSignature({"mask", "dim"}, 1, 2)},
         {"all", IntrinsicSignature({"mask", "dim"}, 1, 2)},
         {"iany", IntrinsicSignature({"array", "dim", "mask"}, 1, 3)},
@@ -1827,7 +1828,8 @@ public:
     };
 
 
-    std::map<std::string, std::pair<std::string, std::vector<std::string>>> intrinsic_mapping = {
+    inline static const PerfectHashMap<std::pair<std::string,
+            std::vector<std::string>>> intrinsic_mapping = {
         {"iabs", {"abs", {"int4"}}},
         {"dabs", {"abs", {"real8"}}},
         {"cabs", {"abs", {"complex4"}}},
@@ -1982,6 +1984,14 @@ public:
     // Attributes defined before declaration
     std::map<std::string, ASR::symbol_t*> symbols_having_only_attributes_without_type;
 
+    // Variables of a derived type that is defined later, by the type's name;
+    // their types are resolved when the type is visited. A member, not a
+    // global: entries left by one file must not point into the next one.
+    std::map<std::string, std::vector<ASR::Variable_t*>> vars_with_deferred_struct_declaration;
+
+    // Ranks of the assumed rank arrays in SELECT RANK blocks, by name
+    std::map<std::string, int> assumed_rank_arrays;
+
     // procedures explicitly declared with 'intrinsic' attribute
     // e.g. a declaration like: 'intrinsic abs' for an intrinsic
     // elemental function 'abs'
@@ -2193,8 +2203,8 @@ public:
                 std::string intrinsic_name = var_name;
                 std::vector<std::string> arg_types;
                 if (intrinsic_mapping.count(var_name) > 0) {
-                    intrinsic_name = intrinsic_mapping[var_name].first;
-                    arg_types = intrinsic_mapping[var_name].second;
+                    intrinsic_name = intrinsic_mapping.at(var_name).first;
+                    arg_types = intrinsic_mapping.at(var_name).second;
                 }
                 if (intrinsic_procedures.is_intrinsic(intrinsic_name)) {
                     v = resolve_intrinsic_function(loc, intrinsic_name);
@@ -3238,7 +3248,15 @@ public:
             }
             int tmp_curr_value = (int) curr_value;
             curr_value += size_of_array;
+            AST::expr_t* prev_ast_value = nullptr;
+            ASR::expr_t* prev_value = nullptr;
             for (int j= tmp_curr_value; j < (int) curr_value; j++) {
+                // A repeat `r*c` was expanded into `r` copies of the same
+                // node; it is checked and folded only for the first of them
+                if (j < (int) a->n_value && a->m_value[j] == prev_ast_value) {
+                    body.push_back(al, prev_value);
+                    continue;
+                }
                 // Get the Type of Object
                 // If object is Real, set current_variable_type to Real
                 // This type flag is passed to Visit_BOZ, 
@@ -3297,6 +3315,8 @@ public:
                 ASR::expr_t* expression_value = ASRUtils::expr_value(value);
                 if (expression_value) {
                     body.push_back(al, expression_value);
+                    prev_ast_value = a->m_value[j];
+                    prev_value = expression_value;
                 } else {
                     diag.add(Diagnostic(
                         "The value in data must be a constant",
@@ -6559,6 +6579,10 @@ public:
                                 is_nopass_attr = true;
                             } else if (sa->m_attr == AST::simple_attributeType::AttrVolatile) {
                                 is_volatile = true;
+                            } else if (sa->m_attr == AST::simple_attributeType::AttrAsynchronous) {
+                                // A pending asynchronous transfer may access the variable
+                                // until the matching WAIT, so keep every access in memory
+                                is_volatile = true;
                             } else if (sa->m_attr == AST::simple_attributeType::AttrProtected) {
                                 is_protected = true;
                             } else if (sa->m_attr == AST::simple_attributeType::AttrKind) {
@@ -11318,7 +11342,7 @@ public:
             
             std::string intrinsic_name = func_name;
             if (intrinsic_mapping.count(func_name) > 0) {
-                intrinsic_name = intrinsic_mapping[func_name].first;
+                intrinsic_name = intrinsic_mapping.at(func_name).first;
             }
             
             if (ASRUtils::IntrinsicElementalFunctionRegistry::is_intrinsic_function(intrinsic_name)) {
@@ -13430,7 +13454,8 @@ public:
                 if(ASRUtils::is_value_constant(argument)){ // Set value
                     double d_val {};
                     ASRUtils::extract_value_(ASRUtils::expr_value(argument), d_val);
-                    compile_time_value = std::to_string(d_val);
+                    compile_time_value = float_to_str_shortest(d_val,
+                        ASRUtils::extract_kind_from_ttype_t(ASRUtils::expr_type(argument)) == 4);
                 }
             break;
             default:
@@ -14018,7 +14043,7 @@ public:
         if( name2signature.find(var_name) == name2signature.end() ) {
             return IntrinsicSignature({}, 1, 1);
         }
-        return name2signature[var_name];
+        return name2signature.at(var_name);
     }
 
     bool is_intrinsic_registry_function(std::string var_name) {
@@ -14175,10 +14200,10 @@ public:
         for (size_t i = 0; i < arg_size; i++) {
             std::string argument_type = "";
             if (array_intrinsic_mapping_names.find(intrinsic_name) != array_intrinsic_mapping_names.end()) {
-                argument_type = intrinsic_mapping[intrinsic_name].second[0];
+                argument_type = intrinsic_mapping.at(intrinsic_name).second[0];
             } else {
-                if(i < intrinsic_mapping[intrinsic_name].second.size()){
-                    argument_type = intrinsic_mapping[intrinsic_name].second[i];
+                if(i < intrinsic_mapping.at(intrinsic_name).second.size()){
+                    argument_type = intrinsic_mapping.at(intrinsic_name).second[i];
                 } else {
                     diag.add(Diagnostic("Too many arguments to call `" + intrinsic_name + "`",
                         Level::Error, Stage::Semantic, {Label("", {loc})}));
@@ -14396,7 +14421,7 @@ public:
             is_function = false;
             if (is_specific_type_intrinsic) {
                 specific_var_name = var_name;
-                var_name = intrinsic_mapping[var_name].first;
+                var_name = intrinsic_mapping.at(var_name).first;
             }
             if( ASRUtils::IntrinsicElementalFunctionRegistry::is_intrinsic_function(var_name) ||
                     ASRUtils::IntrinsicArrayFunctionRegistry::is_intrinsic_function(var_name) ) {
@@ -15142,7 +15167,7 @@ public:
         T res;
         if constexpr (std::is_same_v<T,bool>) {
             res = ASR::down_cast<ASR::LogicalConstant_t>(visitor.value)->m_value;
-        } else if constexpr (std::is_same_v<T,int>) {
+        } else if constexpr (std::is_integral_v<T>) {
             res = ASR::down_cast<ASR::IntegerConstant_t>(visitor.value)->m_n;
         } else if constexpr (std::is_same_v<T,float> || std::is_same_v<T,double>) {
             res = ASR::down_cast<ASR::RealConstant_t>(visitor.value)->m_r;
@@ -15193,6 +15218,7 @@ public:
             increment = 1;
         }
 
+        ImpliedDoLoopValuesVisitor visitor(al, loop_vars, loop_indices, nullptr, idl->m_type, diag);
         for ( int j = start; j <= end; j += increment ) {
             loop_indices[curr_nesting_level] = j;
             for ( size_t i = 0; i < idl->n_values; i++ ) {
@@ -15200,7 +15226,6 @@ public:
                     curr_nesting_level++;
                     populate_compiletime_array_for_idl(ASR::down_cast<ASR::ImpliedDoLoop_t>(idl->m_values[i]), array, loop_vars, loop_indices, curr_nesting_level, itr);
                 } else {
-                    ImpliedDoLoopValuesVisitor visitor(al, loop_vars, loop_indices, nullptr, idl->m_type, diag);
                     array.push_back(al, get_constant_value<T>(idl->m_values[i], visitor));
                     itr++;
                 }
@@ -15209,6 +15234,15 @@ public:
         curr_nesting_level--;
     }
 
+    template<typename T>
+    void* compiletime_idl_data(ASR::ImpliedDoLoop_t* idl, std::vector<ASR::symbol_t*> &loop_vars,
+            std::vector<int> &loop_indices, int &itr) {
+        Vec<T> array; array.reserve(al, 1);
+        int curr_nesting_level = 0;
+        populate_compiletime_array_for_idl(idl, array, loop_vars, loop_indices, curr_nesting_level, itr);
+        return &array.p[0];
+    }
+
     void visit_ImpliedDoLoop(const AST::ImpliedDoLoop_t& x) {
         if (compiler_options.implicit_typing) {
             if (!in_Subroutine) {
@@ -15309,9 +15343,13 @@ public:
             // TODO: handle multiple types
             // populate compiletime array
             if (ASRUtils::is_integer(*type)) {
-                Vec<int> array; array.reserve(al, 1);
-                populate_compiletime_array_for_idl(idl, array, loop_vars, loop_indices, curr_nesting_level, itr);
-                data = &array.p[0];
+                // Packed at the element kind, the layout ArrayConstant expects
+                switch (ASRUtils::extract_kind_from_ttype_t(type)) {
+                    case 1: data = compiletime_idl_data<int8_t>(idl, loop_vars, loop_indices, itr); break;
+                    case 2: data = compiletime_idl_data<int16_t>(idl, loop_vars, loop_indices, itr); break;
+                    case 8: data = compiletime_idl_data<int64_t>(idl, loop_vars, loop_indices, itr); break;
+                    default: data = compiletime_idl_data<int32_t>(idl, loop_vars, loop_indices, itr); break;
+                }
             } else if (ASRUtils::is_logical(*type)) {
                 Vec<bool> array; array.reserve(al, 1);
                 populate_compiletime_array_for_idl(idl, array, loop_vars, loop_indices, curr_nesting_level, itr);
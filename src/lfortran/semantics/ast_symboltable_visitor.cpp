@@ -473,6 +473,7 @@ public:
     }
 
     void visit_Module(const AST::Module_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Module", x.m_name, &al);
         if (compiler_options.implicit_typing) {
             Location a_loc = x.base.base.loc;
             populate_implicit_dictionary(a_loc, implicit_dictionary);
@@ -512,6 +513,7 @@ public:
     }
 
     void visit_Submodule(const AST::Submodule_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Submodule", x.m_name, &al);
         in_submodule = true;
         std::string parent_name;
         if (x.m_parent_name) {
@@ -541,6 +543,7 @@ public:
     }
 
     void visit_Program(const AST::Program_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Program", x.m_name, &al);
         // Check for multiple program units in the same file 
         program_count++;
         if (program_count == 1) {
@@ -1189,6 +1192,7 @@ public:
     }
 
     void visit_Subroutine(const AST::Subroutine_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Procedure", x.m_name, &al);
         in_Subroutine = true;
         SetChar current_function_dependencies_copy = current_function_dependencies;
         current_function_dependencies.clear(al);
@@ -1662,6 +1666,7 @@ public:
     }
 
     void visit_Function(const AST::Function_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Procedure", x.m_name, &al);
         in_Subroutine = true;
         SetChar current_function_dependencies_copy = current_function_dependencies;
         current_function_dependencies.clear(al);
@@ -4880,6 +4885,7 @@ Result<ASR::asr_t*> symbol_table_visitor(Allocator &al, AST::TranslationUnit_t &
         std::map<std::string, std::vector<int>> &entry_function_arguments_mapping,
         std::map<uint32_t, std::vector<ASR::stmt_t*>> &data_structure, LCompilers::LocationManager &lm)
 {
+    TimeTraceScope trace(compiler_options.po.time_trace, "SymbolTableVisitor", "", &al);
     SymbolTableVisitor v(al, symbol_table, diagnostics, compiler_options,
                          implicit_mapping, common_variables_hash,
                          common_variables_byte_offset, external_procedures_mapping,
@@ -7,6 +7,7 @@
 #include <lfortran/ast.h>
 #include <libasr/bigint.h>
 #include <libasr/string_utils.h>
+#include <libasr/perfect_hash.h>
 #include <lfortran/utils.h>
 #include <lfortran/semantics/semantic_exception.h>
 
@@ -52,10 +53,10 @@ struct IntrinsicProceduresAsASRNodes {
 };
 
 struct IntrinsicProcedures {
-    const std::string m_builtin = "lfortran_intrinsic_builtin";
-    const std::string m_ieee_arithmetic = "lfortran_intrinsic_ieee_arithmetic";
-    const std::string m_iso_c_binding = "lfortran_intrinsic_iso_c_binding";
-    const std::string m_custom = "lfortran_intrinsic_custom";
+    inline static const std::string m_builtin = "lfortran_intrinsic_builtin";
+    inline static const std::string m_ieee_arithmetic = "lfortran_intrinsic_ieee_arithmetic";
+    inline static const std::string m_iso_c_binding = "lfortran_intrinsic_iso_c_binding";
+    inline static const std::string m_custom = "lfortran_intrinsic_custom";
 
     /*
         The last parameter is true if the callback accepts evaluated arguments.
@@ -70,10 +71,12 @@ struct IntrinsicProcedures {
     */
 
     typedef ASR::expr_t* (*comptime_eval_callback)(Allocator &, const Location &, Vec<ASR::expr_t*> &, const CompilerOptions &);
-    std::map<std::string, std::tuple<std::string, comptime_eval_callback, bool>> comptime_eval_map;
+    typedef std::tuple<std::string, comptime_eval_callback, bool> comptime_eval_entry;
 
-    IntrinsicProcedures() {
-        comptime_eval_map = {
+    // Built once on first use and shared by every visitor, like the
+    // intrinsic registries
+    static const PerfectHashMap<comptime_eval_entry>& comptime_eval_map() {
+        static const PerfectHashMap<comptime_eval_entry> map = {
             // Arguments can be evaluated or not
             // real and int get transformed into ExplicitCast
             // in intrinsic_function_transformation()
@@ -92,11 +95,12 @@ struct IntrinsicProcedures {
             {"ieee_logb", {m_ieee_arithmetic, &not_implemented, false}},
             {"ieee_rem", {m_ieee_arithmetic, &not_implemented, false}},
         };
+        return map;
     }
 
     bool is_intrinsic(std::string name) const {
-        auto search = comptime_eval_map.find(name);
-        if (search != comptime_eval_map.end()) {
+        auto search = comptime_eval_map().find(name);
+        if (search != comptime_eval_map().end()) {
             return true;
         } else {
             return false;
@@ -104,8 +108,8 @@ struct IntrinsicProcedures {
     }
 
     std::string get_module(std::string name, const Location &loc, diag::Diagnostics &diag) const {
-        auto search = comptime_eval_map.find(name);
-        if (search != comptime_eval_map.end()) {
+        auto search = comptime_eval_map().find(name);
+        if (search != comptime_eval_map().end()) {
             std::string module_name = std::get<0>(search->second);
             return module_name;
         } else {
@@ -119,8 +123,8 @@ struct IntrinsicProcedures {
     }
 
     ASR::expr_t *comptime_eval(std::string name, Allocator &al, const Location &loc, Vec<ASR::call_arg_t>& args, const CompilerOptions &compiler_options) const {
-        auto search = comptime_eval_map.find(name);
-        if (search != comptime_eval_map.end()) {
+        auto search = comptime_eval_map().find(name);
+        if (search != comptime_eval_map().end()) {
             comptime_eval_callback cb = std::get<1>(search->second);
             bool eval_args = std::get<2>(search->second);
             if (eval_args) {
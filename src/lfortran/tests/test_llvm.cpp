@@ -1167,7 +1167,6 @@ end function
     CHECK(r.result.type == FortranEvaluator::EvalResult::integer4);
     CHECK(r.result.i32 == 4);
 
-/*
     r = e.evaluate2(R"(
 integer function fn(i)
 integer, intent(in) :: i
@@ -1180,7 +1179,99 @@ end function
     CHECK(r.ok);
     CHECK(r.result.type == FortranEvaluator::EvalResult::integer4);
     CHECK(r.result.i32 == 2);
-*/
+
+    // Not while another procedure calls it
+    r = e.evaluate2(R"(
+integer function gn(i)
+integer, intent(in) :: i
+gn = fn(i)*10
+end function
+)");
+    CHECK(r.ok);
+    r = e.evaluate2(R"(
+integer function fn(i)
+integer, intent(in) :: i
+fn = i
+end function
+)");
+    CHECK(!r.ok);
+    r = e.evaluate2("gn(3)");
+    CHECK(r.ok);
+    CHECK(r.result.i32 == 20);
+}
+
+TEST_CASE("FortranEvaluator JIT modules") {
+    CompilerOptions cu;
+    cu.interactive = true;
+    cu.po.runtime_library_dir = LCompilers::LFortran::get_runtime_library_dir();
+    FortranEvaluator e(cu);
+    LCompilers::Result<FortranEvaluator::EvalResult>
+    r = e.evaluate2("integer :: i");
+    CHECK(r.ok);
+    size_t jit_modules = r.result.jit_modules;
+    CHECK(jit_modules > 0);
+    r = e.evaluate2("i = 0");
+    CHECK(r.ok);
+    // Statements are dropped from the JIT once they have run
+    for (int k = 0; k < 50; k++) {
+        r = e.evaluate2("i = i + 1");
+        CHECK(r.ok);
+        CHECK(r.result.jit_modules == jit_modules);
+    }
+    r = e.evaluate2("i");
+    CHECK(r.ok);
+    CHECK(r.result.type == FortranEvaluator::EvalResult::integer4);
+    CHECK(r.result.i32 == 50);
+    CHECK(r.result.jit_modules == jit_modules);
+
+    // Procedures stay
+    r = e.evaluate2(R"(
+integer function twice(j)
+integer, intent(in) :: j
+twice = 2*j
+end function
+)");
+    CHECK(r.ok);
+    CHECK(r.result.jit_modules == jit_modules + 1);
+    r = e.evaluate2("twice(i)");
+    CHECK(r.ok);
+    CHECK(r.result.i32 == 100);
+}
+
+TEST_CASE("FortranEvaluator compact") {
+    CompilerOptions cu;
+    cu.interactive = true;
+    cu.po.runtime_library_dir = LCompilers::LFortran::get_runtime_library_dir();
+    FortranEvaluator e(cu);
+    LCompilers::Result<FortranEvaluator::EvalResult>
+    r = e.evaluate2(R"(
+integer function twice(j)
+integer, intent(in) :: j
+twice = 2*j
+end function
+)");
+    CHECK(r.ok);
+    r = e.evaluate2("integer :: i");
+    CHECK(r.ok);
+    r = e.evaluate2("i = 0");
+    CHECK(r.ok);
+    e.compact();
+    size_t live = e.get_al().size_used();
+    for (int k = 0; k < 50; k++) {
+        r = e.evaluate2("i = i + twice(1)");
+        CHECK(r.ok);
+    }
+    CHECK(e.get_al().size_used() > live);
+    // What the 50 cells allocated is freed, what they defined stays
+    e.compact();
+    CHECK(e.get_al().size_used() <= live + 1024);
+    r = e.evaluate2("i");
+    CHECK(r.ok);
+    CHECK(r.result.type == FortranEvaluator::EvalResult::integer4);
+    CHECK(r.result.i32 == 100);
+    r = e.evaluate2("twice(i)");
+    CHECK(r.ok);
+    CHECK(r.result.i32 == 200);
 }
 
 TEST_CASE("FortranEvaluator asr verify 1") {
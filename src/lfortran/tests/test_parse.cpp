@@ -8,6 +8,7 @@
 #include <lfortran/parser/parser.h>
 #include <lfortran/parser/parser.tab.hh>
 #include <libasr/bigint.h>
+#include <libasr/perfect_hash.h>
 
 using LCompilers::LFortran::parse;
 using LCompilers::TRY;
@@ -389,6 +390,9 @@ TEST_CASE("Test LFortran::Allocator") {
     // so the chunk will be equal to what we asked (1024) plus alignment (8)
     al.alloc(1024);
     CHECK(al.size_total() == 1032);
+
+    // Everything handed out so far: 32 + 32 + 96 (90 aligned) + 1024
+    CHECK(al.size_used() == 1184);
 }
 
 TEST_CASE("Test LFortran::Allocator 2") {
@@ -407,6 +411,105 @@ TEST_CASE("Test LFortran::Allocator 2") {
     v->~vector<int>();
 }
 
+TEST_CASE("Test LFortran::Allocator checkpoint") {
+    Allocator al(32);
+    int *p = al.allocate<int>(5);
+    p[4] = 7;
+#if defined(WITH_LFORTRAN_ASSERT)
+    CHECK(al.size_requested() == 20);
+#endif
+    CHECK(al.size_used() == 24);
+    Allocator::Checkpoint cp = al.checkpoint();
+
+    // The 16 bytes left in the first chunk are wasted
+    al.alloc(32);
+    CHECK(al.size_total() == 80);
+    CHECK(al.size_wasted() == 16);
+    al.alloc(200);
+    CHECK(al.size_total() == 208);
+    CHECK(al.size_wasted() == 16 + 48);
+    CHECK(al.num_chunks() == 3);
+    CHECK(al.size_reserved() == 40 + 80 + 208);
+
+    // Back to the first chunk; the released ones are kept
+    al.rewind(cp);
+    CHECK(p[4] == 7);
+    CHECK(al.num_chunks() == 1);
+    CHECK(al.size_total() == 40);
+    CHECK(al.size_used() == 24);
+#if defined(WITH_LFORTRAN_ASSERT)
+    CHECK(al.size_requested() == 20);
+#endif
+    CHECK(al.size_wasted() == 0);
+    CHECK(al.size_reserved() == 40 + 80 + 208);
+
+    // and reused in the same order
+    al.alloc(32);
+    CHECK(al.num_chunks() == 2);
+    CHECK(al.size_total() == 80);
+    al.alloc(200);
+    CHECK(al.num_chunks() == 3);
+    CHECK(al.size_total() == 208);
+    CHECK(al.size_reserved() == 40 + 80 + 208);
+
+    // A released chunk too small for the request is freed
+    al.rewind(cp);
+    al.alloc(100);
+    CHECK(al.num_chunks() == 2);
+    CHECK(al.size_total() == 208);
+    CHECK(al.size_reserved() == 40 + 208);
+
+    al.rewind(cp);
+    al.trim();
+    CHECK(al.size_reserved() == 40);
+    CHECK(al.size_used() == 24);
+}
+
+TEST_CASE("Test LCompilers::PerfectHashMap") {
+    LCompilers::PerfectHashMap<int> empty = {};
+    CHECK(empty.size() == 0);
+    CHECK(empty.find("sin") == empty.end());
+    CHECK(empty.count("") == 0);
+
+    LCompilers::PerfectHashMap<int> m = {
+        {"sin", 1}, {"cos", 2}, {"", 3}, {"sinh", 4}, {"cos", 5}};
+    // A repeated key keeps its first value, iteration is in initializer order
+    CHECK(m.size() == 4);
+    CHECK(m.at("cos") == 2);
+    CHECK(m.at("") == 3);
+    std::vector<int> values;
+    for (auto &e : m) values.push_back(e.second);
+    CHECK(values == std::vector<int>({1, 2, 3, 4}));
+
+    // Misses, including prefixes and extensions of stored keys
+    CHECK(m.find("si") == m.end());
+    CHECK(m.find("sinhh") == m.end());
+    CHECK(m.find("Sin") == m.end());
+    CHECK(m.count("tan") == 0);
+    CHECK_THROWS_AS(m.at("tan"), std::out_of_range);
+
+    // With about one bucket per key many buckets hold several keys, and
+    // keys that differ in one character land in the same slots often
+    std::vector<std::pair<std::string, int>> init;
+    for (int i = 0; i < 1024; i++) {
+        init.push_back({"f" + std::to_string(i), i});
+    }
+    LCompilers::PerfectHashMap<int> big(init);
+    CHECK(big.size() == 1024);
+    int found = 0;
+    for (int i = 0; i < 1024; i++) {
+        auto it = big.find("f" + std::to_string(i));
+        if (it != big.end() && it->second == i) found++;
+    }
+    CHECK(found == 1024);
+    int missed = 0;
+    for (int i = 1024; i < 4096; i++) {
+        if (big.find("f" + std::to_string(i)) == big.end()) missed++;
+        if (big.find("g" + std::to_string(i - 1024)) == big.end()) missed++;
+    }
+    CHECK(missed == 2 * 3072);
+}
+
 using tt = yytokentype;
 
 TEST_CASE("Tokenizer") {
@@ -333,6 +333,73 @@ end module
 
 }
 
+// The ASR and the diagnostics of `src`, with the procedure bodies of its
+// modules analyzed on `threads` threads
+std::string asr_semantic_threads(const std::string &src, int threads) {
+    Allocator al(4*1024);
+
+    LCompilers::SymbolTable::reset_global_counter();
+    LCompilers::LFortran::AST::TranslationUnit_t* ast0;
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::CompilerOptions compiler_options;
+    compiler_options.semantic_threads = threads;
+    ast0 = TRY(LCompilers::LFortran::parse(al, src, diagnostics, compiler_options));
+    LCompilers::LocationManager lm;
+    LCompilers::ASR::TranslationUnit_t* asr = TRY(LCompilers::LFortran::ast_to_asr(al, *ast0,
+        diagnostics, nullptr, false, compiler_options, lm));
+    LCOMPILERS_ASSERT(LCompilers::asr_verify(*asr, true, diagnostics));
+
+    return LCompilers::pickle(*asr) + diagnostics.render2();
+}
+
+TEST_CASE("ASR with --semantic-threads") {
+    // h() calls g(), which prints, so h() is not side effect free either,
+    // also when g() and h() are analyzed on different threads. No BLOCK or
+    // ASSOCIATE: their symbol tables get different IDs on more threads.
+    std::string src = R"""(
+module semantic_threads_01
+implicit none
+
+contains
+
+integer function f(x)
+integer, intent(in) :: x
+f = 2*x
+end function
+
+subroutine g(y)
+integer, intent(inout) :: y
+y = f(y) + 1
+print *, y
+end subroutine
+
+subroutine h(y)
+integer, intent(inout) :: y
+call g(y)
+y = f(y)
+end subroutine
+
+real function k(a)
+real, intent(in) :: a(:)
+k = sum(a) / size(a)
+end function
+
+end module
+
+program semantic_threads_main
+use semantic_threads_01, only: f, h, k
+implicit none
+integer :: i
+i = f(3)
+call h(i)
+print *, i, k([1.0, 2.0, 3.0])
+end
+)""";
+    std::string serial = asr_semantic_threads(src, 1);
+    CHECK(asr_semantic_threads(src, 2) == serial);
+    CHECK(asr_semantic_threads(src, 4) == serial);
+}
+
 TEST_CASE("Topological sorting mod_int") {
     std::map<std::string, std::vector<std::string>> deps;
     // 1 depends on 2
@@ -0,0 +1,118 @@
+#include <tests/doctest.h>
+
+#include <sstream>
+
+#define RAPIDJSON_HAS_STDSTRING 1
+#include <rapidjson/document.h>
+
+#include <libasr/alloc.h>
+#include <libasr/time_trace.h>
+
+using LCompilers::TimeTrace;
+using LCompilers::TimeTraceScope;
+
+namespace {
+
+const rapidjson::Value *find_event(const rapidjson::Value &events,
+        const std::string &name, const std::string &detail="") {
+    for (auto &e : events.GetArray()) {
+        if (e["name"].GetString() != name) continue;
+        if (!detail.empty() && !(e.HasMember("args")
+                && e["args"].HasMember("detail")
+                && e["args"]["detail"].GetString() == detail)) continue;
+        return &e;
+    }
+    return nullptr;
+}
+
+// `inner` starts and ends within `outer`
+bool nested(const rapidjson::Value &outer, const rapidjson::Value &inner) {
+    int64_t start = outer["ts"].GetInt64();
+    int64_t end = start + outer["dur"].GetInt64();
+    return inner["ts"].GetInt64() >= start
+        && inner["ts"].GetInt64() + inner["dur"].GetInt64() <= end;
+}
+
+} // namespace
+
+TEST_CASE("Test LCompilers::TimeTrace write_json") {
+    TimeTrace trace;
+    Allocator al(1024);
+    {
+        TimeTraceScope pass(&trace, "Pass", "p1", &al);
+        al.alloc(100);
+        TimeTraceScope function(&trace, "Function", "f");
+    }
+    {
+        TimeTraceScope pass(&trace, "Pass", "p2");
+        // A contained procedure counts once in the total of its host
+        TimeTraceScope host(&trace, "Function", "host");
+        TimeTraceScope contained(&trace, "Function", "contained");
+    }
+    {
+        // Rewinding below the start of the span does not wrap around
+        Allocator::Checkpoint cp = al.checkpoint();
+        al.alloc(64);
+        TimeTraceScope rewound(&trace, "Rewound", "", &al);
+        al.rewind(cp);
+    }
+    // Still open, so not written
+    size_t open = trace.begin("Open", "");
+    CHECK(open == trace.events().size() - 1);
+
+    std::ostringstream out;
+    trace.write_json(out);
+    rapidjson::Document d;
+    d.Parse(out.str());
+    REQUIRE(!d.HasParseError());
+    REQUIRE(d.IsObject());
+    REQUIRE(d.HasMember("traceEvents"));
+    const rapidjson::Value &events = d["traceEvents"];
+    REQUIRE(events.IsArray());
+
+    // 6 spans, 3 totals and 2 thread names
+    CHECK(events.Size() == 6 + 3 + 2);
+    CHECK(find_event(events, "Open") == nullptr);
+
+    const rapidjson::Value *p1 = find_event(events, "Pass", "p1");
+    const rapidjson::Value *p2 = find_event(events, "Pass", "p2");
+    const rapidjson::Value *f = find_event(events, "Function", "f");
+    const rapidjson::Value *host = find_event(events, "Function", "host");
+    const rapidjson::Value *contained = find_event(events, "Function",
+        "contained");
+    const rapidjson::Value *rewound = find_event(events, "Rewound");
+    REQUIRE(p1);
+    REQUIRE(p2);
+    REQUIRE(f);
+    REQUIRE(host);
+    REQUIRE(contained);
+    REQUIRE(rewound);
+    for (auto *e : {p1, p2, f, host, contained, rewound}) {
+        CHECK(std::string((*e)["ph"].GetString()) == "X");
+        CHECK((*e)["tid"].GetInt() == 0);
+        CHECK((*e)["dur"].GetInt64() >= 0);
+    }
+    CHECK(nested(*p1, *f));
+    CHECK(nested(*p2, *host));
+    CHECK(nested(*host, *contained));
+    CHECK((*p1)["ts"].GetInt64() + (*p1)["dur"].GetInt64()
+        <= (*p2)["ts"].GetInt64());
+
+    CHECK((*p1)["args"]["bytes"].GetInt64() == 104);
+    CHECK(!(*p2)["args"].HasMember("bytes"));
+    CHECK((*rewound)["args"]["bytes"].GetInt64() == 0);
+    CHECK(!(*rewound)["args"].HasMember("detail"));
+
+    const rapidjson::Value *total_pass = find_event(events, "Total Pass");
+    const rapidjson::Value *total_function = find_event(events,
+        "Total Function");
+    REQUIRE(total_pass);
+    REQUIRE(total_function);
+    CHECK((*total_pass)["tid"].GetInt() == 1);
+    CHECK((*total_pass)["dur"].GetInt64()
+        == (*p1)["dur"].GetInt64() + (*p2)["dur"].GetInt64());
+    CHECK((*total_function)["dur"].GetInt64()
+        == (*f)["dur"].GetInt64() + (*host)["dur"].GetInt64());
+    CHECK(find_event(events, "Total Rewound"));
+    CHECK(find_event(events, "thread_name"));
+}
@@ -0,0 +1,109 @@
+#include <libasr/alloc.h>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#  define HAVE_ALLOC_MMAP
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+// Chunks of at least this size are mapped from the OS rather than taken from
+// malloc(), which may keep freed memory on its heap instead of returning it
+#define ALLOC_MMAP_THRESHOLD (1024*1024)
+#define ALLOC_HUGE_PAGE_SIZE (2*1024*1024)
+
+Allocator::Block Allocator::allocate_block(size_t s, bool huge_pages) {
+#ifdef HAVE_ALLOC_MMAP
+    if (s >= ALLOC_MMAP_THRESHOLD) {
+        size_t page = huge_pages ? ALLOC_HUGE_PAGE_SIZE
+            : (size_t)sysconf(_SC_PAGESIZE);
+        size_t n = (s + page - 1) / page * page;
+        // Huge pages need a huge page aligned range: map one page more than
+        // needed and unmap what sticks out on either side
+        size_t extra = huge_pages ? page : 0;
+        void *p = mmap(nullptr, n + extra, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+            if (extra > 0) {
+                size_t head = (page - (size_t)p % page) % page;
+                if (head > 0) munmap(p, head);
+                if (extra - head > 0) munmap((char*)p + head + n, extra - head);
+                p = (char*)p + head;
+#ifdef MADV_HUGEPAGE
+                madvise(p, n, MADV_HUGEPAGE);
+#endif
+            }
+            return {p, n, true};
+        }
+        // Fall back to malloc()
+    }
+#endif
+    void *p = malloc(s);
+    if (p == nullptr) throw std::runtime_error("malloc failed.");
+    return {p, s, false};
+}
+
+void Allocator::free_block(const Block &b) {
+    if (b.p == nullptr) return;
+#ifdef HAVE_ALLOC_MMAP
+    if (b.mapped) {
+        munmap(b.p, b.size);
+        return;
+    }
+#endif
+    free(b.p);
+}
+
+void *Allocator::new_chunk(size_t s) {
+    // `current_pos` was already advanced past the end by alloc()
+    size_t used = size_current() - align(s);
+    size_previous += used;
+    wasted += size - used;
+    // Reuse the chunks released by rewind() in their original order; the
+    // ones too small for this request are not worth keeping
+    while (!spares.empty() && spares.back().size < s + ALIGNMENT) {
+        free_block(spares.back());
+        spares.pop_back();
+    }
+    Block b;
+    if (!spares.empty()) {
+        b = spares.back();
+        spares.pop_back();
+    } else {
+        b = allocate_block(std::max(s+ALIGNMENT, 2*size), huge_pages);
+    }
+    blocks.push_back(b);
+    start = b.p;
+    current_pos = (size_t)start;
+    current_pos = align(current_pos);
+    size = b.size;
+
+    size_t addr = current_pos;
+    current_pos += align(s);
+
+    LCOMPILERS_ASSERT(size_current() <= size_total());
+    return (void*)addr;
+}
+
+void Allocator::rewind(const Checkpoint &c) {
+    LCOMPILERS_ASSERT(c.block < blocks.size());
+    // The released chunks are kept for new_chunk(), so that an arena rewound
+    // after every file neither maps and unmaps its chunks over and over nor
+    // has to grow them again from the size at the checkpoint. Popping from
+    // `blocks` onto `spares` puts the first chunk to reuse at the back.
+    while (blocks.size() > c.block + 1) {
+        Block b = blocks.back();
+        blocks.pop_back();
+#if defined(HAVE_ALLOC_MMAP) && defined(MADV_DONTNEED)
+        // Keep the mapping, but not its pages
+        if (b.mapped) madvise(b.p, b.size, MADV_DONTNEED);
+#endif
+        spares.push_back(b);
+    }
+    start = blocks[c.block].p;
+    size = blocks[c.block].size;
+    LCOMPILERS_ASSERT(c.pos >= (size_t)start && c.pos <= (size_t)start + size);
+    current_pos = c.pos;
+    size_previous = c.size_previous;
+    wasted = c.wasted;
+    requested = c.requested;
+}
@@ -15,21 +15,80 @@ inline size_t align(size_t n) {
   return (n + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
 }
 
+/*
+   Arena allocator: hands out memory by bumping a pointer in the current
+   chunk and grows by allocating a new chunk of twice the size. Nothing is
+   freed individually; all chunks are released when the Allocator is
+   destroyed, or back to a checkpoint():
+
+       Allocator::Checkpoint cp = al.checkpoint();
+       ... // allocate temporaries for one file, module, request
+       al.rewind(cp);
+
+   or, to rewind on every exit from a scope, `Allocator::Scope s(al);`.
+   The chunks released by rewind() are kept and reused in the same order, so
+   an arena that is rewound after every file or request settles at the size
+   of the largest one instead of growing its chunks from scratch each time.
+
+   Large chunks are mapped directly from the OS (see alloc.cpp), so releasing
+   them lowers the resident set size of long running processes, and can be
+   backed by transparent huge pages (`lfortran --huge-pages`).
+*/
 class Allocator
 {
+    struct Block {
+        void *p;
+        size_t size;
+        bool mapped; // from mmap() rather than malloc()
+    };
+
     void *start;
     size_t current_pos;
     size_t size;
-    std::vector<void*> blocks;
+    size_t size_previous; // bytes used in the chunks before the current one
+    size_t wasted;        // unused tails of the chunks before the current one
+    size_t requested;     // bytes asked for, before alignment (asserts only)
+    std::vector<Block> blocks;
+    // Chunks released by rewind(), the next one to reuse at the back
+    std::vector<Block> spares;
+    bool huge_pages;
+
+    static Block allocate_block(size_t s, bool huge_pages);
+    static void free_block(const Block &b);
 public:
-    Allocator(size_t s) {
-        s += ALIGNMENT;
-        start = malloc(s);
-        if (start == nullptr) throw std::runtime_error("malloc failed.");
+    // Applies to the Allocators created afterwards
+    static inline bool default_huge_pages = false;
+
+    struct Checkpoint {
+        size_t block;
+        size_t pos;
+        size_t size_previous;
+        size_t wasted;
+        size_t requested;
+    };
+
+    // Rewinds the allocator to its position at construction when the scope
+    // is left
+    class Scope {
+        Allocator &al;
+        Checkpoint cp;
+    public:
+        Scope(Allocator &al) : al{al}, cp{al.checkpoint()} {}
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() { al.rewind(cp); }
+    };
+
+    Allocator(size_t s) : huge_pages{default_huge_pages} {
+        Block b = allocate_block(s + ALIGNMENT, huge_pages);
+        start = b.p;
         current_pos = (size_t)start;
         current_pos = align(current_pos);
-        size = s;
-        blocks.push_back(start);
+        size = b.size;
+        size_previous = 0;
+        wasted = 0;
+        requested = 0;
+        blocks.push_back(b);
     }
     Allocator() = delete;
     Allocator(const Allocator&) = delete;
@@ -38,8 +97,9 @@ public:
     Allocator& operator=(const Allocator&&) = delete;
     ~Allocator() {
         for (size_t i = 0; i < blocks.size(); i++) {
-            if (blocks[i] != nullptr) free(blocks[i]);
+            free_block(blocks[i]);
         }
+        trim();
     }
 
     // Allocates `s` bytes of memory, returns a pointer to it
@@ -57,6 +117,9 @@ public:
 #endif
             LCOMPILERS_ASSERT(start != nullptr);
             size_t addr = current_pos;
+#if defined(WITH_LFORTRAN_ASSERT)
+            requested += s;
+#endif
             current_pos += align(s);
             if (size_current() > size_total()) {
 #ifdef LCOMPILERS_FAST_ALLOC
@@ -73,22 +136,28 @@ public:
 #endif
     }
 
-    void *new_chunk(size_t s) {
-        size_t snew = std::max(s+ALIGNMENT, 2*size);
-        start = malloc(snew);
-        blocks.push_back(start);
-        if (start == nullptr) {
-            throw std::runtime_error("malloc failed.");
-        }
-        current_pos = (size_t)start;
-        current_pos = align(current_pos);
-        size = snew;
+    // Defined in alloc.cpp, to keep the inlined alloc() short
+    void *new_chunk(size_t s);
+
+    // Marks the current position, to release everything allocated after it
+    // with rewind()
+    Checkpoint checkpoint() {
+        return {blocks.size() - 1, current_pos, size_previous, wasted,
+            requested};
+    }
+
+    // Frees all memory allocated since `c` was taken. Checkpoints taken after
+    // `c` become invalid. Nothing allocated after `c` may be used afterwards.
+    void rewind(const Checkpoint &c);
 
-        size_t addr = current_pos;
-        current_pos += align(s);
+    // Frees the chunks that rewind() keeps for reuse
+    void trim() {
+        for (auto &b : spares) free_block(b);
+        spares.clear();
+    }
 
-        LCOMPILERS_ASSERT(size_current() <= size_total());
-        return (void*)addr;
+    void set_huge_pages(bool enable) {
+        huge_pages = enable;
     }
 
     // Allocates `n` elements of type T, returns the pointer T* to the first
@@ -120,9 +189,38 @@ public:
         return size;
     }
 
+    // Bytes handed out so far, over all chunks
+    size_t size_used() {
+        return size_previous + size_current();
+    }
+
     size_t num_chunks() {
         return blocks.size();
     }
+
+    // Bytes asked for, before alignment; size_used() minus this is the
+    // alignment padding. Only counted in builds with assertions, to keep
+    // alloc() short; otherwise the same as size_used().
+    size_t size_requested() {
+#if defined(WITH_LFORTRAN_ASSERT)
+        return requested;
+#else
+        return size_used();
+#endif
+    }
+
+    // Bytes left unused at the end of filled chunks
+    size_t size_wasted() {
+        return wasted;
+    }
+
+    // Bytes obtained from the system, including the spare chunks
+    size_t size_reserved() {
+        size_t r = 0;
+        for (auto &b : blocks) r += b.size;
+        for (auto &b : spares) r += b.size;
+        return r;
+    }
 };
 
 #endif
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <iomanip>
 #include <sstream>
 
@@ -19,11 +20,20 @@ std::string hexify(T i)
     return buf.str();
 }
 
-unsigned int symbol_table_counter = 0;
+// Atomic, so that symbol tables created on different threads (see
+// --semantic-threads) still get distinct IDs
+std::atomic<unsigned int> symbol_table_counter{0};
 
 SymbolTable::SymbolTable(SymbolTable *parent) : parent{parent} {
-    symbol_table_counter++;
-    counter = symbol_table_counter;
+    counter = ++symbol_table_counter;
+}
+
+void SymbolTable::reset_counter() {
+    counter = ++symbol_table_counter;
+}
+
+unsigned int SymbolTable::get_global_counter() {
+    return symbol_table_counter;
 }
 
 void SymbolTable::reset_global_counter() {
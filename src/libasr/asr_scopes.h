@@ -35,6 +35,8 @@ struct SymbolTable {
     std::string get_counter() {  // Returns a unique ID as a string
         return std::to_string(counter);
     }
+    void reset_counter(); // Gives this table a new ID, as if constructed now
+    static unsigned int get_global_counter(); // The last ID handed out
     static void reset_global_counter(); // Resets the internal global counter
 
     // Resolves the symbol `name` recursively in current and parent scopes.
@@ -65,6 +65,11 @@ public:
         mark_found(x.base.base.loc, "FLUSH statement");
     }
 
+    void visit_FileWait(const FileWait_t &x) {
+        if (found) return;
+        mark_found(x.base.base.loc, "WAIT statement");
+    }
+
     void visit_SubroutineCall(const SubroutineCall_t &x) {
         if (found) return;
         if (x.m_name) {
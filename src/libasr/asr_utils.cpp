@@ -14,6 +14,7 @@
 #include <libasr/pass/intrinsic_array_function_registry.h>
 
 #include <libasr/asr_builder.h>
+#include <libasr/time_trace.h>
 
 namespace LCompilers {
 
@@ -1316,6 +1317,7 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al
                                                 SymbolTable &symtab, bool intrinsic,
                                                 LCompilers::PassOptions& pass_options,
                                                 LCompilers::LocationManager &lm) {
+    TimeTraceScope trace(pass_options.time_trace, "Load module", msym, &al);
     std::filesystem::path runtime_library_dir { pass_options.runtime_library_dir };
     std::filesystem::path filename {msym + ".mod"};
     std::vector<std::filesystem::path> mod_files_dirs;
@@ -21,6 +21,7 @@
 #include <libasr/asr_walk_visitor.h>
 
 #include <complex>
+#include <cstring>
 #include <string>
 
 #define ADD_ASR_DEPENDENCIES(current_scope, final_sym, current_function_dependencies) ASR::symbol_t* asr_owner_sym = nullptr; \
@@ -7232,6 +7233,135 @@ inline void flatten_ArrayConstant_data(Allocator &al, Vec<ASR::expr_t*> &data, A
     }
 }
 
+// Size in bytes of one numeric or logical element in the data of an
+// ArrayConstant of element type `a_type`, 0 for any other element type
+inline int64_t get_ArrayConstant_element_size(ASR::ttype_t* a_type) {
+    switch (a_type->type) {
+        case ASR::ttypeType::Integer:
+        case ASR::ttypeType::UnsignedInteger:
+        case ASR::ttypeType::Real:
+            return extract_kind_from_ttype_t(a_type);
+        case ASR::ttypeType::Complex:
+            return 2 * extract_kind_from_ttype_t(a_type);
+        case ASR::ttypeType::Logical:
+            return sizeof(bool);
+        default:
+            return 0;
+    }
+}
+
+// Stores one scalar constant at `dest` in the layout of ArrayConstant data.
+// Returns false if `value` is not a constant of exactly `a_type`.
+inline bool pack_ArrayConstant_element(char* dest, ASR::expr_t* value,
+        ASR::ttype_t* a_type, int kind) {
+    if (ASRUtils::expr_type(value)->type != a_type->type ||
+            extract_kind_from_ttype_t(ASRUtils::expr_type(value)) != kind) {
+        return false;
+    }
+    switch (value->type) {
+        case ASR::exprType::IntegerConstant: {
+            int64_t n = ASR::down_cast<ASR::IntegerConstant_t>(value)->m_n;
+            switch (kind) {
+                case 1: { int8_t v = n; std::memcpy(dest, &v, 1); return true; }
+                case 2: { int16_t v = n; std::memcpy(dest, &v, 2); return true; }
+                case 4: { int32_t v = n; std::memcpy(dest, &v, 4); return true; }
+                case 8: { std::memcpy(dest, &n, 8); return true; }
+                default: return false;
+            }
+        }
+        case ASR::exprType::UnsignedIntegerConstant: {
+            uint64_t n = ASR::down_cast<ASR::UnsignedIntegerConstant_t>(value)->m_n;
+            switch (kind) {
+                case 1: { uint8_t v = n; std::memcpy(dest, &v, 1); return true; }
+                case 2: { uint16_t v = n; std::memcpy(dest, &v, 2); return true; }
+                case 4: { uint32_t v = n; std::memcpy(dest, &v, 4); return true; }
+                case 8: { std::memcpy(dest, &n, 8); return true; }
+                default: return false;
+            }
+        }
+        case ASR::exprType::RealConstant: {
+            double r = ASR::down_cast<ASR::RealConstant_t>(value)->m_r;
+            if (kind == 4) { float v = r; std::memcpy(dest, &v, 4); return true; }
+            if (kind == 8) { std::memcpy(dest, &r, 8); return true; }
+            return false;
+        }
+        case ASR::exprType::ComplexConstant: {
+            ASR::ComplexConstant_t* c = ASR::down_cast<ASR::ComplexConstant_t>(value);
+            if (kind == 4) {
+                float v[2] = {(float) c->m_re, (float) c->m_im};
+                std::memcpy(dest, v, 8);
+                return true;
+            }
+            if (kind == 8) {
+                double v[2] = {c->m_re, c->m_im};
+                std::memcpy(dest, v, 16);
+                return true;
+            }
+            return false;
+        }
+        case ASR::exprType::LogicalConstant: {
+            bool v = ASR::down_cast<ASR::LogicalConstant_t>(value)->m_value;
+            std::memcpy(dest, &v, sizeof(bool));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/*
+    Packs the values of `a_args` straight into ArrayConstant data when all
+    of them are numeric or logical constants of exactly `a_type`, or
+    ArrayConstants with that element type. Nested ArrayConstants are copied
+    as a whole instead of being expanded into an expression per element,
+    which is what makes large constructors like `[a, b, (i, i = 1, n)]`
+    cheap. Returns nullptr when the general path has to be taken.
+*/
+inline void* pack_ArrayConstant_data(ASR::expr_t** a_args, size_t n_args,
+        ASR::ttype_t* a_type, int &n_elements) {
+    int64_t el_size = get_ArrayConstant_element_size(a_type);
+    if (el_size == 0) return nullptr;
+    int kind = extract_kind_from_ttype_t(a_type);
+    int64_t n = 0;
+    for (size_t i = 0; i < n_args; i++) {
+        ASR::expr_t* a_value = ASRUtils::expr_value(a_args[i]);
+        if (a_value == nullptr) return nullptr;
+        if (ASR::is_a<ASR::ArrayConstant_t>(*a_value)) {
+            ASR::ttype_t* el_type = type_get_past_array(
+                ASR::down_cast<ASR::ArrayConstant_t>(a_value)->m_type);
+            if (el_type->type != a_type->type ||
+                    extract_kind_from_ttype_t(el_type) != kind) {
+                return nullptr;
+            }
+            n += get_fixed_size_of_array(
+                ASR::down_cast<ASR::ArrayConstant_t>(a_value)->m_type);
+        } else {
+            n += 1;
+        }
+    }
+    // m_n_data counts `kind` bytes per logical element, so the buffer is
+    // sized to cover that many bytes as well
+    char* data = new char[std::max<int64_t>(n, 1) * std::max<int64_t>(el_size, kind)]();
+    int64_t pos = 0;
+    for (size_t i = 0; i < n_args; i++) {
+        ASR::expr_t* a_value = ASRUtils::expr_value(a_args[i]);
+        if (ASR::is_a<ASR::ArrayConstant_t>(*a_value)) {
+            ASR::ArrayConstant_t* x = ASR::down_cast<ASR::ArrayConstant_t>(a_value);
+            int64_t size = get_fixed_size_of_array(x->m_type);
+            std::memcpy(data + pos * el_size, x->m_data, size * el_size);
+            pos += size;
+        } else if (pack_ArrayConstant_element(data + pos * el_size,
+                a_value, a_type, kind)) {
+            pos += 1;
+        } else {
+            delete[] data;
+            return nullptr;
+        }
+    }
+    n_elements = n;
+    return (void*) data;
+}
+
 inline ASR::asr_t* make_ArrayConstructor_t_util(Allocator &al, const Location &a_loc,
     ASR::expr_t** a_args, size_t n_args, ASR::ttype_t* a_type, ASR::arraystorageType a_storage_format,
     ASR::expr_t* a_struct_var=nullptr) {
@@ -7278,11 +7408,15 @@ inline ASR::asr_t* make_ArrayConstructor_t_util(Allocator &al, const Location &a
         }
     }
     if (all_expr_evaluated) {
-        Vec<ASR::expr_t*> a_args_values; a_args_values.reserve(al, n_args);
         int curr_idx = 0;
         a_type = ASRUtils::type_get_past_pointer(a_type);
         ASR::Array_t* a_type_ = ASR::down_cast<ASR::Array_t>(a_type);
-        flatten_ArrayConstant_data(al, a_args_values, a_args, n_args, a_type_->m_type, curr_idx, nullptr);
+        void *data = pack_ArrayConstant_data(a_args, n_args, a_type_->m_type, curr_idx);
+        if (data == nullptr) {
+            Vec<ASR::expr_t*> a_args_values; a_args_values.reserve(al, n_args);
+            flatten_ArrayConstant_data(al, a_args_values, a_args, n_args, a_type_->m_type, curr_idx, nullptr);
+            data = set_ArrayConstant_data(a_args_values.p, curr_idx, a_type_->m_type);
+        }
         Vec<ASR::dimension_t> dims; dims.reserve(al, 1);
         ASR::dimension_t dim; dim.loc = a_type_->m_dims[0].loc; dim.m_start = a_type_->m_dims[0].m_start;
         dim.m_length = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, a_type_->m_dims[0].loc,
@@ -7291,7 +7425,6 @@ inline ASR::asr_t* make_ArrayConstructor_t_util(Allocator &al, const Location &a
         dims.push_back(al, dim);
         ASR::ttype_t* new_type = ASRUtils::TYPE(ASR::make_Array_t(al, a_type->base.loc, a_type_->m_type,
             dims.p, dims.n, a_type_->m_physical_type));
-        void *data = set_ArrayConstant_data(a_args_values.p, curr_idx, a_type_->m_type);
         // data is always allocated to n_data bytes
         int64_t n_data = curr_idx * extract_kind_from_ttype_t(a_type_->m_type);
         if (is_character(*a_type_->m_type)) {
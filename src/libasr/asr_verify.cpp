@@ -65,6 +65,9 @@ private:
     const ASR::expr_t* current_expr {}; // current expression being visited 
 
 public:
+    // When set, only these global symbols are verified
+    const std::set<std::string> *only_symbols = nullptr;
+
     VerifyVisitor(bool check_external, diag::Diagnostics &diagnostics) : check_external{check_external},
         diagnostics{diagnostics}, non_global_symbol_visited{false}, _is_return_type_string{false} {}
 
@@ -118,6 +121,14 @@ public:
         require(down_cast2<TranslationUnit_t>(current_symtab->asr_owner)->m_symtab == current_symtab,
             "The asr_owner invariant failed");
         id_symtab_map[x.m_symtab->counter] = x.m_symtab;
+        if (only_symbols) {
+            for (auto &name : *only_symbols) {
+                ASR::symbol_t *sym = x.m_symtab->get_symbol(name);
+                if (sym) this->visit_symbol(*sym);
+            }
+            current_symtab = nullptr;
+            return;
+        }
         for (auto &a : x.m_symtab->get_scope()) {
             this->visit_symbol(*a.second);
         }
@@ -1727,4 +1738,18 @@ bool asr_verify(const ASR::TranslationUnit_t &unit, bool check_external,
     return true;
 }
 
+bool asr_verify(const ASR::TranslationUnit_t &unit,
+            const std::set<std::string> &symbols, bool check_external,
+            diag::Diagnostics &diagnostics) {
+    ASR::VerifyVisitor v(check_external, diagnostics);
+    v.only_symbols = &symbols;
+    try {
+        v.visit_TranslationUnit(unit);
+    } catch (const ASRUtils::VerifyAbort &) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return false;
+    }
+    return true;
+}
+
 } // namespace LCompilers
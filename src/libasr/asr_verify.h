@@ -1,6 +1,9 @@
 #ifndef LFORTRAN_ASR_VERIFY_H
 #define LFORTRAN_ASR_VERIFY_H
 
+#include <set>
+#include <string>
+
 #include <libasr/asr.h>
 
 namespace LCompilers {
@@ -38,6 +41,12 @@ namespace LCompilers {
     bool asr_verify(const ASR::TranslationUnit_t &unit,
         bool check_external, diag::Diagnostics &diagnostics);
 
+    // Same as above, but only walks the global symbols named in `symbols`,
+    // for re-checking the parts of the unit that a pass modified.
+    bool asr_verify(const ASR::TranslationUnit_t &unit,
+        const std::set<std::string> &symbols,
+        bool check_external, diag::Diagnostics &diagnostics);
+
 } // namespace LCompilers
 
 #endif // LFORTRAN_ASR_VERIFY_H
@@ -1,6 +1,7 @@
 #ifndef LFORTRAN_BWRITER_H
 #define LFORTRAN_BWRITER_H
 
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 
@@ -162,10 +163,7 @@ public:
     }
 
     void write_void(void *p, int64_t n_data) {
-        for (int64_t i = 0; i < n_data; i++) {
-            uint8_t* p_i8 = (uint8_t*)p;
-            write_int8(p_i8[i]);
-        }
+        s.append((const char*)p, n_data);
     }
 
 };
@@ -233,16 +231,12 @@ public:
     }
 
     void* read_void(int64_t n_data) {
-        void *p = new char[n_data];
-
-        for (int64_t i = 0; i < n_data; i++) {
-            uint8_t x = read_int8();
-            uint8_t *ip = &x;
-            void *p_i = (void*)((uintptr_t)p + i);
-            uint8_t *p_i_8 = (uint8_t*)p_i;
-            *p_i_8 = *ip;
+        if (n_data < 0 || pos + n_data > s.size()) {
+            throw LCompilersException("read_void: String is too short for deserialization.");
         }
-
+        char *p = new char[n_data];
+        std::memcpy(p, &s[pos], n_data);
+        pos += n_data;
         return p;
     }
 };
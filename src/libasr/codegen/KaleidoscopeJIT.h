@@ -32,6 +32,7 @@
 #include "llvm/Support/DynamicLibrary.h"
 #include "llvm/IR/Mangler.h"
 #endif
+#include <map>
 #include <memory>
 
 #if LLVM_VERSION_MAJOR >= 13
@@ -61,6 +62,10 @@ private:
   DataLayout DL;
   MangleAndInterner Mangle;
   JITDylib &JITDL;
+  size_t NumModules = 0;
+#if LLVM_VERSION_MAJOR >= 12
+  std::map<uint64_t, ResourceTrackerSP> Trackers;
+#endif
 #else
   // LLVM 7: Different JIT infrastructure
   ExecutionSession ES;
@@ -171,8 +176,38 @@ public:
     auto res =  CompileLayer.add(JITDL,
                             ThreadSafeModule(std::move(M), std::move(Ctx)));
     Ctx = std::make_unique<LLVMContext>();
+    NumModules++;
     return res;
   }
+
+#if LLVM_VERSION_MAJOR >= 12
+  // Adds a module that removeModule(Key) can take out of the JIT again,
+  // together with its machine code and symbols
+  Error addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> &Ctx,
+                  uint64_t Key) {
+    ResourceTrackerSP RT = JITDL.createResourceTracker();
+    auto res = CompileLayer.add(RT,
+                            ThreadSafeModule(std::move(M), std::move(Ctx)));
+    Ctx = std::make_unique<LLVMContext>();
+    if (!res) {
+      Trackers[Key] = RT;
+      NumModules++;
+    }
+    return res;
+  }
+
+  Error removeModule(uint64_t Key) {
+    auto it = Trackers.find(Key);
+    if (it == Trackers.end())
+      return Error::success();
+    ResourceTrackerSP RT = it->second;
+    Trackers.erase(it);
+    NumModules--;
+    return RT->remove();
+  }
+#endif
+
+  size_t getNumModules() const { return NumModules; }
 #else
   // LLVM 7: Different addModule API
   Error addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> & /* Ctx */) {
@@ -1632,6 +1632,8 @@ R"(    // Initialise Numpy
                 opening_pragma = "#pragma omp distribute parallel for ";
             } else if (x.m_region == ASR::omp_region_typeType::Distribute) {
                 opening_pragma = "#pragma omp distribute ";
+            } else if (x.m_region == ASR::omp_region_typeType::Simd) {
+                opening_pragma = "#pragma omp simd ";
             } else {
                 throw CodeGenError("Unsupported OpenMP region type: " + std::to_string((int)x.m_region));
             }
@@ -1730,6 +1732,16 @@ R"(    // Initialise Numpy
                     ASR::OMPMap_t* m = ASR::down_cast<ASR::OMPMap_t>(clause);
                     std::string map_clauses = generate_map_clauses(m);
                     clauses += map_clauses;
+                } else if (ASR::is_a<ASR::OMPSimdlen_t>(*clause)) {
+                    ASR::OMPSimdlen_t* c = ASR::down_cast<ASR::OMPSimdlen_t>(clause);
+                    clauses += " simdlen(";
+                    visit_expr(*c->m_simdlen);
+                    clauses += src + ")";
+                } else if (ASR::is_a<ASR::OMPSafelen_t>(*clause)) {
+                    ASR::OMPSafelen_t* c = ASR::down_cast<ASR::OMPSafelen_t>(clause);
+                    clauses += " safelen(";
+                    visit_expr(*c->m_safelen);
+                    clauses += src + ")";
                 }
             }
             
@@ -1750,7 +1762,8 @@ R"(    // Initialise Numpy
             }
             if(x.m_region != ASR::omp_region_typeType::Target && x.m_region != ASR::omp_region_typeType::Teams &&
                x.m_region != ASR::omp_region_typeType::DistributeParallelDo &&
-               x.m_region != ASR::omp_region_typeType::Distribute) {
+               x.m_region != ASR::omp_region_typeType::Distribute &&
+               x.m_region != ASR::omp_region_typeType::Simd) {
                 src = opening_pragma + "{\n" + body + "}\n";
             } else {
                 src =  opening_pragma + "\n" + body + "\n";
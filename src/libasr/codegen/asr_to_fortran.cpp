@@ -1382,6 +1382,12 @@ public:
             visit_expr(*x.m_sign);
             r += src;
         }
+        if (x.m_asynchronous) {
+            r += ", ";
+            r += "asynchronous=";
+            visit_expr(*x.m_asynchronous);
+            r += src;
+        }
         r += ")";
         handle_line_truncation(r, 2);
         r += "\n";
@@ -1461,6 +1467,31 @@ public:
 
     // void visit_FileInquire(const ASR::FileInquire_t &x) {}
 
+    void visit_FileWait(const ASR::FileWait_t &x) {
+        std::string r;
+        r = indent;
+        r += "wait";
+        r += "(";
+        visit_expr(*x.m_unit);
+        r += src;
+        if (x.m_id) {
+            r += ", ";
+            r += "id=";
+            visit_expr(*x.m_id);
+            r += src;
+        }
+        if (x.m_iostat) {
+            r += ", ";
+            r += "iostat=";
+            visit_expr(*x.m_iostat);
+            r += src;
+        }
+        r += ")";
+        handle_line_truncation(r, 2);
+        r += "\n";
+        src = r;
+    }
+
     void visit_FileWrite(const ASR::FileWrite_t &x) {
         ASR::StringFormat_t *sf = nullptr;
         if (x.n_values > 0 && is_a<ASR::StringFormat_t>(*x.m_values[0])) {
@@ -4,10 +4,12 @@
 #include <llvm/IR/Value.h>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/Analysis/Passes.h>
+#include <llvm/Analysis/VectorUtils.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/GenericValue.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
@@ -62,6 +64,7 @@
 #include <libasr/codegen/llvm_array_utils.h>
 #include <libasr/pass/intrinsic_function_registry.h>
 #include <libasr/codegen/llvm_compat.h>
+#include <libasr/time_trace.h>
 
 namespace LCompilers {
 
@@ -245,6 +248,26 @@ public:
         so that we can jump to the end of the block when we reach an exit */
     std::vector<std::string> loop_or_block_end_names;
 
+    /* Vectorization hints for the next loop emitted by `create_loop`, set by
+       `visit_OMPRegion` for `!$omp simd` and `do concurrent` */
+    struct LoopHints {
+        bool vectorize = false;
+        int64_t width = 0;
+        bool parallel_accesses = false;
+        ASR::symbol_t *index = nullptr; // Loop variable, for `parallel_accesses`
+    } pending_loop_hints;
+
+    /* Element pointers of the array items indexed by the loop variable of
+       the loop being emitted with `parallel_accesses`, including those of
+       its inner loops that have no `parallel_accesses` of their own */
+    struct ParallelAccesses {
+        ASR::symbol_t *index = nullptr;
+        std::unordered_set<llvm::Value*> ptrs;
+    } parallel_accesses;
+
+    // Unit number (i32) evaluated by the READ/WRITE being emitted, for `id=`
+    llvm::Value *transfer_unit_val = nullptr;
+
     int64_t ptr_loads;
     bool lookup_enum_value_for_nonints;
     bool is_assignment_target;
@@ -286,6 +309,7 @@ public:
     LLVMFinalize llvm_symtab_finalizer;
     Vec<llvm::Value*> strings_to_be_deallocated;
     Vec<llvm::Value*> heap_fixed_size_arrays;  // Heap-allocated large fixed-size arrays for cleanup
+    llvm::Value* scratch_mark = nullptr;  // Scratch stack mark of the current procedure (--pool-allocator)
     bool in_block_context = false;  // Flag to track if we're inside a BLOCK construct
     // Tracks allocatable/pointer array args in bind(C) functions that need
     // stride conversion from element-based back to byte-based on exit.
@@ -389,7 +413,6 @@ public:
               LLVMArrUtils::DESCR_TYPE::_SimpleCMODescriptor, compiler_options_)),
     llvm_symtab_finalizer(*this, llvm_utils, builder, al, llvm_symtab_fn)
     {
-        LLVM::set_memory_debug(compiler_options.detect_leaks);
         llvm_utils->tuple_api = tuple_api.get();
         llvm_utils->list_api = list_api.get();
         llvm_utils->struct_api = struct_api.get();
@@ -501,6 +524,17 @@ public:
             loop_name = "loop";
         }
 
+        LoopHints hints = pending_loop_hints;
+        pending_loop_hints = LoopHints();
+        // A loop with its own `parallel_accesses` collects the items indexed
+        // by its own variable; other inner loops add to the enclosing set
+        ParallelAccesses parallel_accesses_copy;
+        if (hints.parallel_accesses) {
+            parallel_accesses_copy = std::move(parallel_accesses);
+            parallel_accesses = ParallelAccesses();
+            parallel_accesses.index = hints.index;
+        }
+
         std::string loophead_name = loop_name + ".head";
         std::string loopbody_name = loop_name + ".body";
         std::string loopend_name = loop_name + ".end";
@@ -523,7 +557,13 @@ public:
         // body
         start_new_block(loopbody); {
             loop_body();
-            builder->CreateBr(loophead);
+            llvm::BranchInst *latch = builder->CreateBr(loophead);
+            if (hints.vectorize) {
+                set_loop_hints(latch, loophead, hints);
+            }
+        }
+        if (hints.parallel_accesses) {
+            parallel_accesses = std::move(parallel_accesses_copy);
         }
 
         // end
@@ -534,6 +574,103 @@ public:
         start_new_block(loopend);
     }
 
+    /*
+        Attaches `llvm.loop.vectorize.*` metadata to the loop whose backedge
+        is `latch` and whose first block is `loophead`.
+
+        LLVM only treats a loop as parallel if every memory access in it is
+        in an access group listed by `llvm.loop.parallel_accesses`, so that
+        hint is all or nothing. It is emitted, with every load and store of
+        the loop in the group, only if the loop stores nothing but array
+        items that have the loop variable itself as a subscript and scalar
+        locals that mem2reg turns into registers. Each iteration then writes
+        its own memory. Loops that store anything else (a temporary `t(1)`
+        that is written and read in every iteration, a module variable) or
+        call a procedure that may touch memory get only `vectorize.enable`,
+        and the vectorizer checks their dependences as usual.
+    */
+    void set_loop_hints(llvm::BranchInst *latch, llvm::BasicBlock *loophead,
+            const LoopHints &hints) {
+        llvm::SmallVector<llvm::Metadata*, 4> loop_md;
+        loop_md.push_back(nullptr); // Replaced by the self reference below
+        loop_md.push_back(llvm::MDNode::get(context, {
+            llvm::MDString::get(context, "llvm.loop.vectorize.enable"),
+            llvm::ConstantAsMetadata::get(builder->getTrue())}));
+        if (hints.width > 1) {
+            loop_md.push_back(llvm::MDNode::get(context, {
+                llvm::MDString::get(context, "llvm.loop.vectorize.width"),
+                llvm::ConstantAsMetadata::get(builder->getInt32(hints.width))}));
+        }
+        std::vector<llvm::Instruction*> accesses;
+        if (hints.parallel_accesses
+                && collect_parallel_accesses(loophead, accesses)) {
+            llvm::MDNode *access_group = llvm::MDNode::getDistinct(context, {});
+            for (llvm::Instruction *inst: accesses) {
+                // Accesses of an inner parallel loop stay in its group too
+                inst->setMetadata(llvm::LLVMContext::MD_access_group,
+                    llvm::uniteAccessGroups(inst->getMetadata(
+                        llvm::LLVMContext::MD_access_group), access_group));
+            }
+            loop_md.push_back(llvm::MDNode::get(context, {
+                llvm::MDString::get(context, "llvm.loop.parallel_accesses"),
+                access_group}));
+        }
+        llvm::MDNode *loop_id = llvm::MDNode::getDistinct(context, loop_md);
+        loop_id->replaceOperandWith(0, loop_id);
+        latch->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
+    }
+
+    /*
+        Collects the loads and stores of the loop starting at `loophead`,
+        which are the blocks appended to the function since then. Returns
+        false if the loop has a memory access that cannot be marked parallel
+        (see set_loop_hints).
+    */
+    bool collect_parallel_accesses(llvm::BasicBlock *loophead,
+            std::vector<llvm::Instruction*> &accesses) {
+        llvm::Function *fn = loophead->getParent();
+        for (auto bb = loophead->getIterator(); bb != fn->end(); ++bb) {
+            for (llvm::Instruction &inst: *bb) {
+                if (!inst.mayReadOrWriteMemory()) continue;
+                if (auto *load = llvm::dyn_cast<llvm::LoadInst>(&inst)) {
+                    if (!load->isSimple()) return false;
+                } else if (auto *store = llvm::dyn_cast<llvm::StoreInst>(&inst)) {
+                    llvm::Value *ptr = store->getPointerOperand();
+                    if (!store->isSimple() || !(parallel_accesses.ptrs.count(ptr)
+                            || is_promotable_scalar(ptr))) {
+                        return false;
+                    }
+                } else {
+                    return false;
+                }
+                accesses.push_back(&inst);
+            }
+        }
+        return true;
+    }
+
+    // Whether `ptr` is a scalar local that is only loaded and stored, which
+    // mem2reg promotes to a register
+    static bool is_promotable_scalar(llvm::Value *ptr) {
+        auto *alloca = llvm::dyn_cast<llvm::AllocaInst>(ptr);
+        if (!alloca || alloca->isArrayAllocation()
+                || !alloca->getAllocatedType()->isSingleValueType()) {
+            return false;
+        }
+        for (llvm::User *user: alloca->users()) {
+            if (auto *load = llvm::dyn_cast<llvm::LoadInst>(user)) {
+                if (!load->isSimple()) return false;
+            } else if (auto *store = llvm::dyn_cast<llvm::StoreInst>(user)) {
+                if (!store->isSimple() || store->getValueOperand() == alloca) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void get_type_debug_info(ASR::ttype_t* t, std::string &type_name,
             uint32_t &type_size, uint32_t &type_encoding) {
         ASR::ttype_t* t_ = ASRUtils::extract_type(t);
@@ -704,7 +841,7 @@ public:
                     prod = builder->CreateMul(prod,
                         llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, size)));
                     llvm::Value* arr_first_i8 = LLVMArrUtils::lfortran_malloc(
-                        context, *module, *builder, prod);
+                        context, *module, *builder, llvm_utils->get_allocator_function_name(), prod);
                     arr_first = builder->CreateBitCast(
                         arr_first_i8, llvm_data_type->getPointerTo());
                 } else {
@@ -1264,6 +1401,41 @@ public:
         return builder->CreateCall(fn, args);
     }
 
+    llvm::Value* lfortran_strConcat_n(
+        const std::vector<llvm::Value*> &strs,
+        const std::vector<llvm::Value*> &lens)
+    {
+        std::string runtime_func_name = "_lfortran_strcat_n_alloc";
+        llvm::Type* i64 = llvm::Type::getInt64Ty(context);
+        llvm::Function *fn = module->getFunction(runtime_func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    character_type, {
+                        character_type,
+                        llvm::Type::getInt32Ty(context),
+                        character_type->getPointerTo(),
+                        i64->getPointerTo()
+                    }, false);
+            fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, runtime_func_name, module.get());
+        }
+        size_t n = strs.size();
+        llvm::Type* strs_type = llvm::ArrayType::get(character_type, n);
+        llvm::Type* lens_type = llvm::ArrayType::get(i64, n);
+        llvm::Value* pstrs = llvm_utils->CreateAlloca(strs_type, nullptr, "strcat_strs");
+        llvm::Value* plens = llvm_utils->CreateAlloca(lens_type, nullptr, "strcat_lens");
+        for (size_t i = 0; i < n; i++) {
+            builder->CreateStore(strs[i], llvm_utils->create_gep2(strs_type, pstrs, i));
+            builder->CreateStore(lens[i], llvm_utils->create_gep2(lens_type, plens, i));
+        }
+        llvm::Value* allocator = llvm_utils->get_allocator(module.get());
+        std::vector<llvm::Value*> args = {allocator,
+            llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), n),
+            llvm_utils->create_gep2(strs_type, pstrs, 0),
+            llvm_utils->create_gep2(lens_type, plens, 0)};
+        return builder->CreateCall(fn, args);
+    }
+
     llvm::Value* lfortran_str_cmp(
         llvm::Value* left_arg, llvm::Value* left_arg_len,
         llvm::Value* right_arg, llvm::Value* right_arg_len)
@@ -1283,28 +1455,24 @@ public:
         return builder->CreateCall(fn, args);
     }
 
-    llvm::Value* lfortran_strrepeat(llvm::Value* left_arg, llvm::Value* right_arg)
+    llvm::Value* lfortran_strrepeat(llvm::Value* left_arg, llvm::Value* left_len,
+        llvm::Value* right_arg)
     {
         std::string runtime_func_name = "_lfortran_strrepeat_alloc";
         llvm::Function *fn = module->getFunction(runtime_func_name);
         if (!fn) {
             llvm::FunctionType *function_type = llvm::FunctionType::get(
-                    llvm::Type::getVoidTy(context), {
+                    character_type, {
                         character_type,
-                        character_type->getPointerTo(),
-                        llvm::Type::getInt32Ty(context),
-                        character_type->getPointerTo()
+                        character_type, llvm::Type::getInt64Ty(context),
+                        llvm::Type::getInt32Ty(context)
                     }, false);
             fn = llvm::Function::Create(function_type,
                     llvm::Function::ExternalLinkage, runtime_func_name, module.get());
         }
         llvm::Value* allocator = llvm_utils->get_allocator(module.get());
-        llvm::AllocaInst *pleft_arg = llvm_utils->CreateAlloca(*builder, character_type);
-        builder->CreateStore(left_arg, pleft_arg);
-        llvm::AllocaInst *presult = llvm_utils->CreateAlloca(*builder, character_type);
-        std::vector<llvm::Value*> args = {allocator, pleft_arg, right_arg, presult};
-        builder->CreateCall(fn, args);
-        return llvm_utils->CreateLoad2(character_type, presult);
+        std::vector<llvm::Value*> args = {allocator, left_arg, left_len, right_arg};
+        return builder->CreateCall(fn, args);
     }
 
     llvm::Value* lfortran_str_len(llvm::Type* type, llvm::Value* str, bool use_descriptor=false)
@@ -1764,7 +1932,7 @@ public:
                     llvm::Value* malloc_size = SizeOfTypeUtil(curr_arg.m_a, curr_arg_m_a_type, llvm_utils->getIntType(4),
                     ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                     llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(
-                        context, *module, *builder, malloc_size);
+                        context, *module, *builder, llvm_utils->get_allocator_function_name(), malloc_size);
                     builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)), malloc_size, llvm::MaybeAlign());
                     builder->CreateStore(builder->CreateBitCast(
                         malloc_ptr, llvm_arg_type->getPointerTo()), x_arr);
@@ -1836,7 +2004,8 @@ public:
                         llvm::Value* malloc_size = SizeOfTypeUtil(curr_arg.m_a, curr_arg_m_a_type, llvm_utils->getIntType(4),
                         ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                         llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(
-                            context, *module, *builder, malloc_size);
+                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                malloc_size);
                         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)), malloc_size, llvm::MaybeAlign());
                         llvm::Type* llvm_arg_type = llvm_utils->get_type_from_ttype_t_util(curr_arg.m_a, curr_arg_m_a_type, module.get());
                         llvm::Value* bitcasted_malloc_ptr = builder->CreateBitCast(
@@ -1894,7 +2063,8 @@ public:
                         }
 
                         llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(
-                            context, *module, *builder, malloc_size);
+                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                malloc_size);
                         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                                     malloc_size, llvm::MaybeAlign());
                         if(ASRUtils::is_string_only(dest_asr_type)) { // String type has a state to be cloned.
@@ -1922,7 +2092,8 @@ public:
                             llvm::Value* wrapper_size = SizeOfTypeUtil(curr_arg.m_a, curr_arg_m_a_type,
                                 llvm_utils->getIntType(4), ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                             llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-                                context, *module, *builder, wrapper_size);
+                                context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                    wrapper_size);
                             builder->CreateMemSet(wrapper_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                                 wrapper_size, llvm::MaybeAlign());
                             wrapper_ptr = builder->CreateBitCast(wrapper_ptr, src_struct_type_);
@@ -1994,7 +2165,8 @@ public:
                             llvm::Value* str_len = builder->CreateSExtOrTrunc(
                                 tmp, llvm::Type::getInt64Ty(context));
                             llvm::Value* char_data = LLVM::lfortran_malloc(
-                                context, *module, *builder, str_len);
+                                context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                    str_len);
                             builder->CreateMemSet(char_data,
                                 llvm::ConstantInt::get(context, llvm::APInt(8, 32)),
                                 str_len, llvm::MaybeAlign());
@@ -2195,8 +2367,80 @@ public:
         }
     }
 
+    // Array temporaries that the array_struct_temporary pass gives Scratch
+    // storage are local to the procedure and never escape it, so they can
+    // live on the scratch stack.
+    static bool is_scratch_temporary(ASR::expr_t* expr) {
+        if (!ASR::is_a<ASR::Var_t>(*expr)) {
+            return false;
+        }
+        ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(expr)->m_v);
+        if (!ASR::is_a<ASR::Variable_t>(*sym)) {
+            return false;
+        }
+        ASR::Variable_t* v = ASR::down_cast<ASR::Variable_t>(sym);
+        return v->m_storage == ASR::storage_typeType::Scratch &&
+            v->m_intent == ASRUtils::intent_local &&
+            ASRUtils::is_allocatable(v->m_type) &&
+            ASRUtils::is_array(v->m_type) &&
+            !ASRUtils::is_character(*v->m_type) &&
+            !ASRUtils::is_struct(*v->m_type);
+    }
+
+    static bool has_scratch_temporaries(SymbolTable* symtab) {
+        for (auto& item : symtab->get_scope()) {
+            if (ASR::is_a<ASR::Variable_t>(*item.second)) {
+                ASR::Variable_t* v = ASR::down_cast<ASR::Variable_t>(item.second);
+                if (v->m_storage == ASR::storage_typeType::Scratch) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Remember the top of the scratch stack on entry, so that everything the
+    // procedure put there is released on exit, including on early return.
+    void mark_scratch_stack(SymbolTable* symtab) {
+        scratch_mark = nullptr;
+        if (!compiler_options.pool_allocator || !has_scratch_temporaries(symtab)) {
+            return;
+        }
+        llvm::Function* fn = module->getFunction("_lfortran_scratch_mark");
+        if (!fn) {
+            llvm::FunctionType* function_type = llvm::FunctionType::get(
+                llvm::Type::getInt8Ty(context)->getPointerTo(), {}, false);
+            fn = llvm::Function::Create(function_type,
+                llvm::Function::ExternalLinkage, "_lfortran_scratch_mark", module.get());
+        }
+        scratch_mark = builder->CreateCall(fn, {});
+    }
+
+    void release_scratch_stack() {
+        if (!scratch_mark) {
+            return;
+        }
+        llvm::Function* fn = module->getFunction("_lfortran_scratch_release");
+        if (!fn) {
+            llvm::FunctionType* function_type = llvm::FunctionType::get(
+                llvm::Type::getVoidTy(context),
+                {llvm::Type::getInt8Ty(context)->getPointerTo()}, false);
+            fn = llvm::Function::Create(function_type,
+                llvm::Function::ExternalLinkage, "_lfortran_scratch_release", module.get());
+        }
+        builder->CreateCall(fn, {scratch_mark});
+        scratch_mark = nullptr;
+    }
+
     void visit_Allocate(const ASR::Allocate_t& x) {
+        bool use_scratch = scratch_mark != nullptr;
+        for (size_t i = 0; i < x.n_args && use_scratch; i++) {
+            use_scratch = is_scratch_temporary(x.m_args[i].m_a);
+        }
+        llvm_utils->scratch_allocation = use_scratch;
         visit_AllocateUtil(x, x.m_stat, false, x.m_source);
+        llvm_utils->scratch_allocation = false;
     }
 
     void visit_ReAlloc(const ASR::ReAlloc_t& x) {
@@ -4016,6 +4260,25 @@ public:
             current_der_type_name = get_type_key(
                 ASRUtils::symbol_get_past_external(ASRUtils::get_struct_sym_from_struct_expr(x.m_v)));
         }
+        if (parallel_accesses.index && is_indexed_by(x, parallel_accesses.index)) {
+            parallel_accesses.ptrs.insert(tmp);
+        }
+    }
+
+    // Whether one of the subscripts of `x` is the variable `index` itself
+    static bool is_indexed_by(const ASR::ArrayItem_t &x, ASR::symbol_t *index) {
+        for (size_t i = 0; i < x.n_args; i++) {
+            ASR::expr_t *idx = x.m_args[i].m_right;
+            if (idx && ASR::is_a<ASR::Cast_t>(*idx) && ASR::down_cast<ASR::Cast_t>(idx)->m_kind
+                    == ASR::cast_kindType::IntegerToInteger) {
+                idx = ASR::down_cast<ASR::Cast_t>(idx)->m_arg;
+            }
+            if (idx && ASR::is_a<ASR::Var_t>(*idx) && ASRUtils::symbol_get_past_external(
+                    ASR::down_cast<ASR::Var_t>(idx)->m_v) == index) {
+                return true;
+            }
+        }
+        return false;
     }
 
     void visit_ArraySection(const ASR::ArraySection_t& x) {
@@ -4684,9 +4947,73 @@ public:
         current_der_type_name = get_type_key(x.m_dt_sym);
     }
 
+    template <typename T, typename S = T>
+    llvm::Constant* get_const_data_array(const void* data, size_t n) {
+        const S* elements = (const S*) data;
+        if constexpr (std::is_same_v<T, S>) {
+            return llvm::ConstantDataArray::get(context,
+                llvm::ArrayRef<T>(elements, n));
+        } else {
+            std::vector<T> widened(elements, elements + n);
+            return llvm::ConstantDataArray::get(context, widened);
+        }
+    }
+
+    /*
+        Emits the packed data of a numeric or logical ArrayConstant as a
+        single ConstantDataArray, without creating an ASR node and an LLVM
+        constant for every element. Returns nullptr when `el_type` does not
+        match the layout of the data, so that the caller can fall back to
+        building the array element by element.
+    */
+    llvm::Constant* get_const_data_array(const ASR::ArrayConstant_t &x,
+            llvm::Type* el_type) {
+        ASR::ttype_t* type = ASRUtils::type_get_past_array(
+            ASRUtils::type_get_past_allocatable_pointer(x.m_type));
+        size_t n = ASRUtils::get_fixed_size_of_array(x.m_type);
+        int kind = ASRUtils::extract_kind_from_ttype_t(type);
+        switch (type->type) {
+            case ASR::ttypeType::Integer:
+            case ASR::ttypeType::UnsignedInteger: {
+                if (!el_type->isIntegerTy(8 * kind)) return nullptr;
+                switch (kind) {
+                    case 1: return get_const_data_array<uint8_t>(x.m_data, n);
+                    case 2: return get_const_data_array<uint16_t>(x.m_data, n);
+                    case 4: return get_const_data_array<uint32_t>(x.m_data, n);
+                    case 8: return get_const_data_array<uint64_t>(x.m_data, n);
+                    default: return nullptr;
+                }
+            }
+            case ASR::ttypeType::Real: {
+                if (kind == 4 && el_type->isFloatTy()) {
+                    return get_const_data_array<float>(x.m_data, n);
+                } else if (kind == 8 && el_type->isDoubleTy()) {
+                    return get_const_data_array<double>(x.m_data, n);
+                }
+                return nullptr;
+            }
+            case ASR::ttypeType::Logical: {
+                // Logical elements are stored one `bool` each, whatever the kind
+                if (!el_type->isIntegerTy(8 * kind)) return nullptr;
+                switch (kind) {
+                    case 1: return get_const_data_array<uint8_t, bool>(x.m_data, n);
+                    case 2: return get_const_data_array<uint16_t, bool>(x.m_data, n);
+                    case 4: return get_const_data_array<uint32_t, bool>(x.m_data, n);
+                    case 8: return get_const_data_array<uint64_t, bool>(x.m_data, n);
+                    default: return nullptr;
+                }
+            }
+            default:
+                return nullptr;
+        }
+    }
+
     llvm::Constant* get_const_array(ASR::expr_t *value, llvm::Type* type) {
         LCOMPILERS_ASSERT(ASR::is_a<ASR::ArrayConstant_t>(*value));
         ASR::ArrayConstant_t* arr_const = ASR::down_cast<ASR::ArrayConstant_t>(value);
+        if (llvm::Constant* data_array = get_const_data_array(*arr_const, type)) {
+            return data_array;
+        }
         std::vector<llvm::Constant*> arr_elements;
         size_t arr_const_size = (size_t) ASRUtils::get_fixed_size_of_array(arr_const->m_type);
         arr_elements.reserve(arr_const_size);
@@ -5454,6 +5781,8 @@ public:
 #endif
 
     void visit_Program(const ASR::Program_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Program",
+            x.m_name);
         llvm::DIScope* debug_current_scope_copy = debug_current_scope;
         llvm::DISubprogram *SP = nullptr;
         loop_head.clear();
@@ -5571,6 +5900,19 @@ public:
                 llvm::APInt(32, 1));
             builder->CreateCall(fn, {use_colors});
         }
+        if (compiler_options.mmap_io) {
+            llvm::Function *fn = module->getFunction("_lfortran_set_mmap_io");
+            if(!fn) {
+                llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getVoidTy(context), {
+                        llvm::Type::getInt32Ty(context)
+                    }, false);
+                fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, "_lfortran_set_mmap_io", module.get());
+            }
+            builder->CreateCall(fn, {llvm::ConstantInt::get(context,
+                llvm::APInt(32, 1))});
+        }
         for(to_be_allocated_array array : allocatable_array_details){
             fill_array_details_(array.expr, array.pointer_to_array_type, array.array_type, nullptr, array.n_dims,
                 true, true, false, array.var_type);
@@ -5583,8 +5925,11 @@ public:
         for(variable_inital_value var_to_initalize : variable_inital_value_vec){
             set_VariableInital_value(var_to_initalize.v, var_to_initalize.target_var);
         }
+        mark_scratch_stack(x.m_symtab);
         proc_return = llvm::BasicBlock::Create(context, "return");
         predeclare_goto_targets(F, x.m_body, x.n_body);
+        llvm::IRBuilderBase::FastMathFlagGuard fmf_guard(*builder);
+        builder->setFastMathFlags(get_fast_math_flags(x.m_symtab));
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
         }
@@ -5603,6 +5948,7 @@ public:
             }
         }
         free_heap_fixed_size_arrays();
+        release_scratch_stack();
         {
             llvm::Function *fn_finalize = module->getFunction(
                 "_lfortran_internal_alloc_finalize");
@@ -6534,8 +6880,16 @@ public:
                     uint64_t size = data_layout.getTypeAllocSize(type);
                     array_size = builder->CreateMul(array_size,
                         llvm::ConstantInt::get(context, llvm::APInt(32, size)));
-                    llvm::Value* ptr_i8 = LLVMArrUtils::lfortran_malloc(
-                        context, *module, *builder, array_size);
+                    llvm::Value* ptr_i8 = nullptr;
+                    if (!in_block_context && v->m_storage == ASR::storage_typeType::Default &&
+                            v->m_intent != ASRUtils::intent_return_var &&
+                            compiler_options.max_stack_var_size > 0) {
+                        ptr_i8 = allocate_automatic_array(array_size);
+                    } else {
+                        ptr_i8 = LLVMArrUtils::lfortran_malloc(
+                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                array_size);
+                    }
                     ptr = builder->CreateBitCast(ptr_i8, type->getPointerTo());
                 }
             } else if(ASRUtils::is_string_only(v->m_type)){
@@ -6608,11 +6962,12 @@ public:
                     }
                     gptr->setInitializer(init_value);
                 } else {
-                    // Large fixed-size arrays (> 4KB-1) use heap allocation to prevent stack overflow.
+                    // Large fixed-size arrays (-fmax-stack-var-size bytes and above, 4KB
+                    // by default) use heap allocation to prevent stack overflow.
                     // This is recursion-safe unlike static storage, as each call gets its own copy.
                     // Memory is freed at function exit.
                     // BLOCK constructs always use heap regardless of size (can be in loops).
-                    constexpr uint64_t MAX_STACK_ARRAY_SIZE = 4 * 1024 - 1;  // 4KB arrays and above use heap
+                    const uint64_t max_stack_array_size = compiler_options.max_stack_var_size;
                     bool use_heap_allocation = false;
                     uint64_t type_size = 0;
                     if (!compiler_options.stack_arrays &&
@@ -6622,7 +6977,7 @@ public:
                         const llvm::DataLayout& data_layout = module->getDataLayout();
                         type_size = data_layout.getTypeAllocSize(type);
                         // BLOCKs always use heap (can be in loops), others use threshold
-                        if (in_block_context || type_size > MAX_STACK_ARRAY_SIZE) {
+                        if (in_block_context || type_size >= max_stack_array_size) {
                             use_heap_allocation = true;
                         }
                     }
@@ -6632,7 +6987,8 @@ public:
                         llvm::Value* malloc_size = llvm::ConstantInt::get(
                             llvm_utils->getIntType(8), llvm::APInt(64, type_size));
                         llvm::Value* ptr_i8 = LLVMArrUtils::lfortran_malloc(
-                            context, *module, *builder, malloc_size);
+                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                malloc_size);
                         ptr = builder->CreateBitCast(ptr_i8, type->getPointerTo());
                         // Track for cleanup at function exit
                         heap_fixed_size_arrays.push_back(al, ptr_i8);
@@ -7024,6 +7380,8 @@ public:
     }
 
     void visit_Function(const ASR::Function_t &x) {
+        TimeTraceScope trace(compiler_options.po.time_trace, "Function",
+            x.m_name);
         llvm::DIScope* debug_current_scope_copy = debug_current_scope;
         loop_head.clear();
         loop_head_names.clear();
@@ -7441,6 +7799,58 @@ public:
             // in the prologue above. No additional stride conversion needed.
         }
         declare_local_vars(x);
+        mark_scratch_stack(x.m_symtab);
+    }
+
+    /*
+        Automatic arrays with a runtime size (promoted temporaries included)
+        are allocated on the heap and freed at function exit. With an explicit
+        -fmax-stack-var-size they live on the stack when they are smaller than
+        that many bytes and fall back to the heap otherwise; then the heap
+        pointer (null when the stack was used) is freed at function exit.
+        The stack is opt-in so that the default stack usage of existing
+        programs, which may run on small thread stacks, does not grow.
+    */
+    llvm::Value* allocate_automatic_array(llvm::Value* size_in_bytes) {
+        if (!compiler_options.stack_automatic_arrays) {
+            llvm::Value* heap_ptr = LLVMArrUtils::lfortran_malloc(
+                context, *module, *builder, llvm_utils->get_allocator_function_name(), size_in_bytes);
+            heap_fixed_size_arrays.push_back(al, heap_ptr);
+            return heap_ptr;
+        }
+        llvm::Type* i64 = llvm::Type::getInt64Ty(context);
+        llvm::Type* i8_ptr = llvm::Type::getInt8Ty(context)->getPointerTo();
+        llvm::Function* fn = builder->GetInsertBlock()->getParent();
+        llvm::BasicBlock* stack_bb = llvm::BasicBlock::Create(context, "automatic_array.stack", fn);
+        llvm::BasicBlock* heap_bb = llvm::BasicBlock::Create(context, "automatic_array.heap");
+        llvm::BasicBlock* merge_bb = llvm::BasicBlock::Create(context, "automatic_array.end");
+        // Negative sizes compare as huge and keep going through malloc
+        llvm::Value* is_small = builder->CreateICmpULT(
+            builder->CreateSExt(size_in_bytes, i64),
+            llvm::ConstantInt::get(i64, compiler_options.max_stack_var_size));
+        builder->CreateCondBr(is_small, stack_bb, heap_bb);
+
+        builder->SetInsertPoint(stack_bb);
+        llvm::AllocaInst* stack_ptr = builder->CreateAlloca(
+            llvm::Type::getInt8Ty(context), size_in_bytes);
+        stack_ptr->setAlignment(llvm::Align(16));
+        builder->CreateBr(merge_bb);
+
+        start_new_block(heap_bb);
+        llvm::Value* heap_ptr = LLVMArrUtils::lfortran_malloc(
+            context, *module, *builder, llvm_utils->get_allocator_function_name(), size_in_bytes);
+        llvm::BasicBlock* heap_end_bb = builder->GetInsertBlock();
+
+        start_new_block(merge_bb);
+        llvm::PHINode* data = builder->CreatePHI(i8_ptr, 2);
+        data->addIncoming(stack_ptr, stack_bb);
+        data->addIncoming(heap_ptr, heap_end_bb);
+        llvm::PHINode* to_free = builder->CreatePHI(i8_ptr, 2);
+        to_free->addIncoming(llvm::ConstantPointerNull::get(
+            llvm::cast<llvm::PointerType>(i8_ptr)), stack_bb);
+        to_free->addIncoming(heap_ptr, heap_end_bb);
+        heap_fixed_size_arrays.push_back(al, to_free);
+        return data;
     }
 
     inline void free_heap_fixed_size_arrays() {
@@ -7481,6 +7891,7 @@ public:
             start_new_block(proc_return);
             llvm_symtab_finalizer.finalize_symtab(x.m_symtab);
             free_heap_fixed_size_arrays();
+            release_scratch_stack();
             convert_bindc_strides_to_byte();
             llvm::Function* fn = builder->GetInsertBlock()->getParent();
             if (fn->getReturnType()->isVoidTy()) {
@@ -7558,6 +7969,7 @@ public:
             start_new_block(proc_return);
             llvm_symtab_finalizer.finalize_symtab(x.m_symtab);
             free_heap_fixed_size_arrays();
+            release_scratch_stack();
             convert_bindc_strides_to_byte();
             builder->CreateRetVoid();
         }
@@ -7573,6 +7985,49 @@ public:
     Example: `class_65.f90`
     */
 
+    /*
+        Fast-math flags for the floating point instructions of a procedure
+        body, from -ffast-math, -fno-signed-zeros, -freciprocal-math and
+        -ffp-contract=fast. Procedures that use ieee_arithmetic (directly or
+        through an enclosing module or program) query or rely on exact IEEE
+        semantics, so they always get none.
+    */
+    llvm::FastMathFlags get_fast_math_flags(SymbolTable* scope) {
+        llvm::FastMathFlags fmf;
+        if (!(compiler_options.fast_math || compiler_options.no_signed_zeros ||
+                compiler_options.reciprocal_math || compiler_options.fp_contract_fast)) {
+            return fmf;
+        }
+        // Stops before the global scope, which holds the module itself
+        for (SymbolTable* s = scope; s->parent != nullptr; s = s->parent) {
+            if (s->asr_owner && ASR::is_a<ASR::symbol_t>(*s->asr_owner) &&
+                    std::string(ASRUtils::symbol_name(ASR::down_cast<ASR::symbol_t>(
+                    s->asr_owner))) == "lfortran_intrinsic_ieee_arithmetic") {
+                return fmf;
+            }
+            for (auto &item: s->get_scope()) {
+                if (ASR::is_a<ASR::ExternalSymbol_t>(*item.second) &&
+                        std::string(ASR::down_cast<ASR::ExternalSymbol_t>(
+                        item.second)->m_module_name) == "lfortran_intrinsic_ieee_arithmetic") {
+                    return fmf;
+                }
+            }
+        }
+        if (compiler_options.fast_math) {
+            fmf.setFast();
+        }
+        if (compiler_options.no_signed_zeros) {
+            fmf.setNoSignedZeros();
+        }
+        if (compiler_options.reciprocal_math) {
+            fmf.setAllowReciprocal();
+        }
+        if (compiler_options.fp_contract_fast) {
+            fmf.setAllowContract();
+        }
+        return fmf;
+    }
+
     void generate_function(const ASR::Function_t &x) {
         bool interactive = (ASRUtils::get_FunctionType(x)->m_abi == ASR::abiType::ExternalUndefined);
         if (ASRUtils::get_FunctionType(x)->m_deftype == ASR::deftypeType::Implementation ) {
@@ -7583,6 +8038,8 @@ public:
                 define_function_entry(x);
                 predeclare_goto_targets(builder->GetInsertBlock()->getParent(), x.m_body, x.n_body);
 
+                llvm::IRBuilderBase::FastMathFlagGuard fmf_guard(*builder);
+                builder->setFastMathFlags(get_fast_math_flags(x.m_symtab));
                 for (size_t i=0; i<x.n_body; i++) {
                     this->visit_stmt(*x.m_body[i]);
                 }
@@ -8700,7 +9157,8 @@ public:
                             llvm::Value* wrapper_size = SizeOfTypeUtil(x.m_target, target_base_type,
                                 llvm_utils->getIntType(4), ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                             llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-                                context, *module, *builder, wrapper_size);
+                                context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                    wrapper_size);
                             builder->CreateMemSet(wrapper_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                                 wrapper_size, llvm::MaybeAlign());
                             wrapper_ptr = builder->CreateBitCast(wrapper_ptr, target_llvm_type->getPointerTo());
@@ -8809,7 +9267,8 @@ public:
                             llvm::Value* wrapper_size = SizeOfTypeUtil(x.m_target, target_type,
                                 llvm_utils->getIntType(4), ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                             llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-                                context, *module, *builder, wrapper_size);
+                                context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                    wrapper_size);
                             builder->CreateMemSet(wrapper_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                                 wrapper_size, llvm::MaybeAlign());
                             wrapper_ptr = builder->CreateBitCast(wrapper_ptr, target_llvm_type->getPointerTo());
@@ -9013,7 +9472,8 @@ public:
                                     llvm_utils->getIntType(4),
                                     ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4)));
                                 llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-                                    context, *module, *builder, wrapper_size);
+                                    context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                        wrapper_size);
                                 builder->CreateMemSet(wrapper_ptr, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                                     wrapper_size, llvm::MaybeAlign());
                                 wrapper_ptr = builder->CreateBitCast(wrapper_ptr, wrapper_llvm_type->getPointerTo());
@@ -10009,7 +10469,8 @@ public:
                         llvm::Value* wrapper_size = llvm::ConstantInt::get(
                             llvm::Type::getInt64Ty(context), sz);
                         llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-                            context, *module, *builder, wrapper_size);
+                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                wrapper_size);
                         builder->CreateMemSet(wrapper_ptr,
                             llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
                             wrapper_size, llvm::MaybeAlign());
@@ -10309,7 +10770,7 @@ public:
                     llvm::Value* alloc_size = llvm::ConstantInt::get(
                         llvm::Type::getInt64Ty(context), sz);
                     llvm::Value* new_buf = LLVMArrUtils::lfortran_malloc(
-                        context, *module, *builder, alloc_size);
+                        context, *module, *builder, llvm_utils->get_allocator_function_name(), alloc_size);
                     builder->CreateStore(new_buf, data_field_ptr);
                 }, []() {});
                 data_ptr = llvm_utils->CreateLoad2(llvm_utils->i8_ptr, data_field_ptr);
@@ -12504,14 +12965,77 @@ public:
         tmp = llvm_utils->CreateLoad2(_type, ifexp_res);
     }
 
+    /*
+        Only `simd` regions reach the backend, the openmp pass lowers the
+        rest. `simdlen` and `safelen` bound the vector width; `safelen` and
+        `reduction` mean that iterations may depend on each other, so then
+        the accesses are not marked as parallel.
+    */
+    void visit_OMPRegion(const ASR::OMPRegion_t &x) {
+        if (x.m_region != ASR::omp_region_typeType::Simd) {
+            throw CodeGenError("OpenMP region is not supported by the LLVM backend",
+                x.base.base.loc);
+        }
+        LoopHints hints;
+        hints.vectorize = true;
+        hints.parallel_accesses = true;
+        for (size_t i = 0; i < x.n_clauses; i++) {
+            ASR::omp_clause_t *clause = x.m_clauses[i];
+            int64_t len = 0;
+            if (ASR::is_a<ASR::OMPSimdlen_t>(*clause)) {
+                ASRUtils::extract_value(ASR::down_cast<ASR::OMPSimdlen_t>(clause)->m_simdlen, len);
+            } else if (ASR::is_a<ASR::OMPSafelen_t>(*clause)) {
+                ASRUtils::extract_value(ASR::down_cast<ASR::OMPSafelen_t>(clause)->m_safelen, len);
+                hints.parallel_accesses = false;
+            } else if (ASR::is_a<ASR::OMPReduction_t>(*clause)) {
+                hints.parallel_accesses = false;
+            }
+            if (len > 0 && (hints.width == 0 || len < hints.width)) {
+                hints.width = len;
+            }
+        }
+        LoopHints pending_loop_hints_copy = pending_loop_hints;
+        pending_loop_hints = hints;
+        for (size_t i = 0; i < x.n_body; i++) {
+            this->visit_stmt(*x.m_body[i]);
+        }
+        pending_loop_hints = pending_loop_hints_copy;
+    }
+
     // TODO: Implement visit_DooLoop
     //void visit_DoLoop(const ASR::DoLoop_t &x) {
     //}
 
+    /*
+        The do_loops pass starts the body of a lowered counted loop with
+        `i = i + step`. Returns `i`, or nullptr for other while loops.
+    */
+    static ASR::symbol_t *lowered_loop_index(const ASR::WhileLoop_t &x) {
+        if (x.n_body == 0 || !ASR::is_a<ASR::Assignment_t>(*x.m_body[0])) {
+            return nullptr;
+        }
+        ASR::Assignment_t *inc = ASR::down_cast<ASR::Assignment_t>(x.m_body[0]);
+        if (!ASR::is_a<ASR::Var_t>(*inc->m_target)
+                || !ASR::is_a<ASR::IntegerBinOp_t>(*inc->m_value)) {
+            return nullptr;
+        }
+        ASR::IntegerBinOp_t *add = ASR::down_cast<ASR::IntegerBinOp_t>(inc->m_value);
+        ASR::symbol_t *index = ASR::down_cast<ASR::Var_t>(inc->m_target)->m_v;
+        if (add->m_op != ASR::binopType::Add || !ASR::is_a<ASR::Var_t>(*add->m_left)
+                || ASR::down_cast<ASR::Var_t>(add->m_left)->m_v != index) {
+            return nullptr;
+        }
+        return ASRUtils::symbol_get_past_external(index);
+    }
+
     void visit_WhileLoop(const ASR::WhileLoop_t &x) {
         llvm::Value **strings_to_be_deallocated_copy = strings_to_be_deallocated.p;
         size_t n = strings_to_be_deallocated.n;
         strings_to_be_deallocated.reserve(al, 1);
+        if (pending_loop_hints.parallel_accesses) {
+            pending_loop_hints.index = lowered_loop_index(x);
+            pending_loop_hints.parallel_accesses = pending_loop_hints.index != nullptr;
+        }
         create_loop(x.m_name, [=]() {
             this->visit_expr_wrapper(x.m_test, true);
             return tmp;
@@ -12722,17 +13246,48 @@ public:
         std::tie(left_val, left_len) = get_string_data_and_length(x.m_left);
         this->visit_expr_wrapper(x.m_right, true);
         llvm::Value *right_val = tmp;
-        tmp = lfortran_strrepeat(left_val, right_val);
+        right_val = llvm_utils->convert_kind(right_val, llvm::Type::getInt32Ty(context));
+        tmp = lfortran_strrepeat(left_val, left_len, right_val);
         right_val = llvm_utils->convert_kind(right_val, llvm::Type::getInt64Ty(context));
         tmp = llvm_utils->create_string_descriptor(tmp,
             builder->CreateMul(left_len, right_val), "strRepeat_desc");
     }
 
+    // `a // b // c // d` is a chain of binary StringConcat nodes; collect
+    // the operands so that the whole chain is built with one allocation
+    void flatten_string_concat(ASR::expr_t* x, std::vector<ASR::expr_t*> &operands) {
+        if (ASR::is_a<ASR::StringConcat_t>(*x)
+                && !ASR::down_cast<ASR::StringConcat_t>(x)->m_value) {
+            ASR::StringConcat_t* concat = ASR::down_cast<ASR::StringConcat_t>(x);
+            flatten_string_concat(concat->m_left, operands);
+            flatten_string_concat(concat->m_right, operands);
+        } else {
+            operands.push_back(x);
+        }
+    }
+
     void visit_StringConcat(const ASR::StringConcat_t &x) {
         if (x.m_value) {
             this->visit_expr_wrapper(x.m_value, true);
             return;
         }
+        std::vector<ASR::expr_t*> operands;
+        flatten_string_concat(x.m_left, operands);
+        flatten_string_concat(x.m_right, operands);
+        if (operands.size() > 2) {
+            std::vector<llvm::Value*> strs, lens;
+            llvm::Value* total_len = nullptr;
+            for (ASR::expr_t* operand: operands) {
+                llvm::Value* str {}, *len {};
+                std::tie(str, len) = get_string_data_and_length(operand);
+                strs.push_back(str);
+                lens.push_back(len);
+                total_len = total_len ? builder->CreateAdd(total_len, len) : len;
+            }
+            tmp = lfortran_strConcat_n(strs, lens);
+            tmp = llvm_utils->create_string_descriptor(tmp, total_len, "strConcat_desc");
+            return;
+        }
         llvm::Value* left_val {}, *left_len {};
         llvm::Value* right_val {}, *right_len {};
         std::tie(left_val, left_len) = get_string_data_and_length(x.m_left);
@@ -13546,26 +14101,10 @@ public:
         int64_t arr_size = ASRUtils::get_fixed_size_of_array(x.m_type);
         llvm::Type *Int32Ty = llvm::Type::getInt32Ty(context);
         llvm::ArrayType * arr_type = llvm::ArrayType::get(el_type, arr_size);
-        std::vector<llvm::Constant *> values;
-
-        if (ASRUtils::is_integer(*x_m_type)) {
-            for (size_t i=0; i < (size_t) arr_size; i++) {
-                ASR::expr_t *el = ASRUtils::fetch_ArrayConstant_value(al, x, i);
-                values.push_back(llvm::ConstantInt::get(el_type, down_cast<ASR::IntegerConstant_t>(el)->m_n));
-            }
-        } else if (ASRUtils::is_real(*x_m_type)) {
-            for (size_t i=0; i < (size_t) arr_size; i++) {
-                ASR::expr_t *el = ASRUtils::fetch_ArrayConstant_value(al, x, i);
-                values.push_back(llvm::ConstantFP::get(el_type, down_cast<ASR::RealConstant_t>(el)->m_r));
-            }
-        } else if (ASRUtils::is_logical(*x_m_type)) {
-            int a_kind = ASRUtils::extract_kind_from_ttype_t(x_m_type);
-            for (size_t i=0; i < (size_t) arr_size; i++) {
-                ASR::expr_t *el = ASRUtils::fetch_ArrayConstant_value(al, x, i);
-                values.push_back(llvm::ConstantInt::get(
-                    el_type, llvm::APInt(a_kind * 8, down_cast<ASR::LogicalConstant_t>(el)->m_value ? 1 : 0)));
-            }
-        } else if (ASRUtils::is_complex(*x_m_type)) {
+        llvm::Constant *ConstArray = nullptr;
+        if (ASRUtils::is_complex(*x_m_type)) {
+            std::vector<llvm::Constant *> values;
+            values.reserve(arr_size);
             for (size_t i=0; i < (size_t) arr_size; i++) {
                 ASR::expr_t *el = ASRUtils::fetch_ArrayConstant_value(al, x, i);
                 ASR::ComplexConstant_t *comp_const = down_cast<ASR::ComplexConstant_t>(el);
@@ -13579,12 +14118,19 @@ public:
                         llvm::ConstantFP::get(llvm::Type::getDoubleTy(context), comp_const->m_im)}));
                 }
             }
+            ConstArray = llvm::ConstantArray::get(arr_type, values);
         } else if (ASRUtils::is_character(*x_m_type)) { // Sepcial Case.
             tmp = llvm_utils->declare_constant_stringArray(al, &x);
             return;
+        } else {
+            ConstArray = get_const_data_array(x, el_type);
+            if (ConstArray == nullptr) {
+                // The packed data does not match `el_type`, build the
+                // constant element by element instead
+                ConstArray = get_const_array(
+                    const_cast<ASR::expr_t*>(&x.base), arr_type);
+            }
         }
-
-        llvm::Constant *ConstArray = llvm::ConstantArray::get(arr_type, values);
         llvm::GlobalVariable *global_var = new llvm::GlobalVariable(*module, arr_type, true,
             llvm::GlobalValue::PrivateLinkage, ConstArray, "global_array_" + std::to_string(global_array_count++));
         tmp = builder->CreateGEP(
@@ -15492,6 +16038,14 @@ public:
     }
 
     void visit_FileRead(const ASR::FileRead_t &x) {
+        transfer_unit_val = nullptr;
+        visit_FileRead_transfer(x);
+        if (x.m_id && x.m_unit && ASRUtils::is_integer(*expr_type(x.m_unit))) {
+            store_transfer_id(x.m_id);
+        }
+    }
+
+    void visit_FileRead_transfer(const ASR::FileRead_t &x) {
         if( x.m_overloaded ) {
             this->visit_stmt(*x.m_overloaded);
             return ;
@@ -15522,6 +16076,7 @@ public:
                 } else {
                     this->visit_expr_wrapper(x.m_unit, true);
                     unit_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
+                    transfer_unit_val = unit_val;
                 }
             }
 
@@ -15665,6 +16220,7 @@ public:
             if(ASRUtils::is_integer(*ASRUtils::expr_type(x.m_unit))){
                 // Convert the unit to 32 bit integer (We only support unit number up to 1000).
                 unit_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
+                transfer_unit_val = unit_val;
             }
         }
 
@@ -16807,6 +17363,7 @@ public:
         llvm::Value *encoding_data{}, *encoding_len{};
         llvm::Value *sign_data{}, *sign_len{};
         llvm::Value *decimal_data{}, *decimal_len{};
+        llvm::Value *asynchronous_data{}, *asynchronous_len{};
 
         this->visit_expr_wrapper(x.m_newunit, true);
         unit_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
@@ -16903,6 +17460,12 @@ public:
             decimal_data = llvm::Constant::getNullValue(character_type);
             decimal_len  = llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), 0);
         }
+        if (x.m_asynchronous) {
+            std::tie(asynchronous_data, asynchronous_len) = get_string_data_and_length(x.m_asynchronous);
+        } else {
+            asynchronous_data = llvm::Constant::getNullValue(character_type);
+            asynchronous_len  = llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), 0);
+        }
 
         ptr_loads = ptr_copy;
         std::string runtime_func_name = "_lfortran_open";
@@ -16925,7 +17488,8 @@ public:
                         character_type, i64, //encoding_data, encoding_len
                         llvm::Type::getInt32Ty(context)->getPointerTo(), // recl
                         character_type, i64,  // sign_data, sign_len
-                        character_type, i64   // decimal_data, decimal_len
+                        character_type, i64,  // decimal_data, decimal_len
+                        character_type, i64   // asynchronous_data, asynchronous_len
                     }, false);
             fn = llvm::Function::Create(function_type,
                     llvm::Function::ExternalLinkage, runtime_func_name, module.get());
@@ -16944,7 +17508,8 @@ public:
             encoding_data, encoding_len,
             recl,
             sign_data, sign_len,
-            decimal_data, decimal_len
+            decimal_data, decimal_len,
+            asynchronous_data, asynchronous_len
         });
     }
 
@@ -17421,6 +17986,84 @@ public:
         builder->CreateCall(fn, {unit_val});
     }
 
+    void visit_FileWait(const ASR::FileWait_t& x) {
+        std::string runtime_func_name = "_lfortran_wait";
+        llvm::Function *fn = module->getFunction(runtime_func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getVoidTy(context), {
+                        llvm::Type::getInt32Ty(context),
+                        llvm::Type::getInt32Ty(context),
+                        llvm::Type::getInt1Ty(context),
+                        llvm::Type::getInt32Ty(context)->getPointerTo(),
+                        character_type,
+                        llvm::Type::getInt64Ty(context)
+                    }, false);
+            fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, runtime_func_name, module.get());
+        }
+        this->visit_expr_wrapper(x.m_unit, true);
+        llvm::Value *unit_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
+        llvm::Value *id_val, *has_id;
+        if (x.m_id) {
+            this->visit_expr_wrapper(x.m_id, true);
+            id_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
+            has_id = llvm::ConstantInt::getTrue(context);
+        } else {
+            id_val = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 0);
+            has_id = llvm::ConstantInt::getFalse(context);
+        }
+        llvm::Value *iostat;
+        if (x.m_iostat) {
+            int ptr_copy = ptr_loads;
+            ptr_loads = 0;
+            this->visit_expr_wrapper(x.m_iostat, false);
+            ptr_loads = ptr_copy;
+            iostat = tmp;
+        } else {
+            iostat = llvm::ConstantPointerNull::get(llvm::Type::getInt32Ty(context)->getPointerTo());
+        }
+        llvm::Value *iomsg_data, *iomsg_len;
+        if (x.m_iomsg) {
+            std::tie(iomsg_data, iomsg_len) = get_string_data_and_length(x.m_iomsg);
+        } else {
+            iomsg_data = llvm::Constant::getNullValue(character_type);
+            iomsg_len = llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), 0);
+        }
+        builder->CreateCall(fn, {unit_val, id_val, has_id, iostat, iomsg_data, iomsg_len});
+    }
+
+    /*
+        Stores the identifier of the data transfer just started on an
+        external unit into the `id=` variable of READ/WRITE. The unit number
+        is the one the transfer itself evaluated (`transfer_unit_val`).
+        Defined input/output procedures do their own transfers, which are
+        synchronous, so they get ID 0.
+    */
+    void store_transfer_id(ASR::expr_t* id) {
+        std::string runtime_func_name = "_lfortran_transfer_id";
+        llvm::Function *fn = module->getFunction(runtime_func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getInt32Ty(context), {
+                        llvm::Type::getInt32Ty(context)
+                    }, false);
+            fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, runtime_func_name, module.get());
+        }
+        llvm::Value *unit_val = transfer_unit_val ? transfer_unit_val :
+            llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), llvm::APInt(32, -1, true));
+        llvm::Value *id_val = builder->CreateCall(fn, {unit_val});
+        int ptr_copy = ptr_loads;
+        ptr_loads = 0;
+        this->visit_expr_wrapper(id, false);
+        ptr_loads = ptr_copy;
+        llvm::Value *id_ptr = tmp;
+        llvm::Type *id_type = llvm_utils->get_type_from_ttype_t_util(id,
+            ASRUtils::type_get_past_pointer(ASRUtils::expr_type(id)), module.get());
+        builder->CreateStore(llvm_utils->convert_kind(id_val, id_type), id_ptr);
+    }
+
     void visit_FileRewind(const ASR::FileRewind_t &x) {
         std::string runtime_func_name = "_lfortran_rewind";
         llvm::Function *fn = module->getFunction(runtime_func_name);
@@ -17524,6 +18167,14 @@ public:
     }
 
     void visit_FileWrite(const ASR::FileWrite_t &x) {
+        transfer_unit_val = nullptr;
+        visit_FileWrite_transfer(x);
+        if (x.m_id && x.m_unit && ASRUtils::is_integer(*expr_type(x.m_unit))) {
+            store_transfer_id(x.m_id);
+        }
+    }
+
+    void visit_FileWrite_transfer(const ASR::FileWrite_t &x) {
         if( x.m_overloaded ) {
             this->visit_stmt(*x.m_overloaded);
             return ;
@@ -17538,6 +18189,7 @@ public:
             } else {
                 this->visit_expr_wrapper(x.m_unit, true);
                 unit_val = llvm_utils->convert_kind(tmp, llvm::Type::getInt32Ty(context));
+                transfer_unit_val = unit_val;
             }
 
             if (x.m_iostat) {
@@ -17667,6 +18319,7 @@ public:
                 // Truncate i64 to i32 for runtime function (ILP64 mode)
                 unit = builder->CreateTrunc(unit, llvm::Type::getInt32Ty(context));
             }
+            transfer_unit_val = unit;
         } else { // String Write
             std::tie(unit, string_len) = llvm_utils->get_string_length_data(
                 ASRUtils::get_string_type(x.m_unit), tmp, true, true);
@@ -22334,10 +22987,14 @@ Result<std::unique_ptr<LLVMModule>> asr_to_llvm(ASR::TranslationUnit_t &asr,
 
     co.po.run_fun = run_fn;
     co.po.always_run = false;
+    co.po.simd_do_concurrent = true;
     co.po.skip_optimization_func_instantiation = skip_optimization_func_instantiation;
     pass_manager.rtlib = co.rtlib;
     auto t1 = std::chrono::high_resolution_clock::now();
-    pass_manager.apply_passes(al, &asr, co.po, diagnostics);
+    {
+        TimeTraceScope trace(co.po.time_trace, "ASR passes", "", &al);
+        pass_manager.apply_passes(al, &asr, co.po, diagnostics);
+    }
     auto t2 = std::chrono::high_resolution_clock::now();
 
     if (co.time_report) {
@@ -22356,6 +23013,7 @@ Result<std::unique_ptr<LLVMModule>> asr_to_llvm(ASR::TranslationUnit_t &asr,
     // std::cout << LCompilers::pickle(asr, true, false, false) << std::endl;
 
     t1 = std::chrono::high_resolution_clock::now();
+    TimeTraceScope trace(co.po.time_trace, "LLVM IR");
     try {
         v.visit_asr((ASR::asr_t&)asr);
     } catch (const CodeGenError &e) {
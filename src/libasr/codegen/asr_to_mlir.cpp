@@ -2,6 +2,11 @@
 #include <mlir/IR/BuiltinTypes.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
 #include <mlir/Dialect/OpenMP/OpenMPDialect.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/Arith/IR/Arith.h>
+#include <mlir/Dialect/ControlFlow/IR/ControlFlow.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+#include <mlir/Dialect/SCF/IR/SCF.h>
 #include <mlir/IR/Verifier.h>
 #include <mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h>
 #include <mlir/Target/LLVMIR/Dialect/OpenMP/OpenMPToLLVMIRTranslation.h>
@@ -39,6 +44,70 @@ public:
     { }
 };
 
+// Whether the statements call a procedure, which can read the loop
+// variables through their address or by host association
+class CallFinder : public ASR::BaseWalkVisitor<CallFinder>
+{
+public:
+    bool found = false;
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &) {
+        found = true;
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &) {
+        found = true;
+    }
+};
+
+// Collects the DO loop variables and the variables that are referenced
+// outside of the loops over them. The value that the other loop variables
+// have on exit from their loops is never read.
+class LoopVarUses : public ASR::BaseWalkVisitor<LoopVarUses>
+{
+public:
+    std::set<ASR::symbol_t*> loop_vars, used_outside;
+    std::set<ASR::symbol_t*> active; // Variables of the enclosing loops
+
+    void visit_loop(const ASR::do_loop_head_t *heads, size_t n_heads,
+            ASR::stmt_t **body, size_t n_body) {
+        std::vector<ASR::symbol_t*> entered;
+        for (size_t i = 0; i < n_heads; i++) {
+            const ASR::do_loop_head_t &head = heads[i];
+            if (head.m_start) visit_expr(*head.m_start);
+            if (head.m_end) visit_expr(*head.m_end);
+            if (head.m_increment) visit_expr(*head.m_increment);
+            if (head.m_v && is_a<ASR::Var_t>(*head.m_v)) {
+                ASR::symbol_t *v = down_cast<ASR::Var_t>(head.m_v)->m_v;
+                loop_vars.insert(v);
+                if (active.insert(v).second) entered.push_back(v);
+            }
+        }
+        for (size_t i = 0; i < n_body; i++) {
+            visit_stmt(*body[i]);
+        }
+        for (ASR::symbol_t *v : entered) {
+            active.erase(v);
+        }
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        visit_loop(&x.m_head, 1, x.m_body, x.n_body);
+        for (size_t i = 0; i < x.n_orelse; i++) {
+            visit_stmt(*x.m_orelse[i]);
+        }
+    }
+
+    void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
+        visit_loop(x.m_head, x.n_head, x.m_body, x.n_body);
+    }
+
+    void visit_Var(const ASR::Var_t &x) {
+        if (active.find(x.m_v) == active.end()) {
+            used_outside.insert(x.m_v);
+        }
+    }
+};
 
 class ASRToMLIRVisitor : public ASR::BaseVisitor<ASRToMLIRVisitor>
 {
@@ -56,16 +125,35 @@ public:
 
     std::map<uint64_t, mlir::Value> mlir_symtab; // Used for variables
 
+    bool openmp; // Lower DO CONCURRENT to OpenMP
+    // The current value of the loop variables of the enclosing loops, so
+    // that the loop bodies do not reload them from memory
+    std::map<uint64_t, mlir::Value> loop_vars;
+    // Induction variables of the enclosing affine loops, and the loop
+    // variables as affine expressions of them, for affine.load/store
+    llvm::SmallVector<mlir::Value> affine_dims;
+    std::map<uint64_t, mlir::AffineExpr> affine_vars;
+    // Loop variables whose value on exit from the loop is never read
+    std::set<ASR::symbol_t*> dead_loop_vars;
+
 public:
-    ASRToMLIRVisitor(Allocator &al)
+    ASRToMLIRVisitor(Allocator &al, bool openmp)
         : al{al},
         context(std::make_unique<mlir::MLIRContext>()),
         builder(std::make_unique<mlir::OpBuilder>(context.get())),
-        loc(builder->getUnknownLoc())
+        loc(builder->getUnknownLoc()),
+        openmp{openmp}
         {
             // Load MLIR Dialects
             context->getOrLoadDialect<mlir::LLVM::LLVMDialect>();
             context->getOrLoadDialect<mlir::omp::OpenMPDialect>();
+            context->getOrLoadDialect<mlir::affine::AffineDialect>();
+            context->getOrLoadDialect<mlir::arith::ArithDialect>();
+            context->getOrLoadDialect<mlir::scf::SCFDialect>();
+            context->getOrLoadDialect<mlir::memref::MemRefDialect>();
+            // Not emitted directly, but the structured loops are lowered
+            // to it in MLIRModule::mlir_to_llvm
+            context->getOrLoadDialect<mlir::cf::ControlFlowDialect>();
 
             // Initialize values
             voidPtr = mlir::LLVM::LLVMPointerType::get(context.get());
@@ -119,7 +207,164 @@ public:
         return builder->create<mlir::LLVM::AddressOfOp>(loc, globalStr);
     }
 
+    // Local fixed size arrays are memrefs, so that MLIR can analyze and
+    // transform the loops over them. The shape is reversed, so that the
+    // row major memref has the column major layout of the Fortran array.
+    bool is_memref_array(const ASR::Variable_t &x) {
+        return ASRUtils::is_array(x.m_type) &&
+            ASRUtils::is_fixed_size_array(x.m_type) &&
+            (x.m_intent == ASR::intentType::Local ||
+             x.m_intent == ASR::intentType::ReturnVar);
+    }
+
+    mlir::MemRefType getMemRefType(ASR::ttype_t *asr_type) {
+        ASR::dimension_t *dims = nullptr;
+        size_t n_dims = ASRUtils::extract_dimensions_from_ttype(asr_type, dims);
+        llvm::SmallVector<int64_t> shape;
+        for (size_t i = n_dims; i-- > 0;) {
+            int64_t length = 0;
+            extract_int(dims[i].m_length, length);
+            shape.push_back(length);
+        }
+        return mlir::MemRefType::get(shape, getType(
+            ASRUtils::extract_type(asr_type)));
+    }
+
+    // The address of the first element, e.g. to pass the array to a
+    // procedure
+    mlir::Value memref_pointer(mlir::Value memref) {
+        mlir::Value p = builder->create<
+            mlir::memref::ExtractAlignedPointerAsIndexOp>(loc, memref);
+        p = builder->create<mlir::arith::IndexCastOp>(loc,
+            builder->getI64Type(), p);
+        return builder->create<mlir::LLVM::IntToPtrOp>(loc, voidPtr, p);
+    }
+
+    bool is_variable(ASR::expr_t *v) {
+        return is_a<ASR::Variable_t>(*ASRUtils::symbol_get_past_external(
+            down_cast<ASR::Var_t>(v)->m_v));
+    }
+
+    uint64_t loop_var_hash(ASR::expr_t *v) {
+        return get_hash((ASR::asr_t*) ASRUtils::EXPR2VAR(v));
+    }
+
+    // `x` as an affine expression of the enclosing affine loops
+    bool get_affine_expr(ASR::expr_t *x, mlir::AffineExpr &e) {
+        int64_t value;
+        if (extract_int(x, value)) {
+            e = builder->getAffineConstantExpr(value);
+            return true;
+        }
+        switch (x->type) {
+            case ASR::exprType::Var: {
+                if (!is_variable(x)) return false;
+                auto it = affine_vars.find(loop_var_hash(x));
+                if (it == affine_vars.end()) return false;
+                e = it->second;
+                return true;
+            } case ASR::exprType::IntegerBinOp: {
+                ASR::IntegerBinOp_t *op = down_cast<ASR::IntegerBinOp_t>(x);
+                mlir::AffineExpr left, right;
+                if (!get_affine_expr(op->m_left, left) ||
+                        !get_affine_expr(op->m_right, right)) {
+                    return false;
+                }
+                if (op->m_op == ASR::binopType::Add) {
+                    e = left + right;
+                } else if (op->m_op == ASR::binopType::Sub) {
+                    e = left - right;
+                } else if (op->m_op == ASR::binopType::Mul &&
+                        (extract_int(op->m_left, value) ||
+                         extract_int(op->m_right, value))) {
+                    e = left * right;
+                } else {
+                    return false;
+                }
+                return true;
+            } case ASR::exprType::IntegerUnaryMinus: {
+                if (!get_affine_expr(down_cast<ASR::IntegerUnaryMinus_t>(
+                        x)->m_arg, e)) {
+                    return false;
+                }
+                e = -e;
+                return true;
+            } case ASR::exprType::Cast: {
+                ASR::Cast_t *cast = down_cast<ASR::Cast_t>(x);
+                return cast->m_kind == ASR::cast_kindType::IntegerToInteger &&
+                    get_affine_expr(cast->m_arg, e);
+            } default: {
+                return false;
+            }
+        }
+    }
+
+    // Loads the element `x` of `memref`, or stores `value` to it. Indices
+    // that are affine in the enclosing affine loops give affine.load/store.
+    mlir::Value access_memref(const ASR::ArrayItem_t &x, mlir::Value memref,
+            mlir::Value value = nullptr) {
+        ASR::dimension_t *dims = nullptr;
+        size_t n_dims = ASRUtils::extract_dimensions_from_ttype(
+            ASRUtils::expr_type(x.m_v), dims);
+        LCOMPILERS_ASSERT(n_dims == x.n_args);
+        std::vector<int64_t> lbounds(n_dims, 1);
+        for (size_t i = 0; i < n_dims; i++) {
+            if (dims[i].m_start) extract_int(dims[i].m_start, lbounds[i]);
+        }
+
+        llvm::SmallVector<mlir::AffineExpr> exprs;
+        for (size_t i = x.n_args; i-- > 0;) {
+            mlir::AffineExpr e;
+            if (!x.m_args[i].m_right ||
+                    !get_affine_expr(x.m_args[i].m_right, e)) {
+                break;
+            }
+            exprs.push_back(e - lbounds[i]);
+        }
+        if (exprs.size() == x.n_args) {
+            mlir::AffineMap map = mlir::AffineMap::get(affine_dims.size(), 0,
+                exprs, context.get());
+            if (value) {
+                builder->create<mlir::affine::AffineStoreOp>(loc, value,
+                    memref, map, affine_dims);
+                return nullptr;
+            }
+            return builder->create<mlir::affine::AffineLoadOp>(loc, memref,
+                map, affine_dims);
+        }
+
+        llvm::SmallVector<mlir::Value> indices;
+        for (size_t i = x.n_args; i-- > 0;) {
+            this->visit_expr2(*x.m_args[i].m_right);
+            mlir::Value idx = builder->create<mlir::arith::IndexCastOp>(loc,
+                builder->getIndexType(), tmp);
+            indices.push_back(builder->create<mlir::arith::SubIOp>(loc, idx,
+                builder->create<mlir::arith::ConstantIndexOp>(loc,
+                    lbounds[i])));
+        }
+        if (value) {
+            builder->create<mlir::memref::StoreOp>(loc, value, memref, indices);
+            return nullptr;
+        }
+        return builder->create<mlir::memref::LoadOp>(loc, memref, indices);
+    }
+
     void visit_expr2(ASR::expr_t &x) {
+        if (ASR::is_a<ASR::Var_t>(x) && is_variable(&x)) {
+            auto it = loop_vars.find(loop_var_hash(&x));
+            if (it != loop_vars.end()) {
+                tmp = it->second;
+                return;
+            }
+        }
+        if (ASR::is_a<ASR::ArrayItem_t>(x)) {
+            ASR::ArrayItem_t &item = *ASR::down_cast<ASR::ArrayItem_t>(&x);
+            this->visit_expr(*item.m_v);
+            if (mlir::isa<mlir::MemRefType>(tmp.getType())) {
+                tmp = access_memref(item, tmp);
+                return;
+            }
+        }
         this->visit_expr(x);
         if (ASR::is_a<ASR::Var_t>(x) || ASR::is_a<ASR::ArrayItem_t>(x)) {
             mlir::Type type = getType(ASRUtils::expr_type(&x));
@@ -127,6 +372,30 @@ public:
         }
     }
 
+    void find_dead_loop_vars(SymbolTable *symtab, ASR::stmt_t **body,
+            size_t n_body) {
+        dead_loop_vars.clear();
+        for (auto &item : symtab->get_scope()) {
+            // Contained procedures can read the loop variables of the host
+            if (is_a<ASR::Function_t>(*item.second)) return;
+        }
+        LoopVarUses uses;
+        for (size_t i = 0; i < n_body; i++) {
+            uses.visit_stmt(*body[i]);
+        }
+        for (ASR::symbol_t *s : uses.loop_vars) {
+            if (uses.used_outside.find(s) != uses.used_outside.end() ||
+                    !is_a<ASR::Variable_t>(*s)) {
+                continue;
+            }
+            ASR::Variable_t *v = down_cast<ASR::Variable_t>(s);
+            if (v->m_intent == ASR::intentType::Local &&
+                    v->m_storage != ASR::storage_typeType::Save) {
+                dead_loop_vars.insert(s);
+            }
+        }
+    }
+
     /******************************** Visitors ********************************/
     void visit_TranslationUnit(const ASR::TranslationUnit_t &x) {
         module = std::make_unique<mlir::ModuleOp>(builder->create<mlir::ModuleOp>(loc,
@@ -217,6 +486,7 @@ public:
         }
 
         // Visit the function body
+        find_dead_loop_vars(x.m_symtab, x.m_body, x.n_body);
         for (size_t i = 0; i < x.n_body; i++) {
             visit_stmt(*x.m_body[i]);
         }
@@ -253,6 +523,7 @@ public:
             }
         }
 
+        find_dead_loop_vars(x.m_symtab, x.m_body, x.n_body);
         for (size_t i = 0; i < x.n_body; i++) {
             visit_stmt(*x.m_body[i]);
         }
@@ -274,6 +545,16 @@ public:
             handle_string_variable(h);
             return;
         }
+        if (is_memref_array(x)) {
+            if (x.m_symbolic_value) {
+                throw CodeGenError("Initialization of the array '" +
+                    std::string(x.m_name) + "' is not supported yet",
+                    x.base.base.loc);
+            }
+            mlir_symtab[h] = builder->create<mlir::memref::AllocaOp>(loc,
+                getMemRefType(x.m_type));
+            return;
+        }
         mlir::Value size = builder->create<mlir::LLVM::ConstantOp>(loc,
             builder->getI32Type(), builder->getI64IntegerAttr(1));
         mlir_symtab[h] = builder->create<mlir::LLVM::AllocaOp>(loc,
@@ -302,6 +583,9 @@ public:
         Vec<mlir::Type> argTypes; argTypes.reserve(al, x.n_args);
         for (size_t i=0; i<x.n_args; i++) {
             this->visit_expr(*x.m_args[i].m_value);
+            if (mlir::isa<mlir::MemRefType>(tmp.getType())) {
+                tmp = memref_pointer(tmp);
+            }
             if (!is_a<ASR::Var_t>(*ASRUtils::get_past_array_physical_cast(
                     x.m_args[i].m_value))) {
                 // Constant, BinOp, etc would have the type i32, but not i32*
@@ -426,6 +710,16 @@ public:
     }
 
     void visit_Assignment(const ASR::Assignment_t &x) {
+        if (is_a<ASR::ArrayItem_t>(*x.m_target)) {
+            ASR::ArrayItem_t *item = down_cast<ASR::ArrayItem_t>(x.m_target);
+            this->visit_expr(*item->m_v);
+            if (mlir::isa<mlir::MemRefType>(tmp.getType())) {
+                mlir::Value memref = tmp;
+                this->visit_expr2(*x.m_value);
+                access_memref(*item, memref, tmp);
+                return;
+            }
+        }
         this->visit_expr(*x.m_target);
         mlir::Value target = tmp;
         this->visit_expr2(*x.m_value);
@@ -544,7 +838,10 @@ public:
         this->visit_expr(*x.m_arg);
         switch (x.m_old) {
             case (ASR::array_physical_typeType::FixedSizeArray): {
-                if (x.m_new == ASR::array_physical_typeType::PointerArray) {
+                if (x.m_new == ASR::array_physical_typeType::PointerArray &&
+                        mlir::isa<mlir::MemRefType>(tmp.getType())) {
+                    tmp = memref_pointer(tmp);
+                } else if (x.m_new == ASR::array_physical_typeType::PointerArray) {
                     mlir::Value zero = builder->create<mlir::LLVM::ConstantOp>(loc,
                         builder->getI64Type(), builder->getIndexAttr(0));
                     mlir::Type type = getType(x.m_type);
@@ -701,6 +998,41 @@ public:
         this->visit_expr(*x.m_v);
         mlir::Value m_v = tmp;
 
+        if (mlir::isa<mlir::MemRefType>(m_v.getType())) {
+            // The address of an element, e.g. to pass it by reference.
+            // Loads and stores use access_memref().
+            ASR::dimension_t *dims = nullptr;
+            ASRUtils::extract_dimensions_from_ttype(ASRUtils::expr_type(x.m_v),
+                dims);
+            mlir::Value offset = builder->create<mlir::LLVM::ConstantOp>(loc,
+                builder->getI64Type(), builder->getIndexAttr(0));
+            int64_t stride = 1;
+            for (size_t i = 0; i < x.n_args; i++) {
+                int64_t lbound = 1, length = 0;
+                if (dims[i].m_start) extract_int(dims[i].m_start, lbound);
+                extract_int(dims[i].m_length, length);
+                this->visit_expr2(*x.m_args[i].m_right);
+                mlir::Value idx = tmp;
+                if (ASRUtils::extract_kind_from_ttype_t(ASRUtils::expr_type(
+                        x.m_args[i].m_right)) != 8) {
+                    idx = builder->create<mlir::LLVM::SExtOp>(loc,
+                        builder->getI64Type(), idx);
+                }
+                idx = builder->create<mlir::LLVM::SubOp>(loc, idx,
+                    builder->create<mlir::LLVM::ConstantOp>(loc,
+                        builder->getI64Type(), builder->getIndexAttr(lbound)));
+                offset = builder->create<mlir::LLVM::AddOp>(loc, offset,
+                    builder->create<mlir::LLVM::MulOp>(loc, idx,
+                        builder->create<mlir::LLVM::ConstantOp>(loc,
+                            builder->getI64Type(),
+                            builder->getIndexAttr(stride))));
+                stride *= length;
+            }
+            tmp = builder->create<mlir::LLVM::GEPOp>(loc, voidPtr,
+                getType(x.m_type), memref_pointer(m_v), offset);
+            return;
+        }
+
         LCOMPILERS_ASSERT(x.n_args == 1);
         this->visit_expr2(*x.m_args[0].m_right);
         mlir::Value idx = tmp;
@@ -785,7 +1117,325 @@ public:
         builder->setInsertionPointToStart(contBlock);
     }
 
+    bool extract_int(ASR::expr_t *x, int64_t &value) {
+        ASR::expr_t *x_value = ASRUtils::expr_value(x);
+        return x_value && ASRUtils::extract_value(x_value, value);
+    }
+
+    bool has_call(ASR::stmt_t **body, size_t n_body) {
+        CallFinder v;
+        for (size_t i=0; i<n_body; i++) {
+            v.visit_stmt(*body[i]);
+        }
+        return v.found;
+    }
+
+    // The body of an affine.for or scf.for is a single block, so statements
+    // that branch are emitted into an scf.execute_region inside it
+    void visit_loop_body(ASR::stmt_t **body, size_t n_body) {
+        bool branches = false;
+        for (size_t i=0; i<n_body; i++) {
+            if (!(is_a<ASR::Assignment_t>(*body[i]) ||
+                    is_a<ASR::DoLoop_t>(*body[i]) ||
+                    is_a<ASR::DoConcurrentLoop_t>(*body[i]) ||
+                    is_a<ASR::Print_t>(*body[i]) ||
+                    is_a<ASR::FileWrite_t>(*body[i]) ||
+                    is_a<ASR::SubroutineCall_t>(*body[i]))) {
+                branches = true;
+            }
+        }
+        if (!branches) {
+            for (size_t i=0; i<n_body; i++) {
+                this->visit_stmt(*body[i]);
+            }
+            return;
+        }
+        mlir::scf::ExecuteRegionOp region{builder->create<
+            mlir::scf::ExecuteRegionOp>(loc, mlir::TypeRange{})};
+        mlir::OpBuilder::InsertionGuard ipGuard(*builder);
+        builder->createBlock(&region.getRegion());
+        for (size_t i=0; i<n_body; i++) {
+            this->visit_stmt(*body[i]);
+        }
+        mlir::Block *lastBlock = builder->getBlock();
+        if (!(!lastBlock->empty() &&
+                mlir::isa<mlir::LLVM::UnreachableOp>(lastBlock->back()))) {
+            builder->create<mlir::scf::YieldOp>(loc);
+        }
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        //
+        // Counted loops are kept structured, so that they can be optimized
+        // by MLIR before being lowered to branches. The following code:
+        //
+        // do i = 1, 10
+        //   x(i) = i
+        // end do
+        //
+        // becomes:
+        //
+        // affine.for %arg0 = 1 to 11 {
+        //   %1 = arith.index_cast %arg0 : index to i32
+        //   affine.store %1, %x[%arg0 - 1] : memref<10xi32>
+        // }
+        // [...] // i = 11
+        //
+        // Constant bounds give an affine.for, other loops with a positive
+        // constant step an scf.for from start to end + 1, and loops with a
+        // negative or unknown step an scf.for over the trip count.
+        //
+        // The body reads the loop variable from the induction variable. It
+        // is only stored to memory if the body calls a procedure, and on
+        // exit only if its value after the loop is read.
+        //
+        const ASR::do_loop_head_t &head = x.m_head;
+        if (!head.m_v || x.n_orelse > 0) {
+            throw CodeGenError("DO loop without a loop variable or with an "
+                "else block is not supported yet", x.base.base.loc);
+        }
+        mlir::Type type = getType(ASRUtils::expr_type(head.m_v));
+        mlir::Type indexType = builder->getIndexType();
+
+        // The bounds are evaluated once, before the loop
+        this->visit_expr2(*head.m_start);
+        mlir::Value start = tmp;
+        this->visit_expr2(*head.m_end);
+        mlir::Value end = tmp;
+        int64_t start_value, end_value, step_value = 1;
+        mlir::Value step;
+        if (head.m_increment) {
+            this->visit_expr2(*head.m_increment);
+            step = tmp;
+        } else {
+            step = builder->create<mlir::LLVM::ConstantOp>(loc, type,
+                builder->getIntegerAttr(type, 1));
+        }
+        bool constant_step = !head.m_increment ||
+            extract_int(head.m_increment, step_value);
+        if (constant_step && step_value == 0) {
+            throw CodeGenError("DO loop step must not be zero",
+                x.base.base.loc);
+        }
+
+        // trip = max((end - start + step) / step, 0)
+        mlir::Value trip = builder->create<mlir::LLVM::SDivOp>(loc,
+            builder->create<mlir::LLVM::AddOp>(loc,
+                builder->create<mlir::LLVM::SubOp>(loc, end, start), step),
+            step);
+        mlir::Value zero = builder->create<mlir::LLVM::ConstantOp>(loc, type,
+            builder->getIntegerAttr(type, 0));
+        trip = builder->create<mlir::LLVM::SelectOp>(loc,
+            builder->create<mlir::LLVM::ICmpOp>(loc,
+                mlir::LLVM::ICmpPredicate::sgt, trip, zero), trip, zero);
+
+        mlir::Block *body;
+        mlir::Value iv;
+        bool counts_trips = false, affine = false;
+        if (constant_step && step_value > 0 &&
+                extract_int(head.m_start, start_value) &&
+                extract_int(head.m_end, end_value)) {
+            affine = true;
+            mlir::affine::AffineForOp forOp{builder->create<
+                mlir::affine::AffineForOp>(loc, start_value, end_value + 1,
+                step_value)};
+            body = forOp.getBody();
+            iv = forOp.getInductionVar();
+        } else if (constant_step && step_value > 0) {
+            mlir::Value lowerBound = builder->create<mlir::arith::IndexCastOp>(
+                loc, indexType, start);
+            mlir::Value upperBound = builder->create<mlir::arith::AddIOp>(loc,
+                builder->create<mlir::arith::IndexCastOp>(loc, indexType, end),
+                builder->create<mlir::arith::ConstantIndexOp>(loc, 1));
+            mlir::scf::ForOp forOp{builder->create<mlir::scf::ForOp>(loc,
+                lowerBound, upperBound,
+                builder->create<mlir::arith::ConstantIndexOp>(loc,
+                    step_value))};
+            body = forOp.getBody();
+            iv = forOp.getInductionVar();
+        } else {
+            mlir::scf::ForOp forOp{builder->create<mlir::scf::ForOp>(loc,
+                builder->create<mlir::arith::ConstantIndexOp>(loc, 0),
+                builder->create<mlir::arith::IndexCastOp>(loc, indexType, trip),
+                builder->create<mlir::arith::ConstantIndexOp>(loc, 1))};
+            body = forOp.getBody();
+            iv = forOp.getInductionVar();
+            counts_trips = true;
+        }
+
+        {
+            mlir::OpBuilder::InsertionGuard ipGuard(*builder);
+            builder->setInsertionPointToStart(body);
+            mlir::Value v = builder->create<mlir::arith::IndexCastOp>(loc,
+                type, iv);
+            if (counts_trips) {
+                // i = start + k * step
+                v = builder->create<mlir::LLVM::AddOp>(loc, start,
+                    builder->create<mlir::LLVM::MulOp>(loc, v, step));
+            }
+            if (has_call(x.m_body, x.n_body)) {
+                this->visit_expr(*head.m_v);
+                builder->create<mlir::LLVM::StoreOp>(loc, v, tmp);
+            }
+            uint64_t h = loop_var_hash(head.m_v);
+            loop_vars[h] = v;
+            if (affine) {
+                affine_dims.push_back(iv);
+                affine_vars[h] = builder->getAffineDimExpr(
+                    affine_dims.size() - 1);
+            }
+            visit_loop_body(x.m_body, x.n_body);
+            loop_vars.erase(h);
+            if (affine) {
+                affine_dims.pop_back();
+                affine_vars.erase(h);
+            }
+        }
+
+        if (dead_loop_vars.find(down_cast<ASR::Var_t>(head.m_v)->m_v)
+                != dead_loop_vars.end()) {
+            return;
+        }
+        // On exit the loop variable holds start + trip * step
+        this->visit_expr(*head.m_v);
+        builder->create<mlir::LLVM::StoreOp>(loc,
+            builder->create<mlir::LLVM::AddOp>(loc, start,
+                builder->create<mlir::LLVM::MulOp>(loc, trip, step)).getResult(),
+            tmp);
+    }
+
     void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
+        if (openmp) {
+            handle_DoConcurrentLoop_OpenMP(x);
+            return;
+        }
+        //
+        // All iterations are independent, so the loop becomes a parallel
+        // loop over the trip counts of its indices. The following code:
+        //
+        // do concurrent (i = 1: 10)
+        //   x(i) = i
+        // end do
+        //
+        // becomes:
+        //
+        // affine.parallel (%arg0) = (0) to (10) {
+        //   %1 = arith.index_cast %arg0 : index to i32
+        //   %2 = llvm.add %c1, %1 : i32
+        //   affine.store %2, %x[%arg0] : memref<10xi32>
+        // }
+        //
+        // Constant bounds give an affine.parallel, other loops an
+        // scf.parallel. Both are lowered to sequential loops, the
+        // parallel form is there for the MLIR loop transforms.
+        //
+        Vec<mlir::Value> starts; starts.reserve(al, x.n_head);
+        Vec<mlir::Value> steps; steps.reserve(al, x.n_head);
+        Vec<mlir::Value> trips; trips.reserve(al, x.n_head);
+        llvm::SmallVector<int64_t> start_values, step_values, trip_values;
+        bool constant_bounds = true;
+        for (size_t i = 0; i < x.n_head; i++) {
+            const ASR::do_loop_head_t &head = x.m_head[i];
+            mlir::Type type = getType(ASRUtils::expr_type(head.m_v));
+            this->visit_expr2(*head.m_start);
+            mlir::Value start = tmp;
+            this->visit_expr2(*head.m_end);
+            mlir::Value end = tmp;
+            mlir::Value step;
+            if (head.m_increment) {
+                this->visit_expr2(*head.m_increment);
+                step = tmp;
+            } else {
+                step = builder->create<mlir::LLVM::ConstantOp>(loc, type,
+                    builder->getIntegerAttr(type, 1));
+            }
+            // trip = max((end - start + step) / step, 0)
+            mlir::Value trip = builder->create<mlir::LLVM::SDivOp>(loc,
+                builder->create<mlir::LLVM::AddOp>(loc,
+                    builder->create<mlir::LLVM::SubOp>(loc, end, start), step),
+                step);
+            mlir::Value zero = builder->create<mlir::LLVM::ConstantOp>(loc,
+                type, builder->getIntegerAttr(type, 0));
+            trip = builder->create<mlir::LLVM::SelectOp>(loc,
+                builder->create<mlir::LLVM::ICmpOp>(loc,
+                    mlir::LLVM::ICmpPredicate::sgt, trip, zero), trip, zero);
+            starts.push_back(al, start);
+            steps.push_back(al, step);
+            trips.push_back(al, trip);
+
+            int64_t start_value, end_value, step_value = 1;
+            if (extract_int(head.m_start, start_value) &&
+                    extract_int(head.m_end, end_value) &&
+                    (!head.m_increment ||
+                     extract_int(head.m_increment, step_value)) &&
+                    step_value != 0) {
+                start_values.push_back(start_value);
+                step_values.push_back(step_value);
+                trip_values.push_back(std::max<int64_t>(
+                    (end_value - start_value + step_value) / step_value, 0));
+            } else {
+                constant_bounds = false;
+            }
+        }
+
+        mlir::Block *body;
+        if (constant_bounds) {
+            mlir::affine::AffineParallelOp parallelOp{builder->create<
+                mlir::affine::AffineParallelOp>(loc, mlir::TypeRange{},
+                llvm::ArrayRef<mlir::arith::AtomicRMWKind>{}, trip_values)};
+            body = parallelOp.getBody();
+        } else {
+            llvm::SmallVector<mlir::Value> lowerBounds, upperBounds, ones;
+            for (size_t i = 0; i < x.n_head; i++) {
+                lowerBounds.push_back(
+                    builder->create<mlir::arith::ConstantIndexOp>(loc, 0));
+                upperBounds.push_back(builder->create<mlir::arith::IndexCastOp>(
+                    loc, builder->getIndexType(), trips[i]));
+                ones.push_back(
+                    builder->create<mlir::arith::ConstantIndexOp>(loc, 1));
+            }
+            mlir::scf::ParallelOp parallelOp{builder->create<
+                mlir::scf::ParallelOp>(loc, lowerBounds, upperBounds, ones)};
+            body = parallelOp.getBody();
+        }
+
+        mlir::OpBuilder::InsertionGuard ipGuard(*builder);
+        builder->setInsertionPointToStart(body);
+        bool store = has_call(x.m_body, x.n_body);
+        std::vector<uint64_t> hashes;
+        for (size_t i = 0; i < x.n_head; i++) {
+            const ASR::do_loop_head_t &head = x.m_head[i];
+            mlir::Type type = getType(ASRUtils::expr_type(head.m_v));
+            mlir::Value iv = body->getArgument(i);
+            // i = start + k * step
+            mlir::Value v = builder->create<mlir::LLVM::AddOp>(loc, starts[i],
+                builder->create<mlir::LLVM::MulOp>(loc,
+                    builder->create<mlir::arith::IndexCastOp>(loc, type, iv),
+                    steps[i]));
+            if (store) {
+                this->visit_expr(*head.m_v);
+                builder->create<mlir::LLVM::StoreOp>(loc, v, tmp);
+            }
+            uint64_t h = loop_var_hash(head.m_v);
+            hashes.push_back(h);
+            loop_vars[h] = v;
+            if (constant_bounds) {
+                affine_dims.push_back(iv);
+                affine_vars[h] = builder->getAffineDimExpr(
+                    affine_dims.size() - 1) * step_values[i] + start_values[i];
+            }
+        }
+        visit_loop_body(x.m_body, x.n_body);
+        for (uint64_t h : hashes) {
+            loop_vars.erase(h);
+            if (constant_bounds) {
+                affine_dims.pop_back();
+                affine_vars.erase(h);
+            }
+        }
+    }
+
+    void handle_DoConcurrentLoop_OpenMP(const ASR::DoConcurrentLoop_t &x) {
         //
         // The following source code:
         //
@@ -973,7 +1623,7 @@ public:
 };
 
 Result<std::unique_ptr<MLIRModule>> asr_to_mlir(Allocator &al,
-        ASR::asr_t &asr, diag::Diagnostics &diagnostics) {
+        ASR::asr_t &asr, diag::Diagnostics &diagnostics, bool openmp) {
     if ( !(ASR::is_a<ASR::unit_t>(asr) ||
             (ASR::is_a<ASR::Module_t>((ASR::symbol_t &)asr))) ) {
         diagnostics.diagnostics.push_back(diag::Diagnostic("Unhandled type "
@@ -981,7 +1631,7 @@ Result<std::unique_ptr<MLIRModule>> asr_to_mlir(Allocator &al,
             diag::Level::Error, diag::Stage::CodeGen));
         Error error; return error;
     }
-    ASRToMLIRVisitor v(al);
+    ASRToMLIRVisitor v(al, openmp);
     try {
         v.visit_asr(asr);
     } catch (const CodeGenError &e) {
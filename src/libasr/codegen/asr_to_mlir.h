@@ -7,8 +7,10 @@
 
 namespace LCompilers {
 
+    // With `openmp`, DO CONCURRENT is lowered to omp.wsloop, otherwise to
+    // affine.parallel/scf.parallel
     Result<std::unique_ptr<MLIRModule>> asr_to_mlir(Allocator &al,
-        ASR::asr_t &asr, diag::Diagnostics &diagnostics);
+        ASR::asr_t &asr, diag::Diagnostics &diagnostics, bool openmp=false);
 
 } // namespace LCompilers
 
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <chrono>
+#include <algorithm>
 
 #include <libasr/asr.h>
 #include <libasr/containers.h>
@@ -38,12 +39,155 @@ uint64_t static get_hash(ASR::asr_t *node)
     return (uint64_t)node;
 }
 
+// Live range of an integer local or intent(in) argument, in the linear order
+// of the statements of its procedure
+struct LiveInterval {
+    ASR::Variable_t *v;
+    uint32_t start, end;
+    bool in_reg;
+    X86Reg reg;
+};
+
+/*
+ * Computes live intervals for the integer locals and the intent(in) integer
+ * arguments (passed by value) of a procedure body.
+ *
+ * The intervals are conservative: a variable is live from the first to the
+ * last statement that mentions it, and a variable mentioned inside a loop is
+ * live for the whole loop. Arguments are live from the entry.
+ *
+ * Only loops need widening. The code of an IF is laid out in statement
+ * order (test, then body, else body) and only jumps forward, so every path
+ * from a definition to a use stays within the linear range between them.
+ * DO loops are lowered to WhileLoop by the do_loops pass before code
+ * generation, but are handled the same way in case they reach here.
+ */
+class LiveIntervalVisitor : public ASR::BaseWalkVisitor<LiveIntervalVisitor>
+{
+public:
+    uint32_t pos = 0;
+    std::vector<LiveInterval> intervals;
+    std::map<ASR::Variable_t*, size_t> index;
+
+    void add_argument(ASR::Variable_t *v) {
+        if (v->m_type->type != ASR::ttypeType::Integer
+                || v->m_intent != ASR::intentType::In) {
+            return;
+        }
+        index[v] = intervals.size();
+        intervals.push_back({v, 0, 0, false, X86Reg::eax});
+    }
+
+    void visit_stmt(const ASR::stmt_t &x) {
+        pos++;
+        ASR::BaseWalkVisitor<LiveIntervalVisitor>::visit_stmt(x);
+    }
+
+    // Values flow from one iteration to the next, so everything used in a
+    // loop stays live until its end
+    void extend_over_loop(uint32_t loop_start) {
+        for (auto &iv : intervals) {
+            if (iv.end >= loop_start) {
+                iv.start = std::min(iv.start, loop_start);
+                iv.end = pos;
+            }
+        }
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t &x) {
+        uint32_t loop_start = pos;
+        ASR::BaseWalkVisitor<LiveIntervalVisitor>::visit_WhileLoop(x);
+        extend_over_loop(loop_start);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        uint32_t loop_start = pos;
+        ASR::BaseWalkVisitor<LiveIntervalVisitor>::visit_DoLoop(x);
+        extend_over_loop(loop_start);
+    }
+
+    void visit_Var(const ASR::Var_t &x) {
+        if (!is_a<ASR::Variable_t>(*x.m_v)) return;
+        ASR::Variable_t *v = down_cast<ASR::Variable_t>(x.m_v);
+        auto it = index.find(v);
+        if (it != index.end()) {
+            intervals[it->second].end = pos;
+            return;
+        }
+        if (v->m_type->type != ASR::ttypeType::Integer
+                || (v->m_intent != ASRUtils::intent_local
+                    && v->m_intent != ASRUtils::intent_return_var)) {
+            return;
+        }
+        index[v] = intervals.size();
+        intervals.push_back({v, pos, pos, false, X86Reg::eax});
+    }
+};
+
+/*
+ * Linear scan register allocation (Poletto & Sarkar) of the integer locals
+ * and intent(in) arguments of one procedure into the callee-saved registers
+ * ebx, esi and edi. eax, ecx and edx remain scratch registers for expression
+ * evaluation and calls. When all registers are taken, the interval that ends
+ * last is spilled and keeps its stack slot.
+ */
+std::vector<LiveInterval> allocate_registers(const ASR::stmt_t * const *body,
+        size_t n_body, ASR::expr_t * const *args, size_t n_args) {
+    LiveIntervalVisitor v;
+    for (size_t i = 0; i < n_args; i++) {
+        v.add_argument(ASRUtils::EXPR2VAR(args[i]));
+    }
+    for (size_t i = 0; i < n_body; i++) {
+        v.visit_stmt(*body[i]);
+    }
+    std::vector<LiveInterval> intervals = v.intervals;
+    std::stable_sort(intervals.begin(), intervals.end(),
+        [](const LiveInterval &a, const LiveInterval &b) {
+            return a.start < b.start;
+        });
+
+    std::vector<X86Reg> free_regs = {X86Reg::edi, X86Reg::esi, X86Reg::ebx};
+    std::vector<size_t> active; // indices into intervals, by increasing end
+    auto add_active = [&](size_t i) {
+        auto pos = std::upper_bound(active.begin(), active.end(), i,
+            [&](size_t a, size_t b) {
+                return intervals[a].end < intervals[b].end;
+            });
+        active.insert(pos, i);
+    };
+    for (size_t i = 0; i < intervals.size(); i++) {
+        LiveInterval &iv = intervals[i];
+        while (!active.empty() && intervals[active.front()].end < iv.start) {
+            free_regs.push_back(intervals[active.front()].reg);
+            active.erase(active.begin());
+        }
+        if (!free_regs.empty()) {
+            iv.in_reg = true;
+            iv.reg = free_regs.back();
+            free_regs.pop_back();
+            add_active(i);
+        } else {
+            LiveInterval &last = intervals[active.back()];
+            if (last.end > iv.end) {
+                iv.in_reg = true;
+                iv.reg = last.reg;
+                last.in_reg = false;
+                active.pop_back();
+                add_active(i);
+            }
+        }
+    }
+    return intervals;
+}
+
 class ASRToX86Visitor : public ASR::BaseVisitor<ASRToX86Visitor>
 {
     struct Sym {
         uint32_t stack_offset; // The local variable is [ebp-stack_offset]
         std::string fn_label; // Subroutine / Function assembly label
         bool pointer; // Is variable represented as a pointer (or value)
+        bool in_reg = false; // Is the variable kept in `reg` instead
+        X86Reg reg = X86Reg::eax;
     };
 public:
     Allocator &m_al;
@@ -54,6 +198,81 @@ public:
 
     ASRToX86Visitor(Allocator &al) : m_al{al}, m_a{al, false} {}
 
+    // Keeps the variables chosen by the register allocator in registers and
+    // returns the callee-saved registers that the body uses
+    std::vector<X86Reg> assign_registers(const ASR::stmt_t * const *body,
+            size_t n_body, ASR::expr_t * const *args=nullptr, size_t n_args=0) {
+        std::vector<X86Reg> used;
+        for (auto &iv : allocate_registers(body, n_body, args, n_args)) {
+            if (!iv.in_reg) continue;
+            uint32_t h = get_hash((ASR::asr_t*)iv.v);
+            LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
+            Sym &s = x86_symtab[h];
+            s.in_reg = true;
+            s.reg = iv.reg;
+            if (std::find(used.begin(), used.end(), iv.reg) == used.end()) {
+                used.push_back(iv.reg);
+            }
+        }
+        return used;
+    }
+
+    // Loads the value of a variable into r32
+    void load_var(X86Reg r32, const Sym &s) {
+        if (s.in_reg) {
+            m_a.asm_mov_r32_r32(r32, s.reg);
+            return;
+        }
+        X86Reg base = X86Reg::ebp;
+        // mov r32, [ebp-s.stack_offset]
+        m_a.asm_mov_r32_m32(r32, &base, nullptr, 1, -s.stack_offset);
+        if (s.pointer) {
+            base = r32;
+            // Dereference a pointer
+            // mov r32, [r32]
+            m_a.asm_mov_r32_m32(r32, &base, nullptr, 1, 0);
+        }
+    }
+
+    // Operands that can be loaded into any register without evaluating
+    // anything else first
+    bool is_leaf(const ASR::expr_t *e) {
+        return is_a<ASR::IntegerConstant_t>(*e)
+            || is_a<ASR::LogicalConstant_t>(*e)
+            || (is_a<ASR::Var_t>(*e)
+                && is_a<ASR::Variable_t>(*down_cast<ASR::Var_t>(e)->m_v));
+    }
+
+    void load_leaf(X86Reg r32, const ASR::expr_t *e) {
+        if (is_a<ASR::IntegerConstant_t>(*e)) {
+            m_a.asm_mov_r32_imm32(r32,
+                down_cast<ASR::IntegerConstant_t>(e)->m_n);
+        } else if (is_a<ASR::LogicalConstant_t>(*e)) {
+            m_a.asm_mov_r32_imm32(r32,
+                down_cast<ASR::LogicalConstant_t>(e)->m_value ? 1 : 0);
+        } else {
+            ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(
+                down_cast<ASR::Var_t>(e)->m_v);
+            uint32_t h = get_hash((ASR::asr_t*)v);
+            LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
+            load_var(r32, x86_symtab[h]);
+        }
+    }
+
+    // Evaluates a binary operation with the left operand in eax and the
+    // right operand in ecx
+    void visit_operands(const ASR::expr_t *left, const ASR::expr_t *right) {
+        if (is_leaf(right)) {
+            this->visit_expr(*left);
+            load_leaf(X86Reg::ecx, right);
+        } else {
+            this->visit_expr(*right);
+            m_a.asm_push_r32(X86Reg::eax);
+            this->visit_expr(*left);
+            m_a.asm_pop_r32(X86Reg::ecx);
+        }
+    }
+
     void visit_TranslationUnit(const ASR::TranslationUnit_t &x) {
         // All loose statements must be converted to a function, so the items
         // must be empty:
@@ -145,6 +364,8 @@ public:
             }
         }
         m_a.asm_sub_r32_imm8(X86Reg::esp, total_offset);
+        // The program never returns, so it need not save the registers
+        assign_registers(x.m_body, x.n_body);
 
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
@@ -215,6 +436,21 @@ public:
             }
         }
         m_a.asm_sub_r32_imm8(X86Reg::esp, total_offset);
+        std::vector<X86Reg> saved_regs = assign_registers(x.m_body, x.n_body,
+            x.m_args, x.n_args);
+        for (auto &r : saved_regs) {
+            m_a.asm_push_r32(r);
+        }
+        // Load the arguments kept in registers from the caller's frame
+        for (size_t i=0; i<x.n_args; i++) {
+            uint32_t h = get_hash((ASR::asr_t*)ASRUtils::EXPR2VAR(x.m_args[i]));
+            Sym s = x86_symtab[h];
+            if (s.in_reg) {
+                X86Reg base = X86Reg::ebp;
+                // mov reg, [ebp+8+4*i]
+                m_a.asm_mov_r32_m32(s.reg, &base, nullptr, 1, -s.stack_offset);
+            }
+        }
 
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
@@ -227,10 +463,12 @@ public:
             uint32_t h = get_hash((ASR::asr_t*)retv);
             LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
             Sym s = x86_symtab[h];
-            X86Reg base = X86Reg::ebp;
-            // mov eax, [ebp-s.stack_offset]
-            m_a.asm_mov_r32_m32(X86Reg::eax, &base, nullptr, 1, -s.stack_offset);
             LCOMPILERS_ASSERT(!s.pointer);
+            load_var(X86Reg::eax, s);
+        }
+
+        for (auto r = saved_regs.rbegin(); r != saved_regs.rend(); ++r) {
+            m_a.asm_pop_r32(*r);
         }
 
         // Restore stack
@@ -244,40 +482,19 @@ public:
     // Expressions leave integer values in eax
 
     void visit_IntegerConstant(const ASR::IntegerConstant_t &x) {
-        m_a.asm_mov_r32_imm32(X86Reg::eax, x.m_n);
+        load_leaf(X86Reg::eax, (ASR::expr_t*)&x);
     }
 
     void visit_LogicalConstant(const ASR::LogicalConstant_t &x) {
-        int val;
-        if (x.m_value == true) {
-            val = 1;
-        } else {
-            val = 0;
-        }
-        m_a.asm_mov_r32_imm32(X86Reg::eax, val);
+        load_leaf(X86Reg::eax, (ASR::expr_t*)&x);
     }
 
     void visit_Var(const ASR::Var_t &x) {
-        ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(x.m_v);
-        uint32_t h = get_hash((ASR::asr_t*)v);
-        LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
-        Sym s = x86_symtab[h];
-        X86Reg base = X86Reg::ebp;
-        // mov eax, [ebp-s.stack_offset]
-        m_a.asm_mov_r32_m32(X86Reg::eax, &base, nullptr, 1, -s.stack_offset);
-        if (s.pointer) {
-            base = X86Reg::eax;
-            // Dereference a pointer
-            // mov eax, [eax]
-            m_a.asm_mov_r32_m32(X86Reg::eax, &base, nullptr, 1, 0);
-        }
+        load_leaf(X86Reg::eax, (ASR::expr_t*)&x);
     }
 
     void visit_IntegerBinOp(const ASR::IntegerBinOp_t &x) {
-        this->visit_expr(*x.m_right);
-        m_a.asm_push_r32(X86Reg::eax);
-        this->visit_expr(*x.m_left);
-        m_a.asm_pop_r32(X86Reg::ecx);
+        visit_operands(x.m_left, x.m_right);
         // The left operand is in eax, the right operand is in ecx
         // Leave the result in eax.
         switch (x.m_op) {
@@ -312,10 +529,7 @@ public:
 
     void visit_IntegerCompare(const ASR::IntegerCompare_t &x) {
         std::string id = std::to_string(get_hash((ASR::asr_t*)&x));
-        this->visit_expr(*x.m_right);
-        m_a.asm_push_r32(X86Reg::eax);
-        this->visit_expr(*x.m_left);
-        m_a.asm_pop_r32(X86Reg::ecx);
+        visit_operands(x.m_left, x.m_right);
         // The left operand is in eax, the right operand is in ecx
         // Leave the result in eax.
         m_a.asm_cmp_r32_r32(X86Reg::eax, X86Reg::ecx);
@@ -364,7 +578,9 @@ public:
         LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
         Sym s = x86_symtab[h];
         X86Reg base = X86Reg::ebp;
-        if (s.pointer) {
+        if (s.in_reg) {
+            m_a.asm_mov_r32_r32(s.reg, X86Reg::eax);
+        } else if (s.pointer) {
             // mov ecx, [ebp-s.stack_offset]
             m_a.asm_mov_r32_m32(X86Reg::ecx, &base, nullptr, 1, -s.stack_offset);
             // mov [ecx], eax
@@ -376,6 +592,14 @@ public:
         }
     }
 
+    // The write system call takes the file descriptor in ebx, which may
+    // hold a variable
+    void print_string(const std::string &id, uint32_t size) {
+        m_a.asm_push_r32(X86Reg::ebx);
+        emit_print(m_a, id, size);
+        m_a.asm_pop_r32(X86Reg::ebx);
+    }
+
     void visit_Print(const ASR::Print_t &x) {
         LCOMPILERS_ASSERT(x.m_text != nullptr);
         ASR::expr_t *e = x.m_text;
@@ -389,7 +613,7 @@ public:
             std::string msg = s->m_s;
             msg += "\n";
             std::string id = "string" + std::to_string(get_hash((ASR::asr_t*)e));
-            emit_print(m_a, id, msg.size());
+            print_string(id, msg.size());
             m_global_strings[id] = msg;
         } else {
             this->visit_expr(*e);
@@ -409,7 +633,7 @@ public:
 
             std::string msg = "\n";
             std::string id = "string" + std::to_string(get_hash((ASR::asr_t*)e));
-            emit_print(m_a, id, msg.size());
+            print_string(id, msg.size());
             m_global_strings[id] = msg;
         }
     }
@@ -464,9 +688,11 @@ public:
         m_a.add_label(".loop.end" + id);
     }
 
-    // Push arguments to stack (last argument first)
+    // Push arguments to stack (last argument first). Variables kept in
+    // registers that are passed by reference are stored to their stack slot
+    // first and added to `reload`, to be loaded again after the call.
     template <typename T, typename T2>
-    uint8_t push_call_args(const T &x, const T2 &sub) {
+    uint8_t push_call_args(const T &x, const T2 &sub, std::vector<Sym> &reload) {
         LCOMPILERS_ASSERT(sub.n_args == x.n_args);
         // Note: when counting down in a loop, we have to use signed ints
         // for `i`, so that it can become negative and fail the i>=0 condition.
@@ -487,7 +713,18 @@ public:
                 LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
                 Sym s = x86_symtab[h];
                 X86Reg base = X86Reg::ebp;
-                if (s.pointer) {
+                if (s.in_reg) {
+                    if (pass_as_pointer) {
+                        // mov [ebp-s.stack_offset], reg
+                        m_a.asm_mov_m32_r32(&base, nullptr, 1, -s.stack_offset, s.reg);
+                        // lea eax, [ebp-s.stack_offset]
+                        m_a.asm_lea_r32_m32(X86Reg::eax, &base, nullptr, 1, -s.stack_offset);
+                        m_a.asm_push_r32(X86Reg::eax);
+                        reload.push_back(s);
+                    } else {
+                        m_a.asm_push_r32(s.reg);
+                    }
+                } else if (s.pointer) {
                     if (pass_as_pointer) {
                         // Copy over the stack variable (already a pointer)
                         // mov eax, [ebp-s.stack_offset]
@@ -501,6 +738,7 @@ public:
 
                         // Dereference a pointer
                         // mov eax, [eax]
+                        base = X86Reg::eax;
                         m_a.asm_mov_r32_m32(X86Reg::eax, &base, nullptr, 1, 0);
                     }
                     m_a.asm_push_r32(X86Reg::eax);
@@ -526,6 +764,15 @@ public:
         return x.n_args*4;
     }
 
+    // The callee may have written through the pointers passed for `reload`
+    void reload_registers(const std::vector<Sym> &reload) {
+        X86Reg base = X86Reg::ebp;
+        for (auto &s : reload) {
+            // mov reg, [ebp-s.stack_offset]
+            m_a.asm_mov_r32_m32(s.reg, &base, nullptr, 1, -s.stack_offset);
+        }
+    }
+
     void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
         ASR::Function_t *s = ASR::down_cast<ASR::Function_t>(
             ASRUtils::symbol_get_past_external(x.m_name));
@@ -537,11 +784,13 @@ public:
         }
         Sym &sym = x86_symtab[h];
         // Push arguments to stack (last argument first)
-        uint8_t arg_offset = push_call_args(x, *s);
+        std::vector<Sym> reload;
+        uint8_t arg_offset = push_call_args(x, *s, reload);
         // Call the subroutine
         m_a.asm_call_label(sym.fn_label);
         // Remove arguments from stack
         m_a.asm_add_r32_imm8(X86Reg::esp, arg_offset);
+        reload_registers(reload);
     }
 
     void visit_FunctionCall(const ASR::FunctionCall_t &x) {
@@ -554,11 +803,13 @@ public:
         }
         Sym &sym = x86_symtab[h];
         // Push arguments to stack (last argument first)
-        uint8_t arg_offset = push_call_args(x, *s);
+        std::vector<Sym> reload;
+        uint8_t arg_offset = push_call_args(x, *s, reload);
         // Call the function (the result is in eax, we leave it there)
         m_a.asm_call_label(sym.fn_label);
         // Remove arguments from stack
         m_a.asm_add_r32_imm8(X86Reg::esp, arg_offset);
+        reload_registers(reload);
     }
 
 };
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <fstream>
+#include <set>
+#include <algorithm>
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/ADT/STLExtras.h>
@@ -56,6 +58,7 @@
 #if LLVM_VERSION_MAJOR >= 17
     // TODO: removed from LLVM 17
     #include <llvm/Passes/PassBuilder.h>
+    #include <llvm/Support/VirtualFileSystem.h>
 #else
 #    include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #endif
@@ -74,8 +77,28 @@
 #include <libasr/string_utils.h>
 
 #ifdef HAVE_LFORTRAN_MLIR
+#include <llvm/ADT/SetVector.h>
 #include <mlir/IR/BuiltinOps.h>
 #include <mlir/Target/LLVMIR/Export.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Transforms/Passes.h>
+#include <mlir/Transforms/DialectConversion.h>
+#include <mlir/Conversion/AffineToStandard/AffineToStandard.h>
+#include <mlir/Conversion/ArithToLLVM/ArithToLLVM.h>
+#include <mlir/Conversion/ControlFlowToLLVM/ControlFlowToLLVM.h>
+#include <mlir/Conversion/LLVMCommon/ConversionTarget.h>
+#include <mlir/Conversion/LLVMCommon/TypeConverter.h>
+#include <mlir/Conversion/MemRefToLLVM/MemRefToLLVM.h>
+#include <mlir/Conversion/SCFToControlFlow/SCFToControlFlow.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/Affine/Analysis/AffineAnalysis.h>
+#include <mlir/Dialect/Affine/Analysis/LoopAnalysis.h>
+#include <mlir/Dialect/Affine/Analysis/Utils.h>
+#include <mlir/Dialect/Affine/LoopFusionUtils.h>
+#include <mlir/Dialect/Affine/LoopUtils.h>
+#include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+#include <mlir/Dialect/OpenMP/OpenMPDialect.h>
+#include <mlir/Interfaces/SideEffectInterfaces.h>
 #endif
 
 namespace LCompilers {
@@ -114,6 +137,16 @@ llvm::GlobalVariable *LLVMModule::get_global(const std::string &global_name) {
     return m->getNamedGlobal(global_name);
 }
 
+bool LLVMModule::only_defines(const std::string &fn_name) {
+    for (llvm::GlobalValue &g : m_m->global_values()) {
+        if (!g.isDeclaration() && !g.hasLocalLinkage()
+                && g.getName() != fn_name) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::string LLVMModule::get_return_type(const std::string &fn_name)
 {
     llvm::Module *m = m_m.get();
@@ -156,6 +189,216 @@ std::string LLVMModule::get_return_type(const std::string &fn_name)
 }
 
 #ifdef HAVE_LFORTRAN_MLIR
+namespace {
+
+// A load of a scalar variable, which cannot alias the memref arrays
+bool is_scalar_load(mlir::Operation *op) {
+    mlir::LLVM::LoadOp load = mlir::dyn_cast<mlir::LLVM::LoadOp>(op);
+    return load && load.getAddr().getDefiningOp<mlir::LLVM::AllocaOp>();
+}
+
+// Whether the loop nest only writes memory through affine stores, so that
+// the affine dependence analysis sees every dependence that a transform
+// has to preserve. Reads of scalar variables are allowed, nothing in the
+// nest writes them.
+bool is_affine_only(mlir::affine::AffineForOp forOp) {
+    bool affine_only = true;
+    forOp->walk([&](mlir::Operation *op) {
+        if (mlir::isa<mlir::affine::AffineReadOpInterface,
+                mlir::affine::AffineWriteOpInterface,
+                mlir::affine::AffineForOp,
+                mlir::affine::AffineYieldOp>(op) || is_scalar_load(op)) {
+            return;
+        }
+        if (op->getNumRegions() > 0 || !mlir::isMemoryEffectFree(op)) {
+            affine_only = false;
+        }
+    });
+    return affine_only;
+}
+
+// Fuses a loop into a later loop of the same block, e.g. the loop that
+// initializes an array into the loop that reads it, so that the array is
+// traversed once. Only scalar stores to variables that the first loop does
+// not read may separate the two loops.
+void fuse_loops(mlir::Block &block) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        mlir::affine::AffineForOp src;
+        std::set<mlir::Operation*> src_reads;
+        for (mlir::Operation &op : block) {
+            mlir::affine::AffineForOp dst =
+                mlir::dyn_cast<mlir::affine::AffineForOp>(op);
+            if (!dst) {
+                mlir::LLVM::StoreOp store = mlir::dyn_cast<mlir::LLVM::StoreOp>(op);
+                if (mlir::isMemoryEffectFree(&op)) continue;
+                if (store && store.getAddr().getDefiningOp<mlir::LLVM::AllocaOp>()
+                        && !src_reads.count(store.getAddr().getDefiningOp())) {
+                    continue;
+                }
+                src = nullptr;
+                continue;
+            }
+            if (!is_affine_only(dst)) {
+                src = nullptr;
+                continue;
+            }
+            if (src) {
+                mlir::affine::ComputationSliceState slice;
+                mlir::affine::FusionResult result =
+                    mlir::affine::canFuseLoops(src, dst, 1, &slice);
+                std::optional<bool> maximal = slice.isMaximal();
+                // Only fuse if the whole source loop moves into the
+                // destination, so that it can be erased
+                if (result.value == mlir::affine::FusionResult::Success &&
+                        maximal && *maximal) {
+                    mlir::affine::fuseLoops(src, dst, slice);
+                    src.erase();
+                    changed = true;
+                    break;
+                }
+            }
+            src = dst;
+            src_reads.clear();
+            src->walk([&](mlir::Operation *read) {
+                if (is_scalar_load(read)) {
+                    src_reads.insert(mlir::cast<mlir::LLVM::LoadOp>(read)
+                        .getAddr().getDefiningOp());
+                }
+            });
+        }
+    }
+}
+
+// The coefficient of dimension `pos` in the linear expression `e`
+int64_t dim_coefficient(mlir::AffineExpr e, unsigned pos) {
+    if (mlir::AffineDimExpr dim = mlir::dyn_cast<mlir::AffineDimExpr>(e)) {
+        return dim.getPosition() == pos ? 1 : 0;
+    }
+    mlir::AffineBinaryOpExpr bin = mlir::dyn_cast<mlir::AffineBinaryOpExpr>(e);
+    if (!bin) return 0;
+    if (e.getKind() == mlir::AffineExprKind::Add) {
+        return dim_coefficient(bin.getLHS(), pos) +
+            dim_coefficient(bin.getRHS(), pos);
+    }
+    if (e.getKind() == mlir::AffineExprKind::Mul) {
+        if (mlir::AffineConstantExpr c =
+                mlir::dyn_cast<mlir::AffineConstantExpr>(bin.getRHS())) {
+            return dim_coefficient(bin.getLHS(), pos) * c.getValue();
+        }
+        if (mlir::AffineConstantExpr c =
+                mlir::dyn_cast<mlir::AffineConstantExpr>(bin.getLHS())) {
+            return dim_coefficient(bin.getRHS(), pos) * c.getValue();
+        }
+    }
+    return 0;
+}
+
+// Makes the loop with the smallest memory stride the innermost loop of a
+// perfect nest, so that e.g. `do i; do j; a(i, j) = ...` walks the column
+// major arrays contiguously. Returns the new outermost loop.
+mlir::affine::AffineForOp interchange_loops(
+        llvm::SmallVector<mlir::affine::AffineForOp> &band) {
+    size_t n = band.size();
+    // cost[l]: sum over all accesses of the distance in elements between
+    // two consecutive iterations of loop l
+    std::vector<int64_t> cost(n, 0);
+    band[n-1]->walk([&](mlir::Operation *op) {
+        if (!mlir::isa<mlir::affine::AffineReadOpInterface,
+                mlir::affine::AffineWriteOpInterface>(op)) {
+            return;
+        }
+        mlir::affine::MemRefAccess access(op);
+        mlir::affine::AffineValueMap map;
+        access.getAccessMap(&map);
+        llvm::ArrayRef<int64_t> shape = mlir::cast<mlir::MemRefType>(
+            access.memref.getType()).getShape();
+        for (size_t l = 0; l < n; l++) {
+            for (unsigned j = 0; j < map.getNumDims(); j++) {
+                if (map.getOperand(j) != band[l].getInductionVar()) continue;
+                int64_t stride = 1;
+                for (size_t r = shape.size(); r-- > 0;) {
+                    cost[l] += std::abs(dim_coefficient(
+                        map.getResult(r), j)) * stride;
+                    stride *= shape[r];
+                }
+            }
+        }
+    });
+    size_t inner = n - 1;
+    for (size_t l = 0; l < n; l++) {
+        if (cost[l] < cost[inner]) inner = l;
+    }
+    if (inner == n - 1) return band[0];
+    // permutation[l] is the new position of loop l
+    llvm::SmallVector<unsigned> permutation;
+    for (size_t l = 0; l < n; l++) {
+        permutation.push_back(l < inner ? l : (l == inner ? n - 1 : l - 1));
+    }
+    if (!mlir::affine::isValidLoopInterchangePermutation(band, permutation)) {
+        return band[0];
+    }
+    return band[mlir::affine::permuteLoops(band, permutation)];
+}
+
+// Tiles a fully permutable perfect nest, so that the inner loops work on
+// blocks that stay in cache
+void tile_loops(llvm::SmallVector<mlir::affine::AffineForOp> &band) {
+    const unsigned tile_size = 32;
+    size_t n = band.size();
+    if (n > 3) return;
+    for (mlir::affine::AffineForOp forOp : band) {
+        std::optional<uint64_t> trip = mlir::affine::getConstantTripCount(forOp);
+        if (!trip || *trip <= tile_size) return;
+    }
+    // Tiling is legal if every order of the loops is
+    llvm::SmallVector<unsigned> permutation;
+    for (size_t l = 0; l < n; l++) permutation.push_back(l);
+    do {
+        if (!mlir::affine::isValidLoopInterchangePermutation(band,
+                permutation)) {
+            return;
+        }
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+    llvm::SmallVector<unsigned> tile_sizes(n, tile_size);
+    (void)mlir::affine::tilePerfectlyNested(band, tile_sizes);
+}
+
+// Affine loop fusion, interchange and tiling. The upstream passes run on
+// func.func, the functions here are llvm.func, so the transforms are
+// applied directly on the loops.
+void optimize_affine_loops(mlir::ModuleOp module) {
+    llvm::SetVector<mlir::Block*> blocks;
+    module.walk([&](mlir::affine::AffineForOp forOp) {
+        if (!forOp->getParentOfType<mlir::affine::AffineForOp>()) {
+            blocks.insert(forOp->getBlock());
+        }
+    });
+    for (mlir::Block *block : blocks) {
+        fuse_loops(*block);
+    }
+
+    llvm::SmallVector<mlir::affine::AffineForOp> roots;
+    module.walk([&](mlir::affine::AffineForOp forOp) {
+        if (!forOp->getParentOfType<mlir::affine::AffineForOp>() &&
+                is_affine_only(forOp)) {
+            roots.push_back(forOp);
+        }
+    });
+    for (mlir::affine::AffineForOp root : roots) {
+        llvm::SmallVector<mlir::affine::AffineForOp> band;
+        mlir::affine::getPerfectlyNestedLoops(band, root);
+        if (band.size() < 2) continue;
+        root = interchange_loops(band);
+        band.clear();
+        mlir::affine::getPerfectlyNestedLoops(band, root);
+        tile_loops(band);
+    }
+}
+
+} // namespace
+
 MLIRModule::MLIRModule(std::unique_ptr<mlir::ModuleOp> m,
         std::unique_ptr<mlir::MLIRContext> ctx) {
     mlir_m = std::move(m);
@@ -183,8 +426,46 @@ std::string MLIRModule::llvm_str() {
 }
 
 void MLIRModule::mlir_to_llvm(llvm::LLVMContext &ctx) {
+    // Lower a copy, so that mlir_str() still shows the structured loops
+    mlir::OwningOpRef<mlir::ModuleOp> lowered = mlir_m->clone();
+
+    // Optimize the affine and scf loops while they are still structured.
+    // Canonicalization first removes the dead loop bound computations, so
+    // that the nests are perfect.
+    mlir::PassManager pm(mlir_ctx.get());
+    pm.addPass(mlir::createCanonicalizerPass());
+    if (mlir::failed(pm.run(*lowered))) {
+        throw LCompilersException("Failed to optimize the MLIR loops");
+    }
+    optimize_affine_loops(*lowered);
+    mlir::PassManager pm2(mlir_ctx.get());
+    pm2.addPass(mlir::createLoopInvariantCodeMotionPass());
+    pm2.addPass(mlir::createCanonicalizerPass());
+    if (mlir::failed(pm2.run(*lowered))) {
+        throw LCompilersException("Failed to optimize the MLIR loops");
+    }
+
+    // affine -> scf -> cf, and then memref and everything that is left
+    // to LLVM
+    mlir::LLVMConversionTarget target(*mlir_ctx);
+    target.addLegalOp<mlir::ModuleOp>();
+    target.addLegalDialect<mlir::omp::OpenMPDialect>();
+    mlir::LLVMTypeConverter typeConverter(mlir_ctx.get());
+    mlir::RewritePatternSet patterns(mlir_ctx.get());
+    mlir::populateAffineToStdConversionPatterns(patterns);
+    mlir::populateSCFToControlFlowConversionPatterns(patterns);
+    mlir::arith::populateArithToLLVMConversionPatterns(typeConverter, patterns);
+    mlir::populateFinalizeMemRefToLLVMConversionPatterns(typeConverter,
+        patterns);
+    mlir::cf::populateControlFlowToLLVMConversionPatterns(typeConverter,
+        patterns);
+    if (mlir::failed(mlir::applyFullConversion(lowered->getOperation(), target,
+            std::move(patterns)))) {
+        throw LCompilersException("Failed to lower MLIR to the LLVM dialect");
+    }
+
     std::unique_ptr<llvm::Module> llvmModule = mlir::translateModuleToLLVMIR(
-        *mlir_m, ctx);
+        *lowered, ctx);
     if (llvmModule) {
         llvm_m = std::move(llvmModule);
     } else {
@@ -343,6 +624,60 @@ void LLVMEvaluator::add_module(std::unique_ptr<LLVMModule> m) {
     add_module(std::move(m->m_m));
 }
 
+void LLVMEvaluator::add_module(std::unique_ptr<LLVMModule> m, uint64_t key) {
+#if LLVM_VERSION_MAJOR >= 12
+    std::unique_ptr<llvm::Module> mod = std::move(m->m_m);
+#if LLVM_VERSION_MAJOR >= 21
+    mod->setTargetTriple(llvm::Triple(target_triple));
+#else
+    mod->setTargetTriple(target_triple);
+#endif
+    mod->setDataLayout(jit->getDataLayout());
+    llvm::Error err = jit->addModule(std::move(mod), context, key);
+    if (err) {
+        llvm::SmallVector<char, 128> buf;
+        llvm::raw_svector_ostream dest(buf);
+        llvm::logAllUnhandledErrors(std::move(err), dest, "");
+        std::string msg = std::string(dest.str().data(), dest.str().size());
+        if (msg[msg.size()-1] == '\n') msg = msg.substr(0, msg.size()-1);
+        throw LCompilersException("addModule() returned an error: " + msg);
+    }
+#else
+    (void)key;
+    add_module(std::move(m->m_m));
+#endif
+}
+
+void LLVMEvaluator::remove_module([[maybe_unused]] uint64_t key) {
+#if LLVM_VERSION_MAJOR >= 12
+    llvm::Error err = jit->removeModule(key);
+    if (err) {
+        llvm::SmallVector<char, 128> buf;
+        llvm::raw_svector_ostream dest(buf);
+        llvm::logAllUnhandledErrors(std::move(err), dest, "");
+        std::string msg = std::string(dest.str().data(), dest.str().size());
+        if (msg[msg.size()-1] == '\n') msg = msg.substr(0, msg.size()-1);
+        throw LCompilersException("removeModule() returned an error: " + msg);
+    }
+#endif
+}
+
+bool LLVMEvaluator::can_remove_modules() {
+#if LLVM_VERSION_MAJOR >= 12
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t LLVMEvaluator::n_modules() {
+#if LLVM_VERSION_MAJOR >= 8
+    return jit->getNumModules();
+#else
+    return 0;
+#endif
+}
+
 intptr_t LLVMEvaluator::get_symbol_address(const std::string &name) {
 #if LLVM_VERSION_MAJOR < 8
     // LLVM 7: Use findSymbol which returns JITSymbol
@@ -462,7 +797,9 @@ void LLVMEvaluator::create_empty_object_file(const std::string &filename) {
     save_object_file(*module, filename);
 }
 
-void LLVMEvaluator::opt(llvm::Module &m) {
+void LLVMEvaluator::opt(llvm::Module &m, bool profile_generate,
+        const std::string &profile_generate_path,
+        const std::string &profile_use_path) {
 #if LLVM_VERSION_MAJOR >= 21
     m.setTargetTriple(llvm::Triple(target_triple));
 #else
@@ -475,7 +812,16 @@ void LLVMEvaluator::opt(llvm::Module &m) {
     llvm::FunctionAnalysisManager FAM;
     llvm::CGSCCAnalysisManager CGAM;
     llvm::ModuleAnalysisManager MAM;
-    llvm::PassBuilder PB = llvm::PassBuilder(TM);
+    RM_OPTIONAL_TYPE<llvm::PGOOptions> PGOOpt;
+    if (profile_generate) {
+        PGOOpt = llvm::PGOOptions(profile_generate_path, "", "", "",
+            llvm::vfs::getRealFileSystem(), llvm::PGOOptions::IRInstr);
+    } else if (!profile_use_path.empty()) {
+        PGOOpt = llvm::PGOOptions(profile_use_path, "", "", "",
+            llvm::vfs::getRealFileSystem(), llvm::PGOOptions::IRUse);
+    }
+    llvm::PassBuilder PB = llvm::PassBuilder(TM, llvm::PipelineTuningOptions(),
+        PGOOpt);
     PB.registerModuleAnalyses(MAM);
     PB.registerCGSCCAnalyses(CGAM);
     PB.registerFunctionAnalyses(FAM);
@@ -500,6 +846,12 @@ void LLVMEvaluator::opt(llvm::Module &m) {
     builder.DisableUnrollLoops = false;
     builder.LoopVectorize = true;
     builder.SLPVectorize = true;
+    if (profile_generate) {
+        builder.EnablePGOInstrGen = true;
+        builder.PGOInstrGen = profile_generate_path;
+    } else if (!profile_use_path.empty()) {
+        builder.PGOInstrUse = profile_use_path;
+    }
     builder.populateFunctionPassManager(fpm);
     builder.populateModulePassManager(mpm);
     fpm.doInitialization();
@@ -44,6 +44,8 @@ public:
     std::string get_return_type(const std::string &fn_name);
     llvm::Function *get_function(const std::string &fn_name);
     llvm::GlobalVariable *get_global(const std::string &global_name);
+    // True if `fn_name` is the only definition other modules could refer to
+    bool only_defines(const std::string &fn_name);
 };
 
 class MLIRModule {
@@ -75,12 +77,34 @@ public:
     void add_module(const std::string &source);
     void add_module(std::unique_ptr<llvm::Module> mod);
     void add_module(std::unique_ptr<LLVMModule> m);
+    /*
+        Adds `m` so that remove_module(key) can later drop it from the JIT,
+        releasing its machine code and symbols. Nothing may refer to its
+        symbols by then. Before LLVM 12 the module just stays in the JIT.
+    */
+    void add_module(std::unique_ptr<LLVMModule> m, uint64_t key);
+    void remove_module(uint64_t key);
+    // Whether remove_module() actually drops the module (LLVM >= 12)
+    static bool can_remove_modules();
+    // Number of modules currently held by the JIT
+    size_t n_modules();
     intptr_t get_symbol_address(const std::string &name);
     std::string get_asm(llvm::Module &m);
     void save_asm_file(llvm::Module &m, const std::string &filename);
     void save_object_file(llvm::Module &m, const std::string &filename);
     void create_empty_object_file(const std::string &filename);
-    void opt(llvm::Module &m);
+    /*
+        Runs the LLVM O3 pipeline over `m`. With `profile_generate` the
+        functions and loops are instrumented and the resulting binary writes
+        `.profraw` data at exit to `profile_generate_path` (a file name that
+        may contain the `%m` and `%p` patterns of the profile runtime).
+        A non-empty `profile_use_path` points to an indexed `.profdata` file
+        whose branch weights and entry counts are attached to the IR before
+        the rest of the pipeline runs.
+    */
+    void opt(llvm::Module &m, bool profile_generate=false,
+        const std::string &profile_generate_path="",
+        const std::string &profile_use_path="");
     static std::string module_to_string(llvm::Module &m);
     static void print_version_message();
     static std::string llvm_version();
@@ -10,21 +10,19 @@ namespace LCompilers {
     namespace LLVMArrUtils {
 
         static llvm::Value* get_allocator(llvm::LLVMContext &context,
-                llvm::Module &module, llvm::IRBuilder<> &builder) {
+                llvm::Module &module, llvm::IRBuilder<> &builder,
+                const char* allocator_getter) {
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
-            std::string func_name = LLVM::use_memory_debug()
-                ? "_lfortran_get_compiler_mem_dbg_allocator"
-                : "_lfortran_get_default_allocator";
-            llvm::Function *fn = module.getFunction(func_name);
+            llvm::Function *fn = module.getFunction(allocator_getter);
             if (!fn) {
                 llvm::FunctionType *ft = llvm::FunctionType::get(i8_ptr_type, {}, false);
-                fn = llvm::Function::Create(ft, llvm::Function::ExternalLinkage, func_name, &module);
+                fn = llvm::Function::Create(ft, llvm::Function::ExternalLinkage, allocator_getter, &module);
             }
             return builder.CreateCall(fn, {});
         }
 
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_malloc_alloc";
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
             llvm::Function *fn = module.getFunction(func_name);
@@ -38,12 +36,12 @@ namespace LCompilers {
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
             arg_size = builder.CreateSExt(arg_size, llvm::Type::getInt64Ty(context));
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             return builder.CreateCall(fn, {allocator, arg_size});
         }
 
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* ptr, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_realloc_alloc";
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
             llvm::Function *fn = module.getFunction(func_name);
@@ -57,7 +55,7 @@ namespace LCompilers {
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             return builder.CreateCall(fn, {
                 allocator,
                 builder.CreateBitCast(ptr, i8_ptr_type),
@@ -299,7 +297,7 @@ namespace LCompilers {
             llvm::Type* array_desc_type) {
             llvm::DataLayout data_layout(llvm_utils->module->getDataLayout());
             int64_t desc_size = data_layout.getTypeAllocSize(array_desc_type);
-            llvm::Value* desc_mem = lfortran_malloc(context, *llvm_utils->module, *builder,
+            llvm::Value* desc_mem = lfortran_malloc(context, *llvm_utils->module, *builder, llvm_utils->get_allocator_function_name(),
                 llvm::ConstantInt::get(llvm_utils->getIntType(4), llvm::APInt(32, desc_size)));
             llvm::Value* desc_ptr = builder->CreateBitCast(desc_mem, array_desc_type->getPointerTo());
 
@@ -416,7 +414,8 @@ namespace LCompilers {
                     llvm_utils->CreateLoad2(index_type, llvm_size),
                     llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, size))), llvm_size);
                 llvm::Value* arr_first_i8 = lfortran_malloc(
-                    context, *module, *builder, llvm_utils->CreateLoad2(index_type, llvm_size));
+                    context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                        llvm_utils->CreateLoad2(index_type, llvm_size));
                 arr_first = builder->CreateBitCast(
                     arr_first_i8, llvm_data_type->getPointerTo());
             } else {
@@ -553,11 +552,12 @@ namespace LCompilers {
                 llvm::Value* ptr_as_char_ptr = nullptr;
                 if( realloc ) {
                     ptr_as_char_ptr = lfortran_realloc(context, *module,
-                        *builder, llvm_utils->CreateLoad2(llvm_data_type->getPointerTo(), ptr2firstptr),
+                        *builder, llvm_utils->get_allocator_function_name(),
+                            llvm_utils->CreateLoad2(llvm_data_type->getPointerTo(), ptr2firstptr),
                         arg_size);
                 } else {
                     ptr_as_char_ptr = lfortran_malloc(context, *module,
-                        *builder, arg_size);
+                        *builder, llvm_utils->get_allocator_function_name(), arg_size);
                 }
                 llvm::Value* first_ptr = builder->CreateBitCast(ptr_as_char_ptr, ptr_type);
                 builder->CreateStore(first_ptr, ptr2firstptr);
@@ -1558,7 +1558,8 @@ namespace LCompilers {
             uint64_t elem_size = data_layout.getTypeAllocSize(elem_type);
             llvm::Value* llvm_elem_size = llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, elem_size));
             llvm::Value* total_size = builder->CreateMul(num_elements, llvm_elem_size);
-            llvm::Value* data_buffer_i8 = lfortran_malloc(context, *module, *builder, total_size);
+            llvm::Value* data_buffer_i8 = lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                total_size);
             llvm::Value* data_buffer = builder->CreateBitCast(
                 data_buffer_i8, elem_type->getPointerTo());
             llvm::Value* src_data = llvm_utils->CreateLoad2(elem_type->getPointerTo(), this->get_pointer_to_data(source_llvm_type, source_desc));
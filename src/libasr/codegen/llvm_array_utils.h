@@ -23,9 +23,9 @@ namespace LCompilers {
     namespace LLVMArrUtils {
 
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* arg_size);
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size);
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size);
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* ptr, llvm::Value* arg_size);
 
         /*
         * This function checks whether the
@@ -9,41 +9,27 @@ namespace LCompilers {
 
     namespace LLVM {
 
-        static bool memory_debug_enabled = false;
-
         llvm::Value* CreateStore(llvm::IRBuilder<> &builder, llvm::Value *x, llvm::Value *y) {
             LCOMPILERS_ASSERT(y->getType()->isPointerTy());
             return builder.CreateStore(x, y);
         }
 
-        const char* get_allocator_function_name() {
-            return use_memory_debug()
-                ? "_lfortran_get_compiler_mem_dbg_allocator"
-                : "_lfortran_get_default_allocator";
-        }
-
+        // Calls `allocator_getter`, one of the `_lfortran_get_*_allocator`
+        // runtime functions (see LLVMUtils::get_allocator_function_name())
         static llvm::Value* get_allocator(llvm::LLVMContext &context,
-                llvm::Module &module, llvm::IRBuilder<> &builder) {
+                llvm::Module &module, llvm::IRBuilder<> &builder,
+                const char* allocator_getter) {
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
-            std::string func_name = get_allocator_function_name();
-            llvm::Function *fn = module.getFunction(func_name);
+            llvm::Function *fn = module.getFunction(allocator_getter);
             if (!fn) {
                 llvm::FunctionType *ft = llvm::FunctionType::get(i8_ptr_type, {}, false);
-                fn = llvm::Function::Create(ft, llvm::Function::ExternalLinkage, func_name, &module);
+                fn = llvm::Function::Create(ft, llvm::Function::ExternalLinkage, allocator_getter, &module);
             }
             return builder.CreateCall(fn, {});
         }
 
-        void set_memory_debug(bool state) {
-            memory_debug_enabled = state;
-        }
-
-        bool use_memory_debug() {
-            return memory_debug_enabled;
-        }
-
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_malloc_alloc";
             arg_size = builder.CreateSExt(arg_size, llvm::Type::getInt64Ty(context));
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
@@ -57,7 +43,7 @@ namespace LCompilers {
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             return builder.CreateCall(fn, {allocator, arg_size});
         }
 
@@ -86,7 +72,7 @@ namespace LCompilers {
         * CompileTime length should be handled at compile-time + call `malloc` directly
         */
         llvm::Value* lfortran_string_malloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_string_malloc_alloc";
             arg_size = builder.CreateSExt(arg_size, llvm::Type::getInt64Ty(context));
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
@@ -100,12 +86,12 @@ namespace LCompilers {
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             return builder.CreateCall(fn, {allocator, arg_size});
         }
 
         llvm::Value* lfortran_calloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* count, llvm::Value* type_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* count, llvm::Value* type_size) {
             std::string func_name = "_lfortran_calloc_alloc";
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
             llvm::Function *fn = module.getFunction(func_name);
@@ -119,14 +105,14 @@ namespace LCompilers {
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             count     = builder.CreateSExt(count, llvm::Type::getInt64Ty(context));
             type_size = builder.CreateSExt(type_size, llvm::Type::getInt64Ty(context));
             return builder.CreateCall(fn, {allocator, count, type_size});
         }
 
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size) {
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* ptr, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_realloc_alloc";
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
             llvm::Function *fn = module.getFunction(func_name);
@@ -140,7 +126,7 @@ namespace LCompilers {
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, &module);
             }
-            llvm::Value* allocator = get_allocator(context, module, builder);
+            llvm::Value* allocator = get_allocator(context, module, builder, allocator_getter);
             return builder.CreateCall(fn, {
                 allocator,
                 builder.CreateBitCast(ptr, llvm::Type::getInt8Ty(context)->getPointerTo()),
@@ -303,22 +289,40 @@ namespace LCompilers {
         return nullptr;
     }
 
+    const char* LLVMUtils::get_allocator_function_name() {
+        if (compiler_options.pool_allocator && scratch_allocation) {
+            return compiler_options.detect_leaks
+                ? "_lfortran_get_compiler_mem_dbg_scratch_allocator"
+                : "_lfortran_get_scratch_allocator";
+        }
+        if (compiler_options.pool_allocator) {
+            return compiler_options.detect_leaks
+                ? "_lfortran_get_compiler_mem_dbg_pool_allocator"
+                : "_lfortran_get_pool_allocator";
+        }
+        return compiler_options.detect_leaks
+            ? "_lfortran_get_compiler_mem_dbg_allocator"
+            : "_lfortran_get_default_allocator";
+    }
+
     llvm::Value* LLVMUtils::get_allocator(llvm::Module* mod) {
         // Check if the cached instance is valid for the current function.
         // Each LLVM function needs its own call to the allocator getter
         // because SSA values can't cross function boundaries.
         llvm::Function* current_fn = builder->GetInsertBlock()->getParent();
-        if (allocator_instance) {
-            if (auto* inst = llvm::dyn_cast<llvm::Instruction>(allocator_instance)) {
+        llvm::Value*& cached = compiler_options.pool_allocator && scratch_allocation
+            ? scratch_allocator_instance : allocator_instance;
+        if (cached) {
+            if (auto* inst = llvm::dyn_cast<llvm::Instruction>(cached)) {
                 if (inst->getFunction() == current_fn) {
-                    return allocator_instance;
+                    return cached;
                 }
             }
         }
 
         llvm::Type* allocator_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
 
-        std::string func_name = LLVM::get_allocator_function_name();
+        std::string func_name = get_allocator_function_name();
         llvm::Function *fn = mod->getFunction(func_name);
         if (!fn) {
             llvm::FunctionType *function_type = llvm::FunctionType::get(
@@ -329,8 +333,8 @@ namespace LCompilers {
         // Insert at the entry block so the value dominates all basic blocks
         llvm::BasicBlock& entry_bb = current_fn->getEntryBlock();
         llvm::IRBuilder<> entry_builder(&entry_bb, entry_bb.getFirstInsertionPt());
-        allocator_instance = entry_builder.CreateCall(fn, {});
-        return allocator_instance;
+        cached = entry_builder.CreateCall(fn, {});
+        return cached;
     }
 
     llvm::Value* LLVMUtils::string_format_fortran(const std::vector<llvm::Value*> &args, llvm::Value* decimal_mode, llvm::Value* sign_mode)
@@ -1835,7 +1839,8 @@ namespace LCompilers {
     }
 
     llvm::Value* LLVMUtils::allocate_zeroed_bytes(llvm::Value* size) {
-        llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(context, *module, *builder, size);
+        llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(context, *module, *builder, get_allocator_function_name(),
+            size);
         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(
             context, llvm::APInt(8, 0)), size, llvm::MaybeAlign());
         return malloc_ptr;
@@ -2182,13 +2187,15 @@ namespace LCompilers {
             if(compileTime_len < 0) {throw LCompilersException("String length cannot be negative.");}
             len = llvm::ConstantInt::get(context,
                     llvm::APInt(64, std::max(compileTime_len, (int64_t) 1)));
-            mem_allocated = LLVM::lfortran_malloc(context, *module, *builder, len);
+            mem_allocated = LLVM::lfortran_malloc(context, *module, *builder, get_allocator_function_name(),
+                len);
         } else {
             /*
                 --> Handle RunTime Length <--
                 * Call `_lfortran_string_malloc`. It handles proper length at runtime.
             */
-            mem_allocated = LLVM::lfortran_string_malloc(context, *module, *builder, len);
+            mem_allocated = LLVM::lfortran_string_malloc(context, *module, *builder, get_allocator_function_name(),
+                len);
         }
 
         /* Store Allocated Memory */
@@ -2469,8 +2476,10 @@ namespace LCompilers {
 
         // Allocate memory and store in string's data ptr.
         llvm::Value* allocated_mem = realloc ?
-            LLVMArrUtils::lfortran_realloc(context, *module, *builder, get_string_data(str_type, str), whole_memory_needed)
-            : LLVMArrUtils::lfortran_malloc(context, *module, *builder, whole_memory_needed);
+            LLVMArrUtils::lfortran_realloc(context, *module, *builder, get_allocator_function_name(),
+                get_string_data(str_type, str), whole_memory_needed)
+            : LLVMArrUtils::lfortran_malloc(context, *module, *builder, get_allocator_function_name(),
+                whole_memory_needed);
         builder->CreateStore(allocated_mem, get_string_data(str_type, str, true));
     }
 
@@ -3296,7 +3305,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
 
         llvm::Value* char_bytes = builder->CreateMul(num_elements, str_len);
         llvm::Value* char_data = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, char_bytes);
+            context, *module, *builder, get_allocator_function_name(), char_bytes);
         builder->CreateMemSet(char_data,
             llvm::ConstantInt::get(context, llvm::APInt(8, 32)),
             char_bytes, llvm::MaybeAlign());
@@ -3338,7 +3347,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* total_data_bytes = builder->CreateMul(
             num_elements, elem_size);
         llvm::Value* data_mem = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, total_data_bytes);
+            context, *module, *builder, get_allocator_function_name(), total_data_bytes);
         builder->CreateMemSet(data_mem,
             llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
             total_data_bytes, llvm::MaybeAlign());
@@ -3389,7 +3398,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
 
         llvm::Value* total_bytes = builder->CreateMul(n_elems_i64, char_len);
         llvm::Value* flat_buf = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, total_bytes);
+            context, *module, *builder, get_allocator_function_name(), total_bytes);
 
         llvm::Value* idx = CreateAlloca(*builder, i64_ty);
         builder->CreateStore(llvm::ConstantInt::get(i64_ty, 0), idx);
@@ -3460,7 +3469,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
             module->getDataLayout().getTypeAllocSize(str_desc_ty));
         llvm::Value* total_bytes = builder->CreateMul(n_elems_i64, desc_size);
         llvm::Value* descs_buf = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, total_bytes);
+            context, *module, *builder, get_allocator_function_name(), total_bytes);
         llvm::Value* descs = builder->CreateBitCast(
             descs_buf, str_desc_ty->getPointerTo());
 
@@ -3546,7 +3555,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                 llvm::Value* ptr_to_data = arr_api->get_pointer_to_data(llvm_array_type, dest);
                                 llvm::Value* dest_data  = CreateLoad2(
                                     llvm_data_type->getPointerTo(), ptr_to_data);
-                                llvm::Value* reallocated_arr = LLVMArrUtils::lfortran_realloc(context, *module, *builder, dest_data, total_memory);
+                                llvm::Value* reallocated_arr = LLVMArrUtils::lfortran_realloc(context, *module, *builder, get_allocator_function_name(),
+                                    dest_data, total_memory);
                                 builder->CreateStore(builder->CreateBitCast(
                                     reallocated_arr, llvm_data_type->getPointerTo()), ptr_to_data);
                                 // Store Offset
@@ -3641,11 +3651,12 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                         llvm::Value* src_char_ptr = CreateLoad2(i8_ptr, create_gep2(llvm_str_desc_type, src_str_desc, 0));
                         // Allocate new heap string_descriptor for dest
                         llvm::DataLayout data_layout(module->getDataLayout());
-                        llvm::Value* new_str_desc_raw = LLVMArrUtils::lfortran_malloc(context, *module, *builder,
+                        llvm::Value* new_str_desc_raw = LLVMArrUtils::lfortran_malloc(context, *module, *builder, get_allocator_function_name(),
                             llvm::ConstantInt::get(context, llvm::APInt(64, data_layout.getTypeAllocSize(llvm_str_desc_type))));
                         llvm::Value* new_str_desc = builder->CreateBitCast(new_str_desc_raw, llvm_str_desc_type->getPointerTo());
                         // Allocate heap char data and copy from source
-                        llvm::Value* new_char_data = LLVMArrUtils::lfortran_malloc(context, *module, *builder, total_bytes);
+                        llvm::Value* new_char_data = LLVMArrUtils::lfortran_malloc(context, *module, *builder, get_allocator_function_name(),
+                            total_bytes);
                         builder->CreateMemCpy(new_char_data, llvm::MaybeAlign(), src_char_ptr, llvm::MaybeAlign(), total_bytes);
                         // Set up the new string_descriptor
                         builder->CreateStore(builder->CreateBitCast(new_char_data, i8_ptr),
@@ -3964,7 +3975,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* arg_size = llvm::ConstantInt::get(context,
                                     llvm::APInt(32, type_size * initial_capacity));
 
-        llvm::Value* list_data = LLVM::lfortran_malloc(context, *module, *builder,
+        llvm::Value* list_data = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
                                                        arg_size);
         builder->CreateMemSet(list_data, llvm::ConstantInt::get(context, llvm::APInt(8, 0)), arg_size, llvm::MaybeAlign());
         llvm::Type* el_type = std::get<2>(typecode2listtype[type_code]);
@@ -3989,7 +4000,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Type* list_type = std::get<0>(typecode2listtype[type_code]);
         llvm::Value* llvm_type_size = llvm::ConstantInt::get(context, llvm::APInt(32, type_size));
         llvm::Value* arg_size = builder->CreateMul(llvm_type_size, initial_capacity);
-        llvm::Value* list_data = LLVM::lfortran_malloc(context, *module, *builder, arg_size);
+        llvm::Value* list_data = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            arg_size);
         builder->CreateMemSet(list_data, llvm::ConstantInt::get(context, llvm::APInt(8, 0)), arg_size, llvm::MaybeAlign());
 
         llvm::Type* el_type = std::get<2>(typecode2listtype[type_code]);
@@ -4099,7 +4111,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                             llvm::APInt(32, initial_capacity));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_capacity,
+        llvm::Value* key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            llvm_capacity,
                                                       llvm_mask_size);
         LLVM::CreateStore(*builder, key_mask, get_pointer_to_keymask(dict_type->m_key_type, dict_type->m_value_type, dict));
     }
@@ -4132,7 +4145,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t key_value_type_size = data_layout.getTypeAllocSize(key_value_pair_type);
         llvm::Value* llvm_key_value_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), llvm::APInt(32, key_value_type_size));
         llvm::Value* malloc_size = builder->CreateMul(llvm_capacity, llvm_key_value_size);
-        llvm::Value* key_value_ptr = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* key_value_ptr = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         rehash_flag = builder->CreateAnd(rehash_flag,
                         builder->CreateICmpNE(key_value_ptr,
                         llvm::ConstantPointerNull::get(llvm::Type::getInt8Ty(context)->getPointerTo()))
@@ -4143,7 +4157,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t mask_size = data_layout.getTypeAllocSize(llvm::Type::getInt8Ty(context));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_capacity,
+        llvm::Value* key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            llvm_capacity,
                                                       llvm_mask_size);
         rehash_flag = builder->CreateAnd(rehash_flag,
                         builder->CreateICmpNE(key_mask,
@@ -4180,7 +4195,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         int32_t type_size = std::get<1>(typecode2listtype[src_type_code]);
         llvm::Value* arg_size = builder->CreateMul(llvm::ConstantInt::get(context,
                                                    llvm::APInt(32, type_size)), src_capacity);
-        llvm::Value* copy_data = LLVM::lfortran_malloc(context, *module, *builder,
+        llvm::Value* copy_data = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
                                                        arg_size);
         builder->CreateMemSet(copy_data, llvm::ConstantInt::get(context, llvm::APInt(8, 0)), arg_size, llvm::MaybeAlign());
         copy_data = builder->CreateBitCast(copy_data, el_type->getPointerTo());
@@ -4271,7 +4286,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                                             dict_type->m_key_type,
                                                             dict_type->m_value_type,
                                                             src));
-        llvm::Value* dest_key_mask = LLVM::lfortran_calloc(context, *module, *builder, src_capacity,
+        llvm::Value* dest_key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            src_capacity,
                                                       llvm_mask_size);
         builder->CreateMemCpy(dest_key_mask, llvm::MaybeAlign(), src_key_mask,
                               llvm::MaybeAlign(), builder->CreateMul(src_capacity, llvm_mask_size));
@@ -4471,7 +4487,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
         llvm::Value* malloc_size = builder->CreateMul(src_capacity, llvm_mask_size);
-        llvm::Value* dest_key_mask = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* dest_key_mask = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         LLVM::CreateStore(*builder, dest_key_mask, get_pointer_to_keymask(dict_type->m_key_type, dict_type->m_value_type, dest));
 
         malloc_size = builder->CreateSub(src_occupancy, src_filled_buckets);
@@ -4480,7 +4497,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                 dict_type->m_value_type));
         llvm::Value* llvm_kv_struct_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), llvm::APInt(32, kv_struct_size));
         malloc_size = builder->CreateMul(malloc_size, llvm_kv_struct_size);
-        llvm::Value* dest_key_value_pairs = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* dest_key_value_pairs = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         dest_key_value_pairs = builder->CreateBitCast(
             dest_key_value_pairs,
             get_key_value_pair_type(dict_type->m_key_type, dict_type->m_value_type)->getPointerTo());
@@ -5101,7 +5119,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                 llvm::DataLayout data_layout(module->getDataLayout());
                 size_t kv_struct_size = data_layout.getTypeAllocSize(kv_struct_type);
                 llvm::Value* malloc_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), kv_struct_size);
-                llvm::Value* new_kv_struct_i8 = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+                llvm::Value* new_kv_struct_i8 = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                    malloc_size);
                 llvm::Value* new_kv_struct = builder->CreateBitCast(new_kv_struct_i8, kv_struct_type->getPointerTo());
                 llvm_utils->deepcopy(dict_expr, key, llvm_utils->create_gep2(kv_pair_type, new_kv_struct, 0), key_asr_type, key_asr_type, module);
                 llvm_utils->deepcopy(dict_expr, value, llvm_utils->create_gep2(kv_pair_type, new_kv_struct, 1), value_asr_type, value_asr_type, module);
@@ -5818,7 +5837,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t mask_size = data_layout.getTypeAllocSize(llvm::Type::getInt8Ty(context));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* new_key_mask = LLVM::lfortran_calloc(context, *module, *builder, capacity,
+        llvm::Value* new_key_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            capacity,
                                                           llvm_mask_size);
 
         llvm::Value* current_capacity = llvm_utils->CreateLoad2(llvm::Type::getInt32Ty(context),
@@ -6586,7 +6606,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* arg_size = builder->CreateMul(type_size_, new_capacity);
         llvm::Value* copy_data_ptr = get_pointer_to_list_data_using_type(list_type, list);
         llvm::Value* copy_data = llvm_utils->CreateLoad2(el_type->getPointerTo() ,copy_data_ptr);
-        copy_data = LLVM::lfortran_realloc(context, *module, *builder,
+        copy_data = LLVM::lfortran_realloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
                                            copy_data, arg_size);
         { // Initialize newly allocated memory
             llvm::Value* newly_allocated_capacity = builder->CreateSub(new_capacity, capacity);
@@ -6737,7 +6757,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                                     llvm::APInt(32, type_size)), n);
             llvm::Value* copy_data_ptr = get_pointer_to_list_data_using_type(list_type, list);
             llvm::Value* copy_data = llvm_utils->CreateLoad2(el_type->getPointerTo(), copy_data_ptr);
-            copy_data = LLVM::lfortran_realloc(context, *module, *builder,
+            copy_data = LLVM::lfortran_realloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
                                             copy_data, arg_size);
             copy_data = builder->CreateBitCast(copy_data, el_type->getPointerTo());
             builder->CreateStore(copy_data, copy_data_ptr);
@@ -7719,7 +7739,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                             llvm::APInt(32, initial_capacity));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_capacity,
+        llvm::Value* el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            llvm_capacity,
                                                       llvm_mask_size);
         LLVM::CreateStore(*builder, el_mask, get_pointer_to_mask(set_type, set));
     }
@@ -7755,7 +7776,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t el_type_size = data_layout.getTypeAllocSize(el_type);
         llvm::Value* llvm_el_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), llvm::APInt(32, el_type_size));
         llvm::Value* malloc_size = builder->CreateMul(llvm_capacity, llvm_el_size);
-        llvm::Value* el_ptr = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* el_ptr = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         rehash_flag = builder->CreateAnd(rehash_flag,
                         builder->CreateICmpNE(el_ptr,
                         llvm::ConstantPointerNull::get(llvm::Type::getInt8Ty(context)->getPointerTo()))
@@ -7766,7 +7788,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t mask_size = data_layout.getTypeAllocSize(llvm::Type::getInt8Ty(context));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_capacity,
+        llvm::Value* el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            llvm_capacity,
                                                       llvm_mask_size);
         rehash_flag = builder->CreateAnd(rehash_flag,
                         builder->CreateICmpNE(el_mask,
@@ -8206,7 +8229,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                 llvm::DataLayout data_layout(module->getDataLayout());
                 size_t el_struct_size = data_layout.getTypeAllocSize(el_struct_type);
                 llvm::Value* malloc_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), el_struct_size);
-                llvm::Value* new_el_struct_i8 = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+                llvm::Value* new_el_struct_i8 = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                    malloc_size);
                 llvm::Value* new_el_struct = builder->CreateBitCast(new_el_struct_i8, el_struct_type->getPointerTo());
                 llvm_utils->deepcopy(set_expr, el, llvm_utils->create_gep2(el_struct_type, new_el_struct, 0), el_asr_type, el_asr_type, module);
                 LLVM::CreateStore(*builder,
@@ -8306,7 +8330,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t mask_size = data_layout.getTypeAllocSize(llvm::Type::getInt8Ty(context));
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
-        llvm::Value* new_el_mask = LLVM::lfortran_calloc(context, *module, *builder, capacity,
+        llvm::Value* new_el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            capacity,
                                                           llvm_mask_size);
 
         llvm::Value* current_capacity = llvm_utils->CreateLoad2(llvm::Type::getInt32Ty(context),
@@ -8898,7 +8923,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                             llvm::APInt(32, mask_size));
         llvm::Value* src_capacity = llvm_utils->CreateLoad2(llvm::Type::getInt32Ty(context),
                                                             get_pointer_to_capacity_using_typecode(el_type_code, src));
-        llvm::Value* dest_el_mask = LLVM::lfortran_calloc(context, *module, *builder, src_capacity,
+        llvm::Value* dest_el_mask = LLVM::lfortran_calloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            src_capacity,
                                                       llvm_mask_size);
         builder->CreateMemCpy(dest_el_mask, llvm::MaybeAlign(), src_el_mask,
                               llvm::MaybeAlign(), builder->CreateMul(src_capacity, llvm_mask_size));
@@ -8927,7 +8953,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* llvm_mask_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context),
                                             llvm::APInt(32, mask_size));
         llvm::Value* malloc_size = builder->CreateMul(src_capacity, llvm_mask_size);
-        llvm::Value* dest_el_mask = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* dest_el_mask = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         LLVM::CreateStore(*builder, dest_el_mask, get_pointer_to_mask(set_type_, dest));
 
         // number of elements to be copied = capacity + (occupancy - filled_buckets)
@@ -8937,7 +8964,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         size_t el_struct_size = data_layout.getTypeAllocSize(el_struct_type);
         llvm::Value* llvm_el_struct_size = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), llvm::APInt(32, el_struct_size));
         malloc_size = builder->CreateMul(malloc_size, llvm_el_struct_size);
-        llvm::Value* dest_elems = LLVM::lfortran_malloc(context, *module, *builder, malloc_size);
+        llvm::Value* dest_elems = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+            malloc_size);
         dest_elems = builder->CreateBitCast(dest_elems, el_struct_type->getPointerTo());
         copy_itr = llvm_utils->CreateAlloca(llvm::Type::getInt32Ty(context));
         next_ptr = llvm_utils->CreateAlloca(llvm::Type::getInt32Ty(context));
@@ -9157,7 +9185,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         
         // Step 1: Allocate ONE class wrapper and store it in array_data_ptr
         const int64_t class_wrapper_size = llvm::DataLayout(llvm_utils->module->getDataLayout()).getTypeAllocSize(llvm_class_type);
-        llvm::Value* wrapper_mem = LLVM::lfortran_malloc(context, *llvm_utils->module, *builder,
+        llvm::Value* wrapper_mem = LLVM::lfortran_malloc(context, *llvm_utils->module, *builder, llvm_utils->get_allocator_function_name(),
             llvm::ConstantInt::get(context, llvm::APInt(64, class_wrapper_size)));
         builder->CreateMemSet(wrapper_mem, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
             class_wrapper_size, llvm::MaybeAlign());
@@ -9174,9 +9202,11 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
             llvm::Value* existing_data_ptr = llvm_utils->CreateGEP2(llvm_class_type, class_wrapper, 1);
             llvm::Type* base_struct_type = llvm_utils->getStructType(class_symbol, llvm_utils->module);
             llvm::Value* existing_data = builder->CreateLoad(base_struct_type->getPointerTo(), existing_data_ptr);
-            data_mem = LLVM::lfortran_realloc(context, *llvm_utils->module, *builder, existing_data, total_bytes_to_alloc);
+            data_mem = LLVM::lfortran_realloc(context, *llvm_utils->module, *builder, llvm_utils->get_allocator_function_name(),
+                existing_data, total_bytes_to_alloc);
         } else {
-            data_mem = LLVM::lfortran_malloc(context, *llvm_utils->module, *builder, total_bytes_to_alloc);
+            data_mem = LLVM::lfortran_malloc(context, *llvm_utils->module, *builder, llvm_utils->get_allocator_function_name(),
+                total_bytes_to_alloc);
         }
         builder->CreateMemSet(data_mem, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
             total_bytes_to_alloc, llvm::MaybeAlign());
@@ -9226,7 +9256,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
 
         // Step 1: Allocate ONE class wrapper and store it in array_data_ptr
         int64_t class_wrapper_size = llvm::DataLayout(module->getDataLayout()).getTypeAllocSize(llvm_class_type);
-        llvm::Value* wrapper_mem = LLVM::lfortran_malloc(context, *module, *builder,
+        llvm::Value* wrapper_mem = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
             llvm::ConstantInt::get(context, llvm::APInt(64, class_wrapper_size)));
         builder->CreateMemSet(wrapper_mem, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
             class_wrapper_size, llvm::MaybeAlign());
@@ -9244,9 +9274,11 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
             // For realloc, load existing data pointer from wrapper's data field
             llvm::Value* existing_data_ptr = llvm_utils->CreateGEP2(llvm_class_type, class_wrapper, 1);
             llvm::Value* existing_data = builder->CreateLoad(llvm_utils->i8_ptr, existing_data_ptr);
-            data_mem = LLVM::lfortran_realloc(context, *module, *builder, existing_data, total_bytes);
+            data_mem = LLVM::lfortran_realloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                existing_data, total_bytes);
         } else {
-            data_mem = LLVM::lfortran_malloc(context, *module, *builder, total_bytes);
+            data_mem = LLVM::lfortran_malloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                total_bytes);
         }
         builder->CreateMemSet(data_mem, llvm::ConstantInt::get(context, llvm::APInt(8, 0)),
             total_bytes, llvm::MaybeAlign());
@@ -9611,7 +9643,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* malloc_size = llvm::ConstantInt::get(
             llvm_utils->getIntType(4), llvm::APInt(32, type_size));
         llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, malloc_size);
+            context, *module, *builder, llvm_utils->get_allocator_function_name(), malloc_size);
         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(
             context, llvm::APInt(8, 0)), malloc_size, llvm::MaybeAlign());
         builder->CreateStore(malloc_ptr, argsVec[0]);
@@ -9627,7 +9659,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         malloc_size = llvm::ConstantInt::get(
             llvm_utils->getIntType(4), llvm::APInt(32, type_size));
         malloc_ptr = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, malloc_size);
+            context, *module, *builder, llvm_utils->get_allocator_function_name(), malloc_size);
         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(
             context, llvm::APInt(8, 0)), malloc_size, llvm::MaybeAlign());
         malloc_ptr = builder->CreateBitCast(malloc_ptr, struct_type->getPointerTo());
@@ -9795,7 +9827,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* wrapper_malloc_size = llvm::ConstantInt::get(
             llvm_utils->getIntType(4), llvm::APInt(32, wrapper_size));
         llvm::Value* wrapper_ptr = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, wrapper_malloc_size);
+            context, *module, *builder, llvm_utils->get_allocator_function_name(), wrapper_malloc_size);
         builder->CreateMemSet(wrapper_ptr, llvm::ConstantInt::get(
             context, llvm::APInt(8, 0)), wrapper_malloc_size, llvm::MaybeAlign());
         builder->CreateStore(wrapper_ptr, target_ptr);
@@ -9812,7 +9844,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::Value* data_malloc_size = llvm::ConstantInt::get(
             llvm_utils->getIntType(4), llvm::APInt(32, data_size));
         llvm::Value* data_ptr = LLVMArrUtils::lfortran_malloc(
-            context, *module, *builder, data_malloc_size);
+            context, *module, *builder, llvm_utils->get_allocator_function_name(), data_malloc_size);
         builder->CreateMemSet(data_ptr, llvm::ConstantInt::get(
             context, llvm::APInt(8, 0)), data_malloc_size, llvm::MaybeAlign());
 
@@ -9924,7 +9956,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                     llvm_utils->arr_api->reset_is_allocated_flag(llvm_array_type, dest, llvm_data_type);
                     llvm::Value* reloaded_dest_data = llvm_utils->CreateLoad2(llvm_data_type->getPointerTo(),
                                             llvm_utils->arr_api->get_pointer_to_data(llvm_array_type, dest));
-                    llvm::Value* reallocated_arr = LLVMArrUtils::lfortran_realloc(context, *module, *builder, reloaded_dest_data, total_memory);
+                    llvm::Value* reallocated_arr = LLVMArrUtils::lfortran_realloc(context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                        reloaded_dest_data, total_memory);
                     reloaded_dest_data = builder->CreateBitCast(
                         reallocated_arr, llvm_data_type->getPointerTo());
                     builder->CreateStore(reloaded_dest_data, llvm_utils->arr_api->get_pointer_to_data(llvm_array_type, dest));
@@ -10295,7 +10328,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                                         llvm::Value* malloc_size = llvm::ConstantInt::get(
                                             llvm_utils->getIntType(4), llvm::APInt(32, type_size));
                                         llvm::Value* malloc_ptr = LLVMArrUtils::lfortran_malloc(
-                                            context, *module, *builder, malloc_size);
+                                            context, *module, *builder, llvm_utils->get_allocator_function_name(),
+                                                malloc_size);
                                         builder->CreateMemSet(malloc_ptr, llvm::ConstantInt::get(
                                             context, llvm::APInt(8, 0)), malloc_size, llvm::MaybeAlign());
                                         malloc_ptr = builder->CreateBitCast(malloc_ptr, struct_type->getPointerTo());
@@ -222,18 +222,20 @@ class ASRToLLVMVisitor;
     namespace LLVM {
 
         llvm::Value* CreateStore(llvm::IRBuilder<> &builder, llvm::Value *x, llvm::Value *y);
-        void set_memory_debug(bool state);
-        bool use_memory_debug();
+        // `allocator_getter` names the runtime function that returns the
+        // allocator to use, see LLVMUtils::get_allocator_function_name()
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* arg_size);
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size);
         llvm::Value* lfortran_malloc_alloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* allocator, llvm::Value* arg_size);
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size);
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* ptr, llvm::Value* arg_size);
         llvm::Value* lfortran_realloc_alloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* allocator, llvm::Value* ptr, llvm::Value* arg_size);
         llvm::Value* lfortran_calloc(llvm::LLVMContext &context, llvm::Module &module,
-                llvm::IRBuilder<> &builder, llvm::Value* count, llvm::Value* type_size);
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* count, llvm::Value* type_size);
+        llvm::Value* lfortran_string_malloc(llvm::LLVMContext &context, llvm::Module &module,
+                llvm::IRBuilder<> &builder, const char* allocator_getter, llvm::Value* arg_size);
         static inline bool is_llvm_struct(ASR::ttype_t* asr_type) {
             return ASR::is_a<ASR::Tuple_t>(*asr_type) ||
                    ASR::is_a<ASR::List_t>(*asr_type) ||
@@ -300,6 +302,7 @@ class ASRToLLVMVisitor;
             // Allocator support: the allocator is an opaque struct pointer
             // passed to runtime functions for compiler-controlled allocation.
             llvm::Value* allocator_instance = nullptr; // cached global allocator ptr
+            llvm::Value* scratch_allocator_instance = nullptr; // cached scratch allocator ptr
 
 #if LLVM_VERSION_MAJOR >= 17
             llvm::PointerType* i8_ptr = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
@@ -324,6 +327,14 @@ class ASRToLLVMVisitor;
             llvm::Value* lfortran_free_nocheck(llvm::Value* ptr);
             llvm::Value* lfortran_free_alloc(llvm::Value* allocator, llvm::Value* ptr);
 
+            // Set while allocating compiler generated temporaries, which then
+            // come from the scratch stack (only with the pool allocator)
+            bool scratch_allocation = false;
+
+            // Name of the runtime function returning the allocator selected
+            // by the compiler options and `scratch_allocation`
+            const char* get_allocator_function_name();
+
             // Get or create the cached global allocator pointer
             llvm::Value* get_allocator(llvm::Module* mod);
 
@@ -898,8 +909,8 @@ class ASRToLLVMVisitor;
             // Overload with defaults
             template <typename IF, typename ELSE>
             void create_if_else(llvm::Value *cond, IF if_block, ELSE else_block, const char *name = nullptr) {
-                static std::vector<llvm::BasicBlock*> dummy_blocks;
-                static std::vector<std::string> dummy_names;
+                std::vector<llvm::BasicBlock*> dummy_blocks;
+                std::vector<std::string> dummy_names;
                 create_if_else(cond, if_block, else_block, name, dummy_blocks, dummy_names);
             }
 
@@ -211,6 +211,9 @@ void emit_print_int(X86Assembler &a, const std::string &name)
     // Initialize stack
     a.asm_push_r32(X86Reg::ebp);
     a.asm_mov_r32_r32(X86Reg::ebp, X86Reg::esp);
+    // ebx and esi are callee-saved
+    a.asm_push_r32(X86Reg::ebx);
+    a.asm_push_r32(X86Reg::esi);
 
     X86Reg base = X86Reg::ebp;
     // mov eax, [ebp+8]  // argument "i"
@@ -276,6 +279,9 @@ void emit_print_int(X86Assembler &a, const std::string &name)
 
     a.add_label(".end");
 
+    a.asm_pop_r32(X86Reg::esi);
+    a.asm_pop_r32(X86Reg::ebx);
+
     // Restore stack
     a.asm_mov_r32_r32(X86Reg::esp, X86Reg::ebp);
     a.asm_pop_r32(X86Reg::ebp);
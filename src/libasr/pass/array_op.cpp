@@ -510,7 +510,10 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
     bool bounds_checking;
     bool remove_original_stmt;
     const LCompilers::PassOptions& pass_options;
-    inline static std::set<const ASR::Assignment_t*> debug_inserted;
+    // Assignments that already got their DebugCheckArrayBounds, shared by
+    // the array_op runs of one pipeline through `pass_options.pass_state`
+    PassState own_state;
+    std::set<const ASR::stmt_t*>& debug_inserted;
 
     public:
 
@@ -532,7 +535,10 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
         al(al_), replacer(al, pass_result, remove_original_stmt),
         parent_body(nullptr), realloc_lhs(pass_options_.realloc_lhs_arrays),
         bounds_checking(pass_options_.bounds_checking),
-        remove_original_stmt(false), pass_options(pass_options_) {
+        remove_original_stmt(false), pass_options(pass_options_),
+        debug_inserted(pass_options_.pass_state
+            ? pass_options_.pass_state->array_op_checked
+            : own_state.array_op_checked) {
         pass_result.n = 0;
         pass_result.reserve(al, 0);
     }
@@ -671,6 +677,9 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             parent_body = &body;
             visit_stmt(*m_body[i]);
             parent_body = parent_body_copy;
+            if( pass_result.size() > 0 || remove_original_stmt ) {
+                PassUtils::report_modified(pass_options, current_scope);
+            }
             if( pass_result.size() > 0 ) {
                 for (size_t j=0; j < pass_result.size(); j++) {
                     body.push_back(al, pass_result[j]);
@@ -866,6 +875,7 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
     void generate_loop_for_array_indexed_with_array_indices(const T& x,
         ASR::expr_t** target_address, ASR::expr_t** value_address,
         const Location& loc) {
+        PassUtils::report_modified(pass_options, current_scope);
         ASR::expr_t* target = *target_address;
         ASR::expr_t* value = *value_address;
         size_t var_rank = ASRUtils::extract_n_dims_from_ttype(ASRUtils::expr_type(target));
@@ -1020,6 +1030,7 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
                        Vec<ASR::expr_t**>& fix_types_args,
                        const Location& loc,
                        const std::vector<ASR::expr_t*>* scalar_targets = nullptr) {
+        PassUtils::report_modified(pass_options, current_scope);
         Vec<size_t> var_ranks;
         Vec<ASR::expr_t*> vars_expr;
         var_ranks.reserve(al, vars.size()); vars_expr.reserve(al, vars.size());
@@ -1413,12 +1424,14 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             // value is an ArrayConstant, thus we need to unroll it.
             ASR::IntrinsicArrayFunction_t* iaf = ASR::down_cast<ASR::IntrinsicArrayFunction_t>(xx.m_value);
             if ( iaf->m_value != nullptr ) {
+                PassUtils::report_modified(pass_options, current_scope);
                 xx.m_value = iaf->m_value;
             }
         }
         if ( ASR::is_a<ASR::ArrayReshape_t>(*xx.m_value) ) {
             ASR::ArrayReshape_t* ar = ASR::down_cast<ASR::ArrayReshape_t>(xx.m_value);
             if ( ar->m_value != nullptr ) {
+                PassUtils::report_modified(pass_options, current_scope);
                 xx.m_value = ar->m_value;
             }
         }
@@ -1433,7 +1446,10 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
         bool is_value_assumed_rank = (ASR::is_a<ASR::ArrayPhysicalCast_t>(*xx.m_value) && 
             ASR::down_cast<ASR::ArrayPhysicalCast_t>(xx.m_value)->m_old == ASR::array_physical_typeType::AssumedRankArray)
             || ASRUtils::is_assumed_rank_array(ASRUtils::expr_type(xx.m_value));
-        xx.m_value = ASRUtils::get_past_array_broadcast(xx.m_value);
+        if( ASRUtils::get_past_array_broadcast(xx.m_value) != xx.m_value ) {
+            PassUtils::report_modified(pass_options, current_scope);
+            xx.m_value = ASRUtils::get_past_array_broadcast(xx.m_value);
+        }
         const Location loc = x.base.base.loc;
 
         #define is_array_indexed_with_array_indices_check(expr) \
@@ -1451,6 +1467,7 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
         if( call_replace_on_expr(xx.m_value->type) ||
             ASR::is_a<ASR::ImpliedDoLoop_t>(*xx.m_value) ) {
             if (ASR::is_a<ASR::ImpliedDoLoop_t>(*xx.m_value)) {
+                PassUtils::report_modified(pass_options, current_scope);
                 ASR::ImpliedDoLoop_t* idl = ASR::down_cast<ASR::ImpliedDoLoop_t>(xx.m_value);
                 Vec<ASR::expr_t*> args;
                 args.reserve(al, 1);
@@ -1527,10 +1544,10 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             CollectComponentsFromElementalExpr cv(al, vars);
             cv.visit_expr(*d_value);
 
-            if (debug_inserted.find(&x) == debug_inserted.end()) {
+            if (debug_inserted.find(&x.base) == debug_inserted.end()) {
                 pass_result.push_back(al, ASRUtils::STMT(ASR::make_DebugCheckArrayBounds_t(al, x.base.base.loc, d_target, vars.p, vars.n, x.m_move_allocation)));
                 if (!x.m_move_allocation) {
-                    debug_inserted.insert(&x);
+                    debug_inserted.insert(&x.base);
                 }
             }
         }
@@ -1555,7 +1572,7 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             } 
             ASR::stmt_t* stmt = ASRUtils::STMT(ASRUtils::make_Assignment_t_util(al, loc, x.m_target, x.m_value, x.m_overloaded, x.m_realloc_lhs, x.m_move_allocation));
             pass_result.push_back(al, stmt);
-            debug_inserted.insert(ASR::down_cast<ASR::Assignment_t>(stmt));
+            debug_inserted.insert(stmt);
             return;
         }
 
@@ -1669,6 +1686,7 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
 
 void pass_replace_array_op(Allocator &al, ASR::TranslationUnit_t &unit,
                            const LCompilers::PassOptions& pass_options) {
+    PassUtils::track_modified(pass_options);
     ArrayOpVisitor v(al, pass_options);
     v.call_replacer_on_value = false;
     v.visit_TranslationUnit(unit);
@@ -327,6 +327,20 @@ void set_allocation_size_elemental_function(
     size_t n_dims = ASRUtils::extract_n_dims_from_ttype(elemental_function->m_type);
     allocate_dims.reserve(al, n_dims);
     ASR::expr_t* first_array_arg = get_first_array_function_args(elemental_function);
+    if( is_vectorise_able(first_array_arg) && !ASR::is_a<ASR::Var_t>(*first_array_arg) ) {
+        // The argument is an elemental expression like `a*b` in `sin(a*b)`,
+        // take the size from one of its operands instead.
+        Vec<ASR::expr_t*> array_vars; array_vars.reserve(al, 1);
+        ArrayVarCollector array_var_collector(al, array_vars);
+        array_var_collector.visit_expr(*first_array_arg);
+        for( size_t i = 0; i < array_vars.size(); i++ ) {
+            if( (size_t) ASRUtils::extract_n_dims_from_ttype(
+                    ASRUtils::expr_type(array_vars[i])) == n_dims ) {
+                first_array_arg = array_vars[i];
+                break;
+            }
+        }
+    }
     // Set allocate_dims
     for( size_t i = 0; i < n_dims; i++ ) {
         ASR::dimension_t allocate_dim;
@@ -1138,6 +1152,12 @@ ASR::expr_t* create_and_allocate_temporary_variable_for_array(
         current_body->push_back(al, ASRUtils::STMT(ASR::make_Associate_t(
             al, loc, array_var_temporary, array_expr)));
     } else {
+        if( ASRUtils::is_allocatable(ASRUtils::expr_type(array_var_temporary)) ) {
+            // Allocated and filled here, only read afterwards: its data may
+            // come from the scratch stack (see ASRToLLVMVisitor::visit_Allocate)
+            ASR::Variable_t* v = ASRUtils::EXPR2VAR(array_var_temporary);
+            v->m_storage = ASR::storage_typeType::Scratch;
+        }
         insert_allocate_stmt_for_array(al, array_var_temporary, allocate_size_reference, current_body);
         bool is_array_assumed_rank = ASR::is_a<ASR::ArrayPhysicalCast_t>(*array_expr) && ASR::down_cast<ASR::ArrayPhysicalCast_t>(array_expr)->m_old == ASR::array_physical_typeType::AssumedRankArray;
         if (!is_array_assumed_rank) {
@@ -1224,6 +1244,22 @@ ASR::expr_t* create_and_allocate_temporary_variable_for_struct(
 
 // Returns true if `value` is a direct reference to existing memory (e.g., a variable
 // or a pointer to an array element) and does NOT require a temporary variable to be allocated.
+/*
+    An array valued argument of an elemental procedure which is itself an
+    elemental operation (e.g. `a*b` in `sin(a*b)`) is evaluated element by
+    element by array_op in the same loop nest as the call, so it doesn't
+    need to be materialised in a temporary first.
+*/
+bool is_fusable_elemental_arg(ASR::expr_t* arg) {
+    ASR::ttype_t* arg_type = ASRUtils::expr_type(arg);
+    return is_vectorise_able(arg) &&
+        !ASR::is_a<ASR::Var_t>(*arg) &&
+        !ASR::is_a<ASR::StringCompare_t>(*arg) &&
+        !ASRUtils::is_character(*arg_type) &&
+        !ASRUtils::is_struct(*arg_type) &&
+        !ASRUtils::is_simd_array(arg);
+}
+
 bool is_directly_addressable_array_expr(ASR::expr_t* value) {
     value = ASRUtils::get_past_array_physical_cast(value);
     switch( value->type ) {
@@ -1310,6 +1346,209 @@ bool is_common_symbol_present_in_lhs_and_rhs(Allocator &al, ASR::expr_t* lhs, AS
     return false;
 }
 
+/*
+    Returns true if the procedure `callee` can read the local variable
+    `v` through host association, or if `v` is otherwise reachable from
+    outside the scope it is declared in (module variables, pointers and
+    targets).
+*/
+bool can_procedure_access_variable(ASR::symbol_t* callee, ASR::Variable_t* v) {
+    if( v->m_target_attr || ASRUtils::is_pointer(v->m_type) ) {
+        return true;
+    }
+    ASR::asr_t* v_owner = v->m_parent_symtab->asr_owner;
+    if( !ASR::is_a<ASR::symbol_t>(*v_owner) ||
+        !(ASR::is_a<ASR::Function_t>(*ASR::down_cast<ASR::symbol_t>(v_owner)) ||
+          ASR::is_a<ASR::Program_t>(*ASR::down_cast<ASR::symbol_t>(v_owner)) ||
+          ASR::is_a<ASR::Block_t>(*ASR::down_cast<ASR::symbol_t>(v_owner))) ) {
+        return true;
+    }
+    callee = ASRUtils::symbol_get_past_external(callee);
+    if( !ASR::is_a<ASR::Function_t>(*callee) ) {
+        return true;
+    }
+    SymbolTable* scope = ASR::down_cast<ASR::Function_t>(callee)->m_symtab;
+    while( scope != nullptr ) {
+        if( scope == v->m_parent_symtab ) {
+            return true;
+        }
+        scope = scope->parent;
+    }
+    return false;
+}
+
+/*
+    Returns true if `sym` is a variable that may share storage with another
+    variable: POINTER and TARGET variables, and associate names, which are
+    pointers to their selector.
+*/
+bool may_alias_other_variables(ASR::symbol_t* sym) {
+    sym = ASRUtils::symbol_get_past_external(sym);
+    if( !ASR::is_a<ASR::Variable_t>(*sym) ) {
+        return true;
+    }
+    ASR::Variable_t* v = ASR::down_cast<ASR::Variable_t>(sym);
+    if( v->m_target_attr || ASRUtils::is_pointer(v->m_type) ) {
+        return true;
+    }
+    ASR::asr_t* v_owner = v->m_parent_symtab->asr_owner;
+    return ASR::is_a<ASR::symbol_t>(*v_owner) &&
+        ASR::is_a<ASR::AssociateBlock_t>(*ASR::down_cast<ASR::symbol_t>(v_owner));
+}
+
+class ElementalFusionChecker: public ASR::BaseWalkVisitor<ElementalFusionChecker> {
+    /*
+        Checks that a scalar sub-expression of an elemental array
+        expression neither reads the target symbol, nor a variable that
+        may alias it, nor calls a procedure (which could observe the
+        partially updated target).
+    */
+
+    private:
+
+    ASR::symbol_t* target_sym;
+
+    public:
+
+    bool is_fusable;
+
+    ElementalFusionChecker(ASR::symbol_t* target_sym_):
+        target_sym(target_sym_), is_fusable(true) {}
+
+    void visit_Var(const ASR::Var_t& x) {
+        if( x.m_v == target_sym || may_alias_other_variables(x.m_v) ) {
+            is_fusable = false;
+        }
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t& /*x*/) {
+        is_fusable = false;
+    }
+
+    void visit_ArraySize(const ASR::ArraySize_t& /*x*/) {
+    }
+
+    void visit_ArrayBound(const ASR::ArrayBound_t& /*x*/) {
+    }
+};
+
+/*
+    Returns true if `expr` is a tree of elemental operations in which
+    every reference to the variable `target` is the whole array `target`,
+    and no other variable may alias it. Element `i` of such an expression
+    depends only on element `i` of `target`, so it can be evaluated in the
+    same loop nest that stores into `target`, without an intermediate
+    temporary.
+*/
+bool is_elemental_expr_free_of_overlap(ASR::expr_t* expr, ASR::Variable_t* target) {
+    ASR::symbol_t* target_sym = &(target->base);
+    if( ASRUtils::is_value_constant(ASRUtils::expr_value(expr)) ) {
+        return true;
+    }
+    if( !ASRUtils::is_array(ASRUtils::expr_type(expr)) ) {
+        ElementalFusionChecker checker(target_sym);
+        checker.visit_expr(*expr);
+        return checker.is_fusable;
+    }
+    if( ASRUtils::is_character(*ASRUtils::expr_type(expr)) ||
+        ASRUtils::is_struct(*ASRUtils::expr_type(expr)) ) {
+        return false;
+    }
+    #define fusable_binop(Constructor) case ASR::exprType::Constructor: { \
+        ASR::Constructor##_t* binop = ASR::down_cast<ASR::Constructor##_t>(expr); \
+        return is_elemental_expr_free_of_overlap(binop->m_left, target) && \
+               is_elemental_expr_free_of_overlap(binop->m_right, target); } \
+
+    #define fusable_unaryop(Constructor) case ASR::exprType::Constructor: { \
+        return is_elemental_expr_free_of_overlap( \
+            ASR::down_cast<ASR::Constructor##_t>(expr)->m_arg, target); } \
+
+    switch( expr->type ) {
+        case ASR::exprType::Var: {
+            ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(expr)->m_v;
+            return ASRUtils::symbol_get_past_external(sym) == target_sym ||
+                !may_alias_other_variables(sym);
+        }
+        fusable_unaryop(ArrayPhysicalCast)
+        fusable_unaryop(Cast)
+        fusable_unaryop(IntegerUnaryMinus)
+        fusable_unaryop(RealUnaryMinus)
+        fusable_unaryop(ComplexUnaryMinus)
+        fusable_unaryop(LogicalNot)
+        fusable_binop(IntegerBinOp)
+        fusable_binop(UnsignedIntegerBinOp)
+        fusable_binop(RealBinOp)
+        fusable_binop(ComplexBinOp)
+        fusable_binop(LogicalBinOp)
+        fusable_binop(IntegerCompare)
+        fusable_binop(RealCompare)
+        fusable_binop(ComplexCompare)
+        fusable_binop(LogicalCompare)
+        case ASR::exprType::ArraySection: {
+            ASR::ArraySection_t* array_section = ASR::down_cast<ASR::ArraySection_t>(expr);
+            if( ASRUtils::is_array_indexed_with_array_indices(array_section) ) {
+                return false;
+            }
+            ElementalFusionChecker checker(target_sym);
+            checker.visit_expr(*expr);
+            return checker.is_fusable;
+        }
+        case ASR::exprType::IntrinsicElementalFunction: {
+            ASR::IntrinsicElementalFunction_t* func =
+                ASR::down_cast<ASR::IntrinsicElementalFunction_t>(expr);
+            for( size_t i = 0; i < func->n_args; i++ ) {
+                if( func->m_args[i] &&
+                    !is_elemental_expr_free_of_overlap(func->m_args[i], target) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ASR::exprType::FunctionCall: {
+            ASR::FunctionCall_t* func_call = ASR::down_cast<ASR::FunctionCall_t>(expr);
+            if( !ASRUtils::is_elemental(func_call->m_name) || func_call->m_dt ||
+                can_procedure_access_variable(func_call->m_name, target) ) {
+                return false;
+            }
+            for( size_t i = 0; i < func_call->n_args; i++ ) {
+                if( func_call->m_args[i].m_value &&
+                    !is_elemental_expr_free_of_overlap(func_call->m_args[i].m_value, target) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+
+    #undef fusable_binop
+    #undef fusable_unaryop
+}
+
+/*
+    Returns true if `value` can be assigned to `target` element by element
+    even though `value` references `target`, e.g. `x = x*y + sin(x)`.
+*/
+bool is_elemental_assignment_fusable(ASR::expr_t* target, ASR::expr_t* value) {
+    target = ASRUtils::get_past_array_physical_cast(target);
+    if( !ASR::is_a<ASR::Var_t>(*target) || ASRUtils::is_simd_array(value) ) {
+        return false;
+    }
+    ASR::symbol_t* target_sym = ASRUtils::symbol_get_past_external(
+        ASR::down_cast<ASR::Var_t>(target)->m_v);
+    if( !ASR::is_a<ASR::Variable_t>(*target_sym) ) {
+        return false;
+    }
+    // Pointers may be associated with any part of a target in any order
+    if( may_alias_other_variables(target_sym) ) {
+        return false;
+    }
+    return is_elemental_expr_free_of_overlap(value,
+        ASR::down_cast<ASR::Variable_t>(target_sym));
+}
+
 class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
 {
 
@@ -1407,12 +1646,13 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     }
 
     void traverse_args(Vec<ASR::expr_t*>& x_m_args_vec, ASR::expr_t** x_m_args,
-        size_t x_n_args, const std::string& name_hint) {
+        size_t x_n_args, const std::string& name_hint, bool is_elemental_call=false) {
         /* For other frontends, we might need to traverse the arguments
            in reverse order. */
         for( size_t i = 0; i < x_n_args; i++ ) {
             visit_expr(*x_m_args[i]);
-            if( is_temporary_needed(x_m_args[i]) ) {
+            if( is_temporary_needed(x_m_args[i]) &&
+                !(is_elemental_call && is_fusable_elemental_arg(x_m_args[i])) ) {
                 ASR::expr_t* array_var_temporary = call_create_and_allocate_temporary_variable(x_m_args[i], al, current_body, name_hint, current_scope, exprs_with_target);
                 if( ASR::is_a<ASR::ArrayPhysicalCast_t>(*x_m_args[i]) ) {
                     ASR::ArrayPhysicalCast_t* x_m_args_i = ASR::down_cast<ASR::ArrayPhysicalCast_t>(x_m_args[i]);
@@ -1443,7 +1683,8 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     }
 
     void traverse_call_args(Vec<ASR::call_arg_t>& x_m_args_vec, ASR::call_arg_t* x_m_args,
-        size_t x_n_args, ASR::expr_t **orig_args, const std::string& name_hint) {
+        size_t x_n_args, ASR::expr_t **orig_args, const std::string& name_hint,
+        bool is_elemental_call=false) {
         /* For other frontends, we might need to traverse the arguments
            in reverse order. */
         for( size_t i = 0; i < x_n_args; i++ ) {
@@ -1458,7 +1699,8 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
                     continue;
                 }
             }
-            if( is_temporary_needed(x_m_args[i].m_value) ) {
+            if( is_temporary_needed(x_m_args[i].m_value) &&
+                !(is_elemental_call && is_fusable_elemental_arg(x_m_args[i].m_value)) ) {
                 visit_call_arg(x_m_args[i]);
                 ASR::expr_t* array_var_temporary = call_create_and_allocate_temporary_variable(x_m_args[i].m_value, al, current_body, name_hint, current_scope, exprs_with_target);
                 if( ASR::is_a<ASR::ArrayPhysicalCast_t>(*x_m_args[i].m_value) ) {
@@ -1838,9 +2080,10 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     }
 
     template <typename T>
-    void visit_IntrinsicCall(const T& x, const std::string& name_hint) {
+    void visit_IntrinsicCall(const T& x, const std::string& name_hint,
+        bool is_elemental_call=false) {
         Vec<ASR::expr_t*> x_m_args; x_m_args.reserve(al, x.n_args);
-        traverse_args(x_m_args, x.m_args, x.n_args, name_hint);
+        traverse_args(x_m_args, x.m_args, x.n_args, name_hint, is_elemental_call);
         T& xx = const_cast<T&>(x);
         xx.m_args = x_m_args.p;
         xx.n_args = x_m_args.size();
@@ -1862,7 +2105,7 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     void visit_IntrinsicElementalFunction(const ASR::IntrinsicElementalFunction_t& x) {
         if (!ASRUtils::is_value_constant(x.m_value)) {   // Only simplify runtime function's args
             visit_IntrinsicCall(x, "_intrinsic_elemental_function_" +
-                ASRUtils::get_intrinsic_name(x.m_intrinsic_id));
+                ASRUtils::get_intrinsic_name(x.m_intrinsic_id), true);
             if (x.m_type) {
                 visit_ttype(*x.m_type);
             }
@@ -1891,7 +2134,7 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     }
 
     template <typename T>
-    void visit_Call(const T& x, const std::string& name_hint) {
+    void visit_Call(const T& x, const std::string& name_hint, bool is_elemental_call=false) {
         // LCOMPILERS_ASSERT(!x.m_dt || !ASRUtils::is_array(ASRUtils::expr_type(x.m_dt)));
         Vec<ASR::call_arg_t> x_m_args; x_m_args.reserve(al, x.n_args);
         ASR::expr_t **orig_args = nullptr;
@@ -1908,7 +2151,7 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
             }
         }
         traverse_call_args(x_m_args, x.m_args, x.n_args, orig_args,
-            name_hint + ASRUtils::symbol_name(x.m_name));
+            name_hint + ASRUtils::symbol_name(x.m_name), is_elemental_call);
         T& xx = const_cast<T&>(x);
         xx.m_args = x_m_args.p;
         xx.n_args = x_m_args.size();
@@ -1930,7 +2173,8 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
     }
 
     void visit_FunctionCall(const ASR::FunctionCall_t& x) {
-        visit_Call(x, "_function_call_");
+        visit_Call(x, "_function_call_", ASRUtils::is_elemental(x.m_name) &&
+            !ASRUtils::is_struct(*x.m_type));
         ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>::visit_FunctionCall(x);
     }
 
@@ -2684,6 +2928,10 @@ class ReplaceExprWithTemporaryVisitor:
              ASR::is_a<ASR::StructInstanceMember_t>(*x.m_value)) &&
             is_common_symbol_present_in_lhs_and_rhs(al, lhs_array_var, x.m_value);
 
+        // `x = x*y + sin(x)` reads each element of `x` only to compute the
+        // same element of the result, so it needs no temporary
+        bool is_value_fusable = is_elemental_assignment_fusable(x.m_target, x.m_value);
+
         current_expr = const_cast<ASR::expr_t**>(&(x.m_value));
         call_replacer();
         replacer.lhs_var = nullptr;
@@ -2695,7 +2943,8 @@ class ReplaceExprWithTemporaryVisitor:
             (lhs_array_var && ASRUtils::is_array(ASRUtils::expr_type(x.m_value)) &&
             !ASRUtils::is_simd_array(x.m_value) &&
             !ASRUtils::is_allocatable(x.m_target) &&
-            is_common_symbol_present_in_lhs_and_rhs(al, lhs_array_var, x.m_value)) ||
+            is_common_symbol_present_in_lhs_and_rhs(al, lhs_array_var, x.m_value) &&
+            !is_value_fusable) ||
             is_self_ref_allocatable_array ) {
             replacer.force_replace_current_expr_for_array(current_expr, "_assignment_value_", al, current_body, current_scope,
                                                 exprs_with_target, is_assignment_target_array_section_item);
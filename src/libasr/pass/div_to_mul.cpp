@@ -35,10 +35,12 @@ class DivToMulVisitor : public PassUtils::PassVisitor<DivToMulVisitor>
 private:
 
     std::string rl_path;
+    const LCompilers::PassOptions &pass_options;
 
 public:
-    DivToMulVisitor(Allocator &al_, const std::string& rl_path_) : PassVisitor(al_, nullptr),
-    rl_path(rl_path_)
+    DivToMulVisitor(Allocator &al_, const std::string& rl_path_,
+        const LCompilers::PassOptions &pass_options_) : PassVisitor(al_, nullptr),
+    rl_path(rl_path_), pass_options(pass_options_)
     {
         pass_result.reserve(al, 1);
     }
@@ -63,6 +65,7 @@ public:
                             break;
                     }
                     if( is_feasible ) {
+                        PassUtils::report_modified(pass_options, current_scope);
                         ASR::RealBinOp_t& xx = const_cast<ASR::RealBinOp_t&>(x);
                         xx.m_op = ASR::binopType::Mul;
                         xx.m_right = right_inverse;
@@ -77,7 +80,8 @@ public:
 void pass_replace_div_to_mul(Allocator &al, ASR::TranslationUnit_t &unit,
                              const LCompilers::PassOptions& pass_options) {
     std::string rl_path = pass_options.runtime_library_dir;
-    DivToMulVisitor v(al, rl_path);
+    PassUtils::track_modified(pass_options);
+    DivToMulVisitor v(al, rl_path, pass_options);
     v.visit_TranslationUnit(unit);
 }
 
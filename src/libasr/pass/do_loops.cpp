@@ -32,6 +32,11 @@ to:
     end do
 
 The comparison is >= for c<0.
+
+With `simd_do_concurrent` the innermost loop of a `do concurrent` is
+wrapped in an OMPRegion(Simd), carrying its `reduce` variables as
+OMPReduction clauses, so that the backend can mark it as vectorizable
+without runtime dependence checks.
 */
 class DoLoopVisitor : public ASR::StatementWalkVisitor<DoLoopVisitor>
 {
@@ -58,10 +63,33 @@ public:
             ASR::asr_t* do_loop = ASR::make_DoLoop_t(al, x.base.base.loc, s2c(al, ""), x.m_head[i], body.p, body.n, nullptr, 0);
             body={};body.reserve(al,1);
             body.push_back(al,ASRUtils::STMT(do_loop));
+            if (i == static_cast<int>(x.n_head) - 1) {
+                body = simd_region(x, body);
+            }
         }
         ASR::asr_t* do_loop = ASR::make_DoLoop_t(al, x.base.base.loc, s2c(al, ""), x.m_head[0], body.p, body.n, nullptr, 0);
         const ASR::DoLoop_t &do_loop_ref = (const ASR::DoLoop_t&)(*do_loop);
         pass_result = PassUtils::replace_doloop(al, do_loop_ref, -1, use_loop_variable_after_loop, this->current_scope);
+        if (x.n_head == 1) {
+            pass_result = simd_region(x, pass_result);
+        }
+    }
+
+    Vec<ASR::stmt_t*> simd_region(const ASR::DoConcurrentLoop_t &x, Vec<ASR::stmt_t*> &body) {
+        if (!pass_options.simd_do_concurrent) {
+            return body;
+        }
+        Vec<ASR::omp_clause_t*> clauses; clauses.reserve(al, x.n_reduction);
+        for (size_t i = 0; i < x.n_reduction; i++) {
+            Vec<ASR::expr_t*> vars; vars.reserve(al, 1);
+            vars.push_back(al, x.m_reduction[i].m_arg);
+            clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPReduction_t(
+                al, x.base.base.loc, x.m_reduction[i].m_op, vars.p, vars.n)));
+        }
+        Vec<ASR::stmt_t*> region; region.reserve(al, 1);
+        region.push_back(al, ASRUtils::STMT(ASR::make_OMPRegion_t(al, x.base.base.loc,
+            ASR::omp_region_typeType::Simd, clauses.p, clauses.n, body.p, body.n)));
+        return region;
     }
 };
 
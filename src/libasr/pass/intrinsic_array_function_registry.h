@@ -4882,6 +4882,51 @@ namespace MatMul {
             args.p, args.n, overload_id, ret_type, value);
     }
 
+    // Products with at least this many multiply-adds (m*n*k) are computed
+    // by the blocked runtime kernels, smaller ones by the inline loops
+    static const int64_t runtime_kernel_threshold = 32*32*32;
+
+    /*
+     * Returns the runtime kernel (`_lfortran_[sdcz]gemm`) that can compute
+     * `matmul(matrix_a, matrix_b)` for rank 2 real or complex operands of the
+     * same type and kind as the result, or an empty string if the inline loops
+     * must be used. Operands whose shapes are known at compile time and are
+     * below `runtime_kernel_threshold` always stay inline.
+     */
+    static inline std::string runtime_kernel_name(Vec<ASR::ttype_t*> &arg_types,
+            ASR::ttype_t *return_type, int64_t overload_id) {
+        if ( overload_id != 3 ) {
+            return "";
+        }
+        ASR::ttype_t *type = extract_type(return_type);
+        int kind = extract_kind_from_ttype_t(type);
+        for ( size_t iarg = 0; iarg < 2; iarg++ ) {
+            ASR::ttype_t *arg_type = extract_type(arg_types[iarg]);
+            if ( arg_type->type != type->type ||
+                 extract_kind_from_ttype_t(arg_type) != kind ) {
+                return "";
+            }
+        }
+        if ( is_fixed_size_array(arg_types[0]) && is_fixed_size_array(arg_types[1]) ) {
+            ASR::dimension_t *b_dims = nullptr;
+            extract_dimensions_from_ttype(arg_types[1], b_dims);
+            int64_t n = -1;
+            if ( extract_value(b_dims[1].m_length, n) &&
+                 get_fixed_size_of_array(arg_types[0]) * n < runtime_kernel_threshold ) {
+                return "";
+            }
+        }
+        std::string prefix;
+        if ( is_real(*type) ) {
+            prefix = (kind == 4) ? "s" : "d";
+        } else if ( is_complex(*type) ) {
+            prefix = (kind == 4) ? "c" : "z";
+        } else {
+            return "";
+        }
+        return "_lfortran_" + prefix + "gemm";
+    }
+
     static inline ASR::expr_t *instantiate_MatMul(Allocator &al,
             const Location &loc, SymbolTable *scope,
             Vec<ASR::ttype_t*> &arg_types, ASR::ttype_t *return_type,
@@ -4987,14 +5032,77 @@ namespace MatMul {
         } else {
             mul_value = b.Mul(a_ref, b_ref);
         }
-        body.push_back(al, b.DoLoop(i, a_lbound, a_ubound, {
-            b.DoLoop(j, b_lbound, b_ubound, {
-                b.Assign_Constant(res_ref, 0),
-                b.DoLoop(k, b.GetLBound(args[1], 1), b.GetUBound(args[1], 1), {
-                    b.Assignment(res_ref, b.Add(res_ref, mul_value))
+        ASR::stmt_t *loops;
+        if ( overload_id == 1 ) {
+            loops = b.DoLoop(i, a_lbound, a_ubound, {
+                b.DoLoop(j, b_lbound, b_ubound, {
+                    b.Assign_Constant(res_ref, 0),
+                    b.DoLoop(k, b.GetLBound(args[1], 1), b.GetUBound(args[1], 1), {
+                        b.Assignment(res_ref, b.Add(res_ref, mul_value))
+                    }),
+                })
+            });
+        } else {
+            // Column-major friendly j-k-i order, the innermost loop walks down
+            // the columns of `result` and `matrix_a` with unit stride
+            loops = b.DoLoop(j, b_lbound, b_ubound, {
+                b.DoLoop(i, a_lbound, a_ubound, {
+                    b.Assign_Constant(res_ref, 0)
                 }),
-            })
-        }));
+                b.DoLoop(k, b.GetLBound(args[1], 1), b.GetUBound(args[1], 1), {
+                    b.DoLoop(i, a_lbound, a_ubound, {
+                        b.Assignment(res_ref, b.Add(res_ref, mul_value))
+                    })
+                })
+            });
+        }
+        std::string kernel_name = runtime_kernel_name(arg_types, return_type,
+            overload_id);
+        if ( !kernel_name.empty() ) {
+            /*
+             * if (is_contiguous(result) .and. is_contiguous(matrix_a) .and.
+             *     is_contiguous(matrix_b) .and. m*n*k >= threshold) then
+             *     call _lfortran_dgemm(c_loc(result(1, 1)), c_loc(matrix_a(1, 1)),
+             *         c_loc(matrix_b(1, 1)), m, n, k)
+             * else
+             *     <loops>
+             * end if
+             */
+            Vec<ASR::ttype_t*> kernel_arg_types; kernel_arg_types.reserve(al, 6);
+            for (int iarg = 0; iarg < 3; iarg++) kernel_arg_types.push_back(al, b.CPtr());
+            for (int iarg = 0; iarg < 3; iarg++) kernel_arg_types.push_back(al, int64);
+            ASR::symbol_t *kernel = b.create_c_subroutine_interface(kernel_name,
+                fn_symtab, kernel_arg_types, {"c", "a", "b", "m", "n", "k"},
+                {true, true, true, true, true, true});
+            fn_symtab->add_symbol(kernel_name, kernel);
+            dep.push_back(al, s2c(al, kernel_name));
+            ASR::expr_t *m = b.ArraySize(args[0], b.i32(1), int64);
+            ASR::expr_t *n = b.ArraySize(args[1], b.i32(2), int64);
+            ASR::expr_t *k_ = b.ArraySize(args[0], b.i32(2), int64);
+            auto first_element = [&](ASR::expr_t *arr) -> ASR::expr_t* {
+                ASR::expr_t *item = b.ArrayItem_01(arr,
+                    {b.GetLBound(arr, 1), b.GetLBound(arr, 2)});
+                return b.PointerToCPtr(EXPR(ASR::make_GetPointer_t(al, loc, item,
+                    ASRUtils::TYPE(ASR::make_Pointer_t(al, loc, expr_type(item))),
+                    nullptr)), b.CPtr());
+            };
+            auto is_contiguous = [&](ASR::expr_t *arr) -> ASR::expr_t* {
+                return EXPR(ASR::make_ArrayIsContiguous_t(al, loc, arr,
+                    logical, nullptr));
+            };
+            Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 6);
+            for (ASR::expr_t *arg: {first_element(result), first_element(args[0]),
+                    first_element(args[1]), m, n, k_}) {
+                ASR::call_arg_t call_arg; call_arg.loc = loc; call_arg.m_value = arg;
+                kernel_args.push_back(al, call_arg);
+            }
+            ASR::expr_t *use_kernel = b.And(b.And(b.And(is_contiguous(result),
+                is_contiguous(args[0])), is_contiguous(args[1])),
+                b.GtE(b.Mul(b.Mul(m, n), k_), b.i64(runtime_kernel_threshold)));
+            loops = b.If(use_kernel, {b.SubroutineCall(kernel, kernel_args)},
+                {loops});
+        }
+        body.push_back(al, loops);
         body.push_back(al, b.Return());
         ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
                 body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
@@ -6687,6 +6795,10 @@ namespace DotProduct {
             args.p, args.n, overload_id, ret_type, value);
     }
 
+    // Contiguous real operands with at least this many elements are
+    // reduced by the runtime kernel (`_lfortran_[sd]dot`)
+    static const int64_t runtime_kernel_threshold = 256;
+
     static inline ASR::expr_t *instantiate_DotProduct(Allocator &al,
             const Location &loc, SymbolTable *scope,
             Vec<ASR::ttype_t*> &arg_types, ASR::ttype_t *return_type,
@@ -6724,10 +6836,54 @@ namespace DotProduct {
                 b.Assignment(result, b.Add(result, EXPR(ASR::make_ComplexBinOp_t(al, loc, func_call_conjg, ASR::binopType::Mul, b.ArrayItem_01(args[1], {i}), return_type, nullptr))))
             }, nullptr));
         } else if (is_real(*return_type)) {
-            body.push_back(al, b.Assignment(result, make_ConstantWithType(make_RealConstant_t, 0.0, return_type, loc)));
-            body.push_back(al, b.DoLoop(i, b.GetLBound(args[0], 1), b.GetUBound(args[0], 1), {
+            ASR::stmt_t *init = b.Assignment(result, make_ConstantWithType(make_RealConstant_t, 0.0, return_type, loc));
+            ASR::stmt_t *loop = b.DoLoop(i, b.GetLBound(args[0], 1), b.GetUBound(args[0], 1), {
                 b.Assignment(result, b.Add(result, b.Mul(b.ArrayItem_01(args[0], {i}), b.r2r_t(b.ArrayItem_01(args[1], {i}), ASRUtils::type_get_past_array(arg_types[0])))))
-            }, nullptr));
+            }, nullptr);
+            int kind = extract_kind_from_ttype_t(return_type);
+            if (is_real(*extract_type(arg_types[0])) && is_real(*extract_type(arg_types[1]))
+                    && extract_kind_from_ttype_t(arg_types[0]) == kind
+                    && extract_kind_from_ttype_t(arg_types[1]) == kind) {
+                /*
+                 * if (is_contiguous(matrix_a) .and. is_contiguous(matrix_b) .and.
+                 *     size(matrix_a) >= threshold) then
+                 *     res = _lfortran_ddot(c_loc(matrix_a(1)), c_loc(matrix_b(1)), n)
+                 * else
+                 *     <loop>
+                 * end if
+                 */
+                std::string kernel_name = (kind == 4) ? "_lfortran_sdot" : "_lfortran_ddot";
+                Vec<ASR::ttype_t*> kernel_arg_types; kernel_arg_types.reserve(al, 3);
+                kernel_arg_types.push_back(al, b.CPtr());
+                kernel_arg_types.push_back(al, b.CPtr());
+                kernel_arg_types.push_back(al, int64);
+                ASR::symbol_t *kernel = b.create_c_func(kernel_name, fn_symtab,
+                    return_type, 3, kernel_arg_types);
+                fn_symtab->add_symbol(kernel_name, kernel);
+                dep.push_back(al, s2c(al, kernel_name));
+                ASR::expr_t *n = b.ArraySize(args[0], nullptr, int64);
+                Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 3);
+                for (ASR::expr_t *arg: {args[0], args[1], n}) {
+                    ASR::call_arg_t call_arg; call_arg.loc = loc; call_arg.m_value = arg;
+                    if (arg != n) {
+                        ASR::expr_t *item = b.ArrayItem_01(arg, {b.GetLBound(arg, 1)});
+                        call_arg.m_value = b.PointerToCPtr(EXPR(ASR::make_GetPointer_t(al, loc,
+                            item, ASRUtils::TYPE(ASR::make_Pointer_t(al, loc, expr_type(item))),
+                            nullptr)), b.CPtr());
+                    }
+                    kernel_args.push_back(al, call_arg);
+                }
+                ASR::expr_t *use_kernel = b.And(b.And(
+                    EXPR(ASR::make_ArrayIsContiguous_t(al, loc, args[0], logical, nullptr)),
+                    EXPR(ASR::make_ArrayIsContiguous_t(al, loc, args[1], logical, nullptr))),
+                    b.GtE(n, b.i64(runtime_kernel_threshold)));
+                body.push_back(al, b.If(use_kernel, {
+                    b.Assignment(result, b.Call(kernel, kernel_args, return_type, nullptr))
+                }, {init, loop}));
+            } else {
+                body.push_back(al, init);
+                body.push_back(al, loop);
+            }
         } else {
             body.push_back(al, b.Assignment(result, make_ConstantWithType(make_IntegerConstant_t, 0, return_type, loc)));
             body.push_back(al, b.DoLoop(i, b.GetLBound(args[0], 1), b.GetUBound(args[0], 1), {
@@ -6958,9 +7114,9 @@ namespace IntrinsicArrayFunctionRegistry {
         return intrinsic_function_by_id_db;
     }
 
-    inline const std::map<std::string, std::tuple<create_intrinsic_function,
+    inline const PerfectHashMap<std::tuple<create_intrinsic_function,
             eval_intrinsic_function>>& get_function_by_name_db() {
-        static const std::map<std::string, std::tuple<create_intrinsic_function,
+        static const PerfectHashMap<std::tuple<create_intrinsic_function,
                 eval_intrinsic_function>> function_by_name_db = {
         {"any", {&Any::create_Any, &Any::eval_Any}},
         {"all", {&All::create_All, &All::eval_All}},
@@ -36,6 +36,7 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
     int index_kind;
 
     public:
+    bool replaced = false;
 
     ReplaceIntrinsicFunctions(Allocator& al_, SymbolTable* global_scope_,
     std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions>& func2intrinsicid_, bool& in_debugcheck_, bool &in_ttype_,
@@ -47,6 +48,7 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
     void replace_IntrinsicElementalFunction(ASR::IntrinsicElementalFunction_t* x) {
         if (x->m_value) {
             *current_expr = x->m_value;
+            replaced = true;
             return;
         }
         // If inside DebugCheckArrayBounds and not inside a type
@@ -83,6 +85,7 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
             global_scope, arg_types, type, new_args, x->m_overload_id, index_kind);
         if (current_expr_) {
             *current_expr = current_expr_;
+            replaced = true;
         }
     }
 
@@ -90,6 +93,7 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
         std::string intrinsic_name_ = std::string(ASRUtils::get_array_intrinsic_name(x->m_arr_intrinsic_id));
         if (x->m_value) {
             *current_expr = x->m_value;
+            replaced = true;
             return;
         }
         replace_ttype(x->m_type);
@@ -122,6 +126,7 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
             global_scope, arg_types, x->m_type, new_args, x->m_overload_id, index_kind);
         ASR::expr_t* func_call = current_expr_;
         *current_expr = current_expr_;
+        replaced = true;
         bool condition = ASR::is_a<ASR::FunctionCall_t>(*func_call);
         condition = condition && ASRUtils::is_array(x->m_type);
         if (condition) {
@@ -142,6 +147,7 @@ class ReplaceIntrinsicFunctionsVisitor : public ASR::CallReplacerOnExpressionsVi
     private:
 
         ReplaceIntrinsicFunctions replacer;
+        const LCompilers::PassOptions& pass_options;
 
     public:
         bool in_debugcheck = false;
@@ -149,8 +155,9 @@ class ReplaceIntrinsicFunctionsVisitor : public ASR::CallReplacerOnExpressionsVi
 
         ReplaceIntrinsicFunctionsVisitor(Allocator& al_, SymbolTable* global_scope_,
             std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions>& func2intrinsicid_,
-            int index_kind_) :
-            replacer(al_, global_scope_, func2intrinsicid_, in_debugcheck, in_ttype, index_kind_) {}
+            int index_kind_, const LCompilers::PassOptions& pass_options_) :
+            replacer(al_, global_scope_, func2intrinsicid_, in_debugcheck, in_ttype, index_kind_),
+            pass_options(pass_options_) {}
 
         // Don't replace inside DebugCheckArrayBounds, the arguments for elemental functions might be arrays
         void visit_DebugCheckArrayBounds(const ASR::DebugCheckArrayBounds_t& x) {
@@ -169,7 +176,11 @@ class ReplaceIntrinsicFunctionsVisitor : public ASR::CallReplacerOnExpressionsVi
 
         void call_replacer() {
             replacer.current_expr = current_expr;
+            replacer.replaced = false;
             replacer.replace_expr(*current_expr);
+            if (replacer.replaced) {
+                PassUtils::report_modified(pass_options, current_scope);
+            }
         }
 
 };
@@ -329,14 +340,16 @@ class ReplaceFunctionCallReturningArrayVisitor : public ASR::CallReplacerOnExpre
         ReplaceFunctionCallReturningArray replacer;
         Vec<ASR::stmt_t*> pass_result;
         Vec<ASR::stmt_t*>* parent_body;
+        const LCompilers::PassOptions& pass_options;
 
     public:
 
         ReplaceFunctionCallReturningArrayVisitor(Allocator& al_,
-            std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions>& func2intrinsicid_) :
+            std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions>& func2intrinsicid_,
+            const LCompilers::PassOptions& pass_options_) :
         al(al_),
         replacer(al_, pass_result, func2intrinsicid_),
-        parent_body(nullptr) {
+        parent_body(nullptr), pass_options(pass_options_) {
             pass_result.n = 0;
         }
 
@@ -364,6 +377,7 @@ class ReplaceFunctionCallReturningArrayVisitor : public ASR::CallReplacerOnExpre
                 visit_stmt(*m_body[i]);
                 parent_body = parent_body_copy;
                 if( pass_result.size() > 0 ) {
+                    PassUtils::report_modified(pass_options, current_scope);
                     for (size_t j=0; j < pass_result.size(); j++) {
                         body.push_back(al, pass_result[j]);
                     }
@@ -395,9 +409,13 @@ void pass_replace_intrinsic_function(Allocator &al, ASR::TranslationUnit_t &unit
                             const LCompilers::PassOptions& pass_options) {
     int index_kind = pass_options.descriptor_index_64 ? 8 : 4;
     std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions> func2intrinsicid;
-    ReplaceIntrinsicFunctionsVisitor v(al, unit.m_symtab, func2intrinsicid, index_kind);
+    // The instantiated implementations are new global symbols, which the
+    // pass manager picks up itself
+    PassUtils::track_modified(pass_options);
+    ReplaceIntrinsicFunctionsVisitor v(al, unit.m_symtab, func2intrinsicid,
+        index_kind, pass_options);
     v.visit_TranslationUnit(unit);
-    ReplaceFunctionCallReturningArrayVisitor u(al, func2intrinsicid);
+    ReplaceFunctionCallReturningArrayVisitor u(al, func2intrinsicid, pass_options);
     u.visit_TranslationUnit(unit);
     PassUtils::UpdateDependenciesVisitor w(al);
     w.visit_TranslationUnit(unit);
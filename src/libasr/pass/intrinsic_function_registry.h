@@ -2,6 +2,7 @@
 #define LFORTRAN_PASS_INTRINSIC_FUNCTION_REGISTRY_H
 
 #include <libasr/pass/intrinsic_function_registry_util.h>
+#include <libasr/perfect_hash.h>
 
 #include <cmath>
 #include <string>
@@ -618,11 +619,9 @@ namespace IntrinsicElementalFunctionRegistry {
     }
 
 
-    inline const std::map<std::string,
-        std::tuple<create_intrinsic_function,
+    inline const PerfectHashMap<std::tuple<create_intrinsic_function,
                     eval_intrinsic_function>>& get_intrinsic_function_by_name_db() {
-        static const std::map<std::string,
-            std::tuple<create_intrinsic_function,
+        static const PerfectHashMap<std::tuple<create_intrinsic_function,
                         eval_intrinsic_function>> intrinsic_function_by_name_db = {
                 {"type", {&ObjectType::create_ObjectType, &ObjectType::eval_ObjectType}},
                 {"gamma", {&Gamma::create_Gamma, &Gamma::eval_Gamma}},
@@ -907,9 +906,9 @@ namespace IsIostatEor {
 
 namespace IntrinsicImpureFunctionRegistry {
 
-    inline const std::map<std::string, std::tuple<create_intrinsic_function,
+    inline const PerfectHashMap<std::tuple<create_intrinsic_function,
             eval_intrinsic_function>>& get_function_by_name_db() {
-        static const std::map<std::string, std::tuple<create_intrinsic_function,
+        static const PerfectHashMap<std::tuple<create_intrinsic_function,
                 eval_intrinsic_function>> function_by_name_db = {
             {"is_iostat_end", {&IsIostatEnd::create_IsIostatEnd, nullptr}},
             {"is_iostat_eor", {&IsIostatEor::create_IsIostatEor, nullptr}},
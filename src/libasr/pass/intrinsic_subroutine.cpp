@@ -33,11 +33,13 @@ class ReplaceIntrinsicSubroutines : public ASR::CallReplacerOnExpressionsVisitor
         bool remove_original_statement;
         Vec<ASR::stmt_t*> pass_result;
         Vec<ASR::stmt_t*>* parent_body;
+        const LCompilers::PassOptions& pass_options;
 
     public:
 
-        ReplaceIntrinsicSubroutines(Allocator& al_) :
-        al(al_), remove_original_statement(false) {
+        ReplaceIntrinsicSubroutines(Allocator& al_,
+            const LCompilers::PassOptions& pass_options_) :
+        al(al_), remove_original_statement(false), pass_options(pass_options_) {
             parent_body = nullptr;
             pass_result.n = 0;
         }
@@ -63,6 +65,7 @@ class ReplaceIntrinsicSubroutines : public ASR::CallReplacerOnExpressionsVisitor
             }
             ASR::stmt_t* subroutine_call = instantiate_subroutine(al, x.base.base.loc,
                 global_scope, arg_types, new_args, x.m_overload_id);
+            PassUtils::report_modified(pass_options, current_scope);
             remove_original_statement = true;
             pass_result.push_back(al, subroutine_call);
         }
@@ -178,8 +181,9 @@ class ReplaceIntrinsicSubroutines : public ASR::CallReplacerOnExpressionsVisitor
 };
 
 void pass_replace_intrinsic_subroutine(Allocator &al, ASR::TranslationUnit_t &unit,
-                             const LCompilers::PassOptions& /*pass_options*/) {
-    ReplaceIntrinsicSubroutines v(al);
+                             const LCompilers::PassOptions& pass_options) {
+    PassUtils::track_modified(pass_options);
+    ReplaceIntrinsicSubroutines v(al, pass_options);
     v.visit_TranslationUnit(unit);
     PassUtils::UpdateDependenciesVisitor u(al);
     u.visit_TranslationUnit(unit);
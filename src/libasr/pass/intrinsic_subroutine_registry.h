@@ -3,6 +3,7 @@
 
 // #include <libasr/pass/intrinsic_function_registry_util.h>
 #include <libasr/pass/intrinsic_subroutines.h>
+#include <libasr/perfect_hash.h>
 
 #include <cmath>
 #include <string>
@@ -90,10 +91,10 @@ namespace IntrinsicImpureSubroutineRegistry {
         return intrinsic_subroutine_by_id_db;
     }
 
-    inline const std::map<std::string,
-        create_intrinsic_subroutine>& get_intrinsic_subroutine_by_name_db() {
-        static const std::map<std::string,
-            create_intrinsic_subroutine> intrinsic_subroutine_by_name_db = {
+    inline const PerfectHashMap<create_intrinsic_subroutine>&
+            get_intrinsic_subroutine_by_name_db() {
+        static const PerfectHashMap<create_intrinsic_subroutine>
+            intrinsic_subroutine_by_name_db = {
                 {"random_number", &RandomNumber::create_RandomNumber},
                 {"random_init", &RandomInit::create_RandomInit},
                 {"random_seed", &RandomSeed::create_RandomSeed},
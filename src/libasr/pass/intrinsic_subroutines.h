@@ -148,81 +148,78 @@ namespace RandomSeed {
             SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
             Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/) {
 
-        std::string c_func_name_1 = "_lfortran_random_seed";
-        std::string c_func_name_2 = "_lfortran_dp_rand_num";
+        /*
+            call random_seed(size=n, put=p, get=g)
+                To
+            n = _lfortran_random_seed_size()
+            do i = 1, size(p)
+                call _lfortran_random_seed_put(i, int(p(i), 8))
+            end do
+            do i = 1, size(g)
+                g(i) = _lfortran_random_seed_get(i)
+            end do
+        */
+        std::string c_func_size = "_lfortran_random_seed_size";
+        std::string c_func_put = "_lfortran_random_seed_put";
+        std::string c_func_get = "_lfortran_random_seed_get";
         std::string new_name = "_lcompilers_random_seed_";
         declare_basic_variables(new_name);
-        int flag = 0;
         if (!is_real(*arg_types[0])) {
             fill_func_arg_sub("size", arg_types[0], Out);
-            ASR::symbol_t *s_1 = b.create_c_func_subroutines(c_func_name_1, fn_symtab, 1, arg_types[0]);
-            fn_symtab->add_symbol(c_func_name_1, s_1);
-            dep.push_back(al, s2c(al, c_func_name_1));
+            Vec<ASR::ttype_t*> no_args; no_args.reserve(al, 1);
+            ASR::symbol_t *s_size = b.create_c_func(c_func_size, fn_symtab, int32, 0, no_args);
+            fn_symtab->add_symbol(c_func_size, s_size);
+            dep.push_back(al, s2c(al, c_func_size));
             Vec<ASR::expr_t*> call_args; call_args.reserve(al, 1);
-            call_args.push_back(al, b.i32(8));
-            body.push_back(al, b.Assignment(args[0], b.Call(s_1, call_args, arg_types[0])));
+            ASR::expr_t* size = b.Call(s_size, call_args, int32);
+            if (ASRUtils::extract_kind_from_ttype_t(arg_types[0]) != 4) {
+                size = b.i2i_t(size, arg_types[0]);
+            }
+            body.push_back(al, b.Assignment(args[0], size));
         } else {
             fill_func_arg_sub("size", real32, In);
         }
         if (!is_real(*arg_types[1])) {
-            flag = 1;
             ASR::ttype_t* put_type = ASRUtils::duplicate_type_with_empty_dims(al, arg_types[1]);
             fill_func_arg_sub("put", put_type, In);
-            ASR::ttype_t* elem_type = ASRUtils::type_get_past_array(
-                ASRUtils::type_get_past_allocatable(arg_types[1]));
-            if (fn_symtab->get_symbol(c_func_name_1) == nullptr) {
-                ASR::symbol_t *s_seed = b.create_c_func_subroutines(
-                    c_func_name_1, fn_symtab, 1, elem_type);
-                fn_symtab->add_symbol(c_func_name_1, s_seed);
-                dep.push_back(al, s2c(al, c_func_name_1));
+            Vec<ASR::ttype_t*> parameter_types; parameter_types.reserve(al, 2);
+            parameter_types.push_back(al, int32);
+            parameter_types.push_back(al, int64);
+            ASR::symbol_t *s_put = b.create_c_subroutine_interface(c_func_put,
+                fn_symtab, parameter_types, {"i", "v"}, {true, true});
+            fn_symtab->add_symbol(c_func_put, s_put);
+            dep.push_back(al, s2c(al, c_func_put));
+            ASR::expr_t* i = declare("i_put", int32, Local);
+            ASR::expr_t* v = b.ArrayItem_01(args[1], {i});
+            if (ASRUtils::extract_kind_from_ttype_t(arg_types[1]) != 8) {
+                v = b.i2i_t(v, int64);
             }
-            std::vector<ASR::expr_t*> idx = {b.i32(1)};
-            auto seed_elem = declare("_seed_elem", elem_type, Local);
-            body.push_back(al, b.Assignment(seed_elem,
-                b.ArrayItem_01(args[1], idx)));
-            Vec<ASR::expr_t*> put_call_args; put_call_args.reserve(al, 1);
-            put_call_args.push_back(al, seed_elem);
-            auto seed_discard = declare("_seed_val", elem_type, Local);
-            body.push_back(al, b.Assignment(seed_discard,
-                b.Call(fn_symtab->get_symbol(c_func_name_1),
-                    put_call_args, elem_type)));
+            Vec<ASR::call_arg_t> call_args; call_args.reserve(al, 2);
+            call_args.push_back(al, {loc, i});
+            call_args.push_back(al, {loc, v});
+            body.push_back(al, b.DoLoop(i, b.i32(1), b.ArraySize(args[1], nullptr, int32),
+                {b.SubroutineCall(s_put, call_args)}));
         } else {
             fill_func_arg_sub("put", real32, In);
         }
         if (!is_real(*arg_types[2])) {
             ASR::ttype_t* get_type = ASRUtils::duplicate_type_with_empty_dims(al, arg_types[2]);
             fill_func_arg_sub("get", get_type, Out);
-            if (flag == 1) {
-                body.push_back(al, b.Assignment(args[2], args[1]));
-            } else {
-                std::vector<LCompilers::ASR::expr_t *> vals;
-                std::string c_func = c_func_name_2;
-                int kind = ASRUtils::extract_kind_from_ttype_t(arg_types[2]);
-                if ( is_real(*arg_types[2]) ) {
-                    if (kind == 4) {
-                        c_func = "_lfortran_sp_rand_num";
-                    } else {
-                        c_func = "_lfortran_dp_rand_num";
-                    }
-                } else if ( is_integer(*arg_types[2]) ) {
-                    if (kind == 4) {
-                        c_func = "_lfortran_int32_rand_num";
-                    } else {
-                        c_func = "_lfortran_int64_rand_num";
-                    }
-                }
-                ASR::symbol_t *s_2 = b.create_c_func_subroutines(c_func, fn_symtab, 0, arg_types[2]);
-                fn_symtab->add_symbol(c_func, s_2);
-                dep.push_back(al, s2c(al, c_func));
-                Vec<ASR::expr_t*> call_args2; call_args2.reserve(al, 0);
-                ASR::ttype_t* elem_type = extract_type(arg_types[2]);
-                for (int i = 0; i < 8; i++) {
-                    auto xx = declare("i_" + std::to_string(i), elem_type, Local);
-                    body.push_back(al, b.Assignment(xx, b.Call(s_2, call_args2, int32)));
-                    vals.push_back(xx);
-                }
-                body.push_back(al, b.Assignment(args[2], b.ArrayConstant(vals, extract_type(arg_types[2]), false)));
+            Vec<ASR::ttype_t*> get_arg_types; get_arg_types.reserve(al, 1);
+            get_arg_types.push_back(al, int32);
+            ASR::symbol_t *s_get = b.create_c_func(c_func_get, fn_symtab, int32, 1, get_arg_types);
+            fn_symtab->add_symbol(c_func_get, s_get);
+            dep.push_back(al, s2c(al, c_func_get));
+            ASR::expr_t* i = declare("i_get", int32, Local);
+            Vec<ASR::expr_t*> call_args; call_args.reserve(al, 1);
+            call_args.push_back(al, i);
+            ASR::expr_t* word = b.Call(s_get, call_args, int32);
+            ASR::ttype_t* elem_type = ASRUtils::extract_type(arg_types[2]);
+            if (ASRUtils::extract_kind_from_ttype_t(elem_type) != 4) {
+                word = b.i2i_t(word, elem_type);
             }
+            body.push_back(al, b.DoLoop(i, b.i32(1), b.ArraySize(args[2], nullptr, int32),
+                {b.Assignment(b.ArrayItem_01(args[2], {i}), word)}));
         } else {
             fill_func_arg_sub("get", real32, In);
         }
@@ -307,6 +304,27 @@ namespace RandomNumber {
         return ASR::make_IntrinsicImpureSubroutine_t(al, loc, static_cast<int64_t>(IntrinsicImpureSubroutines::RandomNumber), m_args.p, m_args.n, 0);
     }
 
+    // Whether `x` is a whole array that is always contiguous, so that it
+    // can be filled in memory order
+    static inline bool is_contiguous_array(ASR::expr_t *x) {
+        x = ASRUtils::get_past_array_physical_cast(x);
+        if (!ASR::is_a<ASR::Var_t>(*x)) return false;
+        ASR::symbol_t *sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(x)->m_v);
+        if (!ASR::is_a<ASR::Variable_t>(*sym)) return false;
+        ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(sym);
+        if (!ASRUtils::is_array(v->m_type) || ASRUtils::is_pointer(v->m_type)) {
+            return false;
+        }
+        if (ASRUtils::is_allocatable(v->m_type) || v->m_contiguous_attr) {
+            return true;
+        }
+        ASR::array_physical_typeType physical_type =
+            ASRUtils::extract_physical_type(v->m_type);
+        return physical_type == ASR::array_physical_typeType::FixedSizeArray ||
+            physical_type == ASR::array_physical_typeType::PointerArray;
+    }
+
     static inline ASR::stmt_t* instantiate_RandomNumber(Allocator &al, const Location &loc,
             SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
             Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/) {
@@ -321,11 +339,65 @@ namespace RandomNumber {
 
         declare_basic_variables(new_name);
         fill_func_arg_sub("r", ASRUtils::duplicate_type_with_empty_dims(al, arg_types[0]), Out);
+        ASR::ttype_t *element_type = ASRUtils::type_get_past_array(
+            ASRUtils::type_get_past_allocatable(arg_types[0]));
+
+        if (ASRUtils::is_array(arg_types[0]) &&
+                is_contiguous_array(new_args[0].m_value)) {
+            /*
+                real :: b(3)
+                call random_number(b)
+                    To
+                real :: b(3)
+                if (size(b, kind=8) > 0) then
+                    call _lfortran_sp_random_fill(size(b, kind=8), b(1))
+                end if
+                The runtime fills the elements in memory order with the
+                numbers that the loop below would draw, keeping the
+                generator state in registers
+            */
+            std::string fill_name = kind == 4 ? "_lfortran_sp_random_fill"
+                : "_lfortran_dp_random_fill";
+            SymbolTable *fill_symtab = al.make_new<SymbolTable>(fn_symtab);
+            Vec<ASR::expr_t*> fill_args; fill_args.reserve(al, 2);
+            fill_args.push_back(al, b.Variable(fill_symtab, "n", int64,
+                ASR::intentType::In, nullptr, ASR::abiType::BindC, true));
+            fill_args.push_back(al, b.Variable(fill_symtab, "v", element_type,
+                ASR::intentType::Out, nullptr, ASR::abiType::BindC, false));
+            SetChar fill_dep; fill_dep.reserve(al, 1);
+            Vec<ASR::stmt_t*> fill_body; fill_body.reserve(al, 1);
+            ASR::symbol_t *fill = make_ASR_Function_t(fill_name, fill_symtab,
+                fill_dep, fill_args, fill_body, nullptr, ASR::abiType::BindC,
+                ASR::deftypeType::Interface, s2c(al, fill_name));
+            fn_symtab->add_symbol(fill_name, fill);
+            dep.push_back(al, s2c(al, fill_name));
+
+            // The first element is passed by reference
+            ASR::expr_t *size = b.ArraySize(args[0], nullptr, int64);
+            std::vector<ASR::expr_t*> first;
+            int rank = ASRUtils::extract_n_dims_from_ttype(arg_types[0]);
+            for (int i = 0; i < rank; i++) {
+                first.push_back(b.ArrayLBound(args[0], i + 1));
+            }
+            Vec<ASR::call_arg_t> call_args; call_args.reserve(al, 2);
+            ASR::call_arg_t size_arg; size_arg.loc = loc; size_arg.m_value = size;
+            call_args.push_back(al, size_arg);
+            ASR::call_arg_t first_arg; first_arg.loc = loc;
+            first_arg.m_value = b.ArrayItem_01(args[0], first);
+            call_args.push_back(al, first_arg);
+            body.push_back(al, b.If(b.Gt(size, b.i64(0)),
+                {b.SubroutineCall(fill, call_args)}, {}));
+
+            ASR::symbol_t *new_symbol = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+            scope->add_symbol(fn_name, new_symbol);
+            return b.SubroutineCall(new_symbol, new_args);
+        }
+
         SymbolTable *fn_symtab_1 = al.make_new<SymbolTable>(fn_symtab);
         Vec<ASR::expr_t*> args_1; args_1.reserve(al, 0);
         ASR::expr_t *return_var_1 = b.Variable(fn_symtab_1, c_func_name,
-           ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(arg_types[0])),
-           ASRUtils::intent_return_var, nullptr, ASR::abiType::BindC, false);
+           element_type, ASRUtils::intent_return_var, nullptr, ASR::abiType::BindC, false);
         SetChar dep_1; dep_1.reserve(al, 1);
         Vec<ASR::stmt_t*> body_1; body_1.reserve(al, 1);
         ASR::symbol_t *s = make_ASR_Function_t(c_func_name, fn_symtab_1, dep_1, args_1,
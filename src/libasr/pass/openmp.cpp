@@ -1,4 +1,5 @@
 #include <limits.h>
+#include <tuple>
 #include <libasr/asr.h>
 #include <libasr/containers.h>
 #include <libasr/exception.h>
@@ -1037,10 +1038,10 @@ class ParallelRegionVisitor :
                         break;
                     }
                     case ASR::reduction_opType::ReduceMAX : {
-                        if (ASRUtils::is_integer(*ASRUtils::expr_type(red.m_arg))) {
-                            body.push_back(al, b.Assignment(red.m_arg, b.i_t(INT_MIN, ASRUtils::expr_type(red.m_arg))));
-                        } else if (ASRUtils::is_real(*ASRUtils::expr_type(red.m_arg))) {
-                            body.push_back(al, b.Assignment(red.m_arg, b.f_t(std::numeric_limits<double>::min(), ASRUtils::expr_type(red.m_arg))));
+                        if (ASRUtils::is_integer(*ASRUtils::expr_type(red.m_arg))
+                                || ASRUtils::is_real(*ASRUtils::expr_type(red.m_arg))) {
+                            // -huge() of the variable's own kind
+                            body.push_back(al, b.Assignment(red.m_arg, ASRUtils::get_minimum_value_with_given_type(al, ASRUtils::expr_type(red.m_arg))));
                         } else {
                             // handle other types
                             LCOMPILERS_ASSERT(false);
@@ -1048,10 +1049,10 @@ class ParallelRegionVisitor :
                         break;
                     }
                     case ASR::reduction_opType::ReduceMIN : {
-                        if (ASRUtils::is_integer(*ASRUtils::expr_type(red.m_arg))) {
-                            body.push_back(al, b.Assignment(red.m_arg, b.i_t(INT_MAX, ASRUtils::expr_type(red.m_arg))));
-                        } else if (ASRUtils::is_real(*ASRUtils::expr_type(red.m_arg))) {
-                            body.push_back(al, b.Assignment(red.m_arg, b.f_t(std::numeric_limits<double>::max(), ASRUtils::expr_type(red.m_arg))));
+                        if (ASRUtils::is_integer(*ASRUtils::expr_type(red.m_arg))
+                                || ASRUtils::is_real(*ASRUtils::expr_type(red.m_arg))) {
+                            // huge() of the variable's own kind
+                            body.push_back(al, b.Assignment(red.m_arg, ASRUtils::get_maximum_value_with_given_type(al, ASRUtils::expr_type(red.m_arg))));
                         } else {
                             // handle other types
                             LCOMPILERS_ASSERT(false);
@@ -1113,57 +1114,21 @@ class ParallelRegionVisitor :
             body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc, current_scope->get_symbol("gomp_barrier"), nullptr, nullptr, 0, nullptr, false)));
 
             /*
-                handle reduction variables if any then:
-                call gomp_atomic_start()
-                => perform atomic operation
-                call gomp_atomic_end()
+                handle reduction variables if any then combine each thread's
+                partial result into thread_data, lock-free where possible
+                (see `reduction_combine`)
             */
-            if (do_loop.n_reduction > 0) {
-                body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                        current_scope->get_symbol("gomp_atomic_start"), nullptr, nullptr, 0, nullptr, false)));
-            }
+            std::vector<std::tuple<ASR::reduction_opType, ASR::expr_t*, ASR::expr_t*>> reductions;
             for ( size_t i = 0; i < do_loop.n_reduction; i++ ) {
                 ASR::reduction_expr_t red = do_loop.m_reduction[i];
                 ASR::symbol_t* red_sym = current_scope->get_symbol(std::string(ASRUtils::symbol_name(thread_data_sym)) + "_" + std::string(ASRUtils::symbol_name(ASR::down_cast<ASR::Var_t>(red.m_arg)->m_v)));
                 ASR::expr_t* lhs = ASRUtils::EXPR(ASR::make_StructInstanceMember_t(al, loc, tdata_expr, red_sym, ASRUtils::symbol_type(red_sym), nullptr));
-
-                switch (red.m_op) {
-                    case ASR::reduction_opType::ReduceAdd : {
-                        body.push_back(al, b.Assignment(lhs, b.Add(lhs, red.m_arg)));
-                        break;
-                    }
-                    case ASR::reduction_opType::ReduceSub : {
-                        body.push_back(al, b.Assignment(lhs, b.Sub(lhs, red.m_arg)));
-                        break;
-                    }
-                    case ASR::reduction_opType::ReduceMul : {
-                        body.push_back(al, b.Assignment(lhs, b.Mul(lhs, red.m_arg)));
-                        break;
-                    }
-                    case ASR::reduction_opType::ReduceMAX : {
-                        body.push_back(al, b.If(b.Lt(lhs, red.m_arg), {
-                            b.Assignment(lhs, red.m_arg)
-                        }, {
-                            // do nothing
-                        }));
-                        break;
-                    }
-                    case ASR::reduction_opType::ReduceMIN : {
-                        body.push_back(al, b.If(b.Gt(lhs, red.m_arg), {
-                            b.Assignment(lhs, red.m_arg)
-                        }, {
-                            // do nothing
-                        }));
-                        break;
-                    }
-                    default : {
-                        LCOMPILERS_ASSERT(false);
-                    }
-                }
+                reductions.push_back({red.m_op, lhs, red.m_arg});
             }
-            if (do_loop.n_reduction > 0) {
-                body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                        current_scope->get_symbol("gomp_atomic_end"), nullptr, nullptr, 0, nullptr, false)));
+            std::vector<ASR::stmt_t*> combine_body;
+            reduction_combine(reductions, loc, combine_body);
+            for (auto &stmt: combine_body) {
+                body.push_back(al, stmt);
             }
 
             ASR::symbol_t* function = ASR::down_cast<ASR::symbol_t>(ASRUtils::make_Function_t_util(al, loc, current_scope, s2c(al, current_scope->parent->get_unique_name("lcompilers_function")),
@@ -1180,6 +1145,125 @@ class ParallelRegionVisitor :
             return function;
         }
 
+        // Combines a thread's partial value `rhs` into the shared `lhs`; the
+        // caller has to guard it with gomp_atomic_start()/gomp_atomic_end()
+        ASR::stmt_t* locked_reduction_combine(ASR::reduction_opType op,
+                ASR::expr_t* lhs, ASR::expr_t* rhs, const Location &loc) {
+            ASRUtils::ASRBuilder b(al, loc);
+            switch (op) {
+                case ASR::reduction_opType::ReduceAdd:
+                    return b.Assignment(lhs, b.Add(lhs, rhs));
+                case ASR::reduction_opType::ReduceSub:
+                    return b.Assignment(lhs, b.Sub(lhs, rhs));
+                case ASR::reduction_opType::ReduceMul:
+                    return b.Assignment(lhs, b.Mul(lhs, rhs));
+                case ASR::reduction_opType::ReduceMAX:
+                    return b.If(b.Lt(lhs, rhs), {b.Assignment(lhs, rhs)}, {});
+                case ASR::reduction_opType::ReduceMIN:
+                    return b.If(b.Gt(lhs, rhs), {b.Assignment(lhs, rhs)}, {});
+                default:
+                    throw LCompilersException("Unsupported reduction operation");
+            }
+        }
+
+        /*
+            Same as `locked_reduction_combine`, but without the global lock:
+            for integer and real scalars of kind 4 and 8 the combine is a
+            compare-and-swap loop in the runtime, e.g.
+
+            call _lfortran_atomic_reduce_add_f64(thread_data%x, x)
+
+            Returns nullptr for anything else (complex, other kinds, arrays),
+            in which case the caller falls back to the locked combine.
+        */
+        ASR::stmt_t* atomic_reduction_combine(ASR::reduction_opType op,
+                ASR::expr_t* lhs, ASR::expr_t* rhs, const Location &loc) {
+            ASRUtils::ASRBuilder b(al, loc);
+            ASR::ttype_t* type = ASRUtils::expr_type(lhs);
+            if (ASRUtils::is_array(type) || ASRUtils::is_pointer(type)) {
+                return nullptr;
+            }
+            int kind = ASRUtils::extract_kind_from_ttype_t(type);
+            if (kind != 4 && kind != 8) {
+                return nullptr;
+            }
+            std::string suffix;
+            if (ASRUtils::is_integer(*type)) {
+                suffix = "i" + std::to_string(kind * 8);
+            } else if (ASRUtils::is_real(*type)) {
+                suffix = "f" + std::to_string(kind * 8);
+            } else {
+                return nullptr;
+            }
+            std::string op_name;
+            switch (op) {
+                case ASR::reduction_opType::ReduceAdd:
+                    op_name = "add";
+                    break;
+                case ASR::reduction_opType::ReduceSub:
+                    // lhs - rhs == lhs + (-rhs)
+                    op_name = "add";
+                    rhs = b.Sub(b.constant_t(0.0, type), rhs);
+                    break;
+                case ASR::reduction_opType::ReduceMul:
+                    op_name = "mul";
+                    break;
+                case ASR::reduction_opType::ReduceMAX:
+                    op_name = "max";
+                    break;
+                case ASR::reduction_opType::ReduceMIN:
+                    op_name = "min";
+                    break;
+                default:
+                    return nullptr;
+            }
+            std::string fn_name = "_lfortran_atomic_reduce_" + op_name + "_" + suffix;
+            ASR::symbol_t* fn = current_scope->get_symbol(fn_name);
+            if (fn == nullptr) {
+                Vec<ASR::ttype_t*> arg_types; arg_types.reserve(al, 2);
+                arg_types.push_back(al, type);
+                arg_types.push_back(al, type);
+                fn = b.create_c_subroutine_interface(fn_name, current_scope,
+                    arg_types, {"x", "v"}, {false, true});
+                current_scope->add_symbol(fn_name, fn);
+            }
+            Vec<ASR::call_arg_t> call_args; call_args.reserve(al, 2);
+            ASR::call_arg_t arg;
+            arg.loc = loc; arg.m_value = lhs;
+            call_args.push_back(al, arg);
+            arg.loc = loc; arg.m_value = rhs;
+            call_args.push_back(al, arg);
+            return ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc, fn, nullptr,
+                call_args.p, call_args.n, nullptr, false));
+        }
+
+        // Emits the combine of every reduction variable into `body`. Lock-free
+        // combines go first; whatever is left is serialized by the GOMP lock.
+        void reduction_combine(const std::vector<std::tuple<ASR::reduction_opType,
+                ASR::expr_t*, ASR::expr_t*>> &reductions, const Location &loc,
+                std::vector<ASR::stmt_t*> &body) {
+            std::vector<ASR::stmt_t*> locked;
+            for (auto &red: reductions) {
+                ASR::reduction_opType op = std::get<0>(red);
+                ASR::expr_t* lhs = std::get<1>(red);
+                ASR::expr_t* rhs = std::get<2>(red);
+                ASR::stmt_t* combine = atomic_reduction_combine(op, lhs, rhs, loc);
+                if (combine != nullptr) {
+                    body.push_back(combine);
+                } else {
+                    locked.push_back(locked_reduction_combine(op, lhs, rhs, loc));
+                }
+            }
+            if (locked.empty()) {
+                return;
+            }
+            body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
+                current_scope->get_symbol("gomp_atomic_start"), nullptr, nullptr, 0, nullptr, false)));
+            body.insert(body.end(), locked.begin(), locked.end());
+            body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
+                current_scope->get_symbol("gomp_atomic_end"), nullptr, nullptr, 0, nullptr, false)));
+        }
+
         ASR::ttype_t* f_type_to_c_type(ASR::ttype_t* /*f_type*/) {
             // populate it when required
             // right now in ASR `integer(c_int) :: n` is represented same as `integer :: n`
@@ -2326,19 +2410,19 @@ class ParallelRegionVisitor :
                             nested_lowered_body.push_back(b.Assignment(red, b.constant_t(1.0, red_type)));
                             break;
                         case ASR::reduction_opType::ReduceMAX:
-                            if (ASRUtils::is_integer(*red_type)) {
-                                nested_lowered_body.push_back(b.Assignment(red, b.i_t(INT_MIN, red_type)));
-                            } else if (ASRUtils::is_real(*red_type)) {
-                                nested_lowered_body.push_back(b.Assignment(red, b.f_t(std::numeric_limits<double>::min(), red_type)));
+                            if (ASRUtils::is_integer(*red_type) || ASRUtils::is_real(*red_type)) {
+                                // -huge() of the variable's own kind
+                                nested_lowered_body.push_back(b.Assignment(red,
+                                    ASRUtils::get_minimum_value_with_given_type(al, red_type)));
                             } else {
                                 throw LCompilersException("Unsupported type for MAX reduction");
                             }
                             break;
                         case ASR::reduction_opType::ReduceMIN:
-                            if (ASRUtils::is_integer(*red_type)) {
-                                nested_lowered_body.push_back(b.Assignment(red, b.i_t(INT_MAX, red_type)));
-                            } else if (ASRUtils::is_real(*red_type)) {
-                                nested_lowered_body.push_back(b.Assignment(red, b.f_t(std::numeric_limits<double>::max(), red_type)));
+                            if (ASRUtils::is_integer(*red_type) || ASRUtils::is_real(*red_type)) {
+                                // huge() of the variable's own kind
+                                nested_lowered_body.push_back(b.Assignment(red,
+                                    ASRUtils::get_maximum_value_with_given_type(al, red_type)));
                             } else {
                                 throw LCompilersException("Unsupported type for MIN reduction");
                             }
@@ -2351,45 +2435,18 @@ class ParallelRegionVisitor :
         }
 
         void handle_reduction_vars(Vec<ASR::OMPReduction_t*> reduction_clauses, const LCompilers::Location &loc) {
-            ASRUtils::ASRBuilder b(al,loc);
             nested_lowered_body={};
-            if (reduction_clauses.size() > 0) {
-                nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                    current_scope->get_symbol("gomp_atomic_start"), nullptr, nullptr, 0, nullptr, false)));
-                for(size_t j=0; j<reduction_clauses.size(); j++) {
-                    for (size_t i = 0; i < reduction_clauses[j]->n_vars; i++) {
+            std::vector<std::tuple<ASR::reduction_opType, ASR::expr_t*, ASR::expr_t*>> reductions;
+            for(size_t j=0; j<reduction_clauses.size(); j++) {
+                for (size_t i = 0; i < reduction_clauses[j]->n_vars; i++) {
                     ASR::expr_t* red = reduction_clauses[j]->m_vars[i];
                     std::string red_var_name = ASRUtils::symbol_name(ASR::down_cast<ASR::Var_t>(red)->m_v);
                     ASR::symbol_t* red_sym = current_scope->get_symbol(std::string(ASRUtils::symbol_name(thread_data_sym_copy)) + "_" + red_var_name);
                     ASR::expr_t* lhs = ASRUtils::EXPR(ASR::make_StructInstanceMember_t(al, loc, tdata_expr_copy, red_sym, ASRUtils::symbol_type(red_sym), nullptr));
-                    switch (reduction_clauses[j]->m_operator) {
-                        case ASR::reduction_opType::ReduceAdd:
-                            nested_lowered_body.push_back(b.Assignment(lhs, b.Add(lhs, red)));
-                            break;
-                        case ASR::reduction_opType::ReduceSub:
-                            nested_lowered_body.push_back(b.Assignment(lhs, b.Sub(lhs, red)));
-                            break;
-                        case ASR::reduction_opType::ReduceMul:
-                            nested_lowered_body.push_back(b.Assignment(lhs, b.Mul(lhs, red)));
-                            break;
-                        case ASR::reduction_opType::ReduceMAX:
-                            nested_lowered_body.push_back(b.If(b.Lt(lhs, red),
-                                {b.Assignment(lhs, red)},
-                                {}));
-                            break;
-                        case ASR::reduction_opType::ReduceMIN:
-                            nested_lowered_body.push_back(b.If(b.Gt(lhs, red),
-                                {b.Assignment(lhs, red)},
-                                {}));
-                            break;
-                        default:
-                            throw LCompilersException("Unsupported reduction operation");
-                    }
+                    reductions.push_back({reduction_clauses[j]->m_operator, lhs, red});
                 }
-                }
-                nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                    current_scope->get_symbol("gomp_atomic_end"), nullptr, nullptr, 0, nullptr, false)));
             }
+            reduction_combine(reductions, loc, nested_lowered_body);
         }
 
         // Create outlined function for parallel region
@@ -2582,6 +2639,11 @@ class ParallelRegionVisitor :
 
                 case ASR::omp_region_typeType::Atomic:
                 visit_OMPAtomic(x);
+                break;
+
+                case ASR::omp_region_typeType::Simd:
+                visit_OMPSimd(x);
+                break;
 
                 default:
                     // for now give error for constructs which we do not support
@@ -3539,6 +3601,25 @@ class ParallelRegionVisitor :
             clauses_heirarchial[nesting_lvl].clear();
         }
 
+        /*
+            `simd` needs no runtime support, the region is kept around its
+            loop and the backend turns it into vectorization hints. Inside
+            an outlined parallel region the body is still rewritten to use
+            the outlined function's variables.
+        */
+        void visit_OMPSimd(const ASR::OMPRegion_t &x) {
+            nested_lowered_body = {};
+            if (nesting_lvl > 1) {
+                Vec<ASR::stmt_t*> simd_body;
+                simd_body.reserve(al, x.n_body);
+                visit_OMPBody(&x, simd_body);
+                nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_OMPRegion_t(al,
+                    x.base.base.loc, x.m_region, x.m_clauses, x.n_clauses,
+                    simd_body.p, simd_body.n)));
+            }
+            clauses_heirarchial[nesting_lvl].clear();
+        }
+
         void visit_OMPBarrier(const ASR::OMPRegion_t &x) {
             nested_lowered_body = {};
             Location loc = x.base.base.loc;
@@ -62,6 +62,7 @@
 #include <libasr/codegen/asr_to_fortran.h>
 #include <libasr/asr_verify.h>
 #include <libasr/pickle.h>
+#include <libasr/time_trace.h>
 
 #include <map>
 #include <vector>
@@ -73,13 +74,28 @@ namespace LCompilers {
     typedef void (*pass_function)(Allocator&, ASR::TranslationUnit_t&,
                                   const LCompilers::PassOptions&);
 
+    // Gives the passes of one pipeline run a fresh PassState
+    class PassStateScope {
+        PassOptions &pass_options;
+        PassState *previous;
+        PassState state;
+    public:
+        PassStateScope(PassOptions &pass_options) : pass_options{pass_options},
+                previous{pass_options.pass_state} {
+            pass_options.pass_state = &state;
+        }
+        PassStateScope(const PassStateScope&) = delete;
+        PassStateScope& operator=(const PassStateScope&) = delete;
+        ~PassStateScope() { pass_options.pass_state = previous; }
+    };
+
     class PassManager {
         private:
 
         std::vector<std::string> _passes;
         std::vector<std::string> _optimization_passes;
         std::vector<std::string> _user_defined_passes;
-        std::vector<std::string> _skip_passes, _c_skip_passes;
+        std::vector<std::string> _skip_passes, _c_skip_passes, _mlir_skip_passes;
         std::map<std::string, pass_function> _passes_db = {
             {"replace_with_compile_time_values", &pass_replace_with_compile_time_values},
             {"do_loops", &pass_replace_do_loops},
@@ -124,6 +140,7 @@ namespace LCompilers {
 
         bool apply_default_passes;
         bool c_skip_pass; // This will contain the passes that are to be skipped in C
+        bool mlir_skip_pass; // Skip the passes in `_mlir_skip_passes`
 
         public:
         // This should be removed after a refactor to `pass_manager.h` (This action should be done using more flexible function)
@@ -169,6 +186,11 @@ namespace LCompilers {
                         passes.push_back(_with_optimization_passes[i]);
                 }
             }
+#if defined(WITH_LFORTRAN_ASSERT)
+            std::vector<std::string> unverified_passes;
+            int unchecked_passes = 0;
+#endif
+            PassStateScope pass_state(pass_options);
             for (size_t i = 0; i < passes.size(); i++) {
                 // TODO: rework the whole pass manager: construct the passes
                 // ahead of time (not at the last minute), and remove this much
@@ -182,18 +204,31 @@ namespace LCompilers {
                 if (c_skip_pass && std::find(_c_skip_passes.begin(),
                         _c_skip_passes.end(), passes[i]) != _c_skip_passes.end())
                     continue;
+                if (mlir_skip_pass && std::find(_mlir_skip_passes.begin(),
+                        _mlir_skip_passes.end(), passes[i]) != _mlir_skip_passes.end())
+                    continue;
                 if (pass_options.verbose) {
                     std::cerr << "ASR Pass starts: '" << passes[i] << "'\n";
                 }
                 auto t1 = std::chrono::high_resolution_clock::now();
-                _passes_db[passes[i]](al, *asr, pass_options);
+                {
+                    TimeTraceScope trace(pass_options.time_trace, "Pass",
+                        passes[i], &al);
 #if defined(WITH_LFORTRAN_ASSERT)
-                if (!asr_verify(*asr, true, diagnostics)) {
-                    std::cerr << diagnostics.render2();
-                    throw LCompilersException("Verify failed in the pass: "
-                        + passes[i]);
-                };
+                    ModifiedSymbols modified;
+                    pass_options.modified_symbols = &modified;
+                    std::map<std::string, ASR::symbol_t*> globals_before(
+                        asr->m_symtab->get_scope().begin(),
+                        asr->m_symtab->get_scope().end());
+#endif
+                    _passes_db[passes[i]](al, *asr, pass_options);
+#if defined(WITH_LFORTRAN_ASSERT)
+                    pass_options.modified_symbols = nullptr;
+                    collect_global_changes(*asr, globals_before, modified);
+                    verify_after_pass(*asr, passes[i], modified, pass_options,
+                        diagnostics, unverified_passes, unchecked_passes);
 #endif
+                }
                 auto t2 = std::chrono::high_resolution_clock::now();
                 if (pass_options.time_report) {
                     int time_taken_by_current_pass = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
@@ -205,14 +240,85 @@ namespace LCompilers {
                         message = "[PASS]" + passes[i] + ": " + std::to_string(time_in_milliseconds) + " ms";
                     }
                     pass_options.vector_of_time_report.push_back(message);
+                    pass_options.pass_times.push_back({passes[i],
+                        time_taken_by_current_pass});
                     cummulative_time_taken_by_passes_in_microseconds += (double) std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
                 }
                 if (pass_options.verbose) {
                     std::cerr << "ASR Pass ends: '" << passes[i] << "'\n";
                 }
             }
+#if defined(WITH_LFORTRAN_ASSERT)
+            if (!unverified_passes.empty()) {
+                verify_unit(*asr, diagnostics, unverified_passes);
+            }
+#endif
         }
 
+#if defined(WITH_LFORTRAN_ASSERT)
+        void verify_unit(ASR::TranslationUnit_t &asr,
+                diag::Diagnostics &diagnostics,
+                std::vector<std::string> &unverified_passes) {
+            if (!asr_verify(asr, true, diagnostics)) {
+                std::cerr << diagnostics.render2();
+                std::string names;
+                for (auto &pass: unverified_passes) {
+                    if (!names.empty()) names += ", ";
+                    names += pass;
+                }
+                throw LCompilersException("Verify failed in the pass: "
+                    + names);
+            }
+            unverified_passes.clear();
+        }
+
+        // Global symbols that a reporting pass added or replaced, such as
+        // instantiated intrinsic implementations, are verified with the ones
+        // it reported. Removing a global symbol needs a full verify.
+        void collect_global_changes(ASR::TranslationUnit_t &asr,
+                const std::map<std::string, ASR::symbol_t*> &globals_before,
+                ModifiedSymbols &modified) {
+            if (!modified.reported) return;
+            size_t kept = 0;
+            for (auto &a : asr.m_symtab->get_scope()) {
+                auto it = globals_before.find(a.first);
+                if (it == globals_before.end() || it->second != a.second) {
+                    modified.names.insert(a.first);
+                }
+                if (it != globals_before.end()) kept++;
+            }
+            if (kept != globals_before.size()) modified.reported = false;
+        }
+
+        // Passes that report what they modified only get those symbols
+        // re-verified, or nothing if they changed nothing. The whole unit is
+        // verified after every `verify_interval` other passes, and at the end
+        // if any pass changed it since the last full verify, which catches
+        // references into the modified symbols from ones that were not
+        // re-verified.
+        void verify_after_pass(ASR::TranslationUnit_t &asr,
+                const std::string &pass, ModifiedSymbols &modified,
+                const PassOptions &pass_options, diag::Diagnostics &diagnostics,
+                std::vector<std::string> &unverified_passes,
+                int &unchecked_passes) {
+            if (modified.reported) {
+                if (modified.names.empty()) return;
+                if (!asr_verify(asr, modified.names, true, diagnostics)) {
+                    std::cerr << diagnostics.render2();
+                    throw LCompilersException("Verify failed in the pass: "
+                        + pass);
+                }
+                unverified_passes.push_back(pass);
+                return;
+            }
+            unverified_passes.push_back(pass);
+            if (++unchecked_passes >= pass_options.verify_interval) {
+                verify_unit(asr, diagnostics, unverified_passes);
+                unchecked_passes = 0;
+            }
+        }
+#endif
+
         void _parse_pass_arg(std::string& arg, std::vector<std::string>& passes) {
             if (arg == "") return;
 
@@ -239,7 +345,7 @@ namespace LCompilers {
         }
 
         PassManager(): apply_default_passes{false},
-            c_skip_pass{false} {
+            c_skip_pass{false}, mlir_skip_pass{false} {
             _passes = {
                 "global_stmts",
                 "init_expr",
@@ -295,6 +401,12 @@ namespace LCompilers {
                 "select_case",
                 "inline_function_calls"
             };
+
+            // The MLIR backend lowers DO and DO CONCURRENT loops to
+            // affine/scf loops itself.
+            _mlir_skip_passes = {
+                "do_loops"
+            };
             _user_defined_passes.clear();
         }
 
@@ -350,6 +462,7 @@ namespace LCompilers {
                 passes = _passes;
             }
             size_t pass_cnt_asr_dump = 0, pass_cnt_fortran_dump = 0;
+            PassStateScope pass_state(pass_options);
             for (size_t i = 0; i < passes.size(); i++) {
                 // TODO: rework the whole pass manager: construct the passes
                 // ahead of time (not at the last minute), and remove this much
@@ -360,7 +473,11 @@ namespace LCompilers {
                 if (pass_options.verbose) {
                     std::cerr << "ASR Pass starts: '" << passes[i] << "'\n";
                 }
-                _passes_db[passes[i]](al, *asr, pass_options);
+                {
+                    TimeTraceScope trace(pass_options.time_trace, "Pass",
+                        passes[i], &al);
+                    _passes_db[passes[i]](al, *asr, pass_options);
+                }
                 if (pass_options.dump_all_passes) {
                     std::string str_i = std::to_string(pass_cnt_asr_dump+1);
                     if ( pass_cnt_asr_dump < 9 )  str_i = "0" + str_i;
@@ -423,6 +540,10 @@ namespace LCompilers {
             c_skip_pass = true;
         }
 
+        void skip_mlir_passes() {
+            mlir_skip_pass = true;
+        }
+
         void do_not_use_default_passes() {
             apply_default_passes = false;
         }
@@ -12,6 +12,31 @@ namespace LCompilers {
 
     namespace PassUtils {
 
+        // Called at the start of a pass that reports the global symbols it
+        // modifies with `report_modified` (see ModifiedSymbols)
+        static inline void track_modified(const PassOptions &pass_options) {
+            if (pass_options.modified_symbols) {
+                pass_options.modified_symbols->reported = true;
+            }
+        }
+
+        // Records that the pass modified something in `scope`
+        static inline void report_modified(const PassOptions &pass_options,
+                SymbolTable *scope) {
+            ModifiedSymbols *modified = pass_options.modified_symbols;
+            if (!modified || !modified->reported) return;
+            while (scope && scope->parent && scope->parent->parent) {
+                scope = scope->parent;
+            }
+            if (scope && scope->parent && ASR::is_a<ASR::symbol_t>(*scope->asr_owner)) {
+                modified->names.insert(ASRUtils::symbol_name(
+                    ASR::down_cast<ASR::symbol_t>(scope->asr_owner)));
+            } else {
+                // Global statements: verify the whole unit
+                modified->reported = false;
+            }
+        }
+
         ASR::asr_t* make_Assignment_t_util(Allocator &al, const Location &a_loc,
             ASR::expr_t* a_target, ASR::expr_t* a_value,
             ASR::stmt_t* a_overloaded, bool a_realloc_lhs);
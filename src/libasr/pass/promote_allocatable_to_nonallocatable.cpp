@@ -10,6 +10,47 @@
 
 namespace LCompilers {
 
+/*
+    Dimensions which are compile time constants or depend only on the
+    arguments have the same value everywhere in the procedure, so the array
+    can be declared with them on entry instead of being allocated.
+*/
+static bool is_dimension_invariant(ASR::dimension_t* m_dims, size_t n_dims,
+        bool only_intent_in_args=false) {
+    for( size_t i = 0; i < n_dims; i++ ) {
+        if( m_dims[i].m_length == nullptr ) {
+            return false;
+        }
+        bool is_start_constant = m_dims[i].m_start == nullptr ||
+            ASRUtils::expr_value(m_dims[i].m_start) != nullptr;
+        if( is_start_constant && ASRUtils::expr_value(m_dims[i].m_length) ) {
+            continue;
+        }
+        if( !ASRUtils::is_dimension_dependent_only_on_arguments(
+                &m_dims[i], 1, only_intent_in_args) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Folds the constant dimensions so that the promoted array gets a fixed size
+static void fold_constant_dimensions(Allocator& al, ASR::dimension_t*& m_dims, size_t n_dims) {
+    Vec<ASR::dimension_t> dims;
+    dims.reserve(al, n_dims);
+    for( size_t i = 0; i < n_dims; i++ ) {
+        ASR::dimension_t dim = m_dims[i];
+        if( dim.m_start && ASRUtils::expr_value(dim.m_start) ) {
+            dim.m_start = ASRUtils::expr_value(dim.m_start);
+        }
+        if( dim.m_length && ASRUtils::expr_value(dim.m_length) ) {
+            dim.m_length = ASRUtils::expr_value(dim.m_length);
+        }
+        dims.push_back(al, dim);
+    }
+    m_dims = dims.p;
+}
+
 class IsAllocatedCalled: public ASR::CallReplacerOnExpressionsVisitor<IsAllocatedCalled> {
     public:
 
@@ -115,8 +156,7 @@ class IsAllocatedCalled: public ASR::CallReplacerOnExpressionsVisitor<IsAllocate
                         push_to_scopes_until_symbol_scope(sym);
                     }
                 }
-                if( !ASRUtils::is_dimension_dependent_only_on_arguments(
-                        alloc_arg.m_dims, alloc_arg.n_dims, true) ||
+                if( !is_dimension_invariant(alloc_arg.m_dims, alloc_arg.n_dims, true) ||
                     is_array_size_called_on_pointer(alloc_arg.m_dims, alloc_arg.n_dims) ) {
                     if( ASR::is_a<ASR::Var_t>(*alloc_arg.m_a) ) {
                         ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(alloc_arg.m_a)->m_v;
@@ -208,8 +248,7 @@ class PromoteAllocatableToNonAllocatable:
                     !ASR::is_a<ASR::Module_t>(
                         *ASRUtils::get_asr_owner(ASR::down_cast<ASR::Var_t>(alloc_arg.m_a)->m_v)) &&
                     ASRUtils::expr_intent(alloc_arg.m_a) == ASRUtils::intent_local &&
-                    ASRUtils::is_dimension_dependent_only_on_arguments(
-                        alloc_arg.m_dims, alloc_arg.n_dims) &&
+                    is_dimension_invariant(alloc_arg.m_dims, alloc_arg.n_dims) &&
                     std::find(scope2var[current_scope].begin(),
                         scope2var[current_scope].end(),
                         ASR::down_cast<ASR::Var_t>(alloc_arg.m_a)->m_v) ==
@@ -227,8 +266,10 @@ class PromoteAllocatableToNonAllocatable:
                             str->m_len = alloc_arg.m_len_expr;
                             str->m_len_kind = ASR::string_length_kindType::ExpressionLength;
                         }
+                    ASR::dimension_t* promoted_dims = alloc_arg.m_dims;
+                    fold_constant_dimensions(al, promoted_dims, alloc_arg.n_dims);
                     alloc_variable->m_type = ASRUtils::make_Array_t_util(al, x.base.base.loc,
-                    array_type, alloc_arg.m_dims, alloc_arg.n_dims);
+                    array_type, promoted_dims, alloc_arg.n_dims);
                     promoted_symbols.insert(ASR::down_cast<ASR::Var_t>(alloc_arg.m_a)->m_v);
                 } else if( ASR::is_a<ASR::Allocatable_t>(*ASRUtils::expr_type(alloc_arg.m_a)) ||
                            ASR::is_a<ASR::Pointer_t>(*ASRUtils::expr_type(alloc_arg.m_a)) ) {
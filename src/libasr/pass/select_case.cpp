@@ -278,7 +278,10 @@ class SelectCaseVisitor : public PassUtils::PassVisitor<SelectCaseVisitor>
 {
 
 public:
-    SelectCaseVisitor(Allocator &al) : PassVisitor(al, nullptr) {
+    const LCompilers::PassOptions &pass_options;
+
+    SelectCaseVisitor(Allocator &al, const LCompilers::PassOptions &pass_options)
+        : PassVisitor(al, nullptr), pass_options{pass_options} {
     }
 
     void visit_WhileLoop(const ASR::WhileLoop_t &x) {
@@ -289,6 +292,7 @@ public:
     }
 
     void visit_Select(const ASR::Select_t &x) {
+        PassUtils::report_modified(pass_options, current_scope);
         if( x.m_enable_fall_through ) {
             pass_result = replace_selectcase_with_fall_through(al, x, current_scope);
         } else {
@@ -298,8 +302,9 @@ public:
 };
 
 void pass_replace_select_case(Allocator &al, ASR::TranslationUnit_t &unit,
-                              const LCompilers::PassOptions& /*pass_options*/) {
-    SelectCaseVisitor v(al);
+                              const LCompilers::PassOptions& pass_options) {
+    PassUtils::track_modified(pass_options);
+    SelectCaseVisitor v(al, pass_options);
     // Each call transforms only one layer of nested loops, so we call it twice
     // to transform doubly nested loops:
     v.visit_TranslationUnit(unit);
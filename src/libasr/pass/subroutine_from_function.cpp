@@ -27,14 +27,17 @@ private :
         Allocator& al;
         // Mapping Modified Functions With What Used To Be Its Return Type -- It's Useful Later When Allocating a Temporary is Needed For FuncCall Return.
         std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__TO__ReturnType_MAP_;
+        const LCompilers::PassOptions& pass_options;
 
 public:
 
         /* Constructor */
         CreateFunctionFromSubroutine(
             Allocator &al_,
-            std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__ReturnType_MAP)
-            : al(al_), Function__TO__ReturnType_MAP_(Function__ReturnType_MAP){}
+            std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__ReturnType_MAP,
+            const LCompilers::PassOptions& pass_options_)
+            : al(al_), Function__TO__ReturnType_MAP_(Function__ReturnType_MAP),
+            pass_options(pass_options_){}
 
 
         void visit_Function(const ASR::Function_t& x) {
@@ -43,7 +46,10 @@ public:
             
             /* Transform This Function Into Subroutine IF NEEDED */
             bool transform_success = PassUtils::handle_fn_return_var(al, x_ptr, PassUtils::is_aggregate_or_array_or_nonPrimitive_type);
-            if(transform_success) {Function__TO__ReturnType_MAP_[x_ptr] = return_type;}
+            if(transform_success) {
+                Function__TO__ReturnType_MAP_[x_ptr] = return_type;
+                PassUtils::report_modified(pass_options, x.m_symtab);
+            }
 
             /* Visit Functions In Current SymTable */
             for (auto &str_sym_pair : x.m_symtab->get_scope()) {
@@ -97,6 +103,9 @@ public:
                 if (ASR::is_a<ASR::Pointer_t>(*x.m_type)) {
                     new_type = ASRUtils::TYPE(ASR::make_Pointer_t(al, x.base.base.loc, new_type));
                 }
+                if (ASRUtils::type_get_past_pointer(x.m_type) != func->m_function_signature) {
+                    PassUtils::report_modified(pass_options, x.m_parent_symtab);
+                }
                 x_ptr->m_type = new_type;
             }
         }
@@ -475,6 +484,7 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
         ReplaceFunctionCallWithSubroutineCall replacer;
         bool remove_original_statement = false;
         Vec<ASR::stmt_t*>* parent_body = nullptr;
+        const LCompilers::PassOptions& pass_options;
 
         bool expr_same(ASR::expr_t *a, ASR::expr_t *b) {
             if (a->type != b->type) {
@@ -511,8 +521,10 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
 
         ReplaceFunctionCallWithSubroutineCallVisitor(
             Allocator& al_,
-            std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__TO__ReturnType_MAP)
-            :al(al_), replacer(al, current_scope, pass_result, Function__TO__ReturnType_MAP)
+            std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__TO__ReturnType_MAP,
+            const LCompilers::PassOptions& pass_options_)
+            :al(al_), replacer(al, current_scope, pass_result, Function__TO__ReturnType_MAP),
+            pass_options(pass_options_)
         {
             pass_result.n = 0;
             pass_result.reserve(al, 1);
@@ -520,8 +532,12 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
         }
 
         void call_replacer(){
+            ASR::expr_t* original_expr = *current_expr;
             replacer.current_expr = current_expr;
             replacer.replace_expr(*current_expr);
+            if (*current_expr != original_expr) {
+                PassUtils::report_modified(pass_options, current_scope);
+            }
         }
 
         void transform_stmts(ASR::stmt_t **&m_body, size_t &n_body) {
@@ -544,6 +560,9 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
                 parent_body = &body;
                 remove_original_statement = false;
                 visit_stmt(*m_body[i]);
+                if( pass_result.size() > 0 || remove_original_statement ) {
+                    PassUtils::report_modified(pass_options, current_scope);
+                }
                 if( pass_result.size() > 0 ) {
                     for (size_t j=0; j < pass_result.size(); j++) {
                         body.push_back(al, pass_result[j]);
@@ -801,6 +820,7 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
         pass_result.reserve(al, 0); // Reset
         visit_expr(*x.m_test);
         if (!pass_result.empty()){ // Temps Created!
+            PassUtils::report_modified(pass_options, current_scope);
             ASRUtils::ASRBuilder builder(al, x.base.base.loc);
             pass_result.push_back(al, builder.If(builder.Eq(x.m_test, builder.logical_false()), {builder.Exit()}, {}));
             for(size_t i = 0; i< x.n_body; i++){
@@ -819,11 +839,12 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
 };
 
 void pass_create_subroutine_from_function(Allocator &al, ASR::TranslationUnit_t &unit,
-                                          const LCompilers::PassOptions& /*pass_options*/) {
+                                          const LCompilers::PassOptions& pass_options) {
     std::unordered_map<ASR::Function_t*, ASR::ttype_t*> Function__TO__ReturnType_MAP;
-    CreateFunctionFromSubroutine v(al,Function__TO__ReturnType_MAP);
+    PassUtils::track_modified(pass_options);
+    CreateFunctionFromSubroutine v(al,Function__TO__ReturnType_MAP, pass_options);
     v.visit_TranslationUnit(unit);
-    ReplaceFunctionCallWithSubroutineCallVisitor u(al, Function__TO__ReturnType_MAP);
+    ReplaceFunctionCallWithSubroutineCallVisitor u(al, Function__TO__ReturnType_MAP, pass_options);
     u.visit_TranslationUnit(unit);
     PassUtils::UpdateDependenciesVisitor w(al);
     w.visit_TranslationUnit(unit);
@@ -59,8 +59,10 @@ private:
 
 public:
     std::unordered_map<ASR::stmt_t*, ASR::symbol_t*> flag_map;
+    const LCompilers::PassOptions &pass_options;
 
-    WhileLoopVisitor(Allocator &al) : StatementWalkVisitor(al) {
+    WhileLoopVisitor(Allocator &al, const LCompilers::PassOptions &pass_options)
+        : StatementWalkVisitor(al), pass_options{pass_options} {
         counter = 0;
         flag_map = {};
     }
@@ -74,6 +76,7 @@ public:
         Creates an if statement after the loop to check if the flag was changed
         */
         if (x.n_orelse > 0) {
+            PassUtils::report_modified(pass_options, target_scope);
             Vec<ASR::stmt_t*> result;
             result.reserve(al, 3);
 
@@ -114,8 +117,11 @@ public:
 };
 
 void pass_while_else(Allocator &al, ASR::TranslationUnit_t &unit,
-                           const LCompilers::PassOptions& /*pass_options*/) {
-    WhileLoopVisitor v(al);
+                           const LCompilers::PassOptions& pass_options) {
+    // The `exit` statements rewritten by ExitVisitor are in the loops
+    // WhileLoopVisitor reported
+    PassUtils::track_modified(pass_options);
+    WhileLoopVisitor v(al, pass_options);
     ExitVisitor e(al);
     v.visit_TranslationUnit(unit);
     e.flag_map = v.flag_map;
@@ -0,0 +1,158 @@
+#ifndef LIBASR_PERFECT_HASH_H
+#define LIBASR_PERFECT_HASH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace LCompilers {
+
+/*
+    Read-only map from strings to values for the fixed name tables (intrinsic
+    registries and alike), with the interface of a const std::map.
+
+    The table is built once from its initializer with "hash and displace":
+    keys are hashed into buckets of about one key each, and every bucket
+    gets the smallest displacement that sends all its keys to free slots.
+    A lookup is then one hash of the name, one slot and one string compare,
+    instead of a string compare per level of a search tree. Iteration is in
+    initializer order.
+*/
+template <class V>
+class PerfectHashMap {
+public:
+    typedef std::pair<std::string, V> value_type;
+    typedef const value_type* const_iterator;
+
+    PerfectHashMap(std::initializer_list<value_type> init)
+            : entries(init) {
+        build();
+    }
+
+    // For tables assembled at run time
+    explicit PerfectHashMap(std::vector<value_type> init)
+            : entries(std::move(init)) {
+        build();
+    }
+
+    const_iterator begin() const { return entries.data(); }
+    const_iterator end() const { return entries.data() + entries.size(); }
+    size_t size() const { return entries.size(); }
+
+    const_iterator find(std::string_view key) const {
+        if (entries.empty()) return end();
+        uint64_t h = hash(key);
+        uint32_t d = displacement[h & bucket_mask];
+        int32_t i = slots[slot(h, d)];
+        if (i >= 0 && entries[i].first == key) return &entries[i];
+        return end();
+    }
+
+    size_t count(std::string_view key) const {
+        return find(key) != end();
+    }
+
+    const V& at(std::string_view key) const {
+        const_iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("PerfectHashMap::at: "
+                + std::string(key));
+        }
+        return it->second;
+    }
+
+private:
+    std::vector<value_type> entries;
+    std::vector<int32_t> slots; // index into `entries` or -1
+    std::vector<uint32_t> displacement; // per bucket
+    uint64_t slot_mask = 0, bucket_mask = 0;
+
+    // FNV-1a, then the murmur3 finalizer to spread the bits
+    static uint64_t hash(std::string_view key) {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (char c : key) {
+            h = (h ^ (unsigned char)c) * 0x100000001b3ULL;
+        }
+        return mix(h);
+    }
+
+    static uint64_t mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    size_t slot(uint64_t h, uint32_t d) const {
+        return mix(h + d * 0x9e3779b97f4a7c15ULL) & slot_mask;
+    }
+
+    void build() {
+        size_t n = entries.size();
+        size_t n_slots = 1, n_buckets = 1;
+        while (n_slots < 2 * n) n_slots *= 2;
+        while (n_buckets < n) n_buckets *= 2;
+        slot_mask = n_slots - 1;
+        bucket_mask = n_buckets - 1;
+        slots.assign(n_slots, -1);
+        displacement.assign(n_buckets, 0);
+
+        // Like std::map, a repeated key keeps its first value
+        std::vector<value_type> unique;
+        std::vector<uint64_t> hashes;
+        std::vector<std::vector<int32_t>> buckets(n_buckets);
+        for (size_t i = 0; i < n; i++) {
+            uint64_t h = hash(entries[i].first);
+            std::vector<int32_t> &bucket = buckets[h & bucket_mask];
+            bool repeated = false;
+            for (int32_t j : bucket) {
+                if (unique[j].first == entries[i].first) repeated = true;
+            }
+            if (repeated) continue;
+            bucket.push_back(unique.size());
+            unique.push_back(std::move(entries[i]));
+            hashes.push_back(h);
+        }
+        entries.swap(unique);
+        // Place the largest buckets first, while the table is still empty
+        std::vector<size_t> order;
+        for (size_t b = 0; b < n_buckets; b++) {
+            if (!buckets[b].empty()) order.push_back(b);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+        std::vector<size_t> taken;
+        for (size_t b : order) {
+            for (uint32_t d = 0; ; d++) {
+                taken.clear();
+                bool ok = true;
+                for (int32_t i : buckets[b]) {
+                    size_t s = slot(hashes[i], d);
+                    if (slots[s] != -1) { ok = false; break; }
+                    for (size_t t : taken) if (t == s) ok = false;
+                    if (!ok) break;
+                    taken.push_back(s);
+                }
+                if (ok) {
+                    for (size_t k = 0; k < taken.size(); k++) {
+                        slots[taken[k]] = buckets[b][k];
+                    }
+                    displacement[b] = d;
+                    break;
+                }
+            }
+        }
+    }
+};
+
+} // namespace LCompilers
+
+#endif // LIBASR_PERFECT_HASH_H
@@ -37,6 +37,8 @@ typedef enum {
 #  include <unistd.h>
 #if !defined(COMPILE_TO_WASM)
 #  include <sys/wait.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
 #endif
 #endif
 
@@ -54,8 +56,21 @@ typedef enum {
 /* ----------------------------------------------------- */
 #define MEM_DEBUG_INITIAL_BUCKETS 1024
 
+// Where an allocation was served from
+typedef enum Alloc_source {
+    ALLOC_SOURCE_MALLOC,
+    ALLOC_SOURCE_POOL,
+    ALLOC_SOURCE_SCRATCH,
+    ALLOC_SOURCE_COUNT
+} Alloc_source;
+
+static const char* const alloc_source_names[ALLOC_SOURCE_COUNT] = {
+    "malloc", "pool", "scratch"
+};
+
 typedef struct Alloc_info {
     size_t size;
+    Alloc_source source;
 } Alloc_info;
 
 unsigned long mem_debugger_HASH(void* const ptr) { // Thomas Wang hash
@@ -73,15 +88,22 @@ int mem_debugger_EQUAL(void *a, void *b){
 DEFINE_HASHTABLE_FOR_TYPES(void*, Alloc_info, mem_debugger)
 
 static mem_debugger mem_dbg_hashTable = {NULL, 0, 0};
+static size_t mem_dbg_alloc_count[ALLOC_SOURCE_COUNT] = {0};
 
 // Create `Alloc_info` and map to the ptr
-static void register_ptr(void* const ptr, size_t size){
+static void register_ptr_from(void* const ptr, size_t size, Alloc_source source){
     if(!ptr) return;
     if(!mem_dbg_hashTable.buckets) mem_debugger_init(&mem_dbg_hashTable, MEM_DEBUG_INITIAL_BUCKETS);
 
     Alloc_info a;
     a.size = size;
+    a.source = source;
     mem_debugger_insert(&mem_dbg_hashTable, ptr, a);
+    mem_dbg_alloc_count[source]++;
+}
+
+static void register_ptr(void* const ptr, size_t size){
+    register_ptr_from(ptr, size, ALLOC_SOURCE_MALLOC);
 }
 
 void* dbg_malloc(void *context, int64_t size) {
@@ -164,15 +186,27 @@ void  *dbg_realloc(void *context, void *ptr, int64_t size){
 void dbg_report() {
     size_t leaks = 0;
     size_t total_bytes = 0;
-    fprintf(stdout, "\n---------------- Memory Leak Report ----------------\n");
+    fprintf(stderr, "\n---------------- Memory Leak Report ----------------\n");
     for (size_t i = 0; i < mem_dbg_hashTable.num_buckets; i++) {
         if (mem_dbg_hashTable.buckets[i].state != OCCUPIED_BKT) continue;
         Alloc_info *a = &mem_dbg_hashTable.buckets[i].value;
-        fprintf(stderr, "   ==> LEAK: %zu bytes\n", a->size);
+        if (a->source == ALLOC_SOURCE_MALLOC) {
+            fprintf(stderr, "   ==> LEAK: %zu bytes\n", a->size);
+        } else {
+            fprintf(stderr, "   ==> LEAK: %zu bytes (%s)\n", a->size,
+                alloc_source_names[a->source]);
+        }
         leaks++;
         total_bytes += a->size;
     }
-    fprintf(stdout, "----------------------------------------------------\n");
+    if (mem_dbg_alloc_count[ALLOC_SOURCE_POOL] || mem_dbg_alloc_count[ALLOC_SOURCE_SCRATCH]) {
+        fprintf(stderr, "Allocations:");
+        for (int i = 0; i < ALLOC_SOURCE_COUNT; i++) {
+            fprintf(stderr, " %zu %s%s", mem_dbg_alloc_count[i], alloc_source_names[i],
+                i + 1 < ALLOC_SOURCE_COUNT ? "," : "\n");
+        }
+    }
+    fprintf(stderr, "----------------------------------------------------\n");
     if (leaks){
         fprintf(stderr, "\n----------------------------------------------------\n");
         fprintf(stderr, "TOTAL LEAKS FOUND : %zu, %zu bytes total\n", leaks, total_bytes);
@@ -180,7 +214,7 @@ void dbg_report() {
         exit(1);
     }
     else {
-        fprintf(stdout, "NO LEAKS FOUND\n");
+        fprintf(stderr, "NO LEAKS FOUND\n");
     }
 }
 /* ------------------------------------------------------------- */
@@ -332,6 +366,397 @@ LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_allocator(void
 
 /* --- End default allocator --- */
 
+/* --- Pooled allocator --- */
+
+/*
+ * Selected with `--pool-allocator`. Blocks of up to 64 KiB are rounded up to
+ * a power of two and recycled through thread-local free lists, so
+ * temporaries that are allocated and freed on every iteration of a loop
+ * don't go through malloc/free each time. Larger blocks go to malloc.
+ *
+ * Compiler generated temporaries are instead carved from a thread-local
+ * scratch stack. Every procedure that has such temporaries takes a mark on
+ * entry and releases back to it on exit; freeing the block on top of the
+ * stack pops it immediately, so temporaries freed in LIFO order inside a
+ * loop reuse the same memory.
+ *
+ * Pool memory comes from arenas that are aligned to POOL_ARENA_SIZE and
+ * registered in a table indexed by address. A pointer belongs to the pool
+ * if the table lists the arena it falls in, so ownership is decided without
+ * reading memory the pool doesn't own: blocks from malloc, from code built
+ * without `--pool-allocator` or from the large block path are passed to
+ * realloc/free untouched. Arenas are kept until the program exits.
+ */
+
+#if defined(_MSC_VER)
+#  define LFORTRAN_THREAD_LOCAL __declspec(thread)
+#  include <intrin.h>
+#else
+#  define LFORTRAN_THREAD_LOCAL _Thread_local
+#endif
+
+#define POOL_MIN_SHIFT 5                    /* smallest class: 32 bytes */
+#define POOL_N_CLASSES 12                   /* largest class: 64 KiB */
+#define POOL_ARENA_SHIFT 21
+#define POOL_ARENA_SIZE ((size_t)1 << POOL_ARENA_SHIFT)
+/* Two level table over the arena index: 13 + 14 bits of it, together with
+   the 21 bits of the arena offset, cover a 48 bit address space */
+#define POOL_TABLE_LEAF_BITS 14
+#define POOL_TABLE_LEAF_SIZE ((size_t)1 << POOL_TABLE_LEAF_BITS)
+#define POOL_TABLE_ROOT_SIZE ((size_t)1 << 13)
+
+typedef enum {
+    POOL_ARENA_CLASS,
+    POOL_ARENA_SCRATCH
+} pool_arena_kind;
+
+typedef struct pool_arena {
+    pool_arena_kind kind;
+    uint32_t size_class;            /* class arenas: the class of all blocks */
+    size_t capacity;                /* bytes after the arena header */
+    size_t used;                    /* bytes handed out (scratch: stack top) */
+    struct pool_arena* next;        /* scratch: next chunk of the stack */
+} pool_arena;
+
+/* In front of every scratch block; the stack is a list through `prev` */
+typedef struct scratch_header {
+    pool_arena* chunk;
+    struct scratch_header* prev;
+    int64_t freed;                  /* freed but not yet popped */
+    int64_t size;
+} scratch_header;
+
+typedef struct pool_free_entry {
+    struct pool_free_entry* next;
+} pool_free_entry;
+
+typedef struct pool_thread_state {
+    pool_free_entry* free_list[POOL_N_CLASSES];
+    pool_arena* class_arena[POOL_N_CLASSES];    /* carved from when empty */
+    pool_arena* first_chunk;
+    pool_arena* current_chunk;
+    scratch_header* scratch_top;
+} pool_thread_state;
+
+static LFORTRAN_THREAD_LOCAL pool_thread_state pool_state;
+static void* pool_table[POOL_TABLE_ROOT_SIZE];
+
+#define POOL_ARENA_HEADER_SIZE ((sizeof(pool_arena) + 63) & ~(size_t)63)
+#define POOL_ARENA_DATA(a) ((char*)(a) + POOL_ARENA_HEADER_SIZE)
+#define SCRATCH_DATA(h) ((void*)((char*)(h) + sizeof(scratch_header)))
+
+#if defined(_MSC_VER)
+static inline void* pool_load_ptr(void* volatile* p) {
+    return *p;
+}
+
+static inline void pool_store_ptr(void* volatile* p, void* v) {
+    *p = v;
+}
+
+static inline bool pool_cas_ptr(void* volatile* p, void* expected, void* desired) {
+    return _InterlockedCompareExchangePointer(p, desired, expected) == expected;
+}
+#else
+static inline void* pool_load_ptr(void** p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void pool_store_ptr(void** p, void* v) {
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+static inline bool pool_cas_ptr(void** p, void* expected, void* desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false,
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+#endif
+
+/* The arena `ptr` points into, NULL if it is not pool memory */
+static inline pool_arena* pool_lookup(const void* ptr) {
+    uintptr_t i = (uintptr_t)ptr >> POOL_ARENA_SHIFT;
+    uintptr_t root = i >> POOL_TABLE_LEAF_BITS;
+    if (root >= POOL_TABLE_ROOT_SIZE) return NULL;
+    void** leaf = (void**)pool_load_ptr(&pool_table[root]);
+    if (!leaf) return NULL;
+    return (pool_arena*)pool_load_ptr(&leaf[i & (POOL_TABLE_LEAF_SIZE - 1)]);
+}
+
+/* Points the table entries of [p, p + size) at `a` (or clears them) */
+static bool pool_table_set(void* p, size_t size, pool_arena* a) {
+    uintptr_t first = (uintptr_t)p >> POOL_ARENA_SHIFT;
+    uintptr_t last = ((uintptr_t)p + size - 1) >> POOL_ARENA_SHIFT;
+    if ((last >> POOL_TABLE_LEAF_BITS) >= POOL_TABLE_ROOT_SIZE) return false;
+    for (uintptr_t i = first; i <= last; i++) {
+        uintptr_t root = i >> POOL_TABLE_LEAF_BITS;
+        void** leaf = (void**)pool_load_ptr(&pool_table[root]);
+        if (!leaf) {
+            void** new_leaf = (void**)calloc(POOL_TABLE_LEAF_SIZE, sizeof(void*));
+            if (!new_leaf) {
+                if (a && i > first) {
+                    pool_table_set(p, (size_t)(i - first) << POOL_ARENA_SHIFT, NULL);
+                }
+                return false;
+            }
+            if (pool_cas_ptr(&pool_table[root], NULL, new_leaf)) {
+                leaf = new_leaf;
+            } else {
+                free(new_leaf);
+                leaf = (void**)pool_load_ptr(&pool_table[root]);
+            }
+        }
+        pool_store_ptr(&leaf[i & (POOL_TABLE_LEAF_SIZE - 1)], a);
+    }
+    return true;
+}
+
+static void pool_aligned_free(void* p) {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+/* A registered arena with at least `capacity` bytes of data */
+static pool_arena* pool_arena_new(pool_arena_kind kind, uint32_t size_class,
+        size_t capacity) {
+    size_t size = (POOL_ARENA_HEADER_SIZE + capacity + POOL_ARENA_SIZE - 1)
+        & ~(POOL_ARENA_SIZE - 1);
+    void* p;
+#if defined(_WIN32)
+    p = _aligned_malloc(size, POOL_ARENA_SIZE);
+#else
+    if (posix_memalign(&p, POOL_ARENA_SIZE, size) != 0) p = NULL;
+#endif
+    if (!p) return NULL;
+    pool_arena* a = (pool_arena*)p;
+    a->kind = kind;
+    a->size_class = size_class;
+    a->capacity = size - POOL_ARENA_HEADER_SIZE;
+    a->used = 0;
+    a->next = NULL;
+    if (!pool_table_set(p, size, a)) {
+        pool_aligned_free(p);
+        return NULL;
+    }
+    return a;
+}
+
+static inline int pool_size_class(int64_t size) {
+    size_t n = size > 0 ? (size_t)(size - 1) >> POOL_MIN_SHIFT : 0;
+    int c = 0;
+    while (n) {
+        n >>= 1;
+        c++;
+    }
+    return c;
+}
+
+static inline size_t pool_class_size(int c) {
+    return (size_t)1 << (c + POOL_MIN_SHIFT);
+}
+
+static void* pool_alloc_block(int64_t size, Alloc_source* source) {
+    int c = pool_size_class(size);
+    *source = ALLOC_SOURCE_MALLOC;
+    if (c >= POOL_N_CLASSES) {
+        return malloc((size_t)size);
+    }
+    pool_free_entry* b = pool_state.free_list[c];
+    if (b) {
+        pool_state.free_list[c] = b->next;
+        *source = ALLOC_SOURCE_POOL;
+        return b;
+    }
+    size_t csize = pool_class_size(c);
+    pool_arena* a = pool_state.class_arena[c];
+    if (!a || a->capacity - a->used < csize) {
+        a = pool_arena_new(POOL_ARENA_CLASS, (uint32_t)c, POOL_ARENA_SIZE);
+        if (!a) {
+            // Not pool memory, so it is freed with free()
+            return malloc((size_t)size);
+        }
+        pool_state.class_arena[c] = a;
+    }
+    void* p = POOL_ARENA_DATA(a) + a->used;
+    a->used += csize;
+    *source = ALLOC_SOURCE_POOL;
+    return p;
+}
+
+static void scratch_pop(void) {
+    scratch_header* h = pool_state.scratch_top;
+    h->chunk->used = (size_t)((char*)h - POOL_ARENA_DATA(h->chunk));
+    pool_state.current_chunk = h->chunk;
+    pool_state.scratch_top = h->prev;
+}
+
+static void* scratch_alloc_block(int64_t size) {
+    size_t need = sizeof(scratch_header) + (((size_t)size + 15) & ~(size_t)15);
+    pool_arena* c = pool_state.current_chunk;
+    if (!c || c->capacity - c->used < need) {
+        // Chunks after the current one are empty, reuse the next one if
+        // it is large enough, otherwise insert a new one in front of it.
+        pool_arena* next = c ? c->next : pool_state.first_chunk;
+        if (next && next->capacity >= need) {
+            c = next;
+            c->used = 0;
+        } else {
+            pool_arena* n = pool_arena_new(POOL_ARENA_SCRATCH, 0, need);
+            if (!n) return NULL;
+            n->next = next;
+            if (c) {
+                c->next = n;
+            } else {
+                pool_state.first_chunk = n;
+            }
+            c = n;
+        }
+        pool_state.current_chunk = c;
+    }
+    scratch_header* h = (scratch_header*)(POOL_ARENA_DATA(c) + c->used);
+    c->used += need;
+    h->chunk = c;
+    h->prev = pool_state.scratch_top;
+    h->freed = 0;
+    h->size = size;
+    pool_state.scratch_top = h;
+    return SCRATCH_DATA(h);
+}
+
+static void pool_free_block(void* ptr) {
+    pool_arena* a = pool_lookup(ptr);
+    if (!a) {
+        free(ptr);
+        return;
+    }
+    if (a->kind == POOL_ARENA_CLASS) {
+        pool_free_entry* b = (pool_free_entry*)ptr;
+        b->next = pool_state.free_list[a->size_class];
+        pool_state.free_list[a->size_class] = b;
+    } else {
+        scratch_header* h = (scratch_header*)ptr - 1;
+        h->freed = 1;
+        while (pool_state.scratch_top && pool_state.scratch_top->freed) {
+            scratch_pop();
+        }
+    }
+}
+
+static void* pool_realloc_block(void* ptr, int64_t size, Alloc_source* source) {
+    pool_arena* a = pool_lookup(ptr);
+    *source = ALLOC_SOURCE_MALLOC;
+    if (!a) {
+        return realloc(ptr, (size_t)size);
+    }
+    size_t old_size;
+    if (a->kind == POOL_ARENA_CLASS) {
+        old_size = pool_class_size((int)a->size_class);
+        if ((size_t)size <= old_size) {
+            *source = ALLOC_SOURCE_POOL;
+            return ptr;
+        }
+    } else {
+        old_size = (size_t)((scratch_header*)ptr - 1)->size;
+    }
+    void* new_ptr = pool_alloc_block(size, source);
+    if (!new_ptr) return NULL;
+    memcpy(new_ptr, ptr, old_size < (size_t)size ? old_size : (size_t)size);
+    pool_free_block(ptr);
+    return new_ptr;
+}
+
+/*
+ * The allocator's context is the mem-debug hashtable when `--detect-leaks`
+ * is on, in which case every block is registered there together with where
+ * it was served from, so the leak report can show allocation counts.
+ */
+static void pool_dbg_unregister(void* context, void* ptr) {
+    if (!context || !ptr) return;
+    if (!mem_dbg_hashTable.buckets || !mem_debugger_get(&mem_dbg_hashTable, ptr)) {
+        fprintf(stderr, "Error: at pool_free -- ptr not found\n");
+        exit(1);
+    }
+    mem_debugger_remove(&mem_dbg_hashTable, ptr);
+}
+
+static void* pool_alloc(void* context, int64_t size) {
+    Alloc_source source;
+    void* ptr = pool_alloc_block(size, &source);
+    if (context) register_ptr_from(ptr, (size_t)size, source);
+    return ptr;
+}
+
+static void* scratch_alloc(void* context, int64_t size) {
+    void* ptr = scratch_alloc_block(size);
+    if (context) register_ptr_from(ptr, (size_t)size, ALLOC_SOURCE_SCRATCH);
+    return ptr;
+}
+
+static void* pool_realloc(void* context, void* ptr, int64_t size) {
+    if (!ptr) return pool_alloc(context, size);
+    Alloc_source source;
+    pool_dbg_unregister(context, ptr);
+    void* new_ptr = pool_realloc_block(ptr, size, &source);
+    if (context) register_ptr_from(new_ptr, (size_t)size, source);
+    return new_ptr;
+}
+
+static void pool_dealloc(void* context, void* ptr) {
+    if (!ptr) return;
+    pool_dbg_unregister(context, ptr);
+    pool_free_block(ptr);
+}
+
+static lfortran_allocator_t _pool_allocator = {
+    pool_alloc, pool_realloc, pool_dealloc, NULL
+};
+
+static lfortran_allocator_t compiler_mem_dbg_pool_allocator = {
+    pool_alloc, pool_realloc, pool_dealloc, &mem_dbg_hashTable
+};
+
+static lfortran_allocator_t _scratch_allocator = {
+    scratch_alloc, pool_realloc, pool_dealloc, NULL
+};
+
+static lfortran_allocator_t compiler_mem_dbg_scratch_allocator = {
+    scratch_alloc, pool_realloc, pool_dealloc, &mem_dbg_hashTable
+};
+
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_pool_allocator(void) {
+    return &_pool_allocator;
+}
+
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_pool_allocator(void) {
+    return &compiler_mem_dbg_pool_allocator;
+}
+
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_scratch_allocator(void) {
+    return &_scratch_allocator;
+}
+
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_scratch_allocator(void) {
+    return &compiler_mem_dbg_scratch_allocator;
+}
+
+LFORTRAN_API void* _lfortran_scratch_mark(void) {
+    return pool_state.scratch_top;
+}
+
+LFORTRAN_API void _lfortran_scratch_release(void* mark) {
+    while (pool_state.scratch_top && pool_state.scratch_top != (scratch_header*)mark) {
+        if (!pool_state.scratch_top->freed && mem_dbg_hashTable.buckets) {
+            // Temporaries that were never freed explicitly are released here
+            mem_debugger_remove(&mem_dbg_hashTable, SCRATCH_DATA(pool_state.scratch_top));
+        }
+        scratch_pop();
+    }
+}
+
+/* --- End pooled allocator --- */
+
 /* Internal allocation wrappers — used for memory that stays within the
    runtime and is never returned to compiler-generated code. */
 
@@ -540,59 +965,483 @@ LFORTRAN_API double _lfortran_sum(int n, double *v)
     return r;
 }
 
-LFORTRAN_API void _lfortran_random_number(int n, double *v)
+/* ----------------------------------------------------- */
+/* --- MATMUL / DOT_PRODUCT kernels                  --- */
+/* ----------------------------------------------------- */
+
+/*
+ * Column-major products used by the `matmul` and `dot_product` intrinsics
+ * for contiguous operands that are large enough to amortize the call:
+ *
+ *     c(m, n) = a(m, k) * b(k, n)
+ *
+ * The real kernels follow the GotoBLAS blocking: a KC x NC block of `b` is
+ * packed into NR-column panels, an MC x KC block of `a` into MR-row panels,
+ * and a register tiled MR x NR micro-kernel accumulates into `c`. On x86-64
+ * Linux the block driver is cloned for AVX-512 and AVX2/FMA and the best
+ * clone is picked by the dynamic loader. Independent NC column blocks are
+ * distributed over threads when the runtime is compiled with OpenMP.
+ */
+#define LFORTRAN_GEMM_MC 96
+#define LFORTRAN_GEMM_KC 256
+#define LFORTRAN_GEMM_NC 512
+#define LFORTRAN_GEMM_NR 4
+#define LFORTRAN_SGEMM_MR 16
+#define LFORTRAN_DGEMM_MR 8
+
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+#  if __has_attribute(target_clones)
+#    define LFORTRAN_GEMM_CLONES \
+        __attribute__((target_clones("arch=skylake-avx512", "arch=haswell", "default")))
+#  endif
+#endif
+#ifndef LFORTRAN_GEMM_CLONES
+#  define LFORTRAN_GEMM_CLONES
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define LFORTRAN_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#  define LFORTRAN_ALWAYS_INLINE inline
+#endif
+
+#define LFORTRAN_DEFINE_GEMM(PREFIX, T, MR)                                    \
+static LFORTRAN_ALWAYS_INLINE void PREFIX##_micro_kernel(int64_t kc,           \
+        const T *ap, const T *bp, T *c, int64_t ldc, int64_t mr, int64_t nr)  \
+{                                                                              \
+    T acc[LFORTRAN_GEMM_NR][MR];                                               \
+    for (int64_t j = 0; j < LFORTRAN_GEMM_NR; j++) {                           \
+        for (int64_t i = 0; i < MR; i++) acc[j][i] = 0;                        \
+    }                                                                          \
+    for (int64_t p = 0; p < kc; p++) {                                         \
+        const T *a_p = ap + p*MR;                                              \
+        const T *b_p = bp + p*LFORTRAN_GEMM_NR;                                \
+        for (int64_t j = 0; j < LFORTRAN_GEMM_NR; j++) {                       \
+            T b_pj = b_p[j];                                                   \
+            for (int64_t i = 0; i < MR; i++) acc[j][i] += a_p[i] * b_pj;       \
+        }                                                                      \
+    }                                                                          \
+    for (int64_t j = 0; j < nr; j++) {                                         \
+        for (int64_t i = 0; i < mr; i++) c[i + j*ldc] += acc[j][i];            \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+LFORTRAN_GEMM_CLONES                                                           \
+static void PREFIX##_block(T *c, const T *a, const T *b, int64_t m,            \
+        int64_t k, int64_t jc, int64_t nc, T *ap, T *bp)                       \
+{                                                                              \
+    for (int64_t pc = 0; pc < k; pc += LFORTRAN_GEMM_KC) {                     \
+        int64_t kc = MIN(LFORTRAN_GEMM_KC, k - pc);                            \
+        for (int64_t jr = 0; jr < nc; jr += LFORTRAN_GEMM_NR) {                \
+            T *bp_j = bp + jr*kc;                                              \
+            for (int64_t p = 0; p < kc; p++) {                                 \
+                for (int64_t j = 0; j < LFORTRAN_GEMM_NR; j++) {               \
+                    bp_j[p*LFORTRAN_GEMM_NR + j] = (jr + j < nc)               \
+                        ? b[(pc + p) + (jc + jr + j)*k] : 0;                   \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+        for (int64_t ic = 0; ic < m; ic += LFORTRAN_GEMM_MC) {                 \
+            int64_t mc = MIN(LFORTRAN_GEMM_MC, m - ic);                        \
+            for (int64_t ir = 0; ir < mc; ir += MR) {                          \
+                T *ap_i = ap + ir*kc;                                          \
+                for (int64_t p = 0; p < kc; p++) {                             \
+                    for (int64_t i = 0; i < MR; i++) {                         \
+                        ap_i[p*MR + i] = (ir + i < mc)                         \
+                            ? a[(ic + ir + i) + (pc + p)*m] : 0;               \
+                    }                                                          \
+                }                                                              \
+            }                                                                  \
+            for (int64_t jr = 0; jr < nc; jr += LFORTRAN_GEMM_NR) {            \
+                for (int64_t ir = 0; ir < mc; ir += MR) {                      \
+                    PREFIX##_micro_kernel(kc, ap + ir*kc, bp + jr*kc,          \
+                        c + (ic + ir) + (jc + jr)*m, m,                        \
+                        MIN(MR, mc - ir), MIN(LFORTRAN_GEMM_NR, nc - jr));     \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+LFORTRAN_API void _lfortran_##PREFIX(void *c_, void *a_, void *b_,             \
+        int64_t m, int64_t n, int64_t k)                                       \
+{                                                                              \
+    T *c = (T*) c_;                                                            \
+    const T *a = (const T*) a_, *b = (const T*) b_;                            \
+    if (m <= 0 || n <= 0) return;                                              \
+    memset(c, 0, (size_t) (m*n) * sizeof(T));                                  \
+    if (k <= 0) return;                                                        \
+    int64_t n_blocks = (n + LFORTRAN_GEMM_NC - 1) / LFORTRAN_GEMM_NC;          \
+    int64_t m_pad = ((MIN(m, LFORTRAN_GEMM_MC) + MR - 1) / MR) * MR;           \
+    int64_t nc_max = MIN(n, LFORTRAN_GEMM_NC);                                 \
+    int64_t n_pad = ((nc_max + LFORTRAN_GEMM_NR - 1) / LFORTRAN_GEMM_NR)       \
+        * LFORTRAN_GEMM_NR;                                                    \
+    int64_t kc_max = MIN(k, LFORTRAN_GEMM_KC);                                 \
+    LFORTRAN_GEMM_PARALLEL_FOR                                                 \
+    for (int64_t jb = 0; jb < n_blocks; jb++) {                                \
+        T *ap = (T*) internal_malloc((size_t) (m_pad*kc_max) * sizeof(T));     \
+        T *bp = (T*) internal_malloc((size_t) (n_pad*kc_max) * sizeof(T));     \
+        int64_t jc = jb*LFORTRAN_GEMM_NC;                                      \
+        PREFIX##_block(c, a, b, m, k, jc, MIN(LFORTRAN_GEMM_NC, n - jc),       \
+            ap, bp);                                                           \
+        internal_free(ap);                                                     \
+        internal_free(bp);                                                     \
+    }                                                                          \
+}
+
+#if defined(_OPENMP)
+#  define LFORTRAN_GEMM_PARALLEL_FOR \
+        _Pragma("omp parallel for schedule(static) if(n_blocks > 1)")
+#else
+#  define LFORTRAN_GEMM_PARALLEL_FOR
+#endif
+
+LFORTRAN_DEFINE_GEMM(sgemm, float, LFORTRAN_SGEMM_MR)
+LFORTRAN_DEFINE_GEMM(dgemm, double, LFORTRAN_DGEMM_MR)
+
+/*
+ * Complex products keep the interleaved (re, im) layout of `c`, `a` and `b`
+ * and block the j-k-i loop nest over KC x NC tiles so that the active columns
+ * of `a` stay in cache while a panel of `c` is updated.
+ */
+#define LFORTRAN_DEFINE_COMPLEX_GEMM(PREFIX, T)                                \
+LFORTRAN_GEMM_CLONES                                                           \
+static void PREFIX##_block(T *c, const T *a, const T *b, int64_t m,            \
+        int64_t k, int64_t jc, int64_t nc)                                     \
+{                                                                              \
+    for (int64_t pc = 0; pc < k; pc += LFORTRAN_GEMM_KC) {                     \
+        int64_t kc = MIN(LFORTRAN_GEMM_KC, k - pc);                            \
+        for (int64_t j = jc; j < jc + nc; j++) {                               \
+            T *c_j = c + 2*j*m;                                                \
+            for (int64_t p = pc; p < pc + kc; p++) {                           \
+                T b_re = b[2*(p + j*k)], b_im = b[2*(p + j*k) + 1];            \
+                const T *a_p = a + 2*p*m;                                      \
+                for (int64_t i = 0; i < m; i++) {                              \
+                    T a_re = a_p[2*i], a_im = a_p[2*i + 1];                    \
+                    c_j[2*i] += a_re*b_re - a_im*b_im;                         \
+                    c_j[2*i + 1] += a_re*b_im + a_im*b_re;                     \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+LFORTRAN_API void _lfortran_##PREFIX(void *c_, void *a_, void *b_,             \
+        int64_t m, int64_t n, int64_t k)                                       \
+{                                                                              \
+    T *c = (T*) c_;                                                            \
+    const T *a = (const T*) a_, *b = (const T*) b_;                            \
+    if (m <= 0 || n <= 0) return;                                              \
+    memset(c, 0, (size_t) (2*m*n) * sizeof(T));                                \
+    if (k <= 0) return;                                                        \
+    int64_t n_blocks = (n + LFORTRAN_GEMM_NC - 1) / LFORTRAN_GEMM_NC;          \
+    LFORTRAN_GEMM_PARALLEL_FOR                                                 \
+    for (int64_t jb = 0; jb < n_blocks; jb++) {                                \
+        int64_t jc = jb*LFORTRAN_GEMM_NC;                                      \
+        PREFIX##_block(c, a, b, m, k, jc, MIN(LFORTRAN_GEMM_NC, n - jc));      \
+    }                                                                          \
+}
+
+LFORTRAN_DEFINE_COMPLEX_GEMM(cgemm, float)
+LFORTRAN_DEFINE_COMPLEX_GEMM(zgemm, double)
+
+/*
+ * Real `dot_product` with independent partial sums so that the loop is
+ * vectorized without relying on reassociation of a single accumulator.
+ */
+#define LFORTRAN_DOT_LANES 8
+
+#define LFORTRAN_DEFINE_DOT(PREFIX, T)                                         \
+LFORTRAN_GEMM_CLONES                                                           \
+LFORTRAN_API T _lfortran_##PREFIX(void *a_, void *b_, int64_t n)               \
+{                                                                              \
+    const T *a = (const T*) a_, *b = (const T*) b_;                            \
+    T acc[LFORTRAN_DOT_LANES] = {0};                                           \
+    int64_t i = 0;                                                             \
+    for (; i + LFORTRAN_DOT_LANES <= n; i += LFORTRAN_DOT_LANES) {             \
+        for (int64_t l = 0; l < LFORTRAN_DOT_LANES; l++) {                     \
+            acc[l] += a[i + l] * b[i + l];                                     \
+        }                                                                      \
+    }                                                                          \
+    T r = 0;                                                                   \
+    for (int64_t l = 0; l < LFORTRAN_DOT_LANES; l++) r += acc[l];              \
+    for (; i < n; i++) r += a[i] * b[i];                                       \
+    return r;                                                                  \
+}
+
+LFORTRAN_DEFINE_DOT(sdot, float)
+LFORTRAN_DEFINE_DOT(ddot, double)
+
+// Lock-free combine of OpenMP reduction partials: `*x = op(*x, v)` as a
+// compare-and-swap loop on the bit pattern, so that reals work too.
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static inline bool lfortran_cas32(uint32_t *p, uint32_t *expected, uint32_t desired)
 {
+    uint32_t prev = (uint32_t)_InterlockedCompareExchange((volatile long *)p,
+        (long)desired, (long)*expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+
+static inline bool lfortran_cas64(uint64_t *p, uint64_t *expected, uint64_t desired)
+{
+    uint64_t prev = (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)p,
+        (__int64)desired, (__int64)*expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+#else
+static inline bool lfortran_cas32(uint32_t *p, uint32_t *expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(p, expected, desired, true,
+        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+static inline bool lfortran_cas64(uint64_t *p, uint64_t *expected, uint64_t desired)
+{
+    return __atomic_compare_exchange_n(p, expected, desired, true,
+        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+#endif
+
+#define LFORTRAN_REDUCE_ADD(a, b) ((a) + (b))
+#define LFORTRAN_REDUCE_MUL(a, b) ((a) * (b))
+#define LFORTRAN_REDUCE_MAX(a, b) ((a) < (b) ? (b) : (a))
+#define LFORTRAN_REDUCE_MIN(a, b) ((a) > (b) ? (b) : (a))
+
+#define LFORTRAN_DEFINE_ATOMIC_REDUCE(OP, COMBINE, SUFFIX, T, BITS)            \
+LFORTRAN_API void _lfortran_atomic_reduce_##OP##_##SUFFIX(T *x, T v)           \
+{                                                                              \
+    union { T val; uint##BITS##_t bits; } old, new_;                           \
+    old.val = *(volatile T *)x;                                                \
+    do {                                                                       \
+        new_.val = COMBINE(old.val, v);                                        \
+    } while (!lfortran_cas##BITS((uint##BITS##_t *)x, &old.bits, new_.bits));  \
+}
+
+#define LFORTRAN_DEFINE_ATOMIC_REDUCE_OPS(SUFFIX, T, BITS)                     \
+LFORTRAN_DEFINE_ATOMIC_REDUCE(add, LFORTRAN_REDUCE_ADD, SUFFIX, T, BITS)       \
+LFORTRAN_DEFINE_ATOMIC_REDUCE(mul, LFORTRAN_REDUCE_MUL, SUFFIX, T, BITS)       \
+LFORTRAN_DEFINE_ATOMIC_REDUCE(max, LFORTRAN_REDUCE_MAX, SUFFIX, T, BITS)       \
+LFORTRAN_DEFINE_ATOMIC_REDUCE(min, LFORTRAN_REDUCE_MIN, SUFFIX, T, BITS)
+
+LFORTRAN_DEFINE_ATOMIC_REDUCE_OPS(i32, int32_t, 32)
+LFORTRAN_DEFINE_ATOMIC_REDUCE_OPS(i64, int64_t, 64)
+LFORTRAN_DEFINE_ATOMIC_REDUCE_OPS(f32, float, 32)
+LFORTRAN_DEFINE_ATOMIC_REDUCE_OPS(f64, double, 64)
+
+// Random numbers: xoshiro256++ with one generator per thread. The seed set by
+// random_seed/random_init/srand is the base state; every thread that draws
+// from it takes the next free stream number k and starts from the base state
+// jumped ahead k * 2^128 steps, so threads never share state or overlap. The
+// thread that (re)seeds takes stream 0, which makes serial programs produce
+// the same sequence as before any thread was started. Which stream a worker
+// thread gets depends on the order threads first draw a number.
+
+typedef struct {
+    uint64_t s[4];
+    uint32_t generation;
+} lfortran_rng_state;
+
+static LFORTRAN_THREAD_LOCAL lfortran_rng_state rng_thread_state;
+static uint64_t rng_base[4];
+// Bumped by every reseed; threads holding an older generation re-attach.
+// 0 means no seed has been set yet.
+static volatile uint32_t rng_generation = 0;
+static uint32_t rng_next_stream = 0;
+static uint32_t rng_lock = 0;
+// The seed words passed to random_seed(put=); RANDOM_SEED needs 8 of them.
+#define LFORTRAN_RNG_SEED_SIZE 8
+static uint32_t rng_put_words[LFORTRAN_RNG_SEED_SIZE];
+
+static inline uint64_t rng_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t rng_next(uint64_t *s)
+{
+    uint64_t result = rng_rotl(s[0] + s[3], 23) + s[0];
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rng_rotl(s[3], 45);
+    return result;
+}
+
+// Advances the state by 2^128 steps
+static void rng_jump(uint64_t *s)
+{
+    static const uint64_t jump[] = { 0x180ec6d33cfd0abaULL,
+        0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+    uint64_t t[4] = {0, 0, 0, 0};
+    int i, b;
+    for (i = 0; i < 4; i++) {
+        for (b = 0; b < 64; b++) {
+            if (jump[i] & ((uint64_t)1 << b)) {
+                t[0] ^= s[0];
+                t[1] ^= s[1];
+                t[2] ^= s[2];
+                t[3] ^= s[3];
+            }
+            rng_next(s);
+        }
+    }
+    s[0] = t[0]; s[1] = t[1]; s[2] = t[2]; s[3] = t[3];
+}
+
+static inline uint64_t rng_splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void rng_lock_acquire(void)
+{
+    uint32_t expected;
+    do {
+        expected = 0;
+    } while (!lfortran_cas32(&rng_lock, &expected, 1));
+}
+
+static void rng_lock_release(void)
+{
+    uint32_t expected = 1;
+    while (!lfortran_cas32(&rng_lock, &expected, 0)) expected = 1;
+}
+
+// Installs `s` as the new base state and attaches the calling thread to
+// stream 0. Must be called with rng_lock held.
+static void rng_set_base_locked(const uint64_t *s)
+{
+    uint32_t gen = rng_generation + 1;
+    if (gen == 0) gen = 1;
+    memcpy(rng_base, s, sizeof(rng_base));
+    rng_next_stream = 1;
+    rng_generation = gen;
+    memcpy(rng_thread_state.s, s, sizeof(rng_base));
+    rng_thread_state.generation = gen;
+}
+
+static void rng_seed_u64(uint64_t seed)
+{
+    uint64_t s[4];
     int i;
-    for (i=0; i < n; i++) {
-        v[i] = rand() / (double) RAND_MAX;
+    for (i = 0; i < 4; i++) s[i] = rng_splitmix64(&seed);
+    rng_lock_acquire();
+    rng_set_base_locked(s);
+    rng_lock_release();
+}
+
+static void rng_attach(lfortran_rng_state *st)
+{
+    uint32_t k;
+    rng_lock_acquire();
+    if (rng_generation == 0) {
+        uint64_t seed = 0, s[4];
+        int i;
+        for (i = 0; i < 4; i++) s[i] = rng_splitmix64(&seed);
+        rng_set_base_locked(s);
+        rng_lock_release();
+        return;
+    }
+    memcpy(st->s, rng_base, sizeof(rng_base));
+    st->generation = rng_generation;
+    k = rng_next_stream++;
+    rng_lock_release();
+    while (k-- > 0) rng_jump(st->s);
+}
+
+static inline uint64_t *rng_state(void)
+{
+    lfortran_rng_state *st = &rng_thread_state;
+    if (st->generation != rng_generation || st->generation == 0) {
+        rng_attach(st);
+    }
+    return st->s;
+}
+
+// Uniform in [0, 1): the top 53 (24) bits scaled by 2^-53 (2^-24)
+static inline double rng_to_double(uint64_t x)
+{
+    return (double)(x >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static inline float rng_to_float(uint64_t x)
+{
+    return (float)(x >> 40) * (1.0f / 16777216.0f);
+}
+
+// Fill `v(1:n)` keeping the state in registers for the whole loop
+LFORTRAN_API void _lfortran_dp_random_fill(int64_t n, double *v)
+{
+    uint64_t *p = rng_state();
+    uint64_t s[4] = {p[0], p[1], p[2], p[3]};
+    int64_t i;
+    for (i = 0; i < n; i++) {
+        v[i] = rng_to_double(rng_next(s));
     }
+    p[0] = s[0]; p[1] = s[1]; p[2] = s[2]; p[3] = s[3];
+}
+
+LFORTRAN_API void _lfortran_sp_random_fill(int64_t n, float *v)
+{
+    uint64_t *p = rng_state();
+    uint64_t s[4] = {p[0], p[1], p[2], p[3]};
+    int64_t i;
+    for (i = 0; i < n; i++) {
+        v[i] = rng_to_float(rng_next(s));
+    }
+    p[0] = s[0]; p[1] = s[1]; p[2] = s[2]; p[3] = s[3];
+}
+
+LFORTRAN_API void _lfortran_random_number(int n, double *v)
+{
+    _lfortran_dp_random_fill(n, v);
 }
 
 LFORTRAN_API int _lfortran_init_random_seed(unsigned seed)
 {
-    srand(seed);
+    rng_seed_u64(seed);
     return seed;
 }
 
 LFORTRAN_API void _lfortran_init_random_clock()
 {
-    // The old implementation used the clock to initialize the random seed.
     // Fortran requires random numbers to be deterministic, so we always
-    // initialize with the same seed. The old code should be refactored to
-    // some other function, possibly controllable with a compiler option or
-    // some other mechanism.
-/*
-    unsigned int count;
-#if defined(_WIN32)
-    count = (unsigned int)clock();
-#else
-    struct timespec ts;
-    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-        count = (unsigned int)(ts.tv_nsec);
-    } else {
-        count = (unsigned int)clock();
-    }
-#endif
-    srand(count);
-*/
-    srand(0);
+    // initialize with the same seed (see _lfortran_random_init for the
+    // clock based one).
+    rng_seed_u64(0);
 }
 
 LFORTRAN_API double _lfortran_random()
 {
-    return (rand() / (double) RAND_MAX);
+    return rng_to_double(rng_next(rng_state()));
+}
+
+// Uniform integer in [0, range) by Lemire's multiply-shift, range >= 1
+static inline uint32_t rng_bounded(uint32_t range)
+{
+    return (uint32_t)(((rng_next(rng_state()) >> 32) * (uint64_t)range) >> 32);
 }
 
 LFORTRAN_API int _lfortran_randrange(int lower, int upper)
 {
-    int rr = lower + (rand() % (upper - lower));
-    return rr;
+    return lower + (int)rng_bounded((uint32_t)(upper - lower));
 }
 
 LFORTRAN_API int _lfortran_random_int(int lower, int upper)
 {
-    int randint = lower + (rand() % (upper - lower + 1));
-    return randint;
+    return lower + (int)rng_bounded((uint32_t)(upper - lower) + 1);
 }
 
 LFORTRAN_API void _lfortran_printf(const char* format, const fchar* str, uint32_t str_len, const fchar* end, uint32_t end_len)
@@ -728,6 +1577,1567 @@ void handle_logical(char* format, bool val, char** result) {
     }
 }
 
+/* --- Float to decimal conversion --- */
+
+/*
+ * Correctly rounded decimal digits of binary floating point values, used by
+ * the formatted and list-directed output instead of printf. A finite double
+ * is m * 2^e; when the rounded digits fit in 64 bits they are computed with
+ * 128-bit integer arithmetic, otherwise with a small fixed-size bignum one
+ * digit at a time (Dragon4 without the shortest-digit termination). Ties
+ * round to even like printf in the default rounding mode, so the output is
+ * the same as the `%.*f` / `%.*E` / `%#.*G` conversions it replaces.
+ * real(4) values are converted through their exact double value.
+ */
+
+/* The exact decimal expansion of a double has at most 767 significant
+   digits, so generation always terminates within this buffer. */
+#define FP_DIGITS_SIZE 800
+#define FP_BIG_LIMBS 40
+
+typedef struct fp_bignum {
+    int n;                          /* used limbs, the top one is non-zero */
+    uint32_t limb[FP_BIG_LIMBS];
+} fp_bignum;
+
+static const uint64_t fp_pow10_u64[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/* 10^k as a double, exact for k <= 22 */
+static double fp_pow10_exact(int k) {
+    return k < 20 ? (double)fp_pow10_u64[k] : (double)fp_pow10_u64[19] * (double)fp_pow10_u64[k - 19];
+}
+
+static void fp_decompose(double v, uint64_t* m, int* e) {
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    int biased_exp = (int)((bits >> 52) & 0x7ff);
+    uint64_t fraction = bits & ((1ULL << 52) - 1);
+    if (biased_exp == 0) {
+        *m = fraction;
+        *e = -1074;
+    } else {
+        *m = fraction | (1ULL << 52);
+        *e = biased_exp - 1075;
+    }
+}
+
+static int fp_bit_length(uint64_t x) {
+    int n = 0;
+    while (x >= (1ULL << 16)) { x >>= 16; n += 16; }
+    while (x) { x >>= 1; n++; }
+    return n;
+}
+
+static void fp_big_set_u64(fp_bignum* b, uint64_t v) {
+    b->limb[0] = (uint32_t)v;
+    b->limb[1] = (uint32_t)(v >> 32);
+    b->n = b->limb[1] ? 2 : (b->limb[0] ? 1 : 0);
+}
+
+static void fp_big_mul_small(fp_bignum* b, uint32_t k) {
+    uint64_t carry = 0;
+    for (int i = 0; i < b->n; i++) {
+        uint64_t t = (uint64_t)b->limb[i] * k + carry;
+        b->limb[i] = (uint32_t)t;
+        carry = t >> 32;
+    }
+    if (carry) {
+        b->limb[b->n++] = (uint32_t)carry;
+    }
+}
+
+static void fp_big_mul_pow10(fp_bignum* b, int k) {
+    while (k >= 9) {
+        fp_big_mul_small(b, 1000000000u);
+        k -= 9;
+    }
+    if (k > 0) {
+        fp_big_mul_small(b, (uint32_t)fp_pow10_u64[k]);
+    }
+}
+
+static void fp_big_shl(fp_bignum* b, int s) {
+    if (b->n == 0) return;
+    int limbs = s / 32, bits = s % 32;
+    if (bits) {
+        uint32_t carry = 0;
+        for (int i = 0; i < b->n; i++) {
+            uint32_t t = b->limb[i];
+            b->limb[i] = (t << bits) | carry;
+            carry = t >> (32 - bits);
+        }
+        if (carry) {
+            b->limb[b->n++] = carry;
+        }
+    }
+    if (limbs) {
+        for (int i = b->n - 1; i >= 0; i--) {
+            b->limb[i + limbs] = b->limb[i];
+        }
+        memset(b->limb, 0, limbs * sizeof(uint32_t));
+        b->n += limbs;
+    }
+}
+
+static int fp_big_cmp(const fp_bignum* a, const fp_bignum* b) {
+    if (a->n != b->n) return a->n < b->n ? -1 : 1;
+    for (int i = a->n - 1; i >= 0; i--) {
+        if (a->limb[i] != b->limb[i]) return a->limb[i] < b->limb[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/* a -= b, requires a >= b */
+static void fp_big_sub(fp_bignum* a, const fp_bignum* b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < a->n; i++) {
+        uint64_t t = (uint64_t)a->limb[i] - (i < b->n ? b->limb[i] : 0) - borrow;
+        a->limb[i] = (uint32_t)t;
+        borrow = (t >> 32) & 1;
+    }
+    while (a->n > 0 && a->limb[a->n - 1] == 0) a->n--;
+}
+
+/* Writes the n digits of x (x < 10^n) */
+static void fp_write_u64_digits(char* out, uint64_t x, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        out[i] = (char)('0' + x % 10);
+        x /= 10;
+    }
+}
+
+/* Propagates a round-up through the digits; returns true when it carried
+   out of the first digit (all nines), leaving "100..0" in place. */
+static bool fp_round_up_digits(char* digits, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        if (digits[i] != '9') {
+            digits[i]++;
+            return false;
+        }
+        digits[i] = '0';
+    }
+    digits[0] = '1';
+    return true;
+}
+
+#if defined(__SIZEOF_INT128__)
+typedef unsigned __int128 fp_u128;
+
+static int fp_bit_length_u128(fp_u128 x) {
+    uint64_t hi = (uint64_t)(x >> 64);
+    return hi ? 64 + fp_bit_length(hi) : fp_bit_length((uint64_t)x);
+}
+
+/*
+ * floor(m * 2^e / 10^q) when it fits in 64 bits, with `half` set to how the
+ * discarded part compares with one half (-1, 0, 1). Returns false when the
+ * bignum path has to be used instead.
+ */
+static bool fp_scaled_u64(uint64_t m, int e, int q, uint64_t* d, int* half) {
+    if (q <= 0) {
+        int t = -q;
+        if (t > 27) return false;
+        fp_u128 x = (fp_u128)m;
+        for (int i = 0; i < t; i++) x *= 5;
+        int sh = e + t;   /* m * 10^t * 2^e = m * 5^t * 2^(e + t) */
+        if (sh >= 0) {
+            if (fp_bit_length_u128(x) + sh > 64) return false;
+            *d = (uint64_t)(x << sh);
+            *half = -1;
+            return true;
+        }
+        int s = -sh;
+        if (s >= 128) {
+            /* x < 2^117, far below one half of 2^s */
+            *d = 0;
+            *half = -1;
+            return true;
+        }
+        fp_u128 quotient = x >> s;
+        if (quotient >> 64) return false;
+        fp_u128 rem = x & ((((fp_u128)1) << s) - 1);
+        fp_u128 one_half = ((fp_u128)1) << (s - 1);
+        *d = (uint64_t)quotient;
+        *half = rem < one_half ? -1 : (rem == one_half ? 0 : 1);
+        return true;
+    }
+    if (q > 38) {
+        /* m * 2^e < 2^127 here, so the result is 0 with less than a half */
+        if (e >= 0 && fp_bit_length(m) + e > 127) return false;
+        *d = 0;
+        *half = -1;
+        return true;
+    }
+    fp_u128 den = 1;
+    for (int i = 0; i < q; i++) den *= 10;
+    fp_u128 num = m;
+    if (e >= 0) {
+        if (fp_bit_length(m) + e > 127) return false;
+        num <<= e;
+    } else {
+        if (fp_bit_length_u128(den) - e > 127) {
+            *d = 0;
+            *half = -1;
+            return true;
+        }
+        den <<= -e;
+    }
+    fp_u128 quotient = num / den;
+    if (quotient >> 64) return false;
+    fp_u128 rem2 = (num - quotient * den) * 2;
+    *d = (uint64_t)quotient;
+    *half = rem2 < den ? -1 : (rem2 == den ? 0 : 1);
+    return true;
+}
+#endif
+
+/*
+ * Decimal digits of a finite v > 0. With `fixed` the value is rounded to
+ * `precision` digits after the decimal point, otherwise to `precision`
+ * significant digits. On return the value is 0.<digits> * 10^*decpt. The
+ * return value is the number of digits written, which can be less than the
+ * rounded length: the remaining digits are zeros. 0 means the value rounds
+ * to zero (fixed only), then *decpt is -precision.
+ */
+static int fp_digits(double v, bool fixed, int precision, char* digits, int* decpt) {
+    uint64_t m;
+    int e;
+    fp_decompose(v, &m, &e);
+    int bl = fp_bit_length(m);
+    /* 2^(e+bl-1) <= v < 2^(e+bl), so the number of integer digits is this
+       estimate or one more */
+    int k = (int)floor((e + bl - 1) * 0.30102999566398119521) + 1;
+
+#if defined(__SIZEOF_INT128__)
+    if (fixed) {
+        uint64_t d;
+        int half;
+        if (precision >= 0 && fp_scaled_u64(m, e, -precision, &d, &half)) {
+            if (half > 0 || (half == 0 && (d & 1))) d++;
+            if (d == 0) {
+                *decpt = -precision;
+                return 0;
+            }
+            int n = 1;
+            while (n < 20 && d >= fp_pow10_u64[n]) n++;
+            fp_write_u64_digits(digits, d, n);
+            *decpt = n - precision;
+            return n;
+        }
+    } else if (precision <= 19) {
+        uint64_t d;
+        int half;
+        bool ok = fp_scaled_u64(m, e, k - precision, &d, &half);
+        if (ok && precision < 20 && d >= fp_pow10_u64[precision]) {
+            k++;
+            ok = fp_scaled_u64(m, e, k - precision, &d, &half);
+        }
+        if (ok) {
+            if (half > 0 || (half == 0 && (d & 1))) d++;
+            if (precision < 20 && d == fp_pow10_u64[precision]) {
+                d = fp_pow10_u64[precision - 1];
+                k++;
+            }
+            fp_write_u64_digits(digits, d, precision);
+            *decpt = k;
+            return precision;
+        }
+    }
+#endif
+
+    /* v / 10^k = r / s */
+    fp_bignum r, s;
+    fp_big_set_u64(&r, m);
+    fp_big_set_u64(&s, 1);
+    if (e >= 0) {
+        fp_big_shl(&r, e);
+    } else {
+        fp_big_shl(&s, -e);
+    }
+    if (k >= 0) {
+        fp_big_mul_pow10(&s, k);
+    } else {
+        fp_big_mul_pow10(&r, -k);
+    }
+    if (fp_big_cmp(&r, &s) >= 0) {
+        fp_big_mul_small(&s, 10);
+        k++;
+    }
+    /* Now 0.1 <= r / s < 1 */
+
+    int n = fixed ? k + precision : precision;
+    if (n < 0) {
+        *decpt = -precision;
+        return 0;
+    }
+    if (n == 0) {
+        /* Only the rounding digit is left; ties go to the even 0 */
+        fp_big_shl(&r, 1);
+        if (fp_big_cmp(&r, &s) > 0) {
+            digits[0] = '1';
+            *decpt = k + 1;
+            return 1;
+        }
+        *decpt = -precision;
+        return 0;
+    }
+    int i = 0;
+    while (i < n && i < FP_DIGITS_SIZE - 1 && r.n > 0) {
+        fp_big_mul_small(&r, 10);
+        int digit = 0;
+        while (fp_big_cmp(&r, &s) >= 0) {
+            fp_big_sub(&r, &s);
+            digit++;
+        }
+        digits[i++] = (char)('0' + digit);
+    }
+    if (i == n && r.n > 0) {
+        fp_big_shl(&r, 1);
+        int c = fp_big_cmp(&r, &s);
+        if (c > 0 || (c == 0 && ((digits[n - 1] - '0') & 1))) {
+            if (fp_round_up_digits(digits, n)) {
+                k++;
+                if (fixed && n < FP_DIGITS_SIZE - 1) {
+                    digits[n] = '0';
+                    i = n + 1;
+                }
+            }
+        }
+    }
+    *decpt = k;
+    return i;
+}
+
+typedef struct fp_out {
+    char* buf;
+    size_t cap;
+    size_t len;
+} fp_out;
+
+static inline void fp_put(fp_out* o, char c) {
+    if (o->len + 1 < o->cap) o->buf[o->len] = c;
+    o->len++;
+}
+
+static void fp_put_n(fp_out* o, const char* s, int n) {
+    if (n <= 0) return;
+    if (o->len + n < o->cap) {
+        memcpy(o->buf + o->len, s, n);
+        o->len += n;
+    } else {
+        for (int i = 0; i < n; i++) fp_put(o, s[i]);
+    }
+}
+
+static void fp_put_zeros(fp_out* o, int n) {
+    if (n <= 0) return;
+    if (o->len + n < o->cap) {
+        memset(o->buf + o->len, '0', n);
+        o->len += n;
+    } else {
+        for (int i = 0; i < n; i++) fp_put(o, '0');
+    }
+}
+
+/* e_char (unless it is '\0'), the sign and at least min_digits digits */
+static void fp_put_exponent(fp_out* o, char e_char, int exp, int min_digits) {
+    char tmp[12];
+    int n = 0;
+    int a = exp < 0 ? -exp : exp;
+    if (e_char) fp_put(o, e_char);
+    fp_put(o, exp < 0 ? '-' : '+');
+    do {
+        tmp[n++] = (char)('0' + a % 10);
+        a /= 10;
+    } while (a);
+    for (int i = n; i < min_digits; i++) fp_put(o, '0');
+    while (n) fp_put(o, tmp[--n]);
+}
+
+static int fp_finish(fp_out* o) {
+    if (o->cap > 0) o->buf[o->len < o->cap ? o->len : o->cap - 1] = '\0';
+    return (int)o->len;
+}
+
+/* Fixed layout of n digits with the decimal point after position decpt */
+static void fp_put_fixed(fp_out* o, const char* digits, int n, int decpt,
+        int frac, bool alt) {
+    if (decpt <= 0) {
+        fp_put(o, '0');
+    } else {
+        int int_digits = decpt < n ? decpt : n;
+        fp_put_n(o, digits, int_digits);
+        fp_put_zeros(o, decpt - int_digits);
+    }
+    if (frac > 0 || alt) fp_put(o, '.');
+    if (frac <= 0) return;
+    /* Leading zeros of the fraction, its digits, then trailing zeros */
+    int lead = decpt < 0 ? (-decpt < frac ? -decpt : frac) : 0;
+    fp_put_zeros(o, lead);
+    int first = decpt > 0 ? decpt : 0;
+    int avail = n - first;
+    int count = frac - lead;
+    if (avail > count) avail = count;
+    if (avail > 0) fp_put_n(o, digits + first, avail);
+    fp_put_zeros(o, count - (avail > 0 ? avail : 0));
+}
+
+/* Same as snprintf(buf, cap, alt ? "%#.*f" : "%.*f", frac, v) */
+static int fp_format_f(char* buf, size_t cap, double v, int frac, bool alt) {
+    if (!isfinite(v)) return snprintf(buf, cap, alt ? "%#.*f" : "%.*f", frac, v);
+    fp_out o = {buf, cap, 0};
+    char digits[FP_DIGITS_SIZE];
+    int n = 0, decpt = 0;
+    if (signbit(v)) fp_put(&o, '-');
+    v = fabs(v);
+    if (v != 0.0) n = fp_digits(v, true, frac, digits, &decpt);
+    fp_put_fixed(&o, digits, n, n ? decpt : 0, frac, alt);
+    return fp_finish(&o);
+}
+
+/* Same as snprintf(buf, cap, "%.*E", frac, v), with the E replaced by
+   e_char and at least exp_digits exponent digits (2 for C) */
+static int fp_format_e(char* buf, size_t cap, double v, int frac, char e_char, int exp_digits) {
+    if (!isfinite(v)) return snprintf(buf, cap, "%.*E", frac, v);
+    fp_out o = {buf, cap, 0};
+    char digits[FP_DIGITS_SIZE];
+    int n = 0, decpt = 1;
+    if (signbit(v)) fp_put(&o, '-');
+    v = fabs(v);
+    if (v != 0.0) n = fp_digits(v, false, frac + 1, digits, &decpt);
+    fp_put(&o, n ? digits[0] : '0');
+    if (frac > 0) fp_put(&o, '.');
+    for (int i = 1; i <= frac; i++) fp_put(&o, i < n ? digits[i] : '0');
+    fp_put_exponent(&o, e_char, decpt - 1, exp_digits);
+    return fp_finish(&o);
+}
+
+/* Whether v < 10^p, for a v > 0 that rounds to 10^p at p digits */
+static bool fp_rounds_up_to_pow10(double v, int p) {
+    if (p <= 22) {
+        return v < fp_pow10_exact(p);
+    }
+    /* 10^p is not a double here, and no double is close enough to it for
+       25 digits to round across it */
+    char digits[FP_DIGITS_SIZE];
+    int decpt;
+    fp_digits(v, false, 25, digits, &decpt);
+    return decpt - 1 < p;
+}
+
+/* Same as snprintf(buf, cap, "%#.*G", precision, v) */
+static int fp_format_g_alt(char* buf, size_t cap, double v, int precision) {
+    if (!isfinite(v)) return snprintf(buf, cap, "%#.*G", precision, v);
+    fp_out o = {buf, cap, 0};
+    char digits[FP_DIGITS_SIZE];
+    int p = precision == 0 ? 1 : precision;
+    int n = 0, decpt = 1;
+    if (signbit(v)) fp_put(&o, '-');
+    v = fabs(v);
+    if (v != 0.0) n = fp_digits(v, false, p, digits, &decpt);
+    int x = decpt - 1;
+    if (x == p && n > 0 && fp_rounds_up_to_pow10(v, p)) {
+        /* glibc prints values that reach 10^p only by rounding without
+           fraction digits; keep its output */
+        fp_put(&o, '1');
+        fp_put(&o, '.');
+        fp_put_exponent(&o, 'E', x, 2);
+    } else if (p > x && x >= -4) {
+        fp_put_fixed(&o, digits, n, n ? decpt : 0, p - 1 - x, true);
+    } else {
+        fp_put(&o, n ? digits[0] : '0');
+        fp_put(&o, '.');
+        for (int i = 1; i < p; i++) fp_put(&o, i < n ? digits[i] : '0');
+        fp_put_exponent(&o, 'E', x, 2);
+    }
+    return fp_finish(&o);
+}
+
+/* --- End float to decimal conversion --- */
+
+/* --- Decimal to float conversion --- */
+
+/*
+ * Scanner and converter for Fortran real input: an optional sign, digits
+ * with an optional decimal mark, and an optional exponent written as E, D
+ * or Q with an optionally signed integer, or as a bare signed integer
+ * (`1.5-3`). Inf, Infinity and NaN are accepted in any case. The text is
+ * scanned in place, so callers can pass slices of their record buffers.
+ * The first 19 significant digits w and the decimal exponent q are converted
+ * with Clinger's fast path when w * 10^q is exact in floating point, and
+ * otherwise with the Eisel-Lemire algorithm: w times a 128-bit truncation
+ * of 5^q gives the correctly rounded result in all cases except ones with
+ * more than 19 digits that fall too close to a rounding boundary. Those are
+ * handed to strtod/strtof as plain digits and an `e` exponent.
+ */
+
+#define FP_SCAN_DECIMAL_COMMA 1 /* ',' is the decimal mark, DECIMAL='COMMA' */
+#define FP_SCAN_FIELD 2         /* formatted input, blanks belong to the field */
+#define FP_SCAN_BLANK_ZERO 4    /* with FP_SCAN_FIELD: blanks are zeros (BZ), not ignored (BN) */
+
+/* Significant digits passed on to strtod; 768 decide the rounding of any
+   double, the ones after that only matter for being non-zero */
+#define FP_SCAN_MAX_DIGITS 780
+#define FP_SCAN_MAX_EXP 100000
+
+typedef struct fp_decimal {
+    bool negative;
+    bool is_inf;
+    bool is_nan;
+    bool has_point;
+    bool has_exponent;
+    bool inexact;       /* non-zero digits after the first 19 significant ones */
+    uint64_t mantissa;  /* the first 19 significant digits */
+    int exp10;          /* the value is mantissa * 10^exp10 unless inexact */
+    const char* digits; /* the digits and decimal mark as scanned, for strtod */
+    size_t digits_len;
+    int flags;
+} fp_decimal;
+
+/* The character at s[i] as seen by the scanner: in field mode blanks are
+   read as zeros (BZ) or as nothing, -1 (BN) */
+static inline int fp_scan_char(const char* s, size_t i, int flags) {
+    char c = s[i];
+    if (c == ' ' && (flags & FP_SCAN_FIELD)) {
+        return (flags & FP_SCAN_BLANK_ZERO) ? '0' : -1;
+    }
+    return (unsigned char)c;
+}
+
+/* Index of the next character at or after i that is not an ignored blank */
+static inline size_t fp_scan_skip(const char* s, size_t len, size_t i, int flags) {
+    while (i < len && fp_scan_char(s, i, flags) == -1) i++;
+    return i;
+}
+
+static bool fp_scan_word(const char* s, size_t len, size_t* i, const char* word) {
+    size_t n = strlen(word);
+    if (len - *i < n) return false;
+    for (size_t k = 0; k < n; k++) {
+        if (tolower((unsigned char)s[*i + k]) != word[k]) return false;
+    }
+    *i += n;
+    return true;
+}
+
+/*
+ * Scans a real value at the start of s[0..len) into d. Returns the number of
+ * characters consumed, or 0 if there is no valid value. A trailing exponent
+ * letter without digits is left unconsumed, like strtod does. In field mode
+ * leading blanks are skipped and an all-blank field reads as zero.
+ */
+static size_t fp_scan_real(const char* s, size_t len, int flags, fp_decimal* d) {
+    size_t i = 0;
+    bool field = (flags & FP_SCAN_FIELD) != 0;
+    d->negative = d->is_inf = d->is_nan = false;
+    d->has_point = d->has_exponent = d->inexact = false;
+    d->mantissa = 0;
+    d->exp10 = 0;
+    if (field) {
+        while (i < len && s[i] == ' ') i++;
+        if (i == len) return len;
+    }
+    if (i < len && (s[i] == '+' || s[i] == '-')) {
+        d->negative = (s[i] == '-');
+        i = field ? fp_scan_skip(s, len, i + 1, flags) : i + 1;
+    }
+    if (i < len && (s[i] == 'i' || s[i] == 'I' || s[i] == 'n' || s[i] == 'N')) {
+        if (fp_scan_word(s, len, &i, "inf")) {
+            d->is_inf = true;
+            fp_scan_word(s, len, &i, "inity");
+        } else if (fp_scan_word(s, len, &i, "nan")) {
+            d->is_nan = true;
+            if (i < len && s[i] == '(') {
+                size_t j = i + 1;
+                while (j < len && (isalnum((unsigned char)s[j]) || s[j] == '_')) j++;
+                if (j < len && s[j] == ')') i = j + 1;
+            }
+        } else {
+            return 0;
+        }
+        return i;
+    }
+
+    char mark = (flags & FP_SCAN_DECIMAL_COMMA) ? ',' : '.';
+    bool any_digits = false, has_point = false, inexact = false;
+    uint64_t w = 0;
+    int n_digits = 0, exp10 = 0;
+    int c = -1;
+    d->digits = s + i;
+    for (; i < len; i++) {
+        c = fp_scan_char(s, i, flags);
+        if (c >= '0' && c <= '9') {
+            any_digits = true;
+            if (c == '0' && n_digits == 0) {
+                if (has_point) exp10--;
+            } else if (n_digits < 19) {
+                w = w * 10 + (uint64_t)(c - '0');
+                n_digits++;
+                if (has_point) exp10--;
+            } else {
+                if (c != '0') inexact = true;
+                if (!has_point) exp10++;
+            }
+        } else if (c == mark && !has_point) {
+            has_point = true;
+        } else if (c != -1) {
+            break;
+        }
+    }
+    d->digits_len = (size_t)(s + i - d->digits);
+    if (!any_digits) return 0;
+    d->has_point = has_point;
+
+    if (i < len && (c == 'e' || c == 'E' || c == 'd' || c == 'D' || c == 'q' || c == 'Q'
+            || c == '+' || c == '-')) {
+        size_t j = i;
+        if (c != '+' && c != '-') j = fp_scan_skip(s, len, j + 1, flags);
+        bool exp_negative = false;
+        if (j < len && (s[j] == '+' || s[j] == '-')) {
+            exp_negative = (s[j] == '-');
+            j = fp_scan_skip(s, len, j + 1, flags);
+        }
+        int e = 0;
+        bool any_exp_digits = false;
+        for (; j < len; j++) {
+            c = fp_scan_char(s, j, flags);
+            if (c >= '0' && c <= '9') {
+                if (e < FP_SCAN_MAX_EXP) e = e * 10 + (c - '0');
+                any_exp_digits = true;
+            } else if (c != -1) {
+                break;
+            }
+        }
+        if (any_exp_digits) {
+            exp10 += exp_negative ? -e : e;
+            d->has_exponent = true;
+            i = j;
+        }
+    }
+    d->inexact = inexact;
+    d->mantissa = w;
+    d->exp10 = exp10;
+    d->flags = flags;
+    return i;
+}
+
+#define FP_EL_MIN_POW10 (-342)
+#define FP_EL_MAX_POW10 308
+
+/* 5^q for q in [-342, 308], normalized so the top bit is set and truncated
+   to 128 bits (rounded up for q < 0), high word first */
+static const uint64_t fp_pow5_128[2 * (FP_EL_MAX_POW10 - FP_EL_MIN_POW10 + 1)] = {
+    0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL,
+    0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL,
+    0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL,
+    0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL,
+    0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL,
+    0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL,
+    0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL,
+    0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL,
+    0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL,
+    0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL,
+    0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL,
+    0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL,
+    0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL,
+    0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL,
+    0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL,
+    0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL,
+    0x84a57695fe98746dULL, 0x014bb630f7604b57ULL,
+    0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL,
+    0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL,
+    0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL,
+    0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL,
+    0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL,
+    0xfd00b897478238d0ULL, 0x8920b098955522b4ULL,
+    0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL,
+    0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL,
+    0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL,
+    0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL,
+    0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+    0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL,
+    0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL,
+    0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL,
+    0xeba09271e88d976bULL, 0xf7864a44c633682eULL,
+    0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL,
+    0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL,
+    0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL,
+    0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL,
+    0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL,
+    0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL,
+    0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL,
+    0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL,
+    0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL,
+    0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL,
+    0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL,
+    0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL,
+    0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL,
+    0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL,
+    0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL,
+    0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL,
+    0xa37fce126597973cULL, 0xe50ff107bab528a0ULL,
+    0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL,
+    0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL,
+    0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL,
+    0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL,
+    0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL,
+    0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL,
+    0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL,
+    0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL,
+    0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL,
+    0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL,
+    0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL,
+    0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL,
+    0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL,
+    0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL,
+    0x91376c36d99995beULL, 0x23100809b9c21fa1ULL,
+    0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL,
+    0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL,
+    0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL,
+    0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL,
+    0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL,
+    0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL,
+    0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL,
+    0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL,
+    0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL,
+    0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL,
+    0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL,
+    0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL,
+    0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL,
+    0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL,
+    0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL,
+    0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL,
+    0xc987434744ac874eULL, 0xa327ffb266b56220ULL,
+    0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+    0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL,
+    0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL,
+    0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL,
+    0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL,
+    0xc0314325637a1939ULL, 0xfa911155fefb5308ULL,
+    0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL,
+    0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL,
+    0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL,
+    0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL,
+    0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL,
+    0xb749faed14125d36ULL, 0xcef980ec671f667bULL,
+    0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL,
+    0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL,
+    0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL,
+    0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL,
+    0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL,
+    0xaecc49914078536dULL, 0x58fae9f773886e18ULL,
+    0xda7f5bf590966848ULL, 0xaf39a475506a899eULL,
+    0x888f99797a5e012dULL, 0x6d8406c952429603ULL,
+    0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL,
+    0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL,
+    0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL,
+    0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL,
+    0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL,
+    0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL,
+    0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL,
+    0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL,
+    0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL,
+    0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL,
+    0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL,
+    0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL,
+    0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL,
+    0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL,
+    0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL,
+    0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL,
+    0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL,
+    0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL,
+    0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL,
+    0xb913179899f68584ULL, 0x28e2557b59846e3fULL,
+    0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL,
+    0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL,
+    0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL,
+    0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL,
+    0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL,
+    0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL,
+    0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL,
+    0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL,
+    0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL,
+    0xd77485cb25823ac7ULL, 0x7d633293366b828bULL,
+    0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL,
+    0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL,
+    0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL,
+    0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL,
+    0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+    0xcd795be870516656ULL, 0x67902e276c921f8bULL,
+    0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL,
+    0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL,
+    0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL,
+    0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL,
+    0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL,
+    0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL,
+    0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL,
+    0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL,
+    0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL,
+    0xef340a98172aace4ULL, 0x86fb897116c87c34ULL,
+    0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL,
+    0xbae0a846d2195712ULL, 0x8974836059cca109ULL,
+    0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL,
+    0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL,
+    0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL,
+    0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL,
+    0x8e938662882af53eULL, 0x547eb47b7282ee9cULL,
+    0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL,
+    0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL,
+    0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL,
+    0xae0b158b4738705eULL, 0x9624ab50b148d445ULL,
+    0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL,
+    0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL,
+    0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL,
+    0xd47487cc8470652bULL, 0x7647c3200069671fULL,
+    0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL,
+    0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL,
+    0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL,
+    0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL,
+    0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL,
+    0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL,
+    0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL,
+    0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL,
+    0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL,
+    0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL,
+    0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL,
+    0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL,
+    0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL,
+    0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL,
+    0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL,
+    0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL,
+    0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL,
+    0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL,
+    0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL,
+    0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL,
+    0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL,
+    0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL,
+    0x8c974f7383725573ULL, 0x1e414218c73a13fbULL,
+    0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL,
+    0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL,
+    0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL,
+    0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL,
+    0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+    0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL,
+    0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL,
+    0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL,
+    0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL,
+    0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL,
+    0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL,
+    0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL,
+    0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL,
+    0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL,
+    0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL,
+    0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL,
+    0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL,
+    0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL,
+    0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL,
+    0xbe89523386091465ULL, 0xf6bbb397f1135823ULL,
+    0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL,
+    0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL,
+    0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL,
+    0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL,
+    0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL,
+    0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL,
+    0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL,
+    0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL,
+    0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL,
+    0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL,
+    0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL,
+    0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL,
+    0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL,
+    0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL,
+    0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL,
+    0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL,
+    0x843610cb4bf160cbULL, 0xcedf722a585139baULL,
+    0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL,
+    0xce947a3da6a9273eULL, 0x733d226229feea32ULL,
+    0x811ccc668829b887ULL, 0x0806357d5a3f525fULL,
+    0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL,
+    0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL,
+    0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL,
+    0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL,
+    0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL,
+    0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL,
+    0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL,
+    0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL,
+    0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL,
+    0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL,
+    0xbbe226efb628afeaULL, 0x890489f70a55368bULL,
+    0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL,
+    0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL,
+    0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL,
+    0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL,
+    0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL,
+    0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL,
+    0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL,
+    0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+    0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL,
+    0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL,
+    0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL,
+    0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL,
+    0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL,
+    0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL,
+    0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL,
+    0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL,
+    0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL,
+    0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL,
+    0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL,
+    0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL,
+    0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL,
+    0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL,
+    0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL,
+    0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL,
+    0xc24452da229b021bULL, 0xfbe85badce996168ULL,
+    0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL,
+    0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL,
+    0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL,
+    0xed246723473e3813ULL, 0x290123e9aab23b68ULL,
+    0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL,
+    0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL,
+    0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL,
+    0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL,
+    0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL,
+    0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL,
+    0x8d590723948a535fULL, 0x579c487e5a38ad0eULL,
+    0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL,
+    0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL,
+    0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL,
+    0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL,
+    0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL,
+    0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL,
+    0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL,
+    0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL,
+    0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL,
+    0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL,
+    0xcdb02555653131b6ULL, 0x3792f412cb06794dULL,
+    0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL,
+    0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL,
+    0xc8de047564d20a8bULL, 0xf245825a5a445275ULL,
+    0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL,
+    0x9ced737bb6c4183dULL, 0x55464dd69685606bULL,
+    0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL,
+    0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL,
+    0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL,
+    0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL,
+    0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL,
+    0x95a8637627989aadULL, 0xdde7001379a44aa8ULL,
+    0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL,
+    0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL,
+    0x9226712162ab070dULL, 0xcab3961304ca70e8ULL,
+    0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+    0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL,
+    0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL,
+    0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL,
+    0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL,
+    0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL,
+    0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL,
+    0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL,
+    0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL,
+    0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL,
+    0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL,
+    0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL,
+    0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL,
+    0xcfb11ead453994baULL, 0x67de18eda5814af2ULL,
+    0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL,
+    0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL,
+    0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL,
+    0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL,
+    0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL,
+    0xc612062576589ddaULL, 0x95364afe032a819eULL,
+    0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL,
+    0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL,
+    0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL,
+    0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL,
+    0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL,
+    0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL,
+    0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL,
+    0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL,
+    0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL,
+    0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL,
+    0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL,
+    0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL,
+    0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL,
+    0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL,
+    0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL,
+    0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL,
+    0x89705f4136b4a597ULL, 0x31680a88f8953031ULL,
+    0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL,
+    0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL,
+    0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL,
+    0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL,
+    0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL,
+    0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL,
+    0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL,
+    0xccccccccccccccccULL, 0xcccccccccccccccdULL,
+    0x8000000000000000ULL, 0x0000000000000000ULL,
+    0xa000000000000000ULL, 0x0000000000000000ULL,
+    0xc800000000000000ULL, 0x0000000000000000ULL,
+    0xfa00000000000000ULL, 0x0000000000000000ULL,
+    0x9c40000000000000ULL, 0x0000000000000000ULL,
+    0xc350000000000000ULL, 0x0000000000000000ULL,
+    0xf424000000000000ULL, 0x0000000000000000ULL,
+    0x9896800000000000ULL, 0x0000000000000000ULL,
+    0xbebc200000000000ULL, 0x0000000000000000ULL,
+    0xee6b280000000000ULL, 0x0000000000000000ULL,
+    0x9502f90000000000ULL, 0x0000000000000000ULL,
+    0xba43b74000000000ULL, 0x0000000000000000ULL,
+    0xe8d4a51000000000ULL, 0x0000000000000000ULL,
+    0x9184e72a00000000ULL, 0x0000000000000000ULL,
+    0xb5e620f480000000ULL, 0x0000000000000000ULL,
+    0xe35fa931a0000000ULL, 0x0000000000000000ULL,
+    0x8e1bc9bf04000000ULL, 0x0000000000000000ULL,
+    0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL,
+    0xde0b6b3a76400000ULL, 0x0000000000000000ULL,
+    0x8ac7230489e80000ULL, 0x0000000000000000ULL,
+    0xad78ebc5ac620000ULL, 0x0000000000000000ULL,
+    0xd8d726b7177a8000ULL, 0x0000000000000000ULL,
+    0x878678326eac9000ULL, 0x0000000000000000ULL,
+    0xa968163f0a57b400ULL, 0x0000000000000000ULL,
+    0xd3c21bcecceda100ULL, 0x0000000000000000ULL,
+    0x84595161401484a0ULL, 0x0000000000000000ULL,
+    0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL,
+    0xcecb8f27f4200f3aULL, 0x0000000000000000ULL,
+    0x813f3978f8940984ULL, 0x4000000000000000ULL,
+    0xa18f07d736b90be5ULL, 0x5000000000000000ULL,
+    0xc9f2c9cd04674edeULL, 0xa400000000000000ULL,
+    0xfc6f7c4045812296ULL, 0x4d00000000000000ULL,
+    0x9dc5ada82b70b59dULL, 0xf020000000000000ULL,
+    0xc5371912364ce305ULL, 0x6c28000000000000ULL,
+    0xf684df56c3e01bc6ULL, 0xc732000000000000ULL,
+    0x9a130b963a6c115cULL, 0x3c7f400000000000ULL,
+    0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL,
+    0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL,
+    0x96769950b50d88f4ULL, 0x1314448000000000ULL,
+    0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL,
+    0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL,
+    0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL,
+    0xb7abc627050305adULL, 0xf14a3d9e40000000ULL,
+    0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL,
+    0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL,
+    0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL,
+    0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL,
+    0x8c213d9da502de45ULL, 0x4526f422cc340000ULL,
+    0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL,
+    0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL,
+    0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL,
+    0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL,
+    0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL,
+    0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL,
+    0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL,
+    0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL,
+    0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL,
+    0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL,
+    0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL,
+    0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL,
+    0x9f4f2726179a2245ULL, 0x01d762422c946590ULL,
+    0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL,
+    0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL,
+    0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+    0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL,
+    0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL,
+    0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL,
+    0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL,
+    0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL,
+    0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL,
+    0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL,
+    0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL,
+    0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL,
+    0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL,
+    0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL,
+    0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL,
+    0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL,
+    0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL,
+    0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL,
+    0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL,
+    0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL,
+    0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL,
+    0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL,
+    0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL,
+    0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL,
+    0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL,
+    0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL,
+    0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL,
+    0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL,
+    0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL,
+    0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL,
+    0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL,
+    0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL,
+    0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL,
+    0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL,
+    0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL,
+    0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL,
+    0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL,
+    0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL,
+    0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL,
+    0x924d692ca61be758ULL, 0x593c2626705f9c56ULL,
+    0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL,
+    0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL,
+    0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL,
+    0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL,
+    0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL,
+    0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL,
+    0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL,
+    0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL,
+    0x884134fe908658b2ULL, 0x3109058d147fdcddULL,
+    0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL,
+    0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL,
+    0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL,
+    0xa6539930bf6bff45ULL, 0x84db8346b786151cULL,
+    0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL,
+    0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL,
+    0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL,
+    0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+    0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL,
+    0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL,
+    0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL,
+    0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL,
+    0x9ae757596946075fULL, 0x3375788de9b06958ULL,
+    0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL,
+    0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL,
+    0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL,
+    0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL,
+    0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL,
+    0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL,
+    0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL,
+    0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL,
+    0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL,
+    0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL,
+    0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL,
+    0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL,
+    0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL,
+    0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL,
+    0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL,
+    0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL,
+    0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL,
+    0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL,
+    0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL,
+    0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL,
+    0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL,
+    0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL,
+    0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL,
+    0x802221226be55a64ULL, 0xc2494954da2c9789ULL,
+    0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL,
+    0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL,
+    0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL,
+    0x9c69a97284b578d7ULL, 0xff2a760414536efbULL,
+    0xc38413cf25e2d70dULL, 0xfef5138519684abaULL,
+    0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL,
+    0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL,
+    0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL,
+    0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL,
+    0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL,
+    0xba756174393d88dfULL, 0x94f971119aeef9e4ULL,
+    0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL,
+    0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL,
+    0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL,
+    0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL,
+    0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL,
+    0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL,
+    0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL,
+    0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL,
+    0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL,
+    0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL,
+    0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL,
+    0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL,
+    0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL,
+    0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+    0xa59bc234db398c25ULL, 0x43fab9837e699095ULL,
+    0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL,
+    0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL,
+    0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL,
+    0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL,
+    0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL,
+    0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL,
+    0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL,
+    0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL,
+    0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL,
+    0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL,
+    0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL,
+    0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL,
+    0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL,
+    0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL,
+    0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL,
+    0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL,
+    0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL,
+    0x8fa475791a569d10ULL, 0xf96e017d694487bcULL,
+    0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL,
+    0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL,
+    0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL,
+    0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL,
+    0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL,
+    0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL,
+    0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL,
+    0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL,
+    0x85c7056562757456ULL, 0xf6872d5667844e49ULL,
+    0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL,
+    0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL,
+    0x82a45b450226b39cULL, 0xecc0024661173473ULL,
+    0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL,
+    0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL,
+    0xff290242c83396ceULL, 0x7e67047175a15271ULL,
+    0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL,
+    0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL,
+    0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL,
+    0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL,
+    0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL,
+    0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL,
+    0x98165af37b2153deULL, 0xc3727a337a8b704aULL,
+    0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL,
+    0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL,
+    0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL,
+    0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL,
+    0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL,
+    0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL,
+    0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL,
+    0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL,
+    0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL,
+    0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL,
+    0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL,
+    0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL,
+    0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+    0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL,
+    0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL,
+    0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL,
+    0xd31045a8341ca07cULL, 0x1ede48111209a050ULL,
+    0x83ea2b892091e44dULL, 0x934aed0aab460432ULL,
+    0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL,
+    0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL,
+    0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL,
+    0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL,
+    0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL,
+    0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL,
+    0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL,
+    0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL,
+    0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL,
+    0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL,
+    0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL,
+    0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL,
+    0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL,
+    0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL,
+    0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL,
+    0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL,
+    0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL,
+    0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL,
+    0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL,
+    0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL,
+    0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL,
+    0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL,
+    0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL,
+    0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL,
+    0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL,
+    0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL,
+    0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL,
+    0x8533285c936b35deULL, 0xd53a88958f87275fULL,
+    0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL,
+    0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL,
+    0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL,
+    0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL,
+    0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL,
+    0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL,
+    0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL,
+    0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL,
+    0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL,
+    0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL,
+    0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL,
+    0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL,
+    0x976e41088617ca01ULL, 0xd5be0503e085d813ULL,
+    0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL,
+    0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL,
+    0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL,
+    0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL,
+    0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL,
+    0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL,
+    0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL,
+    0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+    0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL,
+    0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL,
+    0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL,
+    0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL,
+    0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL,
+    0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL,
+    0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL,
+    0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL,
+    0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL,
+    0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL,
+    0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL,
+    0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL,
+    0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL,
+    0xa0555e361951c366ULL, 0xd7e105bcc332621fULL,
+    0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL,
+    0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL,
+    0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL,
+    0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL,
+    0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL,
+    0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL,
+    0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL,
+    0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL,
+    0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL,
+    0xbaa718e68396cffdULL, 0xd30560258f54e6baULL,
+    0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL,
+    0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL,
+    0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL,
+    0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL,
+    0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL
+};
+
+static inline uint64_t fp_mul_64x64(uint64_t a, uint64_t b, uint64_t* hi) {
+#if defined(__SIZEOF_INT128__)
+    fp_u128 r = (fp_u128)a * b;
+    *hi = (uint64_t)(r >> 64);
+    return (uint64_t)r;
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+    *hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (uint32_t)lo_lo;
+#endif
+}
+
+static inline int fp_leading_zeros(uint64_t x) {
+    return 64 - fp_bit_length(x);
+}
+
+/*
+ * Eisel-Lemire: the bits of w * 10^q, w != 0, correctly rounded to a binary
+ * format with `mantissa_bits` explicit mantissa bits and the given minimum
+ * exponent. The result is the raw biased exponent and mantissa fields, with
+ * the exponent set to all ones for an infinity.
+ */
+static uint64_t fp_eisel_lemire(uint64_t w, int q, int mantissa_bits, int min_exponent,
+        int max_biased_exp, int min_round_to_even, int max_round_to_even) {
+    if (q < FP_EL_MIN_POW10) return 0;
+    if (q > FP_EL_MAX_POW10) return (uint64_t)max_biased_exp << mantissa_bits;
+    int lz = fp_leading_zeros(w);
+    w <<= lz;
+    const uint64_t* p5 = &fp_pow5_128[2 * (q - FP_EL_MIN_POW10)];
+    uint64_t hi, lo = fp_mul_64x64(w, p5[0], &hi);
+    uint64_t precision_mask = 0xFFFFFFFFFFFFFFFFULL >> (mantissa_bits + 3);
+    if ((hi & precision_mask) == precision_mask) {
+        /* The truncated power could matter, add the next 64 bits of it */
+        uint64_t hi2;
+        fp_mul_64x64(w, p5[1], &hi2);
+        lo += hi2;
+        if (hi2 > lo) hi++;
+    }
+    int upperbit = (int)(hi >> 63);
+    int shift = upperbit + 64 - mantissa_bits - 3;
+    uint64_t mantissa = hi >> shift;
+    /* floor(q * log2(10)) + 63 */
+    int power2 = (int)((((int64_t)152170 + 65536) * q) >> 16) + 63 + upperbit - lz - min_exponent;
+    if (power2 <= 0) {
+        /* Subnormal */
+        if (-power2 + 1 >= 64) return 0;
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (1ULL << mantissa_bits) ? 0 : 1;
+        return ((uint64_t)power2 << mantissa_bits) | (mantissa & ((1ULL << mantissa_bits) - 1));
+    }
+    /* An exact halfway case rounds to even; only possible when 5^q fits in
+       64 bits, i.e. the product was exact */
+    if (lo <= 1 && q >= min_round_to_even && q <= max_round_to_even
+            && (mantissa & 3) == 1 && (mantissa << shift) == hi) {
+        mantissa &= ~1ULL;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << mantissa_bits)) {
+        mantissa = 1ULL << mantissa_bits;
+        power2++;
+    }
+    mantissa &= ~(1ULL << mantissa_bits);
+    if (power2 >= max_biased_exp) return (uint64_t)max_biased_exp << mantissa_bits;
+    return ((uint64_t)power2 << mantissa_bits) | mantissa;
+}
+
+static inline double fp_eisel_lemire_double(uint64_t w, int q) {
+    uint64_t bits = fp_eisel_lemire(w, q, 52, -1023, 0x7FF, -4, 23);
+    double v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+static inline float fp_eisel_lemire_float(uint64_t w, int q) {
+    uint32_t bits = (uint32_t)fp_eisel_lemire(w, q, 23, -127, 0xFF, -17, 10);
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+/* The significant digits of d and its exponent as text strtod can read,
+   without the sign and independent of the locale's decimal point */
+static void fp_decimal_to_text(const fp_decimal* d, char* buf, size_t cap) {
+    size_t n = 0;
+    bool dropped = false;
+    for (size_t k = 0; k < d->digits_len; k++) {
+        int c = fp_scan_char(d->digits, k, d->flags);
+        if (c < '0' || c > '9' || (n == 0 && c == '0')) continue;
+        if (n < FP_SCAN_MAX_DIGITS) {
+            buf[n++] = (char)c;
+        } else if (c != '0') {
+            dropped = true;
+        }
+    }
+    /* d->exp10 scales the first 19 digits */
+    int exp10 = d->exp10 - (n > 19 ? (int)n - 19 : 0);
+    if (dropped) {
+        buf[n++] = '1';
+        exp10--;
+    }
+    snprintf(buf + n, cap - n, "e%d", exp10);
+}
+
+static double fp_decimal_to_double(const fp_decimal* d) {
+    double v;
+    uint64_t w = d->mantissa;
+    int q = d->exp10;
+    if (d->is_nan) return d->negative ? -NAN : NAN;
+    if (d->is_inf) return d->negative ? -INFINITY : INFINITY;
+    if (w == 0) return d->negative ? -0.0 : 0.0;
+    if (!d->inexact) {
+        if (w <= (1ULL << 53) && q >= -22 && q <= 22) {
+            v = q < 0 ? (double)w / fp_pow10_exact(-q) : (double)w * fp_pow10_exact(q);
+        } else {
+            v = fp_eisel_lemire_double(w, q);
+        }
+        return d->negative ? -v : v;
+    }
+    /* The dropped digits put the value strictly between w and w + 1 */
+    v = fp_eisel_lemire_double(w, q);
+    if (w == UINT64_MAX || v != fp_eisel_lemire_double(w + 1, q)) {
+        char buf[FP_SCAN_MAX_DIGITS + 16];
+        fp_decimal_to_text(d, buf, sizeof(buf));
+        v = strtod(buf, NULL);
+    }
+    return d->negative ? -v : v;
+}
+
+static float fp_decimal_to_float(const fp_decimal* d) {
+    float v;
+    uint64_t w = d->mantissa;
+    int q = d->exp10;
+    if (d->is_nan) return d->negative ? -NAN : NAN;
+    if (d->is_inf) return d->negative ? -INFINITY : INFINITY;
+    if (w == 0) return d->negative ? -0.0f : 0.0f;
+    if (!d->inexact) {
+        if (w <= (1ULL << 24) && q >= -10 && q <= 10) {
+            float p = (float)fp_pow10_u64[q < 0 ? -q : q];
+            v = q < 0 ? (float)w / p : (float)w * p;
+        } else {
+            v = fp_eisel_lemire_float(w, q);
+        }
+        return d->negative ? -v : v;
+    }
+    v = fp_eisel_lemire_float(w, q);
+    if (w == UINT64_MAX || v != fp_eisel_lemire_float(w + 1, q)) {
+        char buf[FP_SCAN_MAX_DIGITS + 16];
+        fp_decimal_to_text(d, buf, sizeof(buf));
+        v = strtof(buf, NULL);
+    }
+    return d->negative ? -v : v;
+}
+
+/* Whether the n digits times 10^exp10 read back as v (as a float with
+   `single`) */
+static bool fp_reads_back(double v, bool single, const char* digits, int n, int exp10) {
+    fp_decimal d;
+    memset(&d, 0, sizeof(d));
+    for (int i = 0; i < n; i++) d.mantissa = d.mantissa * 10 + (uint64_t)(digits[i] - '0');
+    d.exp10 = exp10;
+    if (single) return fp_decimal_to_float(&d) == (float)v;
+    return fp_decimal_to_double(&d) == v;
+}
+
+/*
+ * The fewest significant digits of a finite v > 0 that read back as v, at
+ * most 17 (9 for a real(4) value with `single`). Returns the number of
+ * digits, the value is 0.<digits> * 10^*decpt. Of the n digit values, the
+ * correctly rounded one is the closest to v, and an n + 1 digit one is never
+ * further, so the length is found by bisection. Only for a power of two,
+ * where the values that read back as v reach less far below it than above,
+ * can the next n digit value up read back when the closest one does not;
+ * there the lengths are tried one at a time with both candidates.
+ */
+static int fp_shortest_digits(double v, bool single, char* digits, int* decpt) {
+    int max_digits = single ? 9 : 17;
+    int n, e2;
+    if (frexp(v, &e2) == 0.5) {
+        for (int len = 1; len < max_digits; len++) {
+            n = fp_digits(v, false, len, digits, decpt);
+            if (fp_reads_back(v, single, digits, n, *decpt - n)) break;
+            memset(digits + n, '0', len - n);
+            if (fp_round_up_digits(digits, len)) (*decpt)++;
+            n = len;
+            if (fp_reads_back(v, single, digits, n, *decpt - n)) break;
+            n = 0;
+        }
+        if (n == 0) n = fp_digits(v, false, max_digits, digits, decpt);
+    } else {
+        int lo = 1, hi = max_digits;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            n = fp_digits(v, false, mid, digits, decpt);
+            if (fp_reads_back(v, single, digits, n, *decpt - n)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        n = fp_digits(v, false, hi, digits, decpt);
+    }
+    while (n > 1 && digits[n - 1] == '0') n--;
+    return n;
+}
+
+/*
+ * The shortest text that reads back as v, laid out like Python's repr():
+ * positional for 1e-4 <= |v| < 1e16 with at least one fraction digit
+ * ("2.3", "100.0", "0.0001"), otherwise "1.5e-07" / "1e+16".
+ */
+static int fp_format_shortest(char* buf, size_t cap, double v, bool single) {
+    fp_out o = {buf, cap, 0};
+    if (isnan(v)) {
+        fp_put_n(&o, "nan", 3);
+        return fp_finish(&o);
+    }
+    if (signbit(v)) fp_put(&o, '-');
+    v = fabs(v);
+    if (isinf(v)) {
+        fp_put_n(&o, "inf", 3);
+        return fp_finish(&o);
+    }
+    if (v == 0.0) {
+        fp_put_n(&o, "0.0", 3);
+        return fp_finish(&o);
+    }
+    char digits[FP_DIGITS_SIZE];
+    int decpt;
+    int n = fp_shortest_digits(v, single, digits, &decpt);
+    if (decpt > -4 && decpt <= 16) {
+        int frac = n - decpt;
+        fp_put_fixed(&o, digits, n, decpt, frac > 0 ? frac : 1, false);
+    } else {
+        fp_put(&o, digits[0]);
+        if (n > 1) {
+            fp_put(&o, '.');
+            fp_put_n(&o, digits + 1, n - 1);
+        }
+        fp_put_exponent(&o, 'e', decpt - 1, 2);
+    }
+    return fp_finish(&o);
+}
+
+/* --- End decimal to float conversion --- */
+
 static void format_float_fortran(char* result, float val);
 static void format_double_fortran(char* result, double val);
 
@@ -830,7 +3240,7 @@ void handle_float(FloatFormatType format_type, char* format, double val, int sca
     // TODO: This will work for up to `F65.60` but will fail for:
     // print "(F67.62)", 1.23456789101112e-62_8
     char dec_str[64];
-    sprintf(dec_str, "%.*f", decimal_digits, decimal_part);
+    fp_format_f(dec_str, sizeof(dec_str), decimal_part, decimal_digits, false);
     // removing the leading "0." from the formatted decimal part
     memmove(dec_str, dec_str + 2, strlen(dec_str)-1);
 
@@ -907,6 +3317,34 @@ void parse_decimal_or_en_format(char* format, int* width_digits, int* decimal_di
     }
 }
 
+/* Appends n copies of ch to *result */
+static void append_fill(char** result, char ch, int n) {
+    if (n <= 0) return;
+    char stack_buf[128];
+    char* buf = n < (int)sizeof(stack_buf) ? stack_buf : (char*)internal_malloc(n + 1);
+    memset(buf, ch, n);
+    buf[n] = '\0';
+    *result = append_to_string(*result, buf);
+    if (buf != stack_buf) internal_free(buf);
+}
+
+static int count_decimal_digits(int x) {
+    int n = 1;
+    while (x >= 10) {
+        x /= 10;
+        n++;
+    }
+    return n;
+}
+
+/* Writes the first `count` of the n significant digits, zeros after them */
+static void fp_put_significand(fp_out* o, const char* digits, int n, int start, int count) {
+    int avail = n - start;
+    if (avail > count) avail = count;
+    if (avail > 0) fp_put_n(o, digits + start, avail);
+    fp_put_zeros(o, count - (avail > 0 ? avail : 0));
+}
+
 /*
 `handle_en` - Formats a floating-point number using a Fortran-style "EN" format.
 
@@ -918,10 +3356,8 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
     int width, decimal_digits, exp_digits;
     parse_decimal_or_en_format(format, &width, &decimal_digits, &exp_digits);
 
-    // Default fallback if 0
     bool is_g0_like = (width == 0 && decimal_digits == 0 && exp_digits == 0);
-    if (decimal_digits <= 0) decimal_digits = 9;
-    
+
     // Store original exp_digits to know if Ee was explicitly specified
     int original_exp_digits = exp_digits;
     if (exp_digits == 0) exp_digits = 2;
@@ -929,10 +3365,9 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
 
     bool sign_plus_exist = (is_signed_plus && val >= 0); // SP specifier
 
-    char formatted_value[256];
     double abs_val = fabs(val);
 
-    // Handle special values (Infinity, NaN) before any log10 calculations
+    // Handle special values (Infinity, NaN) before any digit generation
     if (isnan(val) || isinf(val)) {
         const char* special_str;
         const char* short_str = NULL;
@@ -951,121 +3386,86 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
         int special_len = strlen(special_str);
         if (width > 0 && special_len > width && short_str != NULL) {
             special_str = short_str;
-            special_len = strlen(special_str);
-        }
-        if (width == 0 || special_len <= width) {
-            if (width > special_len) {
-                for (int i = 0; i < width - special_len; i++) {
-                    *result = append_to_string(*result, " ");
-                }
-            }
+            special_len = strlen(special_str);
+        }
+        if (width == 0 || special_len <= width) {
+            append_fill(result, ' ', width - special_len);
             *result = append_to_string(*result, special_str);
         } else {
-            for (int i = 0; i < width; i++) {
-                *result = append_to_string(*result, "*");
-            }
+            append_fill(result, '*', width);
         }
         return;
-    } else if (is_g0_like) {
-        // For EN0.0E0, always use engineering notation: scale exponent to multiple of 3
-        int exponent = 0;
-        double scaled_val = val;
-        if (abs_val != 0.0) {
-            exponent = (int)floor(log10(abs_val));
-            int remainder = exponent % 3;
-            if (remainder < 0) remainder += 3;
-            exponent -= remainder;
-            scaled_val = val / pow(10, exponent);
-        }
-
-        // For EN0.0E0, format with 0 decimal digits but keep the decimal point
-        char val_str[128];
-        snprintf(val_str, sizeof(val_str), "%#.0f", scaled_val);
-        if (fabs(atof(val_str)) >= 1000.0) {
-            exponent += 3;
-            scaled_val = val / pow(10, exponent);
-            snprintf(val_str, sizeof(val_str), "%#.0f", scaled_val);
-        }
-        snprintf(formatted_value, sizeof(formatted_value),
-                "%s%s%+d", val_str, c, exponent);  // no padding, plain exponent
-    } else {
-        int exponent = 0;
-        double scaled_val = val;
-        if (abs_val != 0.0) {
-            exponent = (int)floor(log10(abs_val));
-            int remainder = exponent % 3;
-            if (remainder < 0) remainder += 3;
-            exponent -= remainder;
-            scaled_val = val / pow(10, exponent);
-        }
-        
-        char val_str[128];
-        snprintf(val_str, sizeof(val_str), "%.*f", decimal_digits, scaled_val);
-        if (fabs(atof(val_str)) >= 1000.0) {
-            exponent += 3;
-            scaled_val = val / pow(10, exponent);
-            snprintf(val_str, sizeof(val_str), "%.*f", decimal_digits, scaled_val);
-        }
+    }
 
+    // The exponent is a multiple of 3 and the significand has 1 to 3
+    // digits before the decimal mark; for EN0.0E0 it has no fraction
+    // digits but keeps the decimal mark
+    int frac = is_g0_like ? 0 : decimal_digits;
+    char digits[FP_DIGITS_SIZE];
+    int n = 0, exponent = 0, int_digits = 1;
+    if (abs_val != 0.0) {
+        // Rounded to 3 + frac digits first; that is the result when it has
+        // 3 digits before the decimal mark, also when it rounded up to the
+        // next power of 10. Otherwise it is rounded again to fewer digits.
+        int decpt;
+        n = fp_digits(abs_val, false, 3 + frac, digits, &decpt);
+        int e10 = decpt - 1;
+        exponent = e10 - ((e10 % 3) + 3) % 3;
+        int_digits = e10 - exponent + 1;
+        if (int_digits < 3) {
+            n = fp_digits(abs_val, false, int_digits + frac, digits, &decpt);
+            if (decpt - 1 > e10) {
+                // Rounded up to 10^(e10 + 1), the digits are now 100...0
+                int_digits++;
+            }
+        }
+    }
+
+    int abs_exp = exponent < 0 ? -exponent : exponent;
+    int min_exp_digits = 1;
+    if (!is_g0_like) {
         // Adjust exp_digits dynamically if no explicit Ee was given
         if (original_exp_digits <= 0) {
-            int abs_exp = (exponent < 0 ? -exponent : exponent);
-            if (abs_exp >= 100) {
-                exp_digits = 3;
-            } else if (abs_exp >= 10) {
-                exp_digits = 2;
-            } else {
-                exp_digits = 2;
-            }
-        }
-
-        snprintf(formatted_value, sizeof(formatted_value),
-                "%s%s%+0*d", val_str, c, exp_digits + 1, exponent);
-    }
-
-    // Width == 0, no padding
-    if (width == 0) {
-        if (sign_plus_exist) {
-            char* temp = internal_malloc(strlen(formatted_value) + 2);
-            temp[0] = '+';
-            strcpy(temp + 1, formatted_value);
-            *result = append_to_string(*result, temp);
-            internal_free(temp);
-        } else {
-            *result = append_to_string(*result, formatted_value);
+            exp_digits = abs_exp >= 100 ? 3 : 2;
         }
-        return;
+        min_exp_digits = exp_digits;
     }
+    int exp_len = count_decimal_digits(abs_exp);
+    if (exp_len < min_exp_digits) exp_len = min_exp_digits;
+    // As for E, the letter is dropped for 3 digit exponents without Ee
+    bool drop_e = !is_g0_like && original_exp_digits <= 0 && abs_exp >= 100;
+    int c_len = drop_e ? 0 : (int)strlen(c);
+    bool negative = signbit(val);
+    int value_len = negative + int_digits + 1 + frac + c_len + 1 + exp_len;
+    int total_len = value_len + sign_plus_exist;
 
-    // Check for overflow
-    int total_len = strlen(formatted_value);
-    if (sign_plus_exist) total_len += 1;
-    
-    if (total_len > width) {
+    if (width > 0 && total_len > width) {
         // Overflow: fill with '*'
-        char* final_result = internal_malloc(width + 1);
-        memset(final_result, '*', width);
-        final_result[width] = '\0';
-        *result = append_to_string(*result, final_result);
-        internal_free(final_result);
+        append_fill(result, '*', width);
         return;
     }
 
-    // Allocate and pad properly
-    char* final_result = internal_malloc(width + 1);
-    int padding = width - strlen(formatted_value) - sign_plus_exist;
-    if (padding > 0) {
-        memset(final_result, ' ', padding);
-        if (sign_plus_exist) final_result[padding] = '+';
-        strcpy(final_result + padding + sign_plus_exist, formatted_value);
+    int padding = width > total_len ? width - total_len : 0;
+    size_t cap = (size_t)(padding + total_len) + 1;
+    char stack_buf[128];
+    char* buf = cap <= sizeof(stack_buf) ? stack_buf : (char*)internal_malloc(cap);
+    fp_out o = {buf, cap, 0};
+    for (int i = 0; i < padding; i++) fp_put(&o, ' ');
+    if (sign_plus_exist) fp_put(&o, '+');
+    if (negative) fp_put(&o, '-');
+    if (n == 0) {
+        fp_put(&o, '0');
     } else {
-        if (sign_plus_exist) final_result[0] = '+';
-        strncpy(final_result + is_signed_plus, formatted_value, width);
-        final_result[width] = '\0';
+        fp_put_significand(&o, digits, n, 0, int_digits);
     }
+    fp_put(&o, '.');
+    fp_put_significand(&o, digits, n, int_digits, frac);
+    fp_put_n(&o, c, c_len);
+    fp_put_exponent(&o, '\0', exponent, min_exp_digits);
+    fp_finish(&o);
 
-    *result = append_to_string(*result, final_result);
-    internal_free(final_result);
+    *result = append_to_string(*result, buf);
+    if (buf != stack_buf) internal_free(buf);
 }
 
 void handle_decimal(char* format, double val, int scale, char** result, char* c, bool is_signed_plus) {
@@ -1076,7 +3476,7 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
     parse_decimal_or_en_format(format, &width_digits, &decimal_digits, &exp_digits);
     int width = width_digits;
 
-    // Handle special values (Infinity, NaN) before any log10 calculations
+    // Handle special values (Infinity, NaN) before any digit generation
     if (isnan(val) || isinf(val)) {
         const char* special_str;
         const char* short_str = NULL;
@@ -1098,16 +3498,10 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
             special_len = strlen(special_str);
         }
         if (width == 0 || special_len <= width) {
-            if (width > special_len) {
-                for (int i = 0; i < width - special_len; i++) {
-                    *result = append_to_string(*result, " ");
-                }
-            }
+            append_fill(result, ' ', width - special_len);
             *result = append_to_string(*result, special_str);
         } else {
-            for (int i = 0; i < width; i++) {
-                *result = append_to_string(*result, "*");
-            }
+            append_fill(result, '*', width);
         }
         return;
     }
@@ -1115,257 +3509,107 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
     int digits = decimal_digits;
     int sign_width = (val < 0) ? 1 : 0;
     bool sign_plus_exist = (is_signed_plus && val>=0); // Positive sign
-    // sign_width = 0
-    double integer_part = trunc(val);
-    int integer_length = (integer_part == 0) ? 1 : (int)log10(fabs(integer_part)) + 1;
-    // integer_part = 11230000128, integer_length = 11
-    // width = 10, digits = 2
-
-    #define MAX_SIZE 512
-    char val_str[MAX_SIZE] = "";
-    int avail_len_decimal_digits = MAX_SIZE - integer_length - sign_width - 2 /* 0.*/;
-    sprintf(val_str, "%.*lf", avail_len_decimal_digits, val);
-    // val_str = "11230000128.00..."
-    int i = strlen(val_str) - 1;
-    if (val != 0.0) {
-        while (val_str[i] == '0') {
-            val_str[i] = '\0';
-            i--;
-        }
-    }
-    // val_str = "11230000128."
-
-    char* ptr = strchr(val_str, '.');
-    if (ptr != NULL) {
-        memmove(ptr, ptr + 1, strlen(ptr));
-    }
-    // val_str = "11230000128"
-
-    if (val < 0) {
-        // removes `-` (negative) sign
-        memmove(val_str, val_str + 1, strlen(val_str));
-    }
-
-    int decimal = 1;
-    while (val_str[0] == '0') {
-        // Used for the case: 1.123e-10
-        memmove(val_str, val_str + 1, strlen(val_str));
-        decimal--;
-        // loop end: decimal = -9
-    }
     bool is_s_format = false;
     if (tolower(format[1]) == 's') {
         is_s_format = true;
         scale = 1;
     }
-    int exponent_value = 0;
-    if (val == 0.0) {
-        exponent_value = 0;
-        memset(val_str, '0', digits + scale + 1); // +1 in case scale=0
-        val_str[digits + scale] = '\0';
-        integer_length = 1;
-    } else {
-        // Compute exponent based on decimal (stripped zeros) or integer_length
-        // This is more accurate than log10 for values near powers of 10
-        // For val >= 1: exponent = integer_length - scale
-        // For val < 1:  exponent = decimal - scale
-        if (fabs(val) >= 1.0) {
-            exponent_value = integer_length - scale;
-        } else {
-            exponent_value = decimal - scale;
-        }
-    }
 
-    // For ES format with 0 decimal places, we need to round properly
-    // and adjust the exponent if rounding causes overflow
-    if (is_s_format && digits == 0 && val != 0.0) {
-        // Calculate the mantissa for ES format (scale = 1)
-        double abs_val = fabs(val);
-        double mantissa = abs_val / pow(10, exponent_value);
-        // Round to nearest integer
-        double rounded_mantissa = round(mantissa);
-        // If rounding causes mantissa >= 10, adjust exponent
-        if (rounded_mantissa >= 10.0) {
-            exponent_value++;
-            rounded_mantissa = 1.0;
-        }
-        // Reconstruct val_str with the rounded mantissa (unsigned)
-        sprintf(val_str, "%d", (int)rounded_mantissa);
-        integer_length = strlen(val_str);
+    // With a scale factor k > 0 the significand has k digits before the
+    // decimal mark and d - k + 1 after it, otherwise it is 0.<-k zeros>
+    // followed by d + k digits. Other scale factors are not allowed.
+    int precision = scale > 0 ? digits + 1 : digits + scale;
+    if (precision <= 0 || scale > digits + 1) {
+        append_fill(result, '*', width);
+        return;
+    }
+    // 1.123e+10 as ES10.2: precision = 3, sig_digits = "112", decpt = 11
+    char sig_digits[FP_DIGITS_SIZE];
+    int n = 0;
+    int exponent_value = 0;
+    if (val != 0.0) {
+        int decpt;
+        n = fp_digits(fabs(val), false, precision, sig_digits, &decpt);
+        exponent_value = decpt - scale;
     }
+    // exponent_value = 10
 
+    int abs_exp = (exponent_value < 0 ? -exponent_value : exponent_value);
+    int exp_ndigits = count_decimal_digits(abs_exp);
     int exp = 2;
     if (exp_digits > 0) {
         exp = exp_digits;
-    } else if (is_s_format && (exponent_value < 0 ? -exponent_value : exponent_value) >= 10) {
-        int abs_exp = (exponent_value < 0 ? -exponent_value : exponent_value);
-        exp = (abs_exp == 0) ? 2 : (int)log10(abs_exp) + 1;
-    } else if ((exponent_value < 0 ? -exponent_value : exponent_value) >= 100) {
+    } else if (is_s_format && abs_exp >= 10) {
+        exp = exp_ndigits;
+    } else if (abs_exp >= 100) {
         exp = 3;
     }
-    // exp = 2;
-    if (exp != -1 && exponent_value >= (pow(10, exp))) {
-        goto overflow;
+    if (exp_ndigits > exp) {
+        append_fill(result, '*', width);
+        return;
     }
 
-    char exponent[12];
-    if (width_digits == 0) {
-        sprintf(exponent, "%+02d", exponent_value);
-    } else {
-        int exp_width = exp + 1;
-        if (exp_width > 10) exp_width = 10;
-
-        int len = snprintf(exponent, sizeof(exponent), "%+0*d", exp_width, exponent_value);
-        if (len < 0 || len >= sizeof(exponent)) {
-            goto overflow;
-        }
-        // exponent = "+10"
-    }
+    // Sign and at least one digit for a zero width, else at least `exp` digits
+    int min_exp_digits = width_digits == 0 ? 1 : (exp < 9 ? exp : 9);
+    int exp_length = 1 + (exp_ndigits > min_exp_digits ? exp_ndigits : min_exp_digits);
+    // exp_length = 3, for "+10"
 
-    int exp_length = strlen(exponent);
     // The 'E' is dropped for 3+ digit exponents ONLY when no explicit Ee width is given
     // (i.e., when exp_digits <= 0). When an explicit Ee is specified, 'E' is always kept.
-    bool drop_e = (exp_digits <= 0 && (exponent_value < 0 ? -exponent_value : exponent_value) >= 100 && exp_length >= 4 && width_digits != 0);
+    bool drop_e = (exp_digits <= 0 && abs_exp >= 100 && exp_length >= 4 && width_digits != 0);
     int FIXED_CHARS_LENGTH = drop_e ? 2 : 3; // digit, ., [E]
 
     if (width == 0) {
-        // For ES0.0E0 or similar, keep digits = 0 to match gfortran behavior
-        if (digits == 0 && (width_digits != 0 || decimal_digits != 0)) {
-            digits = 9;
-        }
-        width = sign_width + digits + FIXED_CHARS_LENGTH + exp_length;
+        width = sign_width + sign_plus_exist + digits + FIXED_CHARS_LENGTH + exp_length;
     }
     if (digits > width - FIXED_CHARS_LENGTH) {
-        goto overflow;
-    }
-    int val_str_len = strlen(val_str);
-    int zeroes_needed = digits - (val_str_len - integer_length);
-    if (zeroes_needed < 0) zeroes_needed = 0;
-    if (zeroes_needed > MAX_SIZE - val_str_len - 1) zeroes_needed = MAX_SIZE - val_str_len - 1;
-
-    for(int i = 0; i < zeroes_needed && val_str_len + i < MAX_SIZE - 1; i++) {
-        val_str[val_str_len + i] = '0';
-    }
-    val_str[val_str_len + zeroes_needed] = '\0';
-
-    char formatted_value[512] = "";
-    int spaces = width - (sign_width + digits + FIXED_CHARS_LENGTH + exp_length + sign_plus_exist);
-    // spaces = 2
-    for (int i = 0; i < spaces; i++) {
-        strcat(formatted_value, " ");
+        append_fill(result, '*', width);
+        return;
     }
 
-    if (scale > 1) {
-        digits -= scale - 1;
+    int len = sign_width + sign_plus_exist + digits + FIXED_CHARS_LENGTH + exp_length;
+    // The optional zero before the decimal mark is left out if the value
+    // does not fit otherwise
+    bool drop_zero = false;
+    if (len > width) {
+        bool leading_zero = scale <= 0 || (scale == 1 && n == 0);
+        if (len - width != 1 || !leading_zero) {
+            append_fill(result, '*', width);
+            return;
+        }
+        drop_zero = true;
     }
 
+    size_t cap = (size_t)(len > width ? len : width) + 1;
+    char stack_buf[128];
+    char* buf = cap <= sizeof(stack_buf) ? stack_buf : (char*)internal_malloc(cap);
+    fp_out o = {buf, cap, 0};
+    for (int i = len; i < width; i++) fp_put(&o, ' ');
     if (sign_width == 1) {
-        // adds `-` (negative) sign
-        strcat(formatted_value, "-");
-    } else if(sign_plus_exist){ // `SP specifier`
-        strcat(formatted_value, "+");
+        fp_put(&o, '-');
+    } else if (sign_plus_exist) { // `SP specifier`
+        fp_put(&o, '+');
     }
-
     if (scale <= 0) {
-        strcat(formatted_value, "0.");
-        for (int k = 0; k < (scale < 0 ? -scale : scale); k++) {
-            strcat(formatted_value, "0");
-        }
-        int zeros = 0;
-        while(val_str[zeros] == '0') zeros++;
-        if (digits + scale < strlen(val_str) && val != 0) {
-            if (digits + scale - zeros <= 15) {
-                val_str[15] = '\0';
-                long long t = (long long)round((long double)atoll(val_str) / (long long)pow(10, (strlen(val_str) - digits - scale)));
-                sprintf(val_str, "%lld", t);
-                int index = zeros;
-                while(index--) strcat(formatted_value, "0");
-            } else {
-                int round_pos = digits + scale;
-                if (round_pos < (int)strlen(val_str) && val_str[round_pos] >= '5') {
-                    int carry = 1;
-                    for (int k = round_pos - 1; k >= 0 && carry; k--) {
-                        int d = (val_str[k] - '0') + carry;
-                        val_str[k] = (d % 10) + '0';
-                        carry = d / 10;
-                    }
-                }
-                val_str[digits + scale] = '\0';
-            }
-        }
-        strncat(formatted_value, val_str, digits);
+        if (!drop_zero) fp_put(&o, '0');
+        fp_put(&o, '.');
+        fp_put_zeros(&o, -scale);
+        fp_put_significand(&o, sig_digits, n, 0, precision);
     } else {
-        char* temp = substring(val_str, 0, scale);
-        strcat(formatted_value, temp);
-        strcat(formatted_value, ".");
-        // formatted_value = "  1."
-        char* new_str = substring(val_str, scale, strlen(val_str));
-        // new_str = "1230000128" case:  1.123e+10
-        int zeros = 0;
-        if (digits < strlen(new_str)) {
-            if (digits + scale <= 15) {
-                new_str[15] = '\0';
-                zeros = strspn(new_str, "0");
-                long long t = (long long)round((long double)atoll(new_str) / (long long) pow(10, (strlen(new_str) - digits)));
-                sprintf(new_str, "%lld", t);
-                int index = zeros;
-                while(index--) {
-                    memmove(new_str + 1, new_str, strlen(new_str)+1);
-                    new_str[0] = '0';
-                }
-            } else {
-                if (digits < (int)strlen(new_str) && new_str[digits] >= '5') {
-                    int carry = 1;
-                    for (int k = digits - 1; k >= 0 && carry; k--) {
-                        int d = (new_str[k] - '0') + carry;
-                        new_str[k] = (d % 10) + '0';
-                        carry = d / 10;
-                    }
-                }
-            }
-        }
-        new_str[digits] = '\0';
-        strcat(formatted_value, new_str);
-        // formatted_value = "  1.12"
-        internal_free(new_str);
-        internal_free(temp);
+        if (!drop_zero) fp_put_significand(&o, sig_digits, n, 0, scale);
+        fp_put(&o, '.');
+        fp_put_significand(&o, sig_digits, n, scale, precision - scale);
     }
-
     // Add 'E' unless dropped for 3+ digit exponents (when no explicit Ee given)
     if (!drop_e) {
-        strcat(formatted_value, c);
-    }
-    // formatted_value = "  1.12E" or "  1.12" (if E dropped)
-    strcat(formatted_value, exponent);
-    // formatted_value = "  1.12E+10" or "  1.12+100" (if E dropped)
-
-    if (strlen(formatted_value) > width) {
-        size_t formatted_len = strlen(formatted_value);
-        if (formatted_len - width == 1) {
-            if (formatted_value[0] == '0' && formatted_value[1] == '.') {
-                memmove(formatted_value, formatted_value + 1, formatted_len);
-                *result = append_to_string(*result, formatted_value);
-                return;
-            }
-            if ((formatted_value[0] == '-' || formatted_value[0] == '+') &&
-                formatted_value[1] == '0' && formatted_value[2] == '.') {
-                memmove(formatted_value + 1, formatted_value + 2, formatted_len - 1);
-                *result = append_to_string(*result, formatted_value);
-                return;
-            }
-        }
-        goto overflow;
-    } else {
-        *result = append_to_string(*result, formatted_value);
-        return;
-        // result = "  1.12E+10"
+        fp_put_n(&o, c, (int)strlen(c));
     }
+    fp_put_exponent(&o, '\0', exponent_value, exp_length - 1);
+    fp_finish(&o);
+    // buf = "  1.12E+10" or "  1.12+100" (if E dropped)
 
-    overflow:
-    for (int i = 0; i < width; i++) {
-        *result = append_to_string(*result, "*");
-    }
-    return;
+    *result = append_to_string(*result, buf);
+    if (buf != stack_buf) internal_free(buf);
 }
 
 void handle_SP_specifier(char** result, bool is_positive_value){
@@ -2505,18 +4749,17 @@ static void format_float_fortran(char* result, float val) {
         sprintf(result, "0.00000000");
         return;
     }
+    // Callers pass buffers of at least 64 bytes
     if (abs_val < 0.1f || abs_val >= 1.0e8f) {
-        sprintf(result, "%.8E", val);
+        fp_format_e(result, 64, val, 8, 'E', 2);
         return;
     }
 
     int magnitude = (int)floor(log10f(abs_val)) + 1;
     int decimal_places = 9 - magnitude;
     if (decimal_places < 0) decimal_places = 0;
-    
-    char format_str[32];
-    sprintf(format_str, "%%.%df", decimal_places);
-    sprintf(result, format_str, val);
+
+    fp_format_f(result, 64, val, decimal_places, false);
 }
 
 static void format_double_fortran(char* result, double val) {
@@ -2535,24 +4778,17 @@ static void format_double_fortran(char* result, double val) {
         return;
     }
 
+    // Callers pass buffers of at least 64 bytes
     if (abs_val < 0.1 || abs_val >= 1.0e16) {
-        sprintf(result, "%.16E", val);
-        char* e_pos = strchr(result, 'E');
-        if (e_pos != NULL) {
-            char sign = e_pos[1];
-            int exp_val = atoi(e_pos + 2);
-            sprintf(e_pos, "E%c%03d", sign, (exp_val < 0 ? -exp_val : exp_val));
-        }
+        fp_format_e(result, 64, val, 16, 'E', 3);
         return;
     }
-    
+
     int magnitude = (int)floor(log10(abs_val)) + 1;
     int decimal_places = 17 - magnitude;
     if (decimal_places < 0) decimal_places = 0;
-    
-    char format_str[32];
-    sprintf(format_str, "%%.%df", decimal_places);
-    sprintf(result, format_str, val);
+
+    fp_format_f(result, 64, val, decimal_places, false);
 }
 
 // Returns the length of the string that is printed inside result
@@ -3204,9 +5440,7 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(lfortran_allocator_t* al, c
                                 format_double_fortran(formatted, double_val);
                             }
                         } else if (double_val == 0.0 || (fabs(double_val) >= 0.1 && fabs(double_val) < pow(10.0, precision))) {
-                            char format_spec[20];
-                            snprintf(format_spec, sizeof(format_spec), "%%#.%dG", precision);
-                            snprintf(formatted, sizeof(formatted), format_spec, double_val);
+                            fp_format_g_alt(formatted, sizeof(formatted), double_val, precision);
                         } else {
                             int exp = 0;
                             double abs_val = fabs(double_val);
@@ -3216,7 +5450,7 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(lfortran_allocator_t* al, c
                             double scale = pow(10.0, -exp);
                             double final_val = double_val * scale;
                             char mantissa[64], exponent[16];
-                            snprintf(mantissa, sizeof(mantissa), "%.*f", precision, final_val);
+                            fp_format_f(mantissa, sizeof(mantissa), final_val, precision, false);
                             if (width > 0) {
                                 snprintf(exponent, sizeof(exponent), "E%+03d", exp);
                             } else {
@@ -4358,15 +6592,28 @@ LFORTRAN_API char* _lfortran_strcat_alloc(
     char* s1, int64_t s1_len,
     char* s2, int64_t s2_len)
 {
-    int cntr = 0;
     char* dest_char = (char*)ALLOCATOR_ALLOC(al, s1_len+s2_len);
-    for (int i = 0; i < s1_len; i++) {
-        dest_char[cntr] = s1[i];
-        cntr++;
+    if (s1_len > 0) memcpy(dest_char, s1, s1_len);
+    if (s2_len > 0) memcpy(dest_char + s1_len, s2, s2_len);
+    return dest_char;
+}
+
+// `s(1) // s(2) // ... // s(n)` with a single allocation
+LFORTRAN_API char* _lfortran_strcat_n_alloc(
+    lfortran_allocator_t* al, int32_t n,
+    char** s, int64_t* s_len)
+{
+    int64_t len = 0;
+    for (int32_t i = 0; i < n; i++) {
+        len += s_len[i];
     }
-    for (int i = 0; i < s2_len; i++) {
-        dest_char[cntr] = s2[i];
-        cntr++;
+    char* dest_char = (char*)ALLOCATOR_ALLOC(al, len);
+    char* p = dest_char;
+    for (int32_t i = 0; i < n; i++) {
+        if (s_len[i] > 0) {
+            memcpy(p, s[i], s_len[i]);
+            p += s_len[i];
+        }
     }
     return dest_char;
 }
@@ -4453,17 +6700,23 @@ int str_compare(char *s1, int64_t s1_len, char *s2, int64_t s2_len){
     return res;
 }
 
+// The shortest text that reads back as the value, like Python's str()
 LFORTRAN_API char* _lfortran_float_to_str4_alloc(lfortran_allocator_t* al, float num)
 {
-    char* res = (char*)ALLOCATOR_ALLOC(al, 40);
-    sprintf(res, "%f", num);
+    char buf[32];
+    int len = fp_format_shortest(buf, sizeof(buf), (double)num, true);
+    char* res = (char*)ALLOCATOR_ALLOC(al, len + 1);
+    memcpy(res, buf, len + 1);
     return res;
 }
 
 LFORTRAN_API char* _lfortran_float_to_str8_alloc(lfortran_allocator_t* al, double num)
 {
-    char* res = (char*)ALLOCATOR_ALLOC(al, 40);
-    sprintf(res, "%f", num);
+    // 17 digits, the sign, "0.000" or the exponent
+    char buf[32];
+    int len = fp_format_shortest(buf, sizeof(buf), num, false);
+    char* res = (char*)ALLOCATOR_ALLOC(al, len + 1);
+    memcpy(res, buf, len + 1);
     return res;
 }
 
@@ -4541,24 +6794,22 @@ LFORTRAN_API int32_t _lpython_bit_length8(int64_t num)
 }
 
 //repeat str for n time
-LFORTRAN_API void _lfortran_strrepeat_alloc(lfortran_allocator_t* al, char** s, int32_t n, char** dest)
+LFORTRAN_API char* _lfortran_strrepeat_alloc(lfortran_allocator_t* al, char* s, int64_t s_len, int32_t n)
 {
-    int cntr = 0;
-    char trmn = '\0';
-    int s_len = strlen(*s);
-    int trmn_size = sizeof(trmn);
-    int f_len = s_len*n;
-    if (f_len < 0)
-        f_len = 0;
-    char* dest_char = (char*)ALLOCATOR_ALLOC(al, f_len+trmn_size);
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < s_len; j++) {
-            dest_char[cntr] = (*s)[j];
-            cntr++;
+    int64_t f_len = n > 0 ? s_len*n : 0;
+    char* dest_char = (char*)ALLOCATOR_ALLOC(al, f_len+1);
+    if (f_len > 0) {
+        // Copy `s` once, then keep doubling the part already written
+        int64_t done = s_len;
+        memcpy(dest_char, s, s_len);
+        while (done < f_len) {
+            int64_t chunk = MIN(done, f_len - done);
+            memcpy(dest_char + done, dest_char, chunk);
+            done += chunk;
         }
     }
-    dest_char[cntr] = trmn;
-    *dest = &(dest_char[0]);
+    dest_char[f_len] = '\0';
+    return dest_char;
 }
 
 LFORTRAN_API char* _lfortran_strrepeat_c_alloc(lfortran_allocator_t* al, char* s, int32_t n)
@@ -5056,48 +7307,89 @@ LFORTRAN_API int32_t _lfortran_values(int32_t n)
 }
 
 LFORTRAN_API float _lfortran_sp_rand_num() {
-    return rand() / (float) RAND_MAX;
+    return rng_to_float(rng_next(rng_state()));
 }
 
 LFORTRAN_API double _lfortran_dp_rand_num() {
-    return rand() / (double) RAND_MAX;
+    return rng_to_double(rng_next(rng_state()));
 }
 
 LFORTRAN_API int32_t _lfortran_int32_rand_num() {
-    return rand();
+    return (int32_t)(rng_next(rng_state()) >> 33);
 }
 
 LFORTRAN_API int64_t _lfortran_int64_rand_num() {
-    return rand();
+    return (int64_t)(rng_next(rng_state()) >> 1);
 }
 
 LFORTRAN_API bool _lfortran_random_init(bool repeatable, bool image_distinct) {
     if (repeatable) {
-        srand(0);
+        rng_seed_u64(0);
     } else {
         static unsigned int call_count = 0;
-        unsigned int seed;
+        uint64_t seed;
 #if defined(_WIN32)
-        seed = (unsigned int)clock() ^ (++call_count * 2654435761u);
+        seed = (uint64_t)clock() ^ (++call_count * 2654435761u);
 #else
         struct timespec ts;
         if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-            seed = (unsigned int)(ts.tv_nsec) ^ (++call_count * 2654435761u);
+            seed = ((uint64_t)ts.tv_sec << 32) ^ (uint64_t)ts.tv_nsec
+                ^ (++call_count * 2654435761u);
         } else {
-            seed = (unsigned int)time(NULL) ^ (++call_count * 2654435761u);
+            seed = (uint64_t)time(NULL) ^ (++call_count * 2654435761u);
         }
 #endif
-        srand(seed);
+        rng_seed_u64(seed);
     }
     return false;
 }
 
 LFORTRAN_API int64_t _lfortran_random_seed(unsigned seed)
 {
-    srand(seed);
-    // The seed array size is typically 8 elements because Fortran's RNG often uses a seed with a fixed length of 8 integers to ensure sufficient randomness and repeatability in generating sequences of random numbers.
-    return 8;
+    rng_seed_u64(seed);
+    return LFORTRAN_RNG_SEED_SIZE;
+}
+
+// random_seed(size=)
+LFORTRAN_API int32_t _lfortran_random_seed_size()
+{
+    return LFORTRAN_RNG_SEED_SIZE;
+}
+
+// The 8 seed words are the 256 bit generator state, XORed with a constant so
+// that small seeds like put=[1, 2, ...] still give a well mixed state.
+static const uint64_t rng_seed_scramble[4] = { 0x9e3779b97f4a7c15ULL,
+    0xbf58476d1ce4e5b9ULL, 0x94d049bb133111ebULL, 0x2545f4914f6cdd1dULL };
+
+// random_seed(put=): called once for each element i = 1, 2, ... of `put`.
+// i = 1 starts a new seed with the remaining words zero, and every call
+// reseeds, so `put` shorter than the seed size works too.
+LFORTRAN_API void _lfortran_random_seed_put(int32_t i, int64_t v)
+{
+    uint64_t s[4];
+    int k;
+    if (i < 1 || i > LFORTRAN_RNG_SEED_SIZE) return;
+    rng_lock_acquire();
+    if (i == 1) memset(rng_put_words, 0, sizeof(rng_put_words));
+    rng_put_words[i - 1] = (uint32_t)v;
+    for (k = 0; k < 4; k++) {
+        s[k] = (((uint64_t)rng_put_words[2 * k + 1] << 32)
+            | rng_put_words[2 * k]) ^ rng_seed_scramble[k];
+    }
+    if ((s[0] | s[1] | s[2] | s[3]) == 0) s[0] = 1;
+    rng_set_base_locked(s);
+    rng_lock_release();
+}
 
+// random_seed(get=): word i of the calling thread's current state, so that
+// putting it back continues the sequence from this point.
+LFORTRAN_API int32_t _lfortran_random_seed_get(int32_t i)
+{
+    uint64_t *s = rng_state();
+    uint64_t w;
+    if (i < 1 || i > LFORTRAN_RNG_SEED_SIZE) return 0;
+    w = s[(i - 1) / 2] ^ rng_seed_scramble[(i - 1) / 2];
+    return (int32_t)(uint32_t)(i % 2 == 1 ? w : w >> 32);
 }
 
 LFORTRAN_API int64_t _lpython_open(char *path, char *flags)
@@ -5129,12 +7421,295 @@ struct UNIT_FILE {
     int sign_mode;  // 0=processor_defined, 1=plus, 2=suppress
     int decimal_mode; // 0=point, 1=comma
     int encoding; // 0=unknown, 1=UTF-8, 2=default
+    struct async_unit* async; // non-NULL for asynchronous='yes'
+    struct mmap_unit* mmap; // non-NULL for units read through a mapping
 };
 
 int32_t last_index_used = -1;
 
 struct UNIT_FILE unit_to_file[MAXUNITS];
 
+/* --- Asynchronous output --- */
+
+// Units opened with asynchronous='yes' own a writer thread. An unformatted
+// WRITE to such a unit copies its record into one of ASYNC_BUFFERS buffers
+// owned by the unit and returns, so the program can go on computing (and
+// reuse the variables it wrote) while the writer drains the buffers to the
+// file in order. A WRITE that finds every buffer busy waits for the oldest
+// one, which bounds the memory held per unit. Every other operation on the
+// unit goes through get_file_pointer_from_unit(), which first waits for the
+// queue to empty, so the file position and contents are always those of a
+// synchronous run.
+//
+// Transfer IDs are handed out per unit in increasing order and complete in
+// that order: all transfers with ID <= done_id have finished.
+#define ASYNC_BUFFERS 2
+
+#if defined(COMPILE_TO_WASM)
+#define ASYNC_IO_THREADS 0
+#else
+#define ASYNC_IO_THREADS 1
+#if defined(_WIN32)
+typedef SRWLOCK async_mutex_t;
+typedef CONDITION_VARIABLE async_cond_t;
+typedef HANDLE async_thread_t;
+#define async_mutex_init(m)     InitializeSRWLock(m)
+#define async_mutex_lock(m)     AcquireSRWLockExclusive(m)
+#define async_mutex_unlock(m)   ReleaseSRWLockExclusive(m)
+#define async_cond_init(c)      InitializeConditionVariable(c)
+#define async_cond_wait(c, m)   SleepConditionVariableSRW(c, m, INFINITE, 0)
+#define async_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t async_mutex_t;
+typedef pthread_cond_t async_cond_t;
+typedef pthread_t async_thread_t;
+#define async_mutex_init(m)     pthread_mutex_init(m, NULL)
+#define async_mutex_lock(m)     pthread_mutex_lock(m)
+#define async_mutex_unlock(m)   pthread_mutex_unlock(m)
+#define async_cond_init(c)      pthread_cond_init(c, NULL)
+#define async_cond_wait(c, m)   pthread_cond_wait(c, m)
+#define async_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+#endif
+
+struct async_record {
+    char* data;
+    size_t size;
+    size_t capacity;
+    bool seek_end;      // sequential access appends at the end of file
+};
+
+struct async_unit {
+    FILE* filep;
+    struct async_record records[ASYNC_BUFFERS];
+    int head;           // oldest pending record
+    int pending;        // number of queued records
+    int32_t last_id;    // ID of the most recently started transfer
+    int32_t done_id;
+    bool id_ready;      // last_id is an asynchronous WRITE not yet reported
+    int32_t error;      // iostat of the first failed transfer, 0 if none
+    bool stop;
+#if ASYNC_IO_THREADS
+    async_mutex_t mutex;
+    async_cond_t work;  // signalled when a record is queued or on stop
+    async_cond_t done;  // signalled when a record has been written
+    async_thread_t thread;
+#endif
+};
+
+#if ASYNC_IO_THREADS
+static void async_unit_run(struct async_unit* a) {
+    async_mutex_lock(&a->mutex);
+    for (;;) {
+        while (a->pending == 0 && !a->stop) {
+            async_cond_wait(&a->work, &a->mutex);
+        }
+        if (a->pending == 0) break;
+        struct async_record* r = &a->records[a->head];
+        async_mutex_unlock(&a->mutex);
+        if (r->seek_end) {
+            fseek(a->filep, 0, SEEK_END);
+        }
+        size_t written = fwrite(r->data, 1, r->size, a->filep);
+        async_mutex_lock(&a->mutex);
+        if (written != r->size && a->error == 0) {
+            a->error = 11;
+        }
+        a->head = (a->head + 1) % ASYNC_BUFFERS;
+        a->pending--;
+        a->done_id++;
+        async_cond_broadcast(&a->done);
+    }
+    async_mutex_unlock(&a->mutex);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI async_unit_thread(LPVOID arg) {
+    async_unit_run((struct async_unit*) arg);
+    return 0;
+}
+#else
+static void* async_unit_thread(void* arg) {
+    async_unit_run((struct async_unit*) arg);
+    return NULL;
+}
+#endif
+
+static void async_units_shutdown(void);
+
+static struct async_unit* async_unit_create(FILE* filep) {
+    static bool registered = false;
+    struct async_unit* a = (struct async_unit*) internal_calloc(1, sizeof(struct async_unit));
+    if (a == NULL) return NULL;
+    a->filep = filep;
+    async_mutex_init(&a->mutex);
+    async_cond_init(&a->work);
+    async_cond_init(&a->done);
+#if defined(_WIN32)
+    a->thread = CreateThread(NULL, 0, async_unit_thread, a, 0, NULL);
+    bool started = a->thread != NULL;
+#else
+    bool started = pthread_create(&a->thread, NULL, async_unit_thread, a) == 0;
+#endif
+    if (!started) {
+        // Fall back to synchronous transfers
+        internal_free(a);
+        return NULL;
+    }
+    if (!registered) {
+        // Records still queued when the program ends must reach the file
+        atexit(async_units_shutdown);
+        registered = true;
+    }
+    return a;
+}
+
+// Returns a buffer of at least `size` bytes that the caller fills before
+// calling async_unit_commit() with the same `slot`.
+static char* async_unit_reserve(struct async_unit* a, size_t size, int* slot) {
+    async_mutex_lock(&a->mutex);
+    while (a->pending == ASYNC_BUFFERS) {
+        async_cond_wait(&a->done, &a->mutex);
+    }
+    // The writer moves head and pending together, so the first free slot
+    // is only read under the lock. It stays free until it is committed.
+    *slot = (a->head + a->pending) % ASYNC_BUFFERS;
+    async_mutex_unlock(&a->mutex);
+    struct async_record* r = &a->records[*slot];
+    if (r->capacity < size) {
+        char* data = (char*) internal_realloc(r->data, size);
+        if (data == NULL) {
+            fprintf(stderr, "Runtime Error: Out of memory in asynchronous WRITE.\n");
+            exit(1);
+        }
+        r->data = data;
+        r->capacity = size;
+    }
+    return r->data;
+}
+
+static void async_unit_commit(struct async_unit* a, int slot, size_t size, bool seek_end) {
+    async_mutex_lock(&a->mutex);
+    struct async_record* r = &a->records[slot];
+    r->size = size;
+    r->seek_end = seek_end;
+    a->pending++;
+    a->last_id++;
+    a->id_ready = true;
+    async_cond_broadcast(&a->work);
+    async_mutex_unlock(&a->mutex);
+}
+
+// Waits until the transfer `id` has finished, or every queued one if
+// `id` is negative.
+static void async_unit_wait(struct async_unit* a, int32_t id) {
+    async_mutex_lock(&a->mutex);
+    while (a->pending > 0 && (id < 0 || a->done_id < id)) {
+        async_cond_wait(&a->done, &a->mutex);
+    }
+    async_mutex_unlock(&a->mutex);
+}
+
+static void async_unit_destroy(struct async_unit* a) {
+    async_mutex_lock(&a->mutex);
+    a->stop = true;
+    async_cond_broadcast(&a->work);
+    async_mutex_unlock(&a->mutex);
+#if defined(_WIN32)
+    WaitForSingleObject(a->thread, INFINITE);
+    CloseHandle(a->thread);
+#else
+    pthread_join(a->thread, NULL);
+#endif
+    for (int i = 0; i < ASYNC_BUFFERS; i++) {
+        internal_free(a->records[i].data);
+    }
+    internal_free(a);
+}
+#else
+static struct async_unit* async_unit_create(FILE* filep) {
+    (void) filep;
+    return NULL;
+}
+
+static char* async_unit_reserve(struct async_unit* a, size_t size, int* slot) {
+    (void) a; (void) size; (void) slot;
+    return NULL;
+}
+
+static void async_unit_commit(struct async_unit* a, int slot, size_t size, bool seek_end) {
+    (void) a; (void) slot; (void) size; (void) seek_end;
+}
+
+static void async_unit_wait(struct async_unit* a, int32_t id) {
+    (void) a; (void) id;
+}
+
+static void async_unit_destroy(struct async_unit* a) {
+    (void) a;
+}
+#endif
+
+// Called before any synchronous operation on the unit
+static void async_unit_drain(struct async_unit* a) {
+    async_unit_wait(a, -1);
+    a->id_ready = false;
+}
+
+static int32_t async_unit_take_error(struct async_unit* a) {
+#if ASYNC_IO_THREADS
+    async_mutex_lock(&a->mutex);
+#endif
+    int32_t error = a->error;
+    a->error = 0;
+#if ASYNC_IO_THREADS
+    async_mutex_unlock(&a->mutex);
+#endif
+    return error;
+}
+
+// Queues one unformatted record given as the (len, ptr) pairs of
+// _lfortran_file_write(), terminated by len == -1.
+static void async_unit_write_record(struct async_unit* a, bool sequential, va_list args) {
+    va_list sizes;
+    va_copy(sizes, args);
+    size_t total_size = 0;
+    while (1) {
+        int32_t len = va_arg(sizes, int32_t);
+        if (len == -1) break;
+        (void) va_arg(sizes, void*);
+        total_size += len;
+    }
+    va_end(sizes);
+    size_t marker_size = sequential ? sizeof(int32_t) : 0;
+    int slot;
+    char* buf = async_unit_reserve(a, total_size + 2 * marker_size, &slot);
+    int32_t record_marker = (int32_t)total_size;
+    char* p = buf;
+    if (sequential) {
+        memcpy(p, &record_marker, sizeof(record_marker));
+        p += sizeof(record_marker);
+    }
+    while (1) {
+        int32_t len = va_arg(args, int32_t);
+        if (len == -1) break;
+        void* ptr = va_arg(args, void*);
+        if (ptr == NULL) {
+            printf("Internal Compiler Error: NULL pointer passed to _lfortran_file_write.\n");
+            exit(1);
+        }
+        memcpy(p, ptr, len);
+        p += len;
+    }
+    if (sequential) {
+        memcpy(p, &record_marker, sizeof(record_marker));
+    }
+    async_unit_commit(a, slot, total_size + 2 * marker_size, sequential);
+}
+
+/* --- End asynchronous output --- */
+
 // Pre-connect standard Fortran units at program startup.
 // The Fortran standard requires INPUT_UNIT, OUTPUT_UNIT, ERROR_UNIT to be
 // pre-connected, but their values are processor-dependent. Units 5/6/0 are
@@ -5224,27 +7799,148 @@ void store_unit_file(int32_t unit_num, char* filename, FILE* filep, bool unit_fi
             return;  // Don't add duplicate entry
         }
     }
-    // Add new entry
-    last_index_used += 1;
-    if( last_index_used >= MAXUNITS ) {
-        printf("Only %d units can be opened for now\n.", MAXUNITS);
-        exit(1);
+    // Add new entry
+    last_index_used += 1;
+    if( last_index_used >= MAXUNITS ) {
+        printf("Only %d units can be opened for now\n.", MAXUNITS);
+        exit(1);
+    }
+    unit_to_file[last_index_used].unit = unit_num;
+    unit_to_file[last_index_used].filename = filename;
+    unit_to_file[last_index_used].filep = filep;
+    unit_to_file[last_index_used].unit_file_bin = unit_file_bin;
+    unit_to_file[last_index_used].access_id = access_id;
+    unit_to_file[last_index_used].read_access = read_access;
+    unit_to_file[last_index_used].write_access = write_access;
+    unit_to_file[last_index_used].delim = delim;
+    unit_to_file[last_index_used].blank_zero = blank_zero;
+    unit_to_file[last_index_used].record_length = record_length;
+    unit_to_file[last_index_used].sign_mode = sign_mode;
+    unit_to_file[last_index_used].decimal_mode = decimal_mode;
+    unit_to_file[last_index_used].encoding = encoding;
+    unit_to_file[last_index_used].async = NULL;
+    unit_to_file[last_index_used].mmap = NULL;
+}
+
+static struct UNIT_FILE* find_unit_file(int32_t unit_num) {
+    _lfortran_init_standard_units();
+    for( int i = 0; i <= last_index_used; i++ ) {
+        if( unit_to_file[i].unit == unit_num ) {
+            return &unit_to_file[i];
+        }
+    }
+    return NULL;
+}
+
+/* --- Memory-mapped input --- */
+
+// With --mmap-io, units opened with form='unformatted', action='read' and
+// access='stream' or 'direct' map the whole file. Array reads then copy
+// straight from the mapping into the destination instead of going through
+// the stdio buffer and read(). The FILE stays the owner of the position:
+// a mapped read takes the offset from it and moves it past the bytes
+// copied, so scalar reads, REWIND, POS= and REC= keep working unchanged.
+// The file is mapped once at OPEN; changes made to it by other processes
+// afterwards may or may not be seen, as with any read-only connection.
+static bool _lfortran_mmap_io = false;
+
+LFORTRAN_API void _lfortran_set_mmap_io(int enable) {
+    _lfortran_mmap_io = enable;
+}
+
+#if !defined(_WIN32) && !defined(COMPILE_TO_WASM)
+#define MMAP_IO 1
+// Bulk reads at least this large ask the kernel to read the range ahead
+#define MMAP_WILLNEED_BYTES (1 << 20)
+
+struct mmap_unit {
+    char* base;
+    size_t size;
+    size_t page_size;
+};
+
+// Returns NULL when the file cannot (or need not) be mapped, in which case
+// the unit keeps using stdio.
+static struct mmap_unit* mmap_unit_create(FILE* fp, int access_id) {
+    struct stat st;
+    if (fstat(fileno(fp), &st) != 0 || !S_ISREG(st.st_mode)
+            || st.st_size <= 0 || (uint64_t)st.st_size > SIZE_MAX) {
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void* base = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(fp), 0);
+    if (base == MAP_FAILED) return NULL;
+    // Stream reads walk the file, direct access jumps between records
+    madvise(base, size, access_id == 2 ? MADV_RANDOM : MADV_SEQUENTIAL);
+    struct mmap_unit* m = (struct mmap_unit*) internal_malloc(sizeof(struct mmap_unit));
+    m->base = (char*)base;
+    m->size = size;
+    m->page_size = (size_t)sysconf(_SC_PAGESIZE);
+    return m;
+}
+
+static void mmap_unit_destroy(struct mmap_unit* m) {
+    munmap(m->base, m->size);
+    internal_free(m);
+}
+
+// fread() replacement for a mapped unit
+static size_t mmap_unit_read(struct mmap_unit* m, FILE* fp, void* p, size_t size, size_t n) {
+    off_t pos = ftello(fp);
+    if (pos < 0) return fread(p, size, n, fp);
+    size_t avail = (uint64_t)pos < m->size ? m->size - (size_t)pos : 0;
+    size_t count = n <= avail / size ? n : avail / size;
+    size_t bytes = count * size;
+    const char* src = m->base + pos;
+    if (bytes >= MMAP_WILLNEED_BYTES) {
+        size_t offset = (size_t)pos & ~(m->page_size - 1);
+        madvise(m->base + offset, (size_t)pos + bytes - offset, MADV_WILLNEED);
+    }
+    memcpy(p, src, bytes);
+    if (count < n) {
+        // Short read: leave the stream at end of file with EOF set, which
+        // is what fread() does and what the callers check with feof()
+        fseeko(fp, (off_t)m->size, SEEK_SET);
+        (void) getc(fp);
+    } else {
+        fseeko(fp, pos + (off_t)bytes, SEEK_SET);
+    }
+    return count;
+}
+#else
+#define MMAP_IO 0
+
+struct mmap_unit {
+    char unused;
+};
+
+static struct mmap_unit* mmap_unit_create(FILE* fp, int access_id) {
+    (void) fp; (void) access_id;
+    return NULL;
+}
+
+static void mmap_unit_destroy(struct mmap_unit* m) {
+    (void) m;
+}
+#endif
+
+// Reads n items of the given size from an unformatted unit, like fread()
+static size_t unit_read_items(int32_t unit_num, FILE* fp, void* p, size_t size, size_t n) {
+#if MMAP_IO
+    if (_lfortran_mmap_io && n > 0) {
+        struct UNIT_FILE* entry = find_unit_file(unit_num);
+        if (entry != NULL && entry->mmap != NULL) {
+            return mmap_unit_read(entry->mmap, fp, p, size, n);
+        }
     }
-    unit_to_file[last_index_used].unit = unit_num;
-    unit_to_file[last_index_used].filename = filename;
-    unit_to_file[last_index_used].filep = filep;
-    unit_to_file[last_index_used].unit_file_bin = unit_file_bin;
-    unit_to_file[last_index_used].access_id = access_id;
-    unit_to_file[last_index_used].read_access = read_access;
-    unit_to_file[last_index_used].write_access = write_access;
-    unit_to_file[last_index_used].delim = delim;
-    unit_to_file[last_index_used].blank_zero = blank_zero;
-    unit_to_file[last_index_used].record_length = record_length;
-    unit_to_file[last_index_used].sign_mode = sign_mode;
-    unit_to_file[last_index_used].decimal_mode = decimal_mode;
-    unit_to_file[last_index_used].encoding = encoding;
+#else
+    (void) unit_num;
+#endif
+    return fread(p, size, n, fp);
 }
 
+/* --- End memory-mapped input --- */
+
 FILE* get_file_pointer_from_unit(int32_t unit_num, bool *unit_file_bin, int *access_id, bool *read_access, bool *write_access, int *delim, bool *blank_zero, int32_t *recl, int *sign_mode, int *decimal_mode, int *encoding_mode) {
     _lfortran_init_standard_units();
     // Initialize all output params to safe defaults for unconnected units
@@ -5260,6 +7956,7 @@ FILE* get_file_pointer_from_unit(int32_t unit_num, bool *unit_file_bin, int *acc
     if (encoding_mode) *encoding_mode = 0;
     for( int i = 0; i <= last_index_used; i++ ) {
         if( unit_to_file[i].unit == unit_num ) {
+            if (unit_to_file[i].async) async_unit_drain(unit_to_file[i].async);
             if (unit_file_bin) *unit_file_bin = unit_to_file[i].unit_file_bin;
             if (access_id) *access_id = unit_to_file[i].access_id;
             if (read_access) *read_access = unit_to_file[i].read_access;
@@ -5299,14 +7996,41 @@ void remove_from_unit_to_file(int32_t unit_num) {
     if( index == -1 ) {
         return ;
     }
+    if (unit_to_file[index].async) {
+        async_unit_destroy(unit_to_file[index].async);
+        unit_to_file[index].async = NULL;
+    }
+    if (unit_to_file[index].mmap) {
+        mmap_unit_destroy(unit_to_file[index].mmap);
+        unit_to_file[index].mmap = NULL;
+    }
     for( int i = index; i < last_index_used; i++ ) {
         unit_to_file[i] = unit_to_file[i + 1];
     }
     last_index_used -= 1;
 }
 
+#if ASYNC_IO_THREADS
+static void async_units_shutdown(void) {
+    for (int i = 0; i <= last_index_used; i++) {
+        if (unit_to_file[i].async) {
+            async_unit_destroy(unit_to_file[i].async);
+            unit_to_file[i].async = NULL;
+        }
+    }
+}
+#endif
+
 static void _lfortran_close_all_units(void) {
     for (int i = 0; i <= last_index_used; i++) {
+        if (unit_to_file[i].async) {
+            async_unit_destroy(unit_to_file[i].async);
+            unit_to_file[i].async = NULL;
+        }
+        if (unit_to_file[i].mmap) {
+            mmap_unit_destroy(unit_to_file[i].mmap);
+            unit_to_file[i].mmap = NULL;
+        }
         if (unit_to_file[i].filename != NULL) {
             internal_free(unit_to_file[i].filename);
             unit_to_file[i].filename = NULL;
@@ -5444,7 +8168,9 @@ _lfortran_open(int32_t unit_num,
                char* sign,
                int64_t sign_len,
                char* decimal,
-               int64_t decimal_len)
+               int64_t decimal_len,
+               char* asynchronous,
+               int64_t asynchronous_len)
 {
     if (iostat != NULL) {
         *iostat = 0;
@@ -5650,8 +8376,8 @@ _lfortran_open(int32_t unit_num,
         }
     }
 
-    bool unit_file_bin;
-    int access_id;
+    bool unit_file_bin = false;
+    int access_id = 0;
     bool read_access = true;
     bool write_access = true;
     bool blank_zero = false;
@@ -5720,6 +8446,30 @@ _lfortran_open(int32_t unit_num,
         }
     }
 
+    bool asynchronous_yes = false;
+    if (asynchronous != NULL) {
+        trim_trailing_spaces(&asynchronous, &asynchronous_len, true);
+        char* asynchronous_c = to_c_string((const fchar*)asynchronous, asynchronous_len);
+        if (streql(asynchronous_c, "yes")) {
+            asynchronous_yes = true;
+        } else if (!streql(asynchronous_c, "no")) {
+            if (iostat != NULL) {
+                *iostat = 5002;
+                if ((iomsg != NULL) && (iomsg_len > 0)) {
+                    char* temp = "ASYNCHRONOUS specifier in OPEN statement has invalid value.";
+                    snprintf(iomsg, iomsg_len, "%s", temp);
+                    pad_with_spaces(iomsg, strlen(iomsg), iomsg_len);
+                }
+            } else {
+                printf("Runtime error: ASYNCHRONOUS specifier in OPEN statement has "
+                       "invalid value '%s'\n",
+                       asynchronous_c);
+                exit(1);
+            }
+        }
+        internal_free(asynchronous_c);
+    }
+
     if (streql(delim_c, "none")) {
     } else if (streql(delim_c, "apostrophe")) {
         delim_value = 1;
@@ -5792,6 +8542,13 @@ _lfortran_open(int32_t unit_num,
         }
         // f_name_c is stored in the unit table, do not free it
         store_unit_file(unit_num, f_name_c, fd, unit_file_bin, access_id, read_access, write_access, delim_value, blank_zero, record_length, sign_mode, decimal_mode, encoding_mode);
+        if (fd && asynchronous_yes) {
+            find_unit_file(unit_num)->async = async_unit_create(fd);
+        }
+        if (fd && _lfortran_mmap_io && unit_file_bin && access_id != 0
+                && !write_access) {
+            find_unit_file(unit_num)->mmap = mmap_unit_create(fd, access_id);
+        }
         internal_free(status_c);
         internal_free(form_c);
         internal_free(access_c);
@@ -5821,6 +8578,9 @@ LFORTRAN_API void _lfortran_flush(int32_t unit_num)
     // special case: flush all open units
     if (unit_num == -1) {
         for (int i = 0; i <= last_index_used; i++) {
+            if (unit_to_file[i].async) {
+                async_unit_drain(unit_to_file[i].async);
+            }
             if (unit_to_file[i].filep != NULL) {
                 fflush(unit_to_file[i].filep);
             }
@@ -5849,6 +8609,57 @@ LFORTRAN_API void _lfortran_flush(int32_t unit_num)
     }
 }
 
+LFORTRAN_API void _lfortran_wait(int32_t unit_num, int32_t id, bool has_id, int32_t *iostat,
+    char* iomsg, int64_t iomsg_len)
+{
+    if (iostat) {
+        *iostat = 0;
+    }
+    struct UNIT_FILE* entry = find_unit_file(unit_num);
+    if (entry == NULL || entry->async == NULL) {
+        // Transfers on this unit were performed synchronously
+        return;
+    }
+    async_unit_wait(entry->async, has_id ? id : -1);
+    int32_t error = async_unit_take_error(entry->async);
+    if (error != 0) {
+        if (iostat) {
+            *iostat = error;
+            if (iomsg != NULL && iomsg_len > 0) {
+                char msg[64];
+                snprintf(msg, sizeof(msg), "Asynchronous WRITE to unit %d failed", unit_num);
+                int64_t msg_len = (int64_t)strlen(msg);
+                if (msg_len > iomsg_len) msg_len = iomsg_len;
+                memcpy(iomsg, msg, (size_t)msg_len);
+                pad_with_spaces(iomsg, msg_len, iomsg_len);
+            }
+            return;
+        }
+        fprintf(stderr, "Runtime Error: Asynchronous WRITE to unit %d failed.\n", unit_num);
+        exit(1);
+    }
+}
+
+// ID of the data transfer that was just performed on `unit_num`, for the
+// `id=` specifier of READ/WRITE. Transfers that were not queued get a fresh
+// ID that is already complete.
+LFORTRAN_API int32_t _lfortran_transfer_id(int32_t unit_num)
+{
+    struct UNIT_FILE* entry = find_unit_file(unit_num);
+    if (entry == NULL || entry->async == NULL) {
+        return 0;
+    }
+    struct async_unit* a = entry->async;
+    if (a->id_ready) {
+        a->id_ready = false;
+        return a->last_id;
+    }
+    // Synchronous transfers drain the queue first, so nothing is pending
+    a->last_id++;
+    a->done_id = a->last_id;
+    return a->last_id;
+}
+
 LFORTRAN_API void _lfortran_abort()
 {
     abort();
@@ -6844,7 +9655,7 @@ LFORTRAN_API void _lfortran_read_array_int8(int8_t *p, int array_size, int32_t u
                 exit(1);
             }
         }
-        if (fread(p, sizeof(int8_t), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(int8_t), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read int8_t array from binary file.\n");
             exit(1);
@@ -6897,7 +9708,7 @@ LFORTRAN_API void _lfortran_read_array_logical(void *p, int array_size, int kind
             }
         }
         // Binary: read raw bytes directly (same format as written)
-        if (fread(p, kind, array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, kind, array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read logical array from binary file.\n");
             exit(1);
@@ -6950,7 +9761,7 @@ LFORTRAN_API void _lfortran_read_array_int16(int16_t *p, int array_size, int32_t
                 exit(1);
             }
         }
-        if (fread(p, sizeof(int16_t), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(int16_t), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read int16_t array from binary file.\n");
             exit(1);
@@ -7000,7 +9811,7 @@ LFORTRAN_API void _lfortran_read_array_int32(int32_t *p, int array_size, int32_t
                 exit(1);
             }
         }
-        if (fread(p, sizeof(int32_t), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(int32_t), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read int32_t array from binary file.\n");
             exit(1);
@@ -7050,7 +9861,7 @@ LFORTRAN_API void _lfortran_read_array_int64(int64_t *p, int array_size, int32_t
                 exit(1);
             }
         }
-        if (fread(p, sizeof(int64_t), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(int64_t), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read int64_t array from binary file.\n");
             exit(1);
@@ -7244,52 +10055,44 @@ static size_t fortran_real_token_length(const char* buffer) {
     return len;
 }
 
-static int parse_fortran_float_token(const char* buffer, float* result, int* consumed_chars) {
-    size_t token_len = fortran_real_token_length(buffer);
-    char *temp = (char*)internal_malloc(token_len + 2);
-    if (!temp) {
-        return 0;
+static size_t fortran_real_slice_token_length(const char* s, size_t len) {
+    size_t n = 0;
+    while (n < len && s[n] != '\0' &&
+           !isspace((unsigned char)s[n]) &&
+           s[n] != ',' &&
+           s[n] != '/') {
+        n++;
     }
-    memcpy(temp, buffer, token_len);
-    temp[token_len] = '\0';
+    return n;
+}
 
-    int inserted_exponent = normalize_fortran_real_token(temp, token_len + 2);
-    char* endptr;
-    *result = strtof(temp, &endptr);
-    if (consumed_chars) {
-        int consumed = (int)(endptr - temp);
-        if (inserted_exponent && consumed > 0) {
-            consumed -= 1;
-        }
-        *consumed_chars = consumed;
-    }
-    int ok = (endptr != temp && (*endptr == '\0' || isspace((unsigned char)*endptr)));
-    internal_free(temp);
-    return ok;
+// Parses the list-directed real value at the start of s[0..len), which ends
+// at a blank, comma, slash or the end of the slice. Returns 1 if the whole
+// value is a valid real, 0 otherwise; *consumed_chars is set in both cases.
+static int parse_fortran_float_slice(const char* s, size_t len, float* result, int* consumed_chars) {
+    size_t token_len = fortran_real_slice_token_length(s, len);
+    fp_decimal d;
+    size_t consumed = fp_scan_real(s, token_len, 0, &d);
+    *result = consumed ? fp_decimal_to_float(&d) : 0.0f;
+    if (consumed_chars) *consumed_chars = (int)consumed;
+    return consumed > 0 && consumed == token_len;
 }
 
-static int parse_fortran_double_token(const char* buffer, double* result, int* consumed_chars) {
-    size_t token_len = fortran_real_token_length(buffer);
-    char *temp = (char*)internal_malloc(token_len + 2);
-    if (!temp) {
-        return 0;
-    }
-    memcpy(temp, buffer, token_len);
-    temp[token_len] = '\0';
+static int parse_fortran_double_slice(const char* s, size_t len, double* result, int* consumed_chars) {
+    size_t token_len = fortran_real_slice_token_length(s, len);
+    fp_decimal d;
+    size_t consumed = fp_scan_real(s, token_len, 0, &d);
+    *result = consumed ? fp_decimal_to_double(&d) : 0.0;
+    if (consumed_chars) *consumed_chars = (int)consumed;
+    return consumed > 0 && consumed == token_len;
+}
 
-    int inserted_exponent = normalize_fortran_real_token(temp, token_len + 2);
-    char* endptr;
-    *result = strtod(temp, &endptr);
-    if (consumed_chars) {
-        int consumed = (int)(endptr - temp);
-        if (inserted_exponent && consumed > 0) {
-            consumed -= 1;
-        }
-        *consumed_chars = consumed;
-    }
-    int ok = (endptr != temp && (*endptr == '\0' || isspace((unsigned char)*endptr)));
-    internal_free(temp);
-    return ok;
+static int parse_fortran_float_token(const char* buffer, float* result, int* consumed_chars) {
+    return parse_fortran_float_slice(buffer, fortran_real_token_length(buffer), result, consumed_chars);
+}
+
+static int parse_fortran_double_token(const char* buffer, double* result, int* consumed_chars) {
+    return parse_fortran_double_slice(buffer, fortran_real_token_length(buffer), result, consumed_chars);
 }
 
 // Helper to parse float with D exponent support and error checking
@@ -7304,6 +10107,29 @@ static int parse_fortran_double(const char* buffer, double* result) {
     return parse_fortran_double_token(buffer, result, NULL);
 }
 
+// Scans a list-directed complex value `(re, im)` at the start of s[0..len).
+// Returns how many parts were read, like sscanf with " (%lf,%lf)%n", and
+// sets *consumed_chars only when the closing parenthesis was found.
+static int scan_fortran_complex_slice(const char* s, size_t len, fp_decimal* re, fp_decimal* im,
+        size_t* consumed_chars) {
+    fp_decimal* parts[2] = {re, im};
+    size_t i = 0;
+    while (i < len && isspace((unsigned char)s[i])) i++;
+    if (i >= len || s[i] != '(') return 0;
+    i++;
+    for (int k = 0; k < 2; k++) {
+        while (i < len && isspace((unsigned char)s[i])) i++;
+        size_t n = fp_scan_real(s + i, len - i, 0, parts[k]);
+        if (n == 0) return k;
+        i += n;
+        while (i < len && isspace((unsigned char)s[i])) i++;
+        if (i >= len || s[i] != (k == 0 ? ',' : ')')) return k + 1;
+        i++;
+    }
+    *consumed_chars = i;
+    return 2;
+}
+
 // Read a complete complex number expression from file, handling whitespace
 // within parentheses. Fortran list-directed format allows arbitrary whitespace
 // inside (real, imag) format, e.g., "( 0.1000E+01, 0.2000E+01)".
@@ -7341,6 +10167,28 @@ static int read_complex_expr(FILE *filep, char *buffer, size_t bufsize) {
     }
 }
 
+// Scans the whole list-directed real token at the start of s into d
+static int scan_fortran_real_token(const char* s, fp_decimal* d) {
+    size_t len = fortran_real_token_length(s);
+    return len > 0 && fp_scan_real(s, len, 0, d) == len;
+}
+
+// Reads one list-directed complex value from a formatted file into `re` and
+// `im`: `(re, im)`, or two blank separated reals. The scanned digits point
+// into `buf_re` and `buf_im`, which must outlive the conversion. Returns 1 on
+// success, 0 for an invalid value and -1 if the file could not be read.
+static int read_complex_parts(FILE *filep, char *buf_re, char *buf_im, size_t bufsize,
+        fp_decimal* re, fp_decimal* im) {
+    if (!read_complex_expr(filep, buf_re, bufsize)) return -1;
+    if (buf_re[0] == '(') {
+        size_t consumed = 0;
+        return scan_fortran_complex_slice(buf_re, strlen(buf_re), re, im, &consumed) == 2;
+    }
+    if (!scan_fortran_real_token(buf_re, re)) return 0;
+    if (!read_complex_expr(filep, buf_im, bufsize)) return -1;
+    return scan_fortran_real_token(buf_im, im);
+}
+
 // Improved input validation for float reading
 LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num, int32_t *iostat)
 {
@@ -7352,7 +10200,6 @@ LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num, int32_t *iost
             return;
         }
 
-        convert_fortran_d_exponent(buffer);
         char *token = strtok(buffer, " \t\n");
         if (token == NULL) {
             if (iostat) { *iostat = 1; return; }
@@ -7360,14 +10207,14 @@ LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num, int32_t *iost
             exit(1);
         }
 
-        char *endptr;
-        *p = strtof(token, &endptr);
-
-        if (*endptr != '\0') {
+        size_t token_len = strlen(token);
+        fp_decimal d;
+        if (fp_scan_real(token, token_len, 0, &d) != token_len) {
             if (iostat) { *iostat = 1; return; }
             fprintf(stderr, "Error: Invalid input for float.\n");
             exit(1);
         }
+        *p = fp_decimal_to_float(&d);
         return;
     }
 
@@ -7438,10 +10285,14 @@ LFORTRAN_API void _lfortran_read_complex_float(struct _lfortran_complex_32 *p, i
             fprintf(stderr, "Error: Failed to read complex float from stdin.\n");
             exit(1);
         }
-        convert_fortran_d_exponent(buf_re);
-        convert_fortran_d_exponent(buf_im);
-        p->re = strtof(buf_re, NULL);
-        p->im = strtof(buf_im, NULL);
+        fp_decimal re, im;
+        if (!scan_fortran_real_token(buf_re, &re) || !scan_fortran_real_token(buf_im, &im)) {
+            if (iostat) { *iostat = 1; return; }
+            fprintf(stderr, "Error: Invalid input for complex float from stdin.\n");
+            exit(1);
+        }
+        p->re = fp_decimal_to_float(&re);
+        p->im = fp_decimal_to_float(&im);
         return;
     }
 
@@ -7460,43 +10311,16 @@ LFORTRAN_API void _lfortran_read_complex_float(struct _lfortran_complex_32 *p, i
             exit(1);
         }
     } else {
-        char buffer[200];
-        if (!read_complex_expr(filep, buffer, sizeof(buffer))) {
-            if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
+        char buf_re[200], buf_im[200];
+        fp_decimal re, im;
+        int rc = read_complex_parts(filep, buf_re, buf_im, sizeof(buf_re), &re, &im);
+        if (rc != 1) {
+            if (iostat) { *iostat = (rc < 0 && feof(filep)) ? -1 : 1; return; }
             fprintf(stderr, "Error: Invalid input for complex float from file.\n");
             exit(1);
         }
-        convert_fortran_d_exponent(buffer);
-        char *start = strchr(buffer, '(');
-        char *end = strchr(buffer, ')');
-        if (start && end && end > start) {
-            *end = '\0';
-            start++;
-            char *comma = strchr(start, ',');
-            if (comma) {
-                *comma = '\0';
-                while (isspace((unsigned char)*start)) start++;
-                char *endptr_re;
-                p->re = strtof(start, &endptr_re);
-                while (isspace((unsigned char)*endptr_re)) endptr_re++;
-                char *im_start = comma + 1;
-                while (isspace((unsigned char)*im_start)) im_start++;
-                char *endptr_im;
-                p->im = strtof(im_start, &endptr_im);
-            } else {
-                if (iostat) { *iostat = 1; return; }
-                fprintf(stderr, "Error: Invalid complex float format '%s'.\n", buffer);
-                exit(1);
-            }
-        } else {
-            // No parentheses: treat as two whitespace-separated numbers
-            p->re = strtof(buffer, NULL);
-            if (fscanf(filep, "%f", &p->im) != 1) {
-                if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
-                fprintf(stderr, "Error: Failed to read imaginary part of complex float.\n");
-                exit(1);
-            }
-        }
+        p->re = fp_decimal_to_float(&re);
+        p->im = fp_decimal_to_float(&im);
     }
 }
 
@@ -7511,10 +10335,14 @@ LFORTRAN_API void _lfortran_read_complex_double(struct _lfortran_complex_64 *p,
             fprintf(stderr, "Error: Failed to read complex double from stdin.\n");
             exit(1);
         }
-        convert_fortran_d_exponent(buf_re);
-        convert_fortran_d_exponent(buf_im);
-        p->re = strtod(buf_re, NULL);
-        p->im = strtod(buf_im, NULL);
+        fp_decimal re, im;
+        if (!scan_fortran_real_token(buf_re, &re) || !scan_fortran_real_token(buf_im, &im)) {
+            if (iostat) { *iostat = 1; return; }
+            fprintf(stderr, "Error: Invalid input for complex double from stdin.\n");
+            exit(1);
+        }
+        p->re = fp_decimal_to_double(&re);
+        p->im = fp_decimal_to_double(&im);
         return;
     }
 
@@ -7533,43 +10361,16 @@ LFORTRAN_API void _lfortran_read_complex_double(struct _lfortran_complex_64 *p,
             exit(1);
         }
     } else {
-        char buffer[200];
-        if (!read_complex_expr(filep, buffer, sizeof(buffer))) {
-            if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
+        char buf_re[200], buf_im[200];
+        fp_decimal re, im;
+        int rc = read_complex_parts(filep, buf_re, buf_im, sizeof(buf_re), &re, &im);
+        if (rc != 1) {
+            if (iostat) { *iostat = (rc < 0 && feof(filep)) ? -1 : 1; return; }
             fprintf(stderr, "Error: Invalid input for complex double from file.\n");
             exit(1);
         }
-        convert_fortran_d_exponent(buffer);
-        char *start = strchr(buffer, '(');
-        char *end = strchr(buffer, ')');
-        if (start && end && end > start) {
-            *end = '\0';
-            start++;
-            char *comma = strchr(start, ',');
-            if (comma) {
-                *comma = '\0';
-                while (isspace((unsigned char)*start)) start++;
-                char *endptr_re;
-                p->re = strtod(start, &endptr_re);
-                while (isspace((unsigned char)*endptr_re)) endptr_re++;
-                char *im_start = comma + 1;
-                while (isspace((unsigned char)*im_start)) im_start++;
-                char *endptr_im;
-                p->im = strtod(im_start, &endptr_im);
-            } else {
-                if (iostat) { *iostat = 1; return; }
-                fprintf(stderr, "Error: Invalid complex double format '%s'.\n", buffer);
-                exit(1);
-            }
-        } else {
-            // No parentheses: treat as two whitespace-separated numbers
-            p->re = strtod(buffer, NULL);
-            if (fscanf(filep, "%lf", &p->im) != 1) {
-                if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
-                fprintf(stderr, "Error: Failed to read imaginary part of complex double.\n");
-                exit(1);
-            }
-        }
+        p->re = fp_decimal_to_double(&re);
+        p->im = fp_decimal_to_double(&im);
     }
 }
 
@@ -7577,19 +10378,22 @@ LFORTRAN_API void _lfortran_read_array_complex_float(struct _lfortran_complex_32
 {
     if (iostat) *iostat = 0;
 
-    char buf_re[100], buf_im[100];
-
     if (unit_num == -1) {
+        char buf_re[100], buf_im[100];
         for (int i = 0; i < array_size; i++) {
             if (scanf("%99s %99s", buf_re, buf_im) != 2) {
                 if (iostat) { *iostat = feof(stdin) ? -1 : 1; return; }
                 fprintf(stderr, "Error: Failed to read complex float from stdin.\n");
                 exit(1);
             }
-            convert_fortran_d_exponent(buf_re);
-            convert_fortran_d_exponent(buf_im);
-            p[i].re = strtof(buf_re, NULL);
-            p[i].im = strtof(buf_im, NULL);
+            fp_decimal re, im;
+            if (!scan_fortran_real_token(buf_re, &re) || !scan_fortran_real_token(buf_im, &im)) {
+                if (iostat) { *iostat = 1; return; }
+                fprintf(stderr, "Error: Invalid input for complex float from stdin.\n");
+                exit(1);
+            }
+            p[i].re = fp_decimal_to_float(&re);
+            p[i].im = fp_decimal_to_float(&im);
         }
         return;
     }
@@ -7603,50 +10407,23 @@ LFORTRAN_API void _lfortran_read_array_complex_float(struct _lfortran_complex_32
     }
 
     if (unit_file_bin) {
-        if (fread(p, sizeof(struct _lfortran_complex_32), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(struct _lfortran_complex_32), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read complex float array from binary file.\n");
             exit(1);
         }
     } else {
+        char buf_re[200], buf_im[200];
         for (int i = 0; i < array_size; i++) {
-            char buffer[200];
-            if (!read_complex_expr(filep, buffer, sizeof(buffer))) {
-                if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
+            fp_decimal re, im;
+            int rc = read_complex_parts(filep, buf_re, buf_im, sizeof(buf_re), &re, &im);
+            if (rc != 1) {
+                if (iostat) { *iostat = (rc < 0 && feof(filep)) ? -1 : 1; return; }
                 fprintf(stderr, "Error: Invalid input for complex float from file.\n");
                 exit(1);
             }
-            convert_fortran_d_exponent(buffer);
-            char *start = strchr(buffer, '(');
-            char *end = strchr(buffer, ')');
-            if (start && end && end > start) {
-                *end = '\0';
-                start++;
-                char *comma = strchr(start, ',');
-                if (comma) {
-                    *comma = '\0';
-                    while (isspace((unsigned char)*start)) start++;
-                    char *endptr_re;
-                    p[i].re = strtof(start, &endptr_re);
-                    while (isspace((unsigned char)*endptr_re)) endptr_re++;
-                    char *im_start = comma + 1;
-                    while (isspace((unsigned char)*im_start)) im_start++;
-                    char *endptr_im;
-                    p[i].im = strtof(im_start, &endptr_im);
-                } else {
-                    if (iostat) { *iostat = 1; return; }
-                    fprintf(stderr, "Error: Invalid complex float format '%s'.\n", buffer);
-                    exit(1);
-                }
-            } else {
-                // No parentheses: treat as two whitespace-separated numbers
-                p[i].re = strtof(buffer, NULL);
-                if (fscanf(filep, "%f", &p[i].im) != 1) {
-                    if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
-                    fprintf(stderr, "Error: Failed to read complex float from file.\n");
-                    exit(1);
-                }
-            }
+            p[i].re = fp_decimal_to_float(&re);
+            p[i].im = fp_decimal_to_float(&im);
         }
     }
 }
@@ -7655,19 +10432,22 @@ LFORTRAN_API void _lfortran_read_array_complex_double(struct _lfortran_complex_6
 {
     if (iostat) *iostat = 0;
 
-    char buf_re[100], buf_im[100];
-
     if (unit_num == -1) {
+        char buf_re[100], buf_im[100];
         for (int i = 0; i < array_size; i++) {
             if (scanf("%99s %99s", buf_re, buf_im) != 2) {
                 if (iostat) { *iostat = feof(stdin) ? -1 : 1; return; }
                 fprintf(stderr, "Error: Failed to read complex double from stdin.\n");
                 exit(1);
             }
-            convert_fortran_d_exponent(buf_re);
-            convert_fortran_d_exponent(buf_im);
-            p[i].re = strtod(buf_re, NULL);
-            p[i].im = strtod(buf_im, NULL);
+            fp_decimal re, im;
+            if (!scan_fortran_real_token(buf_re, &re) || !scan_fortran_real_token(buf_im, &im)) {
+                if (iostat) { *iostat = 1; return; }
+                fprintf(stderr, "Error: Invalid input for complex double from stdin.\n");
+                exit(1);
+            }
+            p[i].re = fp_decimal_to_double(&re);
+            p[i].im = fp_decimal_to_double(&im);
         }
         return;
     }
@@ -7681,50 +10461,23 @@ LFORTRAN_API void _lfortran_read_array_complex_double(struct _lfortran_complex_6
     }
 
     if (unit_file_bin) {
-        if (fread(p, sizeof(struct _lfortran_complex_64), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(struct _lfortran_complex_64), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read complex double array from binary file.\n");
             exit(1);
         }
     } else {
+        char buf_re[200], buf_im[200];
         for (int i = 0; i < array_size; i++) {
-            char buffer[200];
-            if (!read_complex_expr(filep, buffer, sizeof(buffer))) {
-                if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
+            fp_decimal re, im;
+            int rc = read_complex_parts(filep, buf_re, buf_im, sizeof(buf_re), &re, &im);
+            if (rc != 1) {
+                if (iostat) { *iostat = (rc < 0 && feof(filep)) ? -1 : 1; return; }
                 fprintf(stderr, "Error: Invalid input for complex double from file.\n");
                 exit(1);
             }
-            convert_fortran_d_exponent(buffer);
-            char *start = strchr(buffer, '(');
-            char *end = strchr(buffer, ')');
-            if (start && end && end > start) {
-                *end = '\0';
-                start++;
-                char *comma = strchr(start, ',');
-                if (comma) {
-                    *comma = '\0';
-                    while (isspace((unsigned char)*start)) start++;
-                    char *endptr_re;
-                    p[i].re = strtod(start, &endptr_re);
-                    while (isspace((unsigned char)*endptr_re)) endptr_re++;
-                    char *im_start = comma + 1;
-                    while (isspace((unsigned char)*im_start)) im_start++;
-                    char *endptr_im;
-                    p[i].im = strtod(im_start, &endptr_im);
-                } else {
-                    if (iostat) { *iostat = 1; return; }
-                    fprintf(stderr, "Error: Invalid complex double format '%s'.\n", buffer);
-                    exit(1);
-                }
-            } else {
-                // No parentheses: treat as two whitespace-separated numbers
-                p[i].re = strtod(buffer, NULL);
-                if (fscanf(filep, "%lf", &p[i].im) != 1) {
-                    if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
-                    fprintf(stderr, "Error: Failed to read complex double from file.\n");
-                    exit(1);
-                }
-            }
+            p[i].re = fp_decimal_to_double(&re);
+            p[i].im = fp_decimal_to_double(&im);
         }
     }
 }
@@ -7760,7 +10513,7 @@ LFORTRAN_API void _lfortran_read_array_float(float *p, int array_size, int32_t u
     }
 
     if (unit_file_bin) {
-        if (fread(p, sizeof(float), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(float), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read float array from binary file.\n");
             exit(1);
@@ -7812,7 +10565,7 @@ LFORTRAN_API void _lfortran_read_array_double(double *p, int array_size, int32_t
     }
 
     if (unit_file_bin) {
-        if (fread(p, sizeof(double), array_size, filep) != (size_t)array_size) {
+        if (unit_read_items(unit_num, filep, p, sizeof(double), array_size) != (size_t)array_size) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; return; }
             fprintf(stderr, "Error: Failed to read double array from binary file.\n");
             exit(1);
@@ -7859,7 +10612,7 @@ LFORTRAN_API void _lfortran_read_array_char(char *p, int64_t length, int array_s
 
     if (unit_file_bin) {
         size_t want = (size_t)(length * array_size);
-        size_t got = fread(p, sizeof(char), want, filep);
+        size_t got = unit_read_items(unit_num, filep, p, sizeof(char), want);
         if (got != want) {
             if (iostat) { *iostat = feof(filep) ? -1 : 1; }
         }
@@ -8008,14 +10761,22 @@ static void parse_integer_from_buffer(char* buffer, int field_len,
 }
 
 static void parse_real_from_buffer(char* buffer, int field_len,
-        void* real_ptr, int32_t type_code, int scale_factor, int decimal_places)
+        void* real_ptr, int32_t type_code, int scale_factor, int decimal_places,
+        int blank_mode, int decimal_mode)
 {
     // Handle integer types (type_code 2 = int32, type_code 3 = int64)
     if (type_code == 2 || type_code == 3) {
         char* temp = (char*)internal_malloc(field_len + 1);
         if (temp) {
-            memcpy(temp, buffer, field_len);
-            temp[field_len] = '\0';
+            int temp_len = 0;
+            for (int i = 0; i < field_len; i++) {
+                if (buffer[i] != ' ') {
+                    temp[temp_len++] = buffer[i];
+                } else if (blank_mode == 1) {
+                    temp[temp_len++] = '0';
+                }
+            }
+            temp[temp_len] = '\0';
             if (type_code == 2) {
                 char* endptr;
                 long val = strtol(temp, &endptr, 10);
@@ -8029,73 +10790,27 @@ static void parse_real_from_buffer(char* buffer, int field_len,
         }
         return;
     }
-    // Replace D/d with E for parsing, check for exponent/decimal point
-    bool has_exponent = false;
-    bool has_decimal = false;
-    for (int i = 0; i < field_len; i++) {
-        if (buffer[i] == '.') {
-            has_decimal = true;
-        } else if (buffer[i] == 'D' || buffer[i] == 'd') {
-            buffer[i] = 'E';
-            has_exponent = true;
-        } else if (buffer[i] == 'E' || buffer[i] == 'e') {
-            has_exponent = true;
-        }
-    }
-
-    if (!has_exponent) {
-        int len = (int)strlen(buffer);
-        for (int i = 1; i < len; i++) {
-            if (buffer[i] == '+' || buffer[i] == '-') {
-                char prev = buffer[i - 1];
-                if (prev == 'E' || prev == 'e' || prev == 'D' || prev == 'd') {
-                    continue;
-                }
-                bool has_digit_before = false;
-                bool has_digit_after = false;
-                for (int j = 0; j < i; j++) {
-                    if (isdigit((unsigned char)buffer[j])) {
-                        has_digit_before = true;
-                        break;
-                    }
-                }
-                for (int j = i + 1; j < len; j++) {
-                    if (isdigit((unsigned char)buffer[j])) {
-                        has_digit_after = true;
-                        break;
-                    }
-                }
-                if (has_digit_before && has_digit_after) {
-                    char *expanded = (char*)internal_malloc((size_t)len + 2);
-                    if (expanded) {
-                        memcpy(expanded, buffer, (size_t)i);
-                        expanded[i] = 'E';
-                        memcpy(expanded + i + 1, buffer + i, (size_t)(len - i + 1));
-                        strcpy(buffer, expanded);
-                        internal_free(expanded);
-                        has_exponent = true;
-                    }
-                    break;
-                }
-            }
-        }
-    }
-
-    double v = strtod(buffer, NULL);
-    int total_scale = 0;
-    if (!has_decimal && decimal_places > 0) {
-        total_scale += decimal_places;
+    int flags = FP_SCAN_FIELD;
+    if (blank_mode == 1) flags |= FP_SCAN_BLANK_ZERO;
+    if (decimal_mode == 1) flags |= FP_SCAN_DECIMAL_COMMA;
+    // Like strtod, anything after the longest valid prefix is ignored
+    fp_decimal d;
+    if (fp_scan_real(buffer, (size_t)field_len, flags, &d) == 0) {
+        d.mantissa = 0;
+        d.negative = d.inexact = d.is_inf = d.is_nan = false;
     }
-    if (!has_exponent) {
-        total_scale += scale_factor;
+    // Without a decimal point the last `d` digits of Fw.d are the fraction,
+    // and without an exponent the scale factor applies
+    if (!d.has_point && decimal_places > 0) {
+        d.exp10 -= decimal_places;
     }
-    if (total_scale != 0) {
-        v = v / pow(10.0, (double)total_scale);
+    if (!d.has_exponent) {
+        d.exp10 -= scale_factor;
     }
     if (type_code == 4) {
-        *((float*)real_ptr) = (float)v;
+        *((float*)real_ptr) = fp_decimal_to_float(&d);
     } else {
-        *((double*)real_ptr) = v;
+        *((double*)real_ptr) = fp_decimal_to_double(&d);
     }
 }
 
@@ -8355,7 +11070,8 @@ static bool handle_read_real(InputSource *inputSource, va_list *args, int width,
             char* buffer = NULL; int field_len = 0;
             if (!read_field(inputSource, read_width, advance_no, iostat, chunk,
                             consumed_newline, &buffer, &field_len)) break;
-            parse_real_from_buffer(buffer, field_len, elem_ptr, elem_tc, scale_factor, decimal_places);
+            parse_real_from_buffer(buffer, field_len, elem_ptr, elem_tc, scale_factor, decimal_places,
+                blank_mode, decimal_mode);
             internal_free(buffer);
         }
         return true;
@@ -8378,36 +11094,9 @@ static bool handle_read_real(InputSource *inputSource, va_list *args, int width,
             consumed_newline, &buffer, &field_len)) {
         return false;
     }
-    // Apply blank mode processing
-    if (blank_mode == 0) {
-        // BN mode: remove all blanks from the buffer
-        int write_idx = 0;
-        for (int read_idx = 0; read_idx < field_len; read_idx++) {
-            if (buffer[read_idx] != ' ') {
-                buffer[write_idx++] = buffer[read_idx];
-            }
-        }
-        buffer[write_idx] = '\0';
-        field_len = write_idx;
-    } else if (blank_mode == 1) {
-        // BZ mode: replace blanks with zeros
-        for (int i = 0; i < field_len; i++) {
-            if (buffer[i] == ' ') {
-                buffer[i] = '0';
-            }
-        }
-    }
-
-    if (decimal_mode == 1) {
-        for (int i = 0; i < field_len; i++) {
-            if (buffer[i] == ',') {
-                buffer[i] = '.';
-                break;
-            }
-        }
-    }
-
-    parse_real_from_buffer(buffer, field_len, real_ptr, type_code, scale_factor, decimal_places);
+    // Blanks (BN/BZ) and the decimal mark are handled by the scanner
+    parse_real_from_buffer(buffer, field_len, real_ptr, type_code, scale_factor, decimal_places,
+        blank_mode, decimal_mode);
 
     internal_free(buffer);
     if (is_complex) {
@@ -8418,33 +11107,8 @@ static bool handle_read_real(InputSource *inputSource, va_list *args, int width,
                 consumed_newline, &buffer, &field_len)) {
             return false;
         }
-        if (blank_mode == 0) {
-            int write_idx = 0;
-            for (int read_idx = 0; read_idx < field_len; read_idx++) {
-                if (buffer[read_idx] != ' ') {
-                    buffer[write_idx++] = buffer[read_idx];
-                }
-            }
-            buffer[write_idx] = '\0';
-            field_len = write_idx;
-        } else if (blank_mode == 1) {
-            for (int i = 0; i < field_len; i++) {
-                if (buffer[i] == ' ') {
-                    buffer[i] = '0';
-                }
-            }
-        }
-
-        if (decimal_mode == 1) {
-            for (int i = 0; i < field_len; i++) {
-                if (buffer[i] == ',') {
-                    buffer[i] = '.';
-                    break;
-                }
-            }
-        }
-
-        parse_real_from_buffer(buffer, field_len, imag_ptr, type_code, scale_factor, decimal_places);
+        parse_real_from_buffer(buffer, field_len, imag_ptr, type_code, scale_factor, decimal_places,
+            blank_mode, decimal_mode);
         internal_free(buffer);
     }
     
@@ -9009,6 +11673,19 @@ bool is_write_and_open_format_match(bool unit_file_bin, const char* format_data)
 
 LFORTRAN_API void _lfortran_file_write(int32_t unit_num, int32_t* iostat, const char* format_data, int64_t format_len, ...)
 {
+    // Unformatted records for an asynchronous unit are queued without
+    // waiting for the transfers before them
+    struct UNIT_FILE* entry = find_unit_file(unit_num);
+    if (entry && entry->async && entry->unit_file_bin && entry->write_access
+            && format_data[0] == '\0') {
+        va_list args;
+        va_start(args, format_len);
+        async_unit_write_record(entry->async, entry->access_id == 0, args);
+        va_end(args);
+        if (iostat != NULL) *iostat = 0;
+        return;
+    }
+
     bool unit_file_bin;
     int access_id;
     bool read_access, write_access;
@@ -9409,17 +12086,19 @@ LFORTRAN_API void _lfortran_string_read_i64(char *str, int64_t len, char *format
 
 LFORTRAN_API void _lfortran_string_read_f32(char *str, int64_t len, char *format, float *f, int32_t *iostat, int64_t *offset) {
     int64_t off = offset ? *offset : 0;
-    char *buf = to_c_string((const fchar*)(str + off), len - off);
     int rc;
     if (offset) {
-        int skip = 0;
-        while (buf[skip] && (buf[skip] == ' ' || buf[skip] == '\t' || buf[skip] == ',')) skip++;
+        // Scan the value in place, the string need not be copied
+        const char *rest = str + off;
+        int64_t rest_len = len - off;
+        int64_t skip = 0;
+        while (skip < rest_len && (rest[skip] == ' ' || rest[skip] == '\t' || rest[skip] == ',')) skip++;
         int consumed = 0;
         float tmp_f;
-        parse_fortran_float_token(buf + skip, &tmp_f, &consumed);
+        parse_fortran_float_slice(rest + skip, (size_t)(rest_len - skip), &tmp_f, &consumed);
         rc = 0;
         if (consumed > 0) {
-            char next = buf[skip + consumed];
+            char next = (skip + consumed < rest_len) ? rest[skip + consumed] : '\0';
             /*
              * As per Fortran 2018 standard section 13.10.2 (List-directed formatting),
              * A value separator is (1) a comma, (2) a slash or (3) one or more contiguous blanks.
@@ -9431,15 +12110,14 @@ LFORTRAN_API void _lfortran_string_read_f32(char *str, int64_t len, char *format
                 rc = 1;
             }
         }
+    } else if (strcmp(format, "%f") == 0) {
+        rc = parse_fortran_float_slice(str + off, (size_t)(len - off), f, NULL);
     } else {
-        if (strcmp(format, "%f") == 0) {
-            rc = parse_fortran_float_token(buf, f, NULL);
-        } else {
-            normalize_fortran_real_token(buf, strlen(buf) + 1);
-            rc = sscanf(buf, format, f);
-        }
+        char *buf = to_c_string((const fchar*)(str + off), len - off);
+        normalize_fortran_real_token(buf, strlen(buf) + 1);
+        rc = sscanf(buf, format, f);
+        internal_free(buf);
     }
-    internal_free(buf);
     if (rc != 1) {
         if (iostat) { *iostat = 5010; return; }
         fprintf(stderr, "Error: Bad real for item in list input\n");
@@ -9450,17 +12128,19 @@ LFORTRAN_API void _lfortran_string_read_f32(char *str, int64_t len, char *format
 
 LFORTRAN_API void _lfortran_string_read_f64(char *str, int64_t len, char *format, double *f, int32_t *iostat, int64_t *offset) {
     int64_t off = offset ? *offset : 0;
-    char *buf = to_c_string((const fchar*)(str + off), len - off);
     int rc;
     if (offset) {
-        int skip = 0;
-        while (buf[skip] && (buf[skip] == ' ' || buf[skip] == '\t' || buf[skip] == ',')) skip++;
+        // Scan the value in place, the string need not be copied
+        const char *rest = str + off;
+        int64_t rest_len = len - off;
+        int64_t skip = 0;
+        while (skip < rest_len && (rest[skip] == ' ' || rest[skip] == '\t' || rest[skip] == ',')) skip++;
         int consumed = 0;
         double tmp_f;
-        parse_fortran_double_token(buf + skip, &tmp_f, &consumed);
+        parse_fortran_double_slice(rest + skip, (size_t)(rest_len - skip), &tmp_f, &consumed);
         rc = 0;
         if (consumed > 0) {
-            char next = buf[skip + consumed];
+            char next = (skip + consumed < rest_len) ? rest[skip + consumed] : '\0';
             /*
              * As per Fortran 2018 standard section 13.10.2 (List-directed formatting),
              * A value separator is (1) a comma, (2) a slash or (3) one or more contiguous blanks.
@@ -9472,15 +12152,14 @@ LFORTRAN_API void _lfortran_string_read_f64(char *str, int64_t len, char *format
                 rc = 1;
             }
         }
+    } else if (strcmp(format, "%lf") == 0) {
+        rc = parse_fortran_double_slice(str + off, (size_t)(len - off), f, NULL);
     } else {
-        if (strcmp(format, "%lf") == 0) {
-            rc = parse_fortran_double_token(buf, f, NULL);
-        } else {
-            normalize_fortran_real_token(buf, strlen(buf) + 1);
-            rc = sscanf(buf, format, f);
-        }
+        char *buf = to_c_string((const fchar*)(str + off), len - off);
+        normalize_fortran_real_token(buf, strlen(buf) + 1);
+        rc = sscanf(buf, format, f);
+        internal_free(buf);
     }
-    internal_free(buf);
     if (rc != 1) {
         if (iostat) { *iostat = 5010; return; }
         fprintf(stderr, "Error: Bad real for item in list input\n");
@@ -9598,19 +12277,24 @@ static void _lfortran_replace_d_exponent(char *buf) {
 
 LFORTRAN_API void _lfortran_string_read_c32(char *str, int64_t len, char *format, struct _lfortran_complex_32 *c, int32_t *iostat, int64_t *offset) {
     int64_t off = offset ? *offset : 0;
-    char *buf = to_c_string((const fchar*)(str + off), len - off);
-    _lfortran_replace_d_exponent(buf);
     int rc;
     if (offset) {
-        int skip = 0;
-        while (buf[skip] && (buf[skip] == ' ' || buf[skip] == '\t' || buf[skip] == ',')) skip++;
-        int n = 0;
-        rc = sscanf(buf + skip, " (%f,%f)%n", &c->re, &c->im, &n);
-        *offset = off + skip + n;
+        const char *rest = str + off;
+        int64_t rest_len = len - off;
+        int64_t skip = 0;
+        while (skip < rest_len && (rest[skip] == ' ' || rest[skip] == '\t' || rest[skip] == ',')) skip++;
+        size_t n = 0;
+        fp_decimal re, im;
+        rc = scan_fortran_complex_slice(rest + skip, (size_t)(rest_len - skip), &re, &im, &n);
+        if (rc >= 1) c->re = fp_decimal_to_float(&re);
+        if (rc == 2) c->im = fp_decimal_to_float(&im);
+        *offset = off + skip + (int64_t)n;
     } else {
+        char *buf = to_c_string((const fchar*)(str + off), len - off);
+        _lfortran_replace_d_exponent(buf);
         rc = sscanf(buf, format, &c->re, &c->im);
+        internal_free(buf);
     }
-    internal_free(buf);
     if (rc != 2) {
         if (iostat) { *iostat = 5010; return; }
         fprintf(stderr, "Error: Bad complex for item in list input\n");
@@ -9621,19 +12305,24 @@ LFORTRAN_API void _lfortran_string_read_c32(char *str, int64_t len, char *format
 
 LFORTRAN_API void _lfortran_string_read_c64(char *str, int64_t len, char *format, struct _lfortran_complex_64 *c, int32_t *iostat, int64_t *offset) {
     int64_t off = offset ? *offset : 0;
-    char *buf = to_c_string((const fchar*)(str + off), len - off);
-    _lfortran_replace_d_exponent(buf);
     int rc;
     if (offset) {
-        int skip = 0;
-        while (buf[skip] && (buf[skip] == ' ' || buf[skip] == '\t' || buf[skip] == ',')) skip++;
-        int n = 0;
-        rc = sscanf(buf + skip, " (%lf,%lf)%n", &c->re, &c->im, &n);
-        *offset = off + skip + n;
+        const char *rest = str + off;
+        int64_t rest_len = len - off;
+        int64_t skip = 0;
+        while (skip < rest_len && (rest[skip] == ' ' || rest[skip] == '\t' || rest[skip] == ',')) skip++;
+        size_t n = 0;
+        fp_decimal re, im;
+        rc = scan_fortran_complex_slice(rest + skip, (size_t)(rest_len - skip), &re, &im, &n);
+        if (rc >= 1) c->re = fp_decimal_to_double(&re);
+        if (rc == 2) c->im = fp_decimal_to_double(&im);
+        *offset = off + skip + (int64_t)n;
     } else {
+        char *buf = to_c_string((const fchar*)(str + off), len - off);
+        _lfortran_replace_d_exponent(buf);
         rc = sscanf(buf, format, &c->re, &c->im);
+        internal_free(buf);
     }
-    internal_free(buf);
     if (rc != 2) {
         if (iostat) { *iostat = 5010; return; }
         fprintf(stderr, "Error: Bad complex for item in list input\n");
@@ -9692,48 +12381,38 @@ LFORTRAN_API void _lfortran_string_read_i64_array(char *str, int64_t len, char *
 
 LFORTRAN_API void _lfortran_string_read_f32_array(char *str, int64_t len, char *format, float *arr) {
     (void)format; 
-    char *buf = to_c_string((const fchar*)str, len);
-    convert_fortran_d_exponent(buf);
-    const char *pos = buf;
-    const char *end = buf + len;
-    char *next = NULL;
+    const char *pos = str;
+    const char *end = str + len;
     int64_t count = 0;
     while (pos < end) {
         while (pos < end && (isspace((unsigned char)*pos) || *pos == ',')) {
             pos++;
         }
         if (pos >= end) break;
-        errno = 0;
-        float value = strtof(pos, &next);
-        if (next == pos) break;
-        if ((const char *)next > end) break;
-        arr[count++] = value;
-        pos = next;
+        fp_decimal d;
+        size_t n = fp_scan_real(pos, (size_t)(end - pos), 0, &d);
+        if (n == 0) break;
+        arr[count++] = fp_decimal_to_float(&d);
+        pos += n;
     }
-    internal_free(buf);
 }
 
 LFORTRAN_API void _lfortran_string_read_f64_array(char *str, int64_t len, char *format, double *arr) {
     (void)format; 
-    char *buf = to_c_string((const fchar*)str, len);
-    convert_fortran_d_exponent(buf);
-    const char *pos = buf;
-    const char *end = buf + len;
-    char *next = NULL;
+    const char *pos = str;
+    const char *end = str + len;
     int64_t count = 0;
     while (pos < end) {
         while (pos < end && (isspace((unsigned char)*pos) || *pos == ',')) {
             pos++;
         }
         if (pos >= end) break;
-        errno = 0;
-        double value = strtod(pos, &next);
-        if (next == pos) break;
-        if ((const char *)next > end) break;
-        arr[count++] = value;
-        pos = next;
+        fp_decimal d;
+        size_t n = fp_scan_real(pos, (size_t)(end - pos), 0, &d);
+        if (n == 0) break;
+        arr[count++] = fp_decimal_to_double(&d);
+        pos += n;
     }
-    internal_free(buf);
 }
 
 LFORTRAN_API void _lfortran_string_read_str_array(char *str, int64_t len, char *format, char **arr, int64_t elem_len) {
@@ -9809,6 +12488,17 @@ LFORTRAN_API void _lfortran_close(int32_t unit_num, char* status, int64_t status
     if (!filep) {
         return;
     }
+    // A failed asynchronous WRITE that no WAIT has reported yet
+    struct UNIT_FILE* entry = find_unit_file(unit_num);
+    int32_t async_error = entry->async ? async_unit_take_error(entry->async) : 0;
+    if (async_error != 0) {
+        if (iostat) {
+            *iostat = async_error;
+        } else {
+            fprintf(stderr, "Runtime Error: Asynchronous WRITE to unit %d failed.\n", unit_num);
+            exit(1);
+        }
+    }
     
     // Don't actually close standard units (stdin=5, stdout=6, stderr=0)
     // They are pre-connected and should remain open
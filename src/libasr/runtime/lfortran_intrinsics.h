@@ -87,6 +87,15 @@ typedef struct {
 LFORTRAN_API lfortran_allocator_t* _lfortran_get_default_allocator(void);
 /* Debug allocator that tracks allocations (defined in lfortran_intrinsics.c) */
 LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_allocator(void);
+/* Thread-local size-class pool allocator, selected with --pool-allocator */
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_pool_allocator(void);
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_pool_allocator(void);
+/* Scratch stack for compiler-generated temporaries, freed in LIFO order or
+   at the latest by _lfortran_scratch_release() when the procedure returns */
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_scratch_allocator(void);
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_scratch_allocator(void);
+LFORTRAN_API void* _lfortran_scratch_mark(void);
+LFORTRAN_API void _lfortran_scratch_release(void* mark);
 
 /* Convenience macros for calling through an allocator */
 #define ALLOCATOR_ALLOC(a, size)          ((a)->alloc((a)->context, (size)))
@@ -96,12 +105,36 @@ LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_allocator(void
 LFORTRAN_API void _lfortran_enable_fpe_traps(int32_t trap_mask);
 LFORTRAN_API void _lfortran_internal_alloc_finalize(void);
 LFORTRAN_API double _lfortran_sum(int n, double *v);
+LFORTRAN_API void _lfortran_sgemm(void *c, void *a, void *b, int64_t m, int64_t n, int64_t k);
+LFORTRAN_API void _lfortran_dgemm(void *c, void *a, void *b, int64_t m, int64_t n, int64_t k);
+LFORTRAN_API void _lfortran_cgemm(void *c, void *a, void *b, int64_t m, int64_t n, int64_t k);
+LFORTRAN_API void _lfortran_zgemm(void *c, void *a, void *b, int64_t m, int64_t n, int64_t k);
+LFORTRAN_API float _lfortran_sdot(void *a, void *b, int64_t n);
+LFORTRAN_API double _lfortran_ddot(void *a, void *b, int64_t n);
+LFORTRAN_API void _lfortran_atomic_reduce_add_i32(int32_t *x, int32_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_mul_i32(int32_t *x, int32_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_max_i32(int32_t *x, int32_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_min_i32(int32_t *x, int32_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_add_i64(int64_t *x, int64_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_mul_i64(int64_t *x, int64_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_max_i64(int64_t *x, int64_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_min_i64(int64_t *x, int64_t v);
+LFORTRAN_API void _lfortran_atomic_reduce_add_f32(float *x, float v);
+LFORTRAN_API void _lfortran_atomic_reduce_mul_f32(float *x, float v);
+LFORTRAN_API void _lfortran_atomic_reduce_max_f32(float *x, float v);
+LFORTRAN_API void _lfortran_atomic_reduce_min_f32(float *x, float v);
+LFORTRAN_API void _lfortran_atomic_reduce_add_f64(double *x, double v);
+LFORTRAN_API void _lfortran_atomic_reduce_mul_f64(double *x, double v);
+LFORTRAN_API void _lfortran_atomic_reduce_max_f64(double *x, double v);
+LFORTRAN_API void _lfortran_atomic_reduce_min_f64(double *x, double v);
 LFORTRAN_API void _lfortran_random_number(int n, double *v);
 LFORTRAN_API void _lfortran_init_random_clock();
 LFORTRAN_API int _lfortran_init_random_seed(unsigned seed);
 LFORTRAN_API double _lfortran_random();
 LFORTRAN_API int _lfortran_randrange(int lower, int upper);
 LFORTRAN_API int _lfortran_random_int(int lower, int upper);
+LFORTRAN_API void _lfortran_sp_random_fill(int64_t n, float *v);
+LFORTRAN_API void _lfortran_dp_random_fill(int64_t n, double *v);
 LFORTRAN_API void _lfortran_printf(const char* format, const fchar* str, uint32_t str_len, const fchar* end, uint32_t end_len);
 LFORTRAN_API char* _lcompilers_snprintf_alloc(lfortran_allocator_t* al, const char* format, ...);
 LFORTRAN_API void _lcompilers_print_error(const char* format, ...);
@@ -218,9 +251,10 @@ LFORTRAN_API int32_t _lpython_bit_length1(int8_t num);
 LFORTRAN_API int32_t _lpython_bit_length2(int16_t num);
 LFORTRAN_API int32_t _lpython_bit_length4(int32_t num);
 LFORTRAN_API int32_t _lpython_bit_length8(int64_t num);
-LFORTRAN_API void _lfortran_strrepeat_alloc(lfortran_allocator_t* al, char** s, int32_t n, char** dest);
+LFORTRAN_API char* _lfortran_strrepeat_alloc(lfortran_allocator_t* al, char* s, int64_t s_len, int32_t n);
 LFORTRAN_API char* _lfortran_strrepeat_c_alloc(lfortran_allocator_t* al, char* s, int32_t n);
 LFORTRAN_API char* _lfortran_strcat_alloc(lfortran_allocator_t* al, char* s1, int64_t s1_len, char* s2, int64_t s2_len);
+LFORTRAN_API char* _lfortran_strcat_n_alloc(lfortran_allocator_t* al, int32_t n, char** s, int64_t* s_len);
 LFORTRAN_API void _lfortran_strcpy_alloc(lfortran_allocator_t* al, char** lhs, int64_t* lhs_len, bool is_lhs_allocatable, bool is_lhs_deferred, char* rhs, int64_t rhs_len);
 LFORTRAN_API int64_t _lfortran_str_len(char* s);
 LFORTRAN_API int _lfortran_str_ord(char** s);
@@ -261,6 +295,13 @@ LFORTRAN_API void _lfortran_zone(char* result);
 LFORTRAN_API int32_t _lfortran_values(int32_t n);
 LFORTRAN_API float _lfortran_sp_rand_num();
 LFORTRAN_API double _lfortran_dp_rand_num();
+LFORTRAN_API int32_t _lfortran_int32_rand_num();
+LFORTRAN_API int64_t _lfortran_int64_rand_num();
+LFORTRAN_API bool _lfortran_random_init(bool repeatable, bool image_distinct);
+LFORTRAN_API int64_t _lfortran_random_seed(unsigned seed);
+LFORTRAN_API int32_t _lfortran_random_seed_size();
+LFORTRAN_API void _lfortran_random_seed_put(int32_t i, int64_t v);
+LFORTRAN_API int32_t _lfortran_random_seed_get(int32_t i);
 LFORTRAN_API int64_t _lpython_open(char *path, char *flags);
 LFORTRAN_API int64_t _lfortran_open(int32_t unit_num,
     char* f_name, int64_t f_name_len,
@@ -276,8 +317,12 @@ LFORTRAN_API int64_t _lfortran_open(int32_t unit_num,
     char* encoding, int64_t encoding_len,
     int32_t *recl,
     char* sign, int64_t sign_len,
-    char* decimal, int64_t decimal_len);
+    char* decimal, int64_t decimal_len,
+    char* asynchronous, int64_t asynchronous_len);
 LFORTRAN_API void _lfortran_flush(int32_t unit_num);
+LFORTRAN_API void _lfortran_wait(int32_t unit_num, int32_t id, bool has_id, int32_t *iostat,
+    char* iomsg, int64_t iomsg_len);
+LFORTRAN_API int32_t _lfortran_transfer_id(int32_t unit_num);
 LFORTRAN_API void _lfortran_abort();
 LFORTRAN_API void _lfortran_sleep(int32_t seconds);
 LFORTRAN_API int32_t _lfortran_get_decimal_mode(int32_t unit_num);
@@ -355,6 +400,7 @@ LFORTRAN_API int32_t _lfortran_iachar(char *c);
 LFORTRAN_API void _lpython_set_argv(int32_t argc_1, char *argv_1[]);
 LFORTRAN_API void _lpython_free_argv();
 LFORTRAN_API void _lfortran_set_use_runtime_colors(int use_colors);
+LFORTRAN_API void _lfortran_set_mmap_io(int enable);
 LFORTRAN_API int32_t _lpython_get_argc();
 LFORTRAN_API char *_lpython_get_argv(int32_t index);
 LFORTRAN_API void _lpython_call_initial_functions(int32_t argc_1, char *argv_1[]);
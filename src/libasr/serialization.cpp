@@ -302,6 +302,12 @@ public:
         current_symtab = parent_symtab;
     }
 
+    // Fixes `x`, a symbol of `parent`, and the symbol tables below it
+    void visit_symbol_of(const symbol_t &x, SymbolTable *parent) {
+        current_symtab = parent;
+        this->visit_symbol(x);
+    }
+
 };
 
 class FixExternalSymbolsVisitor : public BaseWalkVisitor<FixExternalSymbolsVisitor>
@@ -493,6 +499,38 @@ void fix_external_symbols(ASR::TranslationUnit_t &unit,
     }
 }
 
+// Adds `symtab` and the symbol tables below it to `ids`, except `skip` and
+// the tables below it
+static void collect_symtab_ids(SymbolTable *symtab, SymbolTable *skip,
+        std::map<uint64_t, SymbolTable*> &ids) {
+    ids[symtab->counter] = symtab;
+    for (auto &a : symtab->get_scope()) {
+        SymbolTable *s = ASRUtils::symbol_symtab(a.second);
+        if (s && s != skip && s->parent == symtab) {
+            collect_symtab_ids(s, skip, ids);
+        }
+    }
+}
+
+void deserialize_symbol_into(Allocator &al, const std::string &s,
+        ASR::TranslationUnit_t &unit, ASR::symbol_t *sym) {
+    SymbolTable *parent = symbol_parent_symtab(sym);
+    ASRDeserializationVisitor v(al, s, true, 0);
+    collect_symtab_ids(unit.m_symtab, ASRUtils::symbol_symtab(sym),
+        v.id_symtab_map);
+    ASR::symbol_t *sym2 = ASR::down_cast<ASR::symbol_t>(v.deserialize_node());
+    LCOMPILERS_ASSERT(sym2->type == sym->type);
+    for (auto &a : parent->get_scope()) {
+        if (a.second == sym) {
+            // Copies `sym2` into `sym`, which keeps its address
+            v.symtab_insert_symbol(*parent, a.first, sym2);
+            break;
+        }
+    }
+    ASR::FixParentSymtabVisitor p;
+    p.visit_symbol_of(*sym, parent);
+}
+
 ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
         bool load_symtab_id, SymbolTable & /*external_symtab*/, uint32_t offset) {
     return deserialize_asr(al, s, load_symtab_id, offset);
@@ -12,6 +12,13 @@ namespace LCompilers {
     ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
             bool load_symtab_id, uint32_t offset);
 
+    // Replaces the content of `sym`, a symbol of `unit`, by the symbol that
+    // `s` (from serialize()) holds, keeping the `sym` pointer and the symbol
+    // table IDs. References outside of `sym` are resolved by symbol table ID
+    // in `unit`. Call fix_external_symbols() afterwards.
+    void deserialize_symbol_into(Allocator &al, const std::string &s,
+            ASR::TranslationUnit_t &unit, ASR::symbol_t *sym);
+
     void fix_external_symbols(ASR::TranslationUnit_t &unit,
             SymbolTable &external_symtab);
 } // namespace LCompilers
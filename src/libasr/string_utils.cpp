@@ -1,4 +1,8 @@
 #include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <regex>
 #include <algorithm>
 #include <string>
@@ -302,4 +306,82 @@ void rtrim(std::string& str) {
     str.erase(std::find_if_not(str.rbegin(), str.rend(), ::isspace).base(), str.end());
 }
 
+// Whether `text` reads back as v (as a float with `single`)
+static bool float_reads_back(const char *text, double v, bool single) {
+    if (single) return std::strtof(text, nullptr) == (float)v;
+    return std::strtod(text, nullptr) == v;
+}
+
+std::string float_to_str_shortest(double v, bool single)
+{
+    if (std::isnan(v)) return "nan";
+    std::string sign = std::signbit(v) ? "-" : "";
+    v = std::fabs(v);
+    if (std::isinf(v)) return sign + "inf";
+    if (v == 0.0) return sign + "0.0";
+    // The correctly rounded n digit value is the closest one, try n = 1, 2,
+    // ... until it reads back as v. Below a power of two the next n digit
+    // value up can read back when the closest one does not.
+    int max_digits = single ? 9 : 17;
+    int e2;
+    bool pow2 = std::frexp(v, &e2) == 0.5;
+    std::string digits;
+    int exp10 = 0;
+    for (int n = 1; n <= max_digits; n++) {
+        char buf[40];
+        std::snprintf(buf, sizeof(buf), "%.*e", n - 1, v);
+        if (n == max_digits || float_reads_back(buf, v, single)) {
+            char *e = std::strchr(buf, 'e');
+            exp10 = std::atoi(e + 1);
+            for (char *c = buf; c < e; c++) {
+                if (std::isdigit((unsigned char)*c)) digits += *c;
+            }
+            break;
+        }
+        if (pow2) {
+            char *e = std::strchr(buf, 'e');
+            std::string up;
+            for (char *c = buf; c < e; c++) {
+                if (std::isdigit((unsigned char)*c)) up += *c;
+            }
+            int exp_up = std::atoi(e + 1);
+            int i = (int)up.size() - 1;
+            while (i >= 0 && up[i] == '9') up[i--] = '0';
+            if (i < 0) {
+                up.insert(up.begin(), '1');
+                up.pop_back();
+                exp_up++;
+            } else {
+                up[i]++;
+            }
+            std::string text = up + "e" + std::to_string(exp_up - n + 1);
+            if (float_reads_back(text.c_str(), v, single)) {
+                digits = up;
+                exp10 = exp_up;
+                break;
+            }
+        }
+    }
+    while (digits.size() > 1 && digits.back() == '0') digits.pop_back();
+    // Positional for 1e-4 <= v < 1e16, like Python's repr()
+    std::string r;
+    int n = digits.size();
+    if (exp10 >= -4 && exp10 < 16) {
+        if (exp10 < 0) {
+            r = "0." + std::string(-exp10 - 1, '0') + digits;
+        } else if (n > exp10 + 1) {
+            r = digits.substr(0, exp10 + 1) + "." + digits.substr(exp10 + 1);
+        } else {
+            r = digits + std::string(exp10 + 1 - n, '0') + ".0";
+        }
+    } else {
+        r = digits.substr(0, 1);
+        if (n > 1) r += "." + digits.substr(1);
+        char e[8];
+        std::snprintf(e, sizeof(e), "e%c%02d", exp10 < 0 ? '-' : '+', std::abs(exp10));
+        r += e;
+    }
+    return sign + r;
+}
+
 } // namespace LCompilers
@@ -54,6 +54,11 @@ char* str_unescape_fortran(Allocator &al, LCompilers::Str &s, char ch);
 bool str_compare(const unsigned char *pos, std::string s);
 void rtrim(std::string& str);
 
+// The shortest text that reads back as v (as a real(4) value with `single`),
+// laid out like Python's str(): "2.3", "100.0", "1e-05". The same as the
+// runtime `_lfortran_float_to_str{4,8}_alloc`.
+std::string float_to_str_shortest(double v, bool single);
+
 } // namespace LCompilers
 
 #endif // LFORTRAN_STRING_UTILS_H
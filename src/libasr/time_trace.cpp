@@ -0,0 +1,116 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#include <libasr/time_trace.h>
+
+namespace LCompilers {
+
+namespace {
+
+std::string json_string(std::string_view s) {
+    std::string r = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"': r += "\\\""; break;
+            case '\\': r += "\\\\"; break;
+            case '\n': r += "\\n"; break;
+            case '\t': r += "\\t"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    r += buf;
+                } else {
+                    r += c;
+                }
+        }
+    }
+    return r + "\"";
+}
+
+} // namespace
+
+TimeTrace::TimeTrace(const std::string &filename)
+    : m_start{std::chrono::steady_clock::now()}, m_filename{filename} {
+}
+
+TimeTrace::~TimeTrace() {
+    if (!m_filename.empty() && !save(m_filename)) {
+        std::cerr << "Cannot write the time trace to '" << m_filename
+            << "'" << std::endl;
+    }
+}
+
+size_t TimeTrace::begin(std::string_view name, std::string_view detail) {
+    m_events.push_back({std::string(name), std::string(detail), now(), -1, -1});
+    return m_events.size() - 1;
+}
+
+void TimeTrace::end(size_t span, int64_t bytes) {
+    Event &e = m_events[span];
+    e.duration = now() - e.start;
+    e.bytes = bytes;
+}
+
+void TimeTrace::write_json(std::ostream &out) const {
+    out << "{\"traceEvents\": [\n";
+    bool first = true;
+    auto sep = [&]() -> std::ostream& {
+        out << (first ? "" : ",\n");
+        first = false;
+        return out;
+    };
+
+    // Per name totals count only the outermost span of nested ones with the
+    // same name (e.g. a contained procedure inside its host), which start
+    // before the enclosing span ends. Events are in the order they began.
+    std::map<std::string, std::pair<int64_t, int64_t>> totals; // total, end
+    std::vector<std::string> names;
+    for (auto &e : m_events) {
+        if (e.duration < 0) continue;
+        sep() << "{\"name\": " << json_string(e.name)
+            << ", \"ph\": \"X\", \"pid\": 1, \"tid\": 0"
+            << ", \"ts\": " << e.start << ", \"dur\": " << e.duration;
+        if (!e.detail.empty() || e.bytes >= 0) {
+            out << ", \"args\": {";
+            if (!e.detail.empty()) out << "\"detail\": " << json_string(e.detail);
+            if (e.bytes >= 0) {
+                out << (e.detail.empty() ? "" : ", ") << "\"bytes\": " << e.bytes;
+            }
+            out << "}";
+        }
+        out << "}";
+
+        auto it = totals.find(e.name);
+        if (it == totals.end()) {
+            names.push_back(e.name);
+            totals[e.name] = {e.duration, e.start + e.duration};
+        } else if (e.start >= it->second.second) {
+            it->second.first += e.duration;
+            it->second.second = e.start + e.duration;
+        }
+    }
+
+    // Totals go on their own track, stacked from the start of the trace
+    for (auto &name : names) {
+        sep() << "{\"name\": " << json_string("Total " + name)
+            << ", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": 0"
+            << ", \"dur\": " << totals[name].first << "}";
+    }
+    sep() << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1"
+        ", \"tid\": 0, \"args\": {\"name\": \"lfortran\"}}";
+    sep() << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1"
+        ", \"tid\": 1, \"args\": {\"name\": \"Totals\"}}";
+    out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+bool TimeTrace::save(const std::string &filename) const {
+    std::ofstream out(filename);
+    if (!out) return false;
+    write_json(out);
+    return out.good();
+}
+
+} // namespace LCompilers
@@ -0,0 +1,104 @@
+#ifndef LIBASR_TIME_TRACE_H
+#define LIBASR_TIME_TRACE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <libasr/alloc.h>
+
+namespace LCompilers {
+
+/*
+   Records nested time spans of one compilation and exports them in the
+   Chrome trace event format, which chrome://tracing, https://ui.perfetto.dev
+   and speedscope can display as a flame graph (`lfortran --time-trace`).
+
+   Spans are opened with TimeTraceScope, which does nothing when it is given
+   a null trace, so instrumented code costs one pointer test when tracing is
+   off:
+
+       TimeTraceScope scope(pass_options.time_trace, "Pass", pass_name, &al);
+
+   A span has a name (the phase: "Parse", "Pass", "Function", ...) and an
+   optional detail (the file, pass or procedure it was spent on). If an
+   Allocator is given, the bytes it handed out during the span are recorded
+   as well. Spans must be closed in the reverse order they were opened, which
+   the scopes guarantee. A TimeTrace is not thread-safe.
+*/
+class TimeTrace {
+public:
+    struct Event {
+        std::string name;
+        std::string detail;
+        int64_t start;    // microseconds since the trace was created
+        int64_t duration; // microseconds, -1 while the span is open
+        int64_t bytes;    // allocator growth during the span, -1 if unknown
+    };
+
+    // If `filename` is not empty, the trace is written there when this
+    // object is destroyed, on every way out of the driver
+    TimeTrace(const std::string &filename="");
+    ~TimeTrace();
+
+    // Returns the index of the new span, to be passed to end()
+    size_t begin(std::string_view name, std::string_view detail);
+    void end(size_t span, int64_t bytes=-1);
+
+    const std::vector<Event> &events() const { return m_events; }
+
+    // Writes all closed spans as "complete" ("ph": "X") events, followed by
+    // one "Total <name>" event per span name on its own track
+    void write_json(std::ostream &out) const;
+    bool save(const std::string &filename) const;
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    std::vector<Event> m_events;
+    std::string m_filename;
+
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_start).count();
+    }
+};
+
+class TimeTraceScope {
+public:
+    TimeTraceScope(TimeTrace *trace, std::string_view name,
+            std::string_view detail="", Allocator *al=nullptr)
+        : m_trace{trace}, m_al{al} {
+        if (m_trace) {
+            m_bytes = m_al ? m_al->size_used() : 0;
+            m_span = m_trace->begin(name, detail);
+        }
+    }
+    ~TimeTraceScope() {
+        if (m_trace) {
+            int64_t bytes = -1;
+            if (m_al) {
+                // The allocator may have been rewound below its position at
+                // the start of the span
+                bytes = std::max<int64_t>(
+                    int64_t(m_al->size_used()) - int64_t(m_bytes), 0);
+            }
+            m_trace->end(m_span, bytes);
+        }
+    }
+    TimeTraceScope(const TimeTraceScope&) = delete;
+    TimeTraceScope& operator=(const TimeTraceScope&) = delete;
+
+private:
+    TimeTrace *m_trace;
+    Allocator *m_al;
+    size_t m_span = 0;
+    size_t m_bytes = 0;
+};
+
+} // namespace LCompilers
+
+#endif // LIBASR_TIME_TRACE_H
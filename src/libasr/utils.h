@@ -1,6 +1,7 @@
 #ifndef LIBASR_UTILS_H
 #define LIBASR_UTILS_H
 
+#include <set>
 #include <string>
 #include <vector>
 #include <filesystem>
@@ -8,6 +9,9 @@
 
 namespace LCompilers {
 
+class TimeTrace;
+namespace ASR { struct stmt_t; }
+
 enum Platform {
     Linux,
     macOS_Intel,
@@ -25,6 +29,24 @@ std::string get_unique_ID();
 int visualize_json(std::string &astr_data_json, LCompilers::Platform os);
 std::string generate_visualize_html(std::string &astr_data_json);
 
+// Global symbols (modules, programs, procedures) that a pass modified. A pass
+// that sets `reported` and lists every symbol it changed gets only those
+// re-verified after it runs; other passes get the whole unit verified.
+struct ModifiedSymbols {
+    bool reported = false;
+    std::set<std::string> names;
+};
+
+// State that a pass keeps between its runs over the same translation unit,
+// owned by the pass manager for one run of the pipeline. It is keyed by ASR
+// nodes, so it must not outlive the unit: a rewound arena hands the same
+// addresses to the next file.
+struct PassState {
+    // Array assignments that already got their DebugCheckArrayBounds from
+    // the first of the two array_op runs
+    std::set<const ASR::stmt_t*> array_op_checked;
+};
+
 struct PassOptions {
     std::filesystem::path mod_files_dir;
     std::vector<std::filesystem::path> include_dirs;
@@ -41,6 +63,9 @@ struct PassOptions {
     bool verbose = false; // For developer debugging
     bool dump_all_passes = false; // For developer debugging
     bool dump_fortran = false; // For developer debugging
+    int verify_interval = 1; // Verify the whole ASR after every N-th pass (asserts only)
+    ModifiedSymbols *modified_symbols = nullptr; // Set by the pass manager
+    PassState *pass_state = nullptr; // Set by the pass manager
     bool pass_cumulative = false; // Apply passes cumulatively
     bool disable_main = false;
     bool use_loop_variable_after_loop = false;
@@ -66,12 +91,17 @@ struct PassOptions {
     bool c_skip_bindpy_pass = false;
     bool openmp = false;
     bool enable_gpu_offloading = false;
+    bool simd_do_concurrent = false; // Wrap do concurrent loops in `simd` regions (LLVM)
     bool time_report = false;
     bool skip_removal_of_unused_procedures_in_pass_array_by_data = false;
     bool bounds_checking = true;
     bool strict_bounds_checking = false;
     bool descriptor_index_64 = false; // Use 64-bit indices in array descriptors
     std::vector<std::string> vector_of_time_report;
+    // (pass name, microseconds) for each pass run while `time_report` is set
+    std::vector<std::pair<std::string, int64_t>> pass_times;
+    // Records nested spans for `--time-trace`, null when not tracing
+    TimeTrace *time_trace = nullptr;
 };
 
 struct CompilerOptions {
@@ -143,15 +173,36 @@ struct CompilerOptions {
     bool legacy_array_sections = false;
     bool ignore_pragma = false;
     bool stack_arrays = false;
+    // Local arrays of this many bytes or more are allocated on the heap
+    int64_t max_stack_var_size = 4096; // -fmax-stack-var-size=<bytes>
+    // Automatic arrays also go on the stack below max_stack_var_size; only
+    // when -fmax-stack-var-size is given, otherwise they use the heap
+    bool stack_automatic_arrays = false;
     bool internal_alloc_check = false;
     bool descriptor_index_64 = false; // Use 64-bit indices in array descriptors (implied by -fdefault-integer-8)
     bool wasm_html = false;
     bool time_report = false;
+    std::string time_trace_file = ""; // --time-trace=<file>, Chrome trace event JSON
+    bool huge_pages = false; // back large Allocator chunks with huge pages
+    // Threads that analyze the procedure bodies of a module, see
+    // BodyVisitor::visit_contains_concurrently()
+    int semantic_threads = 1; // --semantic-threads=<n>
+    bool profile_generate = false; // -fprofile-generate[=<path>]
+    std::string profile_generate_path = ""; // `<dir>/default_%m.profraw`, where the instrumented binary writes its profile
+    std::string profile_use_path = ""; // -fprofile-use=<file|dir>, `.profdata` merged by llvm-profdata
+    // Floating point relaxations, applied per instruction by the LLVM backend
+    // (procedures that use ieee_arithmetic are always compiled strictly)
+    bool fast_math = false; // -ffast-math
+    bool no_signed_zeros = false; // -fno-signed-zeros
+    bool reciprocal_math = false; // -freciprocal-math
+    bool fp_contract_fast = false; // -ffp-contract=fast
     int32_t fpe_traps = 0; // Bitmask of LCOMPILERS_FE_* flags
     std::string emcc_embed;
     std::vector<std::string> import_paths;
     Platform platform;
     bool detect_leaks = false;
+    bool pool_allocator = false;
+    bool mmap_io = false;
 
     CompilerOptions () : platform{get_platform()} {};
 };